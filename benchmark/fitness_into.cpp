@@ -0,0 +1,109 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+// Microbenchmark for the allocation-free fitness evaluation interface.
+//
+// The built-in test functions implementing fitness_into() are evaluated repeatedly
+// on a fixed decision vector both via problem::fitness(), which allocates a new
+// fitness vector at each call, and via problem::fitness_into() with a reused
+// output vector. The same comparison is done with the trusted entry points
+// detail::prob_invoke_mem_fitness() and detail::prob_invoke_mem_fitness_into(),
+// which skip the checks and thus expose the cost of the memory allocations.
+//
+// Usage: fitness_into [n_evals]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rastrigin.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+// Time n invocations of f, in nanoseconds per invocation.
+template <typename F>
+double bench(const F &f, unsigned long long n)
+{
+    double acc = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < n; ++i) {
+        acc += f();
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    // Prevent the compiler from optimising away the evaluations.
+    if (acc == 42.) {
+        std::cout << "";
+    }
+    return ns / static_cast<double>(n);
+}
+
+void bench_problem(const problem &p, unsigned long long n_evals)
+{
+    const vector_double dv(p.get_nx(), .5);
+    vector_double fv(p.get_nf());
+
+    const auto t_alloc = bench([&p, &dv]() { return p.fitness(dv)[0]; }, n_evals);
+    const auto t_into = bench(
+        [&p, &dv, &fv]() {
+            p.fitness_into(dv, fv);
+            return fv[0];
+        },
+        n_evals);
+    const auto tt_alloc = bench([&p, &dv]() { return detail::prob_invoke_mem_fitness(p, dv)[0]; }, n_evals);
+    const auto tt_into = bench(
+        [&p, &dv, &fv]() {
+            detail::prob_invoke_mem_fitness_into(p, dv.data(), fv.data());
+            return fv[0];
+        },
+        n_evals);
+
+    std::cout << p.get_name() << " (nx = " << p.get_nx() << ")\n";
+    std::cout << "\tchecked:\t" << t_alloc << " ns fitness(), " << t_into << " ns fitness_into(), "
+              << (t_alloc - t_into) / t_alloc * 100 << "% saved\n";
+    std::cout << "\ttrusted:\t" << tt_alloc << " ns fitness(), " << tt_into << " ns fitness_into(), "
+              << (tt_alloc - tt_into) / tt_alloc * 100 << "% saved\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const unsigned long long n_evals = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000ull;
+
+    std::cout << n_evals << " evaluations\n\n";
+    for (auto nx : {2u, 10u, 100u}) {
+        bench_problem(problem{rosenbrock{nx}}, n_evals);
+        bench_problem(problem{rastrigin{nx}}, n_evals);
+    }
+}
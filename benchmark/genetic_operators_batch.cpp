@@ -0,0 +1,214 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+// Microbenchmark for the batch variation operators.
+//
+// The SBX crossover and the polynomial mutation are applied to a population
+// of N decision vectors of dimension nx, both via the scalar per-gene
+// implementation formerly used by nsga2 (one std::uniform_real_distribution
+// call per random number, drawn from a Mersenne Twister) and via the batch
+// operators of pagmo/utils/genetic_operators.hpp. The same comparison is done
+// for the DE/rand/1/bin strategy.
+//
+// Usage: genetic_operators_batch [nx] [N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+using bounds_t = std::pair<vector_double, vector_double>;
+
+// Scalar SBX crossover of the couple (x1, x2), continuous part only.
+void scalar_sbx(double *x1, double *x2, const bounds_t &bounds, double p_cr, double eta_c,
+                detail::random_engine_type &r_engine)
+{
+    std::uniform_real_distribution<> drng(0., 1.);
+    const auto &lb = bounds.first;
+    const auto &ub = bounds.second;
+    if (drng(r_engine) <= p_cr) {
+        for (decltype(lb.size()) i = 0u; i < lb.size(); i++) {
+            if ((drng(r_engine) <= 0.5) && (std::abs(x1[i] - x2[i])) > 1e-14 && lb[i] != ub[i]) {
+                const auto y1 = std::min(x1[i], x2[i]), y2 = std::max(x1[i], x2[i]);
+                const auto rand01 = drng(r_engine);
+                auto beta = 1. + (2. * (y1 - lb[i]) / (y2 - y1));
+                auto alpha = 2. - std::pow(beta, -(eta_c + 1.));
+                auto betaq = (rand01 <= (1. / alpha)) ? std::pow((rand01 * alpha), (1. / (eta_c + 1.)))
+                                                      : std::pow((1. / (2. - rand01 * alpha)), (1. / (eta_c + 1.)));
+                auto c1 = std::min(std::max(0.5 * ((y1 + y2) - betaq * (y2 - y1)), lb[i]), ub[i]);
+                beta = 1. + (2. * (ub[i] - y2) / (y2 - y1));
+                alpha = 2. - std::pow(beta, -(eta_c + 1.));
+                betaq = (rand01 <= (1. / alpha)) ? std::pow((rand01 * alpha), (1. / (eta_c + 1.)))
+                                                 : std::pow((1. / (2. - rand01 * alpha)), (1. / (eta_c + 1.)));
+                auto c2 = std::min(std::max(0.5 * ((y1 + y2) + betaq * (y2 - y1)), lb[i]), ub[i]);
+                if (drng(r_engine) <= .5) {
+                    x1[i] = c1;
+                    x2[i] = c2;
+                } else {
+                    x1[i] = c2;
+                    x2[i] = c1;
+                }
+            }
+        }
+    }
+}
+
+// Scalar polynomial mutation of x, continuous part only.
+void scalar_poly(double *x, const bounds_t &bounds, double p_m, double eta_m, detail::random_engine_type &r_engine)
+{
+    std::uniform_real_distribution<> drng(0., 1.);
+    const auto &lb = bounds.first;
+    const auto &ub = bounds.second;
+    for (decltype(lb.size()) j = 0u; j < lb.size(); ++j) {
+        if (drng(r_engine) <= p_m && lb[j] != ub[j]) {
+            const auto y = x[j], yl = lb[j], yu = ub[j];
+            const auto rnd = drng(r_engine);
+            double deltaq;
+            if (rnd <= 0.5) {
+                const auto val = 2. * rnd + (1. - 2. * rnd) * (std::pow(1. - (y - yl) / (yu - yl), (eta_m + 1.)));
+                deltaq = std::pow(val, 1. / (eta_m + 1.)) - 1.;
+            } else {
+                const auto val
+                    = 2. * (1. - rnd) + 2. * (rnd - 0.5) * (std::pow(1. - (yu - y) / (yu - yl), (eta_m + 1.)));
+                deltaq = 1. - (std::pow(val, 1. / (eta_m + 1.)));
+            }
+            x[j] = std::min(std::max(y + deltaq * (yu - yl), yl), yu);
+        }
+    }
+}
+
+// Scalar DE/rand/1/bin for the whole population.
+vector_double scalar_de(const std::vector<vector_double> &pop, double F, double CR, const bounds_t &bounds,
+                        detail::random_engine_type &r_engine)
+{
+    const auto NP = pop.size(), dim = pop[0].size();
+    vector_double retval(NP * dim);
+    std::uniform_real_distribution<double> drng(0., 1.);
+    std::uniform_int_distribution<vector_double::size_type> c_idx(0u, dim - 1u);
+    std::vector<vector_double::size_type> r(3);
+    for (vector_double::size_type i = 0; i < NP; ++i) {
+        std::vector<vector_double::size_type> idxs(NP);
+        std::iota(idxs.begin(), idxs.end(), vector_double::size_type(0u));
+        for (auto j = 0u; j < 3u; ++j) {
+            auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(r_engine);
+            r[j] = idxs[idx];
+            std::swap(idxs[idx], idxs[NP - 1u - j]);
+        }
+        vector_double tmp = pop[i];
+        auto n = c_idx(r_engine);
+        for (vector_double::size_type L = 0u; L < dim; ++L) {
+            if ((drng(r_engine) < CR) || L + 1u == dim) {
+                tmp[n] = pop[r[0]][n] + F * (pop[r[1]][n] - pop[r[2]][n]);
+            }
+            n = (n + 1u) % dim;
+        }
+        detail::force_bounds_random(tmp, bounds.first, bounds.second, r_engine);
+        std::copy(tmp.begin(), tmp.end(), retval.begin() + static_cast<vector_double::difference_type>(i * dim));
+    }
+    return retval;
+}
+
+// Time f, in milliseconds.
+template <typename F>
+double bench(const F &f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const vector_double::size_type nx = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000u;
+    const vector_double::size_type N = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000u;
+    const unsigned n_trials = 10;
+
+    const bounds_t bounds{vector_double(nx, -5.), vector_double(nx, 5.)};
+    detail::random_engine_type r_engine(42u);
+    vector_double pop(N * nx);
+    std::uniform_real_distribution<double> rdist(-5., 5.);
+    std::generate(pop.begin(), pop.end(), [&]() { return rdist(r_engine); });
+    std::vector<vector_double> vpop;
+    for (vector_double::size_type i = 0; i < N; ++i) {
+        vpop.emplace_back(pop.begin() + static_cast<vector_double::difference_type>(i * nx),
+                          pop.begin() + static_cast<vector_double::difference_type>((i + 1u) * nx));
+    }
+
+    std::cout << "nx = " << nx << ", N = " << N << ", best of " << n_trials << " runs\n\n";
+
+    double t_scalar = 1e300, t_batch = 1e300;
+    for (unsigned t = 0; t < n_trials; ++t) {
+        auto x = pop;
+        t_scalar = std::min(t_scalar, bench([&]() {
+                                for (vector_double::size_type i = 0; i + 1u < N; i += 2u) {
+                                    scalar_sbx(x.data() + i * nx, x.data() + (i + 1u) * nx, bounds, .95, 10.,
+                                               r_engine);
+                                }
+                            }));
+        x = pop;
+        t_batch = std::min(t_batch, bench([&]() { sbx_crossover_batch(x, bounds, 0u, .95, 10., t); }));
+    }
+    std::cout << "SBX crossover:\t\t" << t_scalar << " ms scalar, " << t_batch << " ms batch\n";
+
+    t_scalar = t_batch = 1e300;
+    for (unsigned t = 0; t < n_trials; ++t) {
+        auto x = pop;
+        t_scalar = std::min(t_scalar, bench([&]() {
+                                for (vector_double::size_type i = 0; i < N; ++i) {
+                                    scalar_poly(x.data() + i * nx, bounds, .5, 10., r_engine);
+                                }
+                            }));
+        x = pop;
+        t_batch = std::min(t_batch, bench([&]() { polynomial_mutation_batch(x, bounds, 0u, .5, 10., t); }));
+    }
+    std::cout << "Polynomial mutation:\t" << t_scalar << " ms scalar, " << t_batch << " ms batch\n";
+
+    t_scalar = t_batch = 1e300;
+    for (unsigned t = 0; t < n_trials; ++t) {
+        t_scalar = std::min(t_scalar, bench([&]() { scalar_de(vpop, .8, .9, bounds, r_engine); }));
+        t_batch = std::min(t_batch, bench([&]() { de_trial_batch(vpop, vpop[0], 7u, .8, .9, bounds, t); }));
+    }
+    std::cout << "DE/rand/1/bin:\t\t" << t_scalar << " ms scalar, " << t_batch << " ms batch\n";
+}
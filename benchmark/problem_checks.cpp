@@ -0,0 +1,117 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+// Microbenchmark for the validation overhead of problem::fitness().
+//
+// The built-in scalable test functions are evaluated repeatedly on a fixed decision
+// vector both via the checked problem::fitness() and via the trusted entry point
+// detail::prob_invoke_mem_fitness(), which skips the checks on the input decision
+// vector and on the output fitness vector. The difference between the two timings
+// is the cost of the validation. The same comparison is done for batches of
+// decision vectors, by comparing a thread_bfe wrapped in a bfe (which validates
+// the whole batch) with a bare thread_bfe.
+//
+// Usage: problem_checks [n_evals] [batch_size]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/ackley.hpp>
+#include <pagmo/problems/griewank.hpp>
+#include <pagmo/problems/rastrigin.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/schwefel.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+// Time n invocations of f, in nanoseconds per invocation.
+template <typename F>
+double bench(const F &f, unsigned long long n)
+{
+    double acc = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < n; ++i) {
+        acc += f();
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    // Prevent the compiler from optimising away the evaluations.
+    if (acc == 42.) {
+        std::cout << "";
+    }
+    return ns / static_cast<double>(n);
+}
+
+void bench_problem(const problem &p, unsigned long long n_evals, unsigned long long batch_size)
+{
+    const vector_double dv(p.get_nx(), .5);
+    const vector_double dvs(static_cast<vector_double::size_type>(p.get_nx() * batch_size), .5);
+
+    const auto t_checked = bench([&p, &dv]() { return p.fitness(dv)[0]; }, n_evals);
+    const auto t_trusted = bench([&p, &dv]() { return detail::prob_invoke_mem_fitness(p, dv)[0]; }, n_evals);
+
+    const thread_bfe t_bfe;
+    const bfe w_bfe{t_bfe};
+    const auto n_batches = n_evals / batch_size + 1u;
+    const auto tb_checked = bench([&p, &dvs, &w_bfe]() { return w_bfe(p, dvs)[0]; }, n_batches)
+                            / static_cast<double>(batch_size);
+    const auto tb_trusted = bench([&p, &dvs, &t_bfe]() { return t_bfe(p, dvs)[0]; }, n_batches)
+                            / static_cast<double>(batch_size);
+
+    std::cout << p.get_name() << " (nx = " << p.get_nx() << ")\n";
+    std::cout << "\tfitness:\t" << t_checked << " ns checked, " << t_trusted << " ns trusted, "
+              << (t_checked - t_trusted) / t_checked * 100 << "% saved\n";
+    std::cout << "\tbatch:\t\t" << tb_checked << " ns checked, " << tb_trusted << " ns trusted, "
+              << (tb_checked - tb_trusted) / tb_checked * 100 << "% saved\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const unsigned long long n_evals = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000ull;
+    const unsigned long long batch_size = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000ull;
+
+    std::cout << n_evals << " evaluations, batch size " << batch_size << "\n\n";
+    for (auto nx : {10u, 1000u}) {
+        bench_problem(problem{rosenbrock{nx}}, n_evals, batch_size);
+        bench_problem(problem{rastrigin{nx}}, n_evals, batch_size);
+        bench_problem(problem{ackley{nx}}, n_evals, batch_size);
+        bench_problem(problem{griewank{nx}}, n_evals, batch_size);
+        bench_problem(problem{schwefel{nx}}, n_evals, batch_size);
+    }
+}
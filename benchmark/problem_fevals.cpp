@@ -0,0 +1,132 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+// Microbenchmark for the evaluation counters of pagmo::problem.
+//
+// A trivially cheap UDP (a low-dimensional Rosenbrock function) is evaluated
+// concurrently from an increasing number of threads, so that the cost of the
+// evaluation is dominated by the bookkeeping in pagmo::problem. Each thread
+// evaluates the same problem object, both via problem::fitness() and via
+// thread_bfe. As the Rosenbrock UDP is thread-safe (thread_safety::constant),
+// thread_bfe evaluates it in parallel and increments the fevals counter once
+// per evaluation. With perfect scaling, the throughput grows linearly with
+// the number of threads.
+//
+// Usage: problem_fevals [n_evals_per_thread] [max_threads]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+// Evaluate p from n_threads threads, n_evals times per thread.
+// Return the wall-clock time in seconds.
+double bench_fitness(const problem &p, unsigned n_threads, unsigned long long n_evals)
+{
+    const vector_double dv(p.get_nx(), .5);
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < n_threads; ++i) {
+        threads.emplace_back([&p, &dv, n_evals]() {
+            double acc = 0;
+            for (unsigned long long j = 0; j < n_evals; ++j) {
+                acc += p.fitness(dv)[0];
+            }
+            // Prevent the compiler from optimising away the evaluations.
+            if (acc < 0) {
+                std::abort();
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Evaluate p via thread_bfe in batches of batch_size decision vectors,
+// until n_evals evaluations have been performed. Return the wall-clock
+// time in seconds.
+double bench_thread_bfe(const problem &p, unsigned long long n_evals, unsigned long long batch_size)
+{
+    const vector_double dvs(static_cast<vector_double::size_type>(p.get_nx() * batch_size), .5);
+    thread_bfe bfe;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long n = 0; n < n_evals; n += batch_size) {
+        bfe(p, dvs);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const unsigned long long n_evals = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000ull;
+    const unsigned max_threads
+        = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                   : std::max(1u, std::thread::hardware_concurrency());
+
+    problem p{rosenbrock{2}};
+    std::cout << "Problem: " << p.get_name() << ", " << n_evals << " evaluations per thread\n\n";
+    std::cout << "threads\ttime (s)\tMevals/s\tspeedup\n";
+
+    double base_rate = 0;
+    for (unsigned n_threads = 1; n_threads <= max_threads; n_threads *= 2u) {
+        const auto fevals_before = p.get_fevals();
+        const auto t = bench_fitness(p, n_threads, n_evals);
+        const auto rate = static_cast<double>(n_threads * n_evals) / t;
+        if (n_threads == 1u) {
+            base_rate = rate;
+        }
+        std::cout << n_threads << '\t' << t << '\t' << rate * 1E-6 << '\t' << rate / base_rate << '\n';
+        if (p.get_fevals() - fevals_before != n_threads * n_evals) {
+            std::cerr << "Inconsistent fevals counter\n";
+            return 1;
+        }
+    }
+
+    std::cout << "\nthread_bfe, " << max_threads * n_evals << " evaluations\n\n";
+    std::cout << "batch size\ttime (s)\tMevals/s\n";
+    for (auto batch_size : {1000ull, 100000ull}) {
+        const auto t = bench_thread_bfe(p, max_threads * n_evals, batch_size);
+        std::cout << batch_size << '\t' << t << '\t' << static_cast<double>(max_threads * n_evals) / t * 1E-6 << '\n';
+    }
+}
@@ -0,0 +1,192 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+// Microbenchmark for the fixed-dimension static_problem adaptor.
+//
+// Fixed-dimension versions of the Rosenbrock and Ackley functions, written against
+// std::array, are wrapped in a static_problem and compared with the dynamic
+// rosenbrock and ackley UDPs. The timings are reported for single evaluations via
+// problem::fitness() and problem::fitness_into(), for batch evaluations via a
+// single-threaded loop over the trusted fitness_into() entry point used by
+// thread_bfe, and for direct calls to the inner fixed-dimension fitness function,
+// which is the lower bound for the cost of an evaluation.
+//
+// Usage: static_problem_dispatch [n_evals] [batch_size]
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include <pagmo/detail/constants.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/ackley.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/static_problem.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+template <std::size_t N>
+struct s_rosenbrock {
+    std::array<double, 1> fitness(const std::array<double, N> &x) const
+    {
+        double retval = 0.;
+        for (std::size_t i = 0; i < N - 1u; ++i) {
+            retval += 100. * (x[i] * x[i] - x[i + 1]) * (x[i] * x[i] - x[i + 1]) + (x[i] - 1) * (x[i] - 1);
+        }
+        return {{retval}};
+    }
+    std::pair<std::array<double, N>, std::array<double, N>> get_bounds() const
+    {
+        std::array<double, N> lb, ub;
+        lb.fill(-5.);
+        ub.fill(10.);
+        return {lb, ub};
+    }
+    std::string get_name() const
+    {
+        return "Static Rosenbrock";
+    }
+};
+
+template <std::size_t N>
+struct s_ackley {
+    std::array<double, 1> fitness(const std::array<double, N> &x) const
+    {
+        const double omega = 2. * detail::pi();
+        double s1 = 0., s2 = 0.;
+        for (std::size_t i = 0; i < N; ++i) {
+            s1 += x[i] * x[i];
+            s2 += std::cos(omega * x[i]);
+        }
+        return {{-20 * std::exp(-0.2 * std::sqrt(1.0 / static_cast<double>(N) * s1))
+                 - std::exp(1.0 / static_cast<double>(N) * s2) + 20 + std::exp(1.0)}};
+    }
+    std::pair<std::array<double, N>, std::array<double, N>> get_bounds() const
+    {
+        std::array<double, N> lb, ub;
+        lb.fill(-15.);
+        ub.fill(30.);
+        return {lb, ub};
+    }
+    std::string get_name() const
+    {
+        return "Static Ackley";
+    }
+};
+
+// Time n invocations of f, in nanoseconds per invocation.
+template <typename F>
+double bench(const F &f, unsigned long long n)
+{
+    double acc = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < n; ++i) {
+        acc += f();
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    // Prevent the compiler from optimising away the evaluations.
+    if (acc == 42.) {
+        std::cout << "";
+    }
+    return ns / static_cast<double>(n);
+}
+
+void print_timings(const problem &p, double t_f, double t_fi, double t_b)
+{
+    std::cout << "\t" << p.get_name() << ":\t" << t_f << " ns fitness(), " << t_fi << " ns fitness_into(), " << t_b
+              << " ns batch\n";
+}
+
+double bench_batch(const problem &p, const vector_double &dvs, unsigned long long n_evals,
+                   unsigned long long batch_size)
+{
+    const auto nx = p.get_nx();
+    const auto n_batches = n_evals / batch_size + 1u;
+    vector_double fvs(batch_size);
+    return bench(
+               [&p, &dvs, &fvs, nx, batch_size]() {
+                   for (unsigned long long i = 0; i < batch_size; ++i) {
+                       detail::prob_invoke_mem_fitness_into(p, dvs.data() + i * nx, fvs.data() + i);
+                   }
+                   return fvs[0];
+               },
+               n_batches)
+           / static_cast<double>(batch_size);
+}
+
+template <std::size_t N, typename S>
+void bench_pair(const problem &p_dyn, unsigned long long n_evals, unsigned long long batch_size)
+{
+    const problem p_st{static_problem<N, 1, S>{}};
+    const vector_double dv(N, .5);
+    const vector_double dvs(static_cast<vector_double::size_type>(N * batch_size), .5);
+    vector_double fv(1);
+
+    std::cout << p_dyn.get_name() << " (nx = " << N << ")\n";
+    for (const auto *p : {&p_dyn, &p_st}) {
+        const auto t_f = bench([p, &dv]() { return p->fitness(dv)[0]; }, n_evals);
+        const auto t_fi = bench(
+            [p, &dv, &fv]() {
+                p->fitness_into(dv, fv);
+                return fv[0];
+            },
+            n_evals);
+        print_timings(*p, t_f, t_fi, bench_batch(*p, dvs, n_evals, batch_size));
+    }
+
+    // Direct calls of the inner fixed-dimension fitness.
+    const S s;
+    std::array<double, N> x;
+    x.fill(.5);
+    std::cout << "\tdirect:\t\t" << bench([&s, &x]() { return s.fitness(x)[0]; }, n_evals) << " ns\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const unsigned long long n_evals = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000ull;
+    const unsigned long long batch_size = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000ull;
+
+    std::cout << n_evals << " evaluations, batch size " << batch_size << "\n\n";
+    bench_pair<2, s_rosenbrock<2>>(problem{rosenbrock{2}}, n_evals, batch_size);
+    bench_pair<8, s_rosenbrock<8>>(problem{rosenbrock{8}}, n_evals, batch_size);
+    bench_pair<16, s_rosenbrock<16>>(problem{rosenbrock{16}}, n_evals, batch_size);
+    bench_pair<2, s_ackley<2>>(problem{ackley{2}}, n_evals, batch_size);
+    bench_pair<8, s_ackley<8>>(problem{ackley{8}}, n_evals, batch_size);
+    bench_pair<16, s_ackley<16>>(problem{ackley{16}}, n_evals, batch_size);
+}
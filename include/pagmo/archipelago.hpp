@@ -30,7 +30,9 @@ see https://www.gnu.org/licenses/. */
 #define PAGMO_ARCHIPELAGO_HPP
 
 #include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -42,6 +44,8 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/iterator/indirect_iterator.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/optional.hpp>
+#include <boost/serialization/version.hpp>
 
 #include <pagmo/algorithm.hpp>
 #include <pagmo/bfe.hpp>
@@ -53,6 +57,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/r_policy.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policy.hpp>
+#include <pagmo/stats.hpp>
 #include <pagmo/topology.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
@@ -110,6 +115,106 @@ PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, migrant_handling);
 
 #endif
 
+/// Migration scheduler.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This class describes an opt-in asynchronous migration scheme for :cpp:class:`~pagmo::archipelago`,
+ * which can be activated via :cpp:func:`pagmo::archipelago::set_migration_scheduler()`.
+ *
+ * With the default migration scheme, at the beginning of every generation an island copies the
+ * latest candidate migrants of the connecting islands from the archipelago's migrants database,
+ * regardless of whether or not it has already seen them. When a migration scheduler is active instead:
+ *
+ * - after each evolution, the migrants selected by an island are pushed, together with a timestamp,
+ *   into a bounded mailbox associated to the island. When the mailbox is full, the oldest
+ *   group of migrants is discarded;
+ * - each connection of the topology keeps track of the migrants it has already delivered, so that
+ *   an island receives through each incoming connection only the migrants it has not seen yet,
+ *   and only if they are not older than a maximum staleness;
+ * - migration into an island is attempted only after a minimum number of generations *and* a minimum
+ *   wall-clock time have elapsed since the last migration into the island;
+ * - if no fresh migrants are available, the replacement policy is not invoked at all.
+ *
+ * The migration type has the same meaning as in the default migration scheme. With the
+ * :cpp:enumerator:`~pagmo::migrant_handling::preserve` policy, a group of migrants in a mailbox
+ * can be delivered through all the outgoing connections of the island, while with the
+ * :cpp:enumerator:`~pagmo::migrant_handling::evict` policy it is delivered only once, to the
+ * first island fetching it.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC migration_scheduler
+{
+public:
+    // Constructor.
+    explicit migration_scheduler(migration_type = migration_type::p2p, migrant_handling = migrant_handling::preserve,
+                                 unsigned gen_interval = 1u, double time_interval = 0., std::size_t mailbox_size = 1u,
+                                 double max_staleness = std::numeric_limits<double>::infinity());
+
+    // Getters.
+    migration_type get_migration_type() const;
+    migrant_handling get_migrant_handling() const;
+    unsigned get_gen_interval() const;
+    double get_time_interval() const;
+    std::size_t get_mailbox_size() const;
+    double get_max_staleness() const;
+
+    /// Save to archive.
+    /**
+     * @param ar the output archive.
+     *
+     * @throws unspecified any exception thrown by the serialization of primitive types.
+     */
+    template <typename Archive>
+    void save(Archive &ar, unsigned) const
+    {
+        detail::to_archive(ar, m_migr_type, m_migr_handling, m_gen_interval, m_time_interval, m_mailbox_size,
+                           m_max_staleness);
+    }
+    /// Load from archive.
+    /**
+     * @param ar the input archive.
+     *
+     * @throws std::invalid_argument if the loaded parameters are not valid.
+     * @throws unspecified any exception thrown by the deserialization of primitive types.
+     */
+    template <typename Archive>
+    void load(Archive &ar, unsigned)
+    {
+        migration_type mt;
+        migrant_handling mh;
+        unsigned gen_interval;
+        double time_interval;
+        std::size_t mailbox_size;
+        double max_staleness;
+        detail::from_archive(ar, mt, mh, gen_interval, time_interval, mailbox_size, max_staleness);
+        *this = migration_scheduler(mt, mh, gen_interval, time_interval, mailbox_size, max_staleness);
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+private:
+    migration_type m_migr_type;
+    migrant_handling m_migr_handling;
+    unsigned m_gen_interval;
+    double m_time_interval;
+    std::size_t m_mailbox_size;
+    double m_max_staleness;
+};
+
+// Stream operator for migration_scheduler.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const migration_scheduler &);
+
+namespace detail
+{
+
+// The mailbox of an island, used when a migration
+// scheduler is active in the archipelago.
+struct migration_mailbox;
+
+} // namespace detail
+
 /// Archipelago.
 /**
  * \image html archi_no_text.png
@@ -141,6 +246,8 @@ class PAGMO_DLL_PUBLIC archipelago
 {
     // Make friends with island.
     friend class PAGMO_DLL_PUBLIC island;
+    // Make friends with the checkpointing machinery.
+    friend struct detail::archi_checkpoint;
 
     using container_t = std::vector<std::unique_ptr<island>>;
     using size_type_implementation = container_t::size_type;
@@ -639,6 +746,8 @@ public:
     std::vector<vector_double> get_champions_f() const;
     // Get the decision vectors of the islands' champions.
     std::vector<vector_double> get_champions_x() const;
+    // Get the islands' summaries.
+    std::vector<island_summary> get_summaries() const;
 
     // Get the migration log.
     migration_log_t get_migration_log() const;
@@ -656,6 +765,17 @@ public:
     migrant_handling get_migrant_handling() const;
     void set_migrant_handling(migrant_handling);
 
+    // Migration scheduler.
+    void set_migration_scheduler(const migration_scheduler &);
+    void unset_migration_scheduler();
+    boost::optional<migration_scheduler> get_migration_scheduler() const;
+
+    // Instrumentation.
+    void set_stats_enabled(bool);
+    std::vector<island_stats> get_stats() const;
+    island_stats get_aggregated_stats() const;
+    void reset_stats();
+
     /// Save to archive.
     /**
      * This method will save to \p ar the islands of the archipelago.
@@ -668,9 +788,13 @@ public:
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
+        const auto sched = get_migration_scheduler();
         detail::to_archive(ar, m_islands, get_migrants_db(), get_migration_log(), get_topology(),
                            m_migr_type.load(std::memory_order_relaxed),
-                           m_migr_handling.load(std::memory_order_relaxed));
+                           m_migr_handling.load(std::memory_order_relaxed), static_cast<bool>(sched));
+        if (sched) {
+            ar << *sched;
+        }
     }
     /// Load from archive.
     /**
@@ -683,27 +807,17 @@ public:
      * or primitive types, or by memory errors in standard containers.
      */
     template <typename Archive>
-    void load(Archive &ar, unsigned)
+    void load(Archive &ar, unsigned version)
     {
         // NOTE: the idea here is that we will be loading the member of archi one by one in
         // separate variables, move assign the loaded data into a tmp archi and finally move-assign
-        // the tmp archi into this. This allows the method to be exception safe, and to have
+        // the tmp archi into this (see assign_parts()). This allows the method to be exception safe, and to have
         // archi objects always in a consistent state at every stage of the deserialization.
 
-        // The tmp archi. This is def-cted and idle, we will be able to move-in data without
-        // worrying about synchronization.
-        archipelago tmp;
-
         // The islands.
         container_t tmp_islands;
         ar >> tmp_islands;
 
-        // Map the islands to indices.
-        idx_map_t tmp_idx_map;
-        for (size_type i = 0; i < tmp_islands.size(); ++i) {
-            tmp_idx_map.emplace(tmp_islands[i].get(), i);
-        }
-
         // The migrants.
         migrants_db_t tmp_migrants;
         ar >> tmp_migrants;
@@ -723,20 +837,21 @@ public:
         ar >> tmp_migr_type;
         ar >> tmp_migr_handling;
 
-        // From now on, everything is noexcept. Thus, there is
-        // no danger that tmp is destructed while in an inconsistent
-        // state.
-        tmp.m_islands = std::move(tmp_islands);
-        tmp.m_idx_map = std::move(tmp_idx_map);
-        tmp.m_migrants = std::move(tmp_migrants);
-        tmp.m_migr_log = std::move(tmp_migr_log);
-        tmp.m_topology = std::move(tmp_topo);
-        tmp.m_migr_type.store(tmp_migr_type, std::memory_order_relaxed);
-        tmp.m_migr_handling.store(tmp_migr_handling, std::memory_order_relaxed);
-
-        // NOTE: this final assignment will take care of setting the islands' archi pointers
-        // appropriately via archi's move assignment operator.
-        *this = std::move(tmp);
+        // The migration scheduler, if any.
+        // NOTE: the migration scheduler was added in version 1.
+        bool has_sched = false;
+        if (version > 0u) {
+            ar >> has_sched;
+        }
+        std::shared_ptr<const migration_scheduler> tmp_sched;
+        if (has_sched) {
+            migration_scheduler ms;
+            ar >> ms;
+            tmp_sched = std::make_shared<const migration_scheduler>(ms);
+        }
+
+        assign_parts(std::move(tmp_islands), std::move(tmp_migrants), std::move(tmp_migr_log), std::move(tmp_topo),
+                     tmp_migr_type, tmp_migr_handling, std::move(tmp_sched));
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 
@@ -752,6 +867,21 @@ private:
     PAGMO_DLL_LOCAL size_type get_island_idx(const island &) const;
     // Get the connections to the island at the given index.
     PAGMO_DLL_LOCAL std::pair<std::vector<size_type>, vector_double> get_island_connections(size_type) const;
+    // Same as above, but re-using a cached CSR snapshot of the topology, if possible.
+    PAGMO_DLL_LOCAL void get_island_connections(size_type, std::shared_ptr<const topology_csr> &,
+                                                std::pair<std::vector<size_type>, vector_double> &) const;
+    // Assign to this the deserialised parts of an archipelago.
+    void assign_parts(container_t &&, migrants_db_t &&, migration_log_t &&, topology &&, migration_type,
+                      migrant_handling, std::shared_ptr<const migration_scheduler> &&);
+    // Helpers for the migration scheduler.
+    static std::vector<std::shared_ptr<detail::migration_mailbox>> make_mailboxes(size_type);
+    PAGMO_DLL_LOCAL std::shared_ptr<const migration_scheduler> get_migration_scheduler_ptr() const;
+    PAGMO_DLL_LOCAL std::shared_ptr<detail::migration_mailbox> get_mailbox(size_type) const;
+    PAGMO_DLL_LOCAL void prune_mailbox_cursors() noexcept;
+    PAGMO_DLL_LOCAL void push_migrants(size_type, const migration_scheduler &, const individuals_group_t &);
+    PAGMO_DLL_LOCAL std::vector<std::pair<size_type, individuals_group_t>>
+    pull_migrants(size_type, const migration_scheduler &, const std::pair<std::vector<size_type>, vector_double> &,
+                  std::mt19937 &);
 
 private:
     container_t m_islands;
@@ -773,6 +903,12 @@ private:
     // Migration type and migrant handling policy.
     std::atomic<migration_type> m_migr_type;
     std::atomic<migrant_handling> m_migr_handling;
+    // The migration scheduler (null if not active).
+    mutable std::mutex m_sched_mutex;
+    std::shared_ptr<const migration_scheduler> m_sched;
+    // The mailboxes of the islands. They are protected
+    // by m_migrants_mutex, like the migrants database.
+    std::vector<std::shared_ptr<detail::migration_mailbox>> m_mailboxes;
 };
 
 // Stream operator.
@@ -783,4 +919,8 @@ PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const archipelago &);
 // Disable tracking for the serialisation of archipelago.
 BOOST_CLASS_TRACKING(pagmo::archipelago, boost::serialization::track_never)
 
+// NOTE: version 1 added the migration scheduler
+// to the serialised state.
+BOOST_CLASS_VERSION(pagmo::archipelago, 1)
+
 #endif
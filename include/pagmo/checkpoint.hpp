@@ -0,0 +1,75 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_CHECKPOINT_HPP
+#define PAGMO_CHECKPOINT_HPP
+
+#include <iostream>
+#include <string>
+
+#include <pagmo/archipelago.hpp>
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+/// Checkpoint compression.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This enumeration represents the compression schemes available for archipelago checkpoints
+ * (see :cpp:func:`pagmo::save_checkpoint()`).
+ *
+ * \endverbatim
+ */
+enum class checkpoint_compression {
+    none = 0, ///< No compression.
+    zlib = 1  ///< Byte-shuffling followed by zlib compression (requires pagmo to be built with zlib support).
+};
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for checkpoint_compression.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, checkpoint_compression);
+
+#endif
+
+// Save an archipelago checkpoint.
+PAGMO_DLL_PUBLIC void save_checkpoint(const archipelago &, std::ostream &,
+                                      checkpoint_compression = checkpoint_compression::none);
+PAGMO_DLL_PUBLIC void save_checkpoint(const archipelago &, const std::string &,
+                                      checkpoint_compression = checkpoint_compression::none);
+
+// Load an archipelago checkpoint.
+PAGMO_DLL_PUBLIC void load_checkpoint(archipelago &, std::istream &);
+PAGMO_DLL_PUBLIC void load_checkpoint(archipelago &, const std::string &);
+
+} // namespace pagmo
+
+#endif
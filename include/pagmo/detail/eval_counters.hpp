@@ -0,0 +1,94 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_DETAIL_EVAL_COUNTERS_HPP
+#define PAGMO_DETAIL_EVAL_COUNTERS_HPP
+
+#include <atomic>
+
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Sharded counters for the fitness, gradient and hessians evaluations
+// of a problem. Each thread increments the counters in its own shard
+// (shards are assigned round-robin to threads on first use, and they are
+// shared if there are more threads than shards), and the shards are summed up
+// on read. The shards are aligned to and padded to the size of a cache line,
+// so that concurrent evaluations of the same problem in different threads
+// do not contend for the same cache line.
+//
+// The number of shards is the hardware concurrency, capped to max_shards. The shards
+// are allocated on the first increment, so that constructing and copying the counters
+// do not allocate. On single-core machines, no shard is ever allocated and the
+// increments go directly to the base counters.
+class PAGMO_DLL_PUBLIC eval_counters
+{
+public:
+    // The counter types.
+    enum counter_type : unsigned { fevals = 0u, gevals = 1u, hevals = 2u };
+    // Maximum number of shards and size of a shard.
+    static constexpr unsigned max_shards = 16u;
+    static constexpr unsigned shard_size = 64u;
+
+    eval_counters() noexcept;
+    eval_counters(const eval_counters &) noexcept;
+    eval_counters(eval_counters &&) noexcept;
+    eval_counters &operator=(eval_counters &&) noexcept;
+    eval_counters &operator=(const eval_counters &) = delete;
+    ~eval_counters();
+
+    // Increment a counter.
+    void increment(counter_type, unsigned long long) const;
+    // Sum up the shards of a counter.
+    unsigned long long load(counter_type) const noexcept;
+    // Set the values of all the counters.
+    void store(unsigned long long, unsigned long long, unsigned long long) noexcept;
+
+private:
+    struct shard;
+    struct shard_block;
+
+    shard_block *get_block() const;
+
+    // The base values of the counters (i.e., the values set
+    // via store() or inherited from a copy).
+    mutable std::atomic<unsigned long long> m_base[3];
+    // The lazily-allocated shards.
+    mutable std::atomic<shard_block *> m_block;
+};
+
+} // namespace detail
+
+} // namespace pagmo
+
+#endif
@@ -0,0 +1,72 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_DETAIL_TOPOLOGY_HASH_HPP
+#define PAGMO_DETAIL_TOPOLOGY_HASH_HPP
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// The finalizer of the splitmix64 generator. It is used
+// as a (non-cryptographic) hash function to generate
+// random quantities on the fly in the implicit topologies.
+inline std::uint64_t splitmix64(std::uint64_t z)
+{
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// Hash a sequence of integral keys.
+inline std::uint64_t topology_hash(std::initializer_list<std::uint64_t> keys)
+{
+    std::uint64_t retval = 0;
+    for (auto k : keys) {
+        retval = splitmix64(retval ^ k);
+    }
+    return retval;
+}
+
+// Turn a hash value into a double in the [0, 1) range.
+inline double topology_hash_to_unit(std::uint64_t h)
+{
+    return static_cast<double>(h >> 11) * (1. / static_cast<double>(std::uint64_t(1) << 53));
+}
+
+} // namespace detail
+
+} // namespace pagmo
+
+#endif
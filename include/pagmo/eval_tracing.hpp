@@ -0,0 +1,234 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_EVAL_TRACING_HPP
+#define PAGMO_EVAL_TRACING_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/stats.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+/// Evaluation types.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This enumeration represents the evaluation methods of :cpp:class:`~pagmo::problem`
+ * which are reported to an :cpp:class:`~pagmo::eval_tracer`.
+ *
+ * \endverbatim
+ */
+enum class eval_type {
+    fitness = 0,       ///< problem::fitness().
+    batch_fitness = 1, ///< problem::batch_fitness().
+    gradient = 2,      ///< problem::gradient().
+    hessians = 3       ///< problem::hessians().
+};
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for eval_type.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, eval_type);
+
+#endif
+
+/// Evaluation tracer.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This is the base class of the hooks which can be installed via :cpp:func:`pagmo::set_eval_tracer()`
+ * in order to observe the evaluations performed by :cpp:class:`~pagmo::problem`. The hooks are compiled
+ * into pagmo only if the ``PAGMO_WITH_EVAL_TRACING`` build option is enabled: otherwise, no tracer
+ * is ever invoked, and the evaluation methods of :cpp:class:`~pagmo::problem` contain no tracing code at all.
+ *
+ * After each successful evaluation, :cpp:func:`~pagmo::eval_tracer::record()` is invoked from the thread
+ * which performed the evaluation. Since evaluations may run concurrently in several threads,
+ * implementations of :cpp:func:`~pagmo::eval_tracer::record()` must be thread-safe, and, in order not
+ * to perturb the measurements, they should avoid locking.
+ *
+ * A fused evaluation via :cpp:func:`pagmo::problem::fitness_and_gradient()` is recorded as
+ * a fitness evaluation followed by a gradient evaluation, both reporting the duration of the fused call.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC eval_tracer
+{
+public:
+    virtual ~eval_tracer();
+
+    /// Record an evaluation.
+    /**
+     * @param t the type of evaluation.
+     * @param ns the wall-clock time (in nanoseconds) of the evaluation, including the checks on its output.
+     * @param dv a pointer to the input decision vector(s).
+     * @param dv_size the size of the input decision vector(s).
+     * @param out a pointer to the output of the evaluation (the fitness vector(s) or the gradient). For
+     * pagmo::eval_type::hessians, \p out is null.
+     * @param out_size the size of the output.
+     */
+    virtual void record(eval_type t, unsigned long long ns, const double *dv, std::size_t dv_size, const double *out,
+                        std::size_t out_size) noexcept = 0;
+};
+
+// Install/fetch the evaluation tracer.
+PAGMO_DLL_PUBLIC eval_tracer *set_eval_tracer(eval_tracer *) noexcept;
+PAGMO_DLL_PUBLIC eval_tracer *get_eval_tracer() noexcept;
+
+/// Lock-free evaluation trace collector.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This :cpp:class:`~pagmo::eval_tracer` records, without ever locking:
+ *
+ * - for each :cpp:enum:`~pagmo::eval_type`, a histogram of the evaluation latencies (see
+ *   :cpp:class:`~pagmo::stats_histogram`),
+ * - per-thread counters of the number and of the total duration of the evaluations. Each thread
+ *   is assigned a slot on its first evaluation; if more than
+ *   :cpp:member:`~pagmo::eval_trace_collector::n_thread_slots` threads perform evaluations, slots
+ *   are shared,
+ * - optionally, a sample of the evaluated decision vectors and of the corresponding outputs, stored
+ *   in a fixed-size ring buffer which retains the most recent samples. A sample is taken every
+ *   *interval* evaluations. If two threads attempt to write into the same slot of the ring buffer at the
+ *   same time, one of the samples is dropped rather than waiting.
+ *
+ * The data can be exported via :cpp:func:`pagmo::dump_eval_trace_csv()`,
+ * :cpp:func:`pagmo::dump_eval_trace_samples_csv()` and :cpp:func:`pagmo::dump_eval_trace_folded()`.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC eval_trace_collector final : public eval_tracer
+{
+public:
+    /// The number of per-thread slots.
+    static constexpr unsigned n_thread_slots = 64u;
+    /// The number of evaluation types.
+    static constexpr unsigned n_eval_types = 4u;
+    /// Per-thread counters, indexed by pagmo::eval_type.
+    using thread_counters_t = std::array<unsigned long long, n_eval_types>;
+
+    /// A sampled evaluation.
+    struct sample {
+        /// The sequence number of the evaluation.
+        unsigned long long seq;
+        /// The type of evaluation.
+        eval_type type;
+        /// The thread slot.
+        unsigned thread;
+        /// The latency in nanoseconds.
+        unsigned long long ns;
+        /// The input decision vector(s).
+        vector_double dv;
+        /// The output of the evaluation.
+        vector_double out;
+    };
+
+    // Constructor.
+    explicit eval_trace_collector(std::size_t sample_capacity = 0, unsigned long long sample_interval = 1);
+    // Deleted copy/move operations.
+    eval_trace_collector(const eval_trace_collector &) = delete;
+    eval_trace_collector(eval_trace_collector &&) = delete;
+    eval_trace_collector &operator=(const eval_trace_collector &) = delete;
+    eval_trace_collector &operator=(eval_trace_collector &&) = delete;
+    // Destructor.
+    ~eval_trace_collector();
+
+    // The recording function.
+    void record(eval_type, unsigned long long, const double *, std::size_t, const double *,
+                std::size_t) noexcept override;
+
+    // Getters.
+    stats_histogram get_latency(eval_type) const;
+    std::vector<thread_counters_t> get_thread_counts() const;
+    std::vector<thread_counters_t> get_thread_times() const;
+    std::vector<sample> get_samples() const;
+    unsigned long long get_n_dropped_samples() const;
+    std::size_t get_sample_capacity() const;
+    unsigned long long get_sample_interval() const;
+
+    // The thread slot of the calling thread.
+    static unsigned thread_slot() noexcept;
+
+private:
+    struct impl;
+    std::unique_ptr<impl> m_impl;
+};
+
+// Dump the latency histograms in CSV format.
+PAGMO_DLL_PUBLIC void dump_eval_trace_csv(std::ostream &, const eval_trace_collector &);
+// Dump the samples in CSV format.
+PAGMO_DLL_PUBLIC void dump_eval_trace_samples_csv(std::ostream &, const eval_trace_collector &);
+// Dump the per-thread times in folded stack format.
+PAGMO_DLL_PUBLIC void dump_eval_trace_folded(std::ostream &, const eval_trace_collector &);
+
+namespace detail
+{
+
+// Helper to time an evaluation and report it to the
+// installed tracer (if any). If no tracer is installed,
+// the clock is never queried.
+class eval_trace_timer
+{
+public:
+    eval_trace_timer() noexcept
+        : m_tracer(get_eval_tracer()),
+          m_start(m_tracer ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{})
+    {
+    }
+    void record(eval_type t, const double *dv, std::size_t dv_size, const double *out, std::size_t out_size) const
+        noexcept
+    {
+        if (m_tracer) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                                 - m_start)
+                                .count();
+            m_tracer->record(t, static_cast<unsigned long long>(ns), dv, dv_size, out, out_size);
+        }
+    }
+
+private:
+    eval_tracer *m_tracer;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace detail
+
+} // namespace pagmo
+
+#endif
@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_ISLAND_HPP
 #define PAGMO_ISLAND_HPP
 
+#include <atomic>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -59,6 +60,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policy.hpp>
+#include <pagmo/stats.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
 
@@ -137,9 +139,62 @@ public:
 template <typename T>
 const bool is_udi<T>::value;
 
+/// Island summary.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This class contains a lightweight snapshot of the state of an :cpp:class:`~pagmo::island`:
+ * the champion of the island's population, the number of fitness evaluations of the population's
+ * problem, the number of evolutions completed by the island and the size of the population.
+ *
+ * The summary is published by the island every time its population is replaced
+ * (e.g., via :cpp:func:`pagmo::island::set_population()`) and at the end of each evolution,
+ * and it can be fetched via :cpp:func:`pagmo::island::get_summary()` without copying the island's
+ * population and without contending with the island's evolution.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC island_summary
+{
+    // The island publishes the summaries.
+    friend class PAGMO_DLL_PUBLIC island;
+    // Make friends with the stream operator.
+    friend PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const island_summary &);
+
+public:
+    // Default constructor.
+    island_summary();
+
+    // Getters.
+    vector_double get_champion_x() const;
+    vector_double get_champion_f() const;
+    unsigned long long get_fevals() const;
+    unsigned long long get_evolutions() const;
+    population::size_type get_population_size() const;
+
+private:
+    PAGMO_DLL_LOCAL void check_champion() const;
+
+private:
+    vector_double m_champion_x;
+    vector_double m_champion_f;
+    unsigned long long m_fevals;
+    unsigned long long m_evolutions;
+    population::size_type m_pop_size;
+    vector_double::size_type m_nobj;
+    bool m_stochastic;
+};
+
+// Stream operator for island_summary.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const island_summary &);
+
 namespace detail
 {
 
+// The implementation of the archipelago checkpoints.
+struct archi_checkpoint;
+
 struct PAGMO_DLL_PUBLIC_INLINE_CLASS isl_inner_base {
     virtual ~isl_inner_base() {}
     virtual std::unique_ptr<isl_inner_base> clone() const = 0;
@@ -242,6 +297,14 @@ namespace detail
 // if isl::wait()/isl::wait_check() holds the GIL while waiting.
 PAGMO_DLL_PUBLIC extern std::function<boost::any()> wait_raii_getter;
 
+// NOTE: these helpers return the object produced by gte_getter() (see gte_getter.hpp)
+// only if the input algorithm or problem might be implemented in Python, and an empty
+// object otherwise. Pythonic algorithms and problems never provide the basic thread safety
+// guarantee, thus if both algo and prob are at least basic thread-safe we can copy/destroy
+// them without locking the Python interpreter.
+PAGMO_DLL_PUBLIC boost::any island_gte(const population &);
+PAGMO_DLL_PUBLIC boost::any island_gte(const algorithm &, const population &);
+
 // NOTE: this structure holds an std::function that implements the logic for the selection of the UDI
 // type in the constructor of island_data. The logic is decoupled so that we can override the default logic with
 // alternative implementations (e.g., use a process-based island rather than the default thread island if prob, algo,
@@ -331,6 +394,17 @@ struct PAGMO_DLL_PUBLIC island_data {
     // In all other situations, it will be null.
     archipelago *archi_ptr = nullptr;
     task_queue queue;
+    // The instrumentation data. The flag is checked
+    // (with relaxed ordering) before recording anything,
+    // so that the cost of disabled instrumentation is a single load.
+    std::atomic<bool> stats_enabled{false};
+    std::mutex stats_mutex;
+    island_stats stats;
+    // The number of evolutions completed by the island, and the last
+    // published summary. The summary is read and written via the atomic
+    // shared_ptr functions, and it is null until the first publication.
+    std::atomic<unsigned long long> n_evolutions{0};
+    std::shared_ptr<const island_summary> summary;
 };
 } // namespace detail
 
@@ -444,6 +518,12 @@ class PAGMO_DLL_PUBLIC island
     using idata_t = detail::island_data;
     // archi needs access to the internal of island.
     friend class PAGMO_DLL_PUBLIC archipelago;
+    // thread_island needs access to the internal algo/pop
+    // in order to avoid locking the Python interpreter
+    // when they are not pythonic.
+    friend class PAGMO_DLL_PUBLIC thread_island;
+    // Make friends with the checkpointing machinery.
+    friend struct detail::archi_checkpoint;
 #if !defined(PAGMO_DOXYGEN_INVOKED)
     // Make friends with the stream operator.
     friend PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const island &);
@@ -1102,6 +1182,15 @@ public:
     // Island's extra info.
     std::string get_extra_info() const;
 
+    // Instrumentation.
+    void set_stats_enabled(bool);
+    bool get_stats_enabled() const;
+    island_stats get_stats() const;
+    void reset_stats();
+
+    // Get the summary.
+    island_summary get_summary() const;
+
     // Check if the island is valid.
     bool is_valid() const;
     /// Save to archive.
@@ -1155,6 +1244,25 @@ private:
     PAGMO_DLL_LOCAL migration_data_t get_migration_data() const;
     // Set all the individuals in the population.
     PAGMO_DLL_LOCAL void set_individuals(const individuals_group_t &);
+    // Replace the current population with the pointed-to population.
+    PAGMO_DLL_LOCAL void reset_population_ptr(std::shared_ptr<population>);
+    // Run the selection/replacement policies on the current population.
+    PAGMO_DLL_LOCAL individuals_group_t select_migrants() const;
+    PAGMO_DLL_LOCAL individuals_group_t replace_with_migrants(const individuals_group_t &);
+    // Get references to the current algorithm and population.
+    PAGMO_DLL_LOCAL std::shared_ptr<const algorithm> get_algorithm_ptr() const;
+    PAGMO_DLL_LOCAL std::shared_ptr<const population> get_population_ptr() const;
+    // Record instrumentation data.
+    PAGMO_DLL_LOCAL void record_stat(stats_histogram island_stats::*, unsigned long long) const;
+    PAGMO_DLL_LOCAL void record_pop_copy(const population &) const;
+    // Summary machinery.
+    PAGMO_DLL_LOCAL static std::shared_ptr<island_summary> make_summary(const population &);
+    PAGMO_DLL_LOCAL std::shared_ptr<const island_summary> get_summary_ptr() const;
+    PAGMO_DLL_LOCAL void publish_summary();
+    // Implementation of wait()/wait_check(), without
+    // the wait RAII object.
+    PAGMO_DLL_LOCAL void wait_impl();
+    PAGMO_DLL_LOCAL void wait_check_impl();
 
 private:
     std::unique_ptr<idata_t> m_ptr;
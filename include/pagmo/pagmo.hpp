@@ -35,6 +35,8 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/algorithm.hpp>
 #include <pagmo/archipelago.hpp>
 #include <pagmo/bfe.hpp>
+#include <pagmo/checkpoint.hpp>
+#include <pagmo/eval_tracing.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/island.hpp>
@@ -44,6 +46,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policy.hpp>
+#include <pagmo/stats.hpp>
 #include <pagmo/threading.hpp>
 #include <pagmo/topology.hpp>
 #include <pagmo/type_traits.hpp>
@@ -52,7 +55,9 @@ see https://www.gnu.org/licenses/. */
 // Utils.
 #include <pagmo/utils/constrained.hpp>
 #include <pagmo/utils/discrepancy.hpp>
+#include <pagmo/utils/dual.hpp>
 #include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
 #include <pagmo/utils/gradients_and_hessians.hpp>
 #include <pagmo/utils/hv_algos/hv_algorithm.hpp>
 #include <pagmo/utils/hv_algos/hv_bf_approx.hpp>
@@ -107,6 +112,7 @@ see https://www.gnu.org/licenses/. */
 
 // Problems.
 #include <pagmo/problems/ackley.hpp>
+#include <pagmo/problems/autodiff.hpp>
 #include <pagmo/problems/cec2006.hpp>
 #include <pagmo/problems/cec2009.hpp>
 #include <pagmo/problems/decompose.hpp>
@@ -117,11 +123,14 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/problems/inventory.hpp>
 #include <pagmo/problems/lennard_jones.hpp>
 #include <pagmo/problems/luksan_vlcek1.hpp>
+#include <pagmo/problems/memoize.hpp>
 #include <pagmo/problems/minlp_rastrigin.hpp>
 #include <pagmo/problems/null_problem.hpp>
+#include <pagmo/problems/numerical_gradient.hpp>
 #include <pagmo/problems/rastrigin.hpp>
 #include <pagmo/problems/rosenbrock.hpp>
 #include <pagmo/problems/schwefel.hpp>
+#include <pagmo/problems/static_problem.hpp>
 #include <pagmo/problems/translate.hpp>
 #include <pagmo/problems/unconstrain.hpp>
 #include <pagmo/problems/wfg.hpp>
@@ -152,7 +161,11 @@ see https://www.gnu.org/licenses/. */
 // Topologies.
 #include <pagmo/topologies/base_bgl_topology.hpp>
 #include <pagmo/topologies/fully_connected.hpp>
+#include <pagmo/topologies/hypercube.hpp>
+#include <pagmo/topologies/random_regular.hpp>
 #include <pagmo/topologies/ring.hpp>
+#include <pagmo/topologies/small_world.hpp>
+#include <pagmo/topologies/torus.hpp>
 #include <pagmo/topologies/unconnected.hpp>
 
 #endif
@@ -47,6 +47,15 @@ see https://www.gnu.org/licenses/. */
 
 namespace pagmo
 {
+
+namespace detail
+{
+
+// The implementation of the archipelago checkpoints.
+struct archi_checkpoint;
+
+} // namespace detail
+
 /// Population class.
 /**
  * \image html pop_no_text.png
@@ -81,6 +90,8 @@ class PAGMO_DLL_PUBLIC population
     // access to the population's members during
     // evolution.
     friend class PAGMO_DLL_PUBLIC island;
+    // Make friends with the checkpointing machinery.
+    friend struct detail::archi_checkpoint;
 
 public:
     /// The size type of the population.
@@ -193,6 +204,12 @@ private:
     void push_back_impl(T &&, U &&);
     // Short routine to update the champion. Does nothing if the problem is MO
     PAGMO_DLL_LOCAL void update_champion(vector_double, vector_double);
+    // Comparison used in the update of the champion.
+    PAGMO_DLL_LOCAL bool champion_less(const vector_double &, const vector_double &) const;
+    // Checks and champion update for the batch API.
+    PAGMO_DLL_LOCAL void check_batch(const std::vector<vector_double> &, const std::vector<vector_double> &) const;
+    PAGMO_DLL_LOCAL void update_champion_batch(const std::vector<vector_double> &,
+                                               const std::vector<vector_double> &);
 
 public:
     // Adds one decision vector (chromosome) to the population.
@@ -204,6 +221,11 @@ public:
     // Adds one decision vector/fitness vector to the population (move overload).
     void push_back(vector_double &&, vector_double &&);
 
+    // Adds a batch of decision vectors/fitness vectors to the population.
+    void append(const vector_double &, const vector_double &);
+    // Adds a batch of decision vectors/fitness vectors to the population (move overload).
+    void append(std::vector<vector_double> &&, std::vector<vector_double> &&);
+
     // Creates a random decision vector
     vector_double random_decision_vector() const;
 
@@ -241,6 +263,10 @@ public:
     void set_xf(size_type, const vector_double &, const vector_double &);
     // Sets the \f$i\f$-th individual's chromosome
     void set_x(size_type, const vector_double &);
+    // Sets the decision vectors and fitnesses of the first individuals.
+    void assign_batch(const vector_double &, const vector_double &);
+    // Sets the decision vectors and fitnesses of the first individuals (move overload).
+    void assign_batch(std::vector<vector_double> &&, std::vector<vector_double> &&);
 
     /// Const getter for the pagmo::problem.
     /**
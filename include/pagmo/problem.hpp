@@ -42,6 +42,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_virtual_base_of.hpp>
 
+#include <pagmo/detail/eval_counters.hpp>
 #include <pagmo/detail/make_unique.hpp>
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/exceptions.hpp>
@@ -457,6 +458,100 @@ public:
 template <typename T>
 const bool override_has_batch_fitness<T>::value;
 
+/// Detect \p fitness_and_gradient() method.
+/**
+ * This type trait will be \p true if \p T provides a method with
+ * the following signature:
+ * @code{.unparsed}
+ * std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const;
+ * @endcode
+ * The \p fitness_and_gradient() method is part of the interface for the definition of a problem
+ * (see pagmo::problem).
+ */
+template <typename T>
+class has_fitness_and_gradient
+{
+    template <typename U>
+    using fitness_and_gradient_t
+        = decltype(std::declval<const U &>().fitness_and_gradient(std::declval<const vector_double &>()));
+    static const bool implementation_defined
+        = std::is_same<std::pair<vector_double, vector_double>, detected_t<fitness_and_gradient_t, T>>::value;
+
+public:
+    /// Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool has_fitness_and_gradient<T>::value;
+
+/// Detect \p has_fitness_and_gradient() method.
+/**
+ * This type trait will be \p true if \p T provides a method with
+ * the following signature:
+ * @code{.unparsed}
+ * bool has_fitness_and_gradient() const;
+ * @endcode
+ * The \p has_fitness_and_gradient() method is part of the interface for the definition of a problem
+ * (see pagmo::problem).
+ */
+template <typename T>
+class override_has_fitness_and_gradient
+{
+    template <typename U>
+    using has_fitness_and_gradient_t = decltype(std::declval<const U &>().has_fitness_and_gradient());
+    static const bool implementation_defined = std::is_same<bool, detected_t<has_fitness_and_gradient_t, T>>::value;
+
+public:
+    /// Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool override_has_fitness_and_gradient<T>::value;
+
+/// Detect \p fitness_into() method.
+/**
+ * This type trait will be \p true if \p T provides a method with
+ * the following signature:
+ * @code{.unparsed}
+ * void fitness_into(const double *, double *) const;
+ * @endcode
+ * The \p fitness_into() method is part of the interface for the definition of a problem
+ * (see pagmo::problem).
+ */
+template <typename T>
+class has_fitness_into
+{
+    template <typename U>
+    using fitness_into_t = decltype(
+        std::declval<const U &>().fitness_into(std::declval<const double *>(), std::declval<double *>()));
+    static const bool implementation_defined = std::is_same<void, detected_t<fitness_into_t, T>>::value;
+
+public:
+    /// Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool has_fitness_into<T>::value;
+
+/// Opt-in trait for the sharing of UDP instances.
+/**
+ * Specialise this type trait to derive from \p std::true_type in order to allow the copies of a pagmo::problem
+ * constructed from a UDP of type \p T to share the same UDP instance, rather than deep-copying it
+ * (see the copy constructor of pagmo::problem). The UDP instance is shared only if, in addition,
+ * its thread safety level is thread_safety::constant.
+ *
+ * A UDP should opt in only if its const methods do not modify its state and if it does not contain
+ * other pagmo::problem objects: the evaluation counters of an inner problem would otherwise
+ * be shared among all the copies of the outer problem. For this reason, none of the meta-problems
+ * provided by pagmo opts in.
+ */
+template <typename T>
+struct is_shareable_udp : std::false_type {
+};
+
 namespace detail
 {
 
@@ -521,6 +616,10 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner_base {
     virtual bool has_batch_fitness() const = 0;
     virtual vector_double gradient(const vector_double &) const = 0;
     virtual bool has_gradient() const = 0;
+    virtual std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const = 0;
+    virtual bool has_fitness_and_gradient() const = 0;
+    virtual void fitness_into(const double *, double *) const = 0;
+    virtual bool has_fitness_into() const = 0;
     virtual sparsity_pattern gradient_sparsity() const = 0;
     virtual bool has_gradient_sparsity() const = 0;
     virtual std::vector<vector_double> hessians(const vector_double &) const = 0;
@@ -537,12 +636,33 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner_base {
     virtual std::string get_name() const = 0;
     virtual std::string get_extra_info() const = 0;
     virtual thread_safety get_thread_safety() const = 0;
+    virtual bool is_shareable() const = 0;
     template <typename Archive>
     void serialize(Archive &, unsigned)
     {
     }
 };
 
+// Helper to save a UDP via a plain pointer.
+// NOTE: the UDP used to be stored in a std::unique_ptr. This wrapper is
+// serialised exactly like a std::unique_ptr, so that the archive format
+// is preserved.
+struct prob_inner_ptr_saver {
+    template <typename Archive>
+    void save(Archive &ar, unsigned) const
+    {
+        ar << m_ptr;
+    }
+    template <typename Archive>
+    void load(Archive &, unsigned)
+    {
+        assert(false);
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+    const prob_inner_base *m_ptr;
+};
+
 template <typename T>
 struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner final : prob_inner_base {
     // We just need the def ctor, delete everything else.
@@ -589,6 +709,22 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner final : prob_inner_base {
     {
         return has_gradient_impl(m_value);
     }
+    virtual std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &dv) const override final
+    {
+        return fitness_and_gradient_impl(m_value, dv);
+    }
+    virtual bool has_fitness_and_gradient() const override final
+    {
+        return has_fitness_and_gradient_impl(m_value);
+    }
+    virtual void fitness_into(const double *dv, double *fv) const override final
+    {
+        fitness_into_impl(m_value, dv, fv);
+    }
+    virtual bool has_fitness_into() const override final
+    {
+        return pagmo::has_fitness_into<T>::value;
+    }
     virtual sparsity_pattern gradient_sparsity() const override final
     {
         return gradient_sparsity_impl(m_value);
@@ -645,6 +781,10 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner final : prob_inner_base {
     {
         return get_thread_safety_impl(m_value);
     }
+    virtual bool is_shareable() const override final
+    {
+        return pagmo::is_shareable_udp<T>::value;
+    }
     // Implementation of the optional methods.
     template <typename U, enable_if_t<pagmo::has_batch_fitness<U>::value, int> = 0>
     static vector_double batch_fitness_impl(const U &value, const vector_double &dv)
@@ -718,6 +858,51 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS prob_inner final : prob_inner_base {
     {
         return false;
     }
+    template <typename U, enable_if_t<pagmo::has_fitness_and_gradient<U>::value, int> = 0>
+    static std::pair<vector_double, vector_double> fitness_and_gradient_impl(const U &value, const vector_double &dv)
+    {
+        return value.fitness_and_gradient(dv);
+    }
+    template <typename U, enable_if_t<!pagmo::has_fitness_and_gradient<U>::value, int> = 0>
+    [[noreturn]] static std::pair<vector_double, vector_double> fitness_and_gradient_impl(const U &value,
+                                                                                         const vector_double &)
+    {
+        pagmo_throw(not_implemented_error,
+                    "The fitness_and_gradient() method has been invoked, but it is not implemented in a UDP of type '"
+                        + get_name_impl(value) + "'");
+    }
+    template <typename U, enable_if_t<detail::conjunction<pagmo::has_fitness_and_gradient<U>,
+                                                          pagmo::override_has_fitness_and_gradient<U>>::value,
+                                      int> = 0>
+    static bool has_fitness_and_gradient_impl(const U &p)
+    {
+        return p.has_fitness_and_gradient();
+    }
+    template <typename U,
+              enable_if_t<detail::conjunction<pagmo::has_fitness_and_gradient<U>,
+                                              detail::negation<pagmo::override_has_fitness_and_gradient<U>>>::value,
+                          int> = 0>
+    static bool has_fitness_and_gradient_impl(const U &)
+    {
+        return true;
+    }
+    template <typename U, enable_if_t<!pagmo::has_fitness_and_gradient<U>::value, int> = 0>
+    static bool has_fitness_and_gradient_impl(const U &)
+    {
+        return false;
+    }
+    template <typename U, enable_if_t<pagmo::has_fitness_into<U>::value, int> = 0>
+    static void fitness_into_impl(const U &value, const double *dv, double *fv)
+    {
+        value.fitness_into(dv, fv);
+    }
+    template <typename U, enable_if_t<!pagmo::has_fitness_into<U>::value, int> = 0>
+    [[noreturn]] static void fitness_into_impl(const U &value, const double *, double *)
+    {
+        pagmo_throw(not_implemented_error,
+                    "The fitness_into() method has been invoked, but it is not implemented in a UDP of type '"
+                        + get_name_impl(value) + "'");
+    }
     template <typename U, enable_if_t<pagmo::has_gradient_sparsity<U>::value, int> = 0>
     static sparsity_pattern gradient_sparsity_impl(const U &p)
     {
@@ -955,6 +1140,8 @@ namespace detail
 PAGMO_DLL_PUBLIC void prob_check_dv(const problem &, const double *, vector_double::size_type);
 PAGMO_DLL_PUBLIC void prob_check_fv(const problem &, const double *, vector_double::size_type);
 PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_batch_fitness(const problem &, const vector_double &);
+PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_fitness(const problem &, const vector_double &);
+PAGMO_DLL_PUBLIC void prob_invoke_mem_fitness_into(const problem &, const double *, double *);
 
 } // namespace detail
 
@@ -1017,6 +1204,9 @@ PAGMO_DLL_PUBLIC vector_double prob_invoke_mem_batch_fitness(const problem &, co
  * bool has_batch_fitness() const;
  * bool has_gradient() const;
  * vector_double gradient(const vector_double &) const;
+ * bool has_fitness_and_gradient() const;
+ * std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const;
+ * void fitness_into(const double *, double *) const;
  * bool has_gradient_sparsity() const;
  * sparsity_pattern gradient_sparsity() const;
  * bool has_hessians() const;
@@ -1089,14 +1279,15 @@ public:
      * - the <tt>%gradient_sparsity()</tt> and <tt>%hessians_sparsity()</tt> methods of the UDP fail basic sanity checks
      *   (e.g., they return vectors with repeated indices, they contain indices exceeding the problem's dimensions,
      *   etc.).
-     * - the integer part of the problem is larger than the problem size.
+     * - the integer part of the problem is larger than the problem size,
+     * - the UDP provides a fused fitness and gradient computation (see problem::has_fitness_and_gradient()),
+     *   but it does not provide the gradient (see problem::has_gradient()).
      * @throws unspecified any exception thrown by methods of the UDP invoked during construction or by memory errors
      * in strings and standard containers.
      */
     template <typename T, generic_ctor_enabler<T> = 0>
     explicit problem(T &&x)
-        : m_ptr(detail::make_unique<detail::prob_inner<uncvref_t<T>>>(std::forward<T>(x))), m_fevals(0u), m_gevals(0u),
-          m_hevals(0u)
+        : m_ptr(detail::make_unique<detail::prob_inner<uncvref_t<T>>>(std::forward<T>(x)))
     {
         generic_ctor_impl();
     }
@@ -1177,14 +1368,26 @@ public:
      *    The ability to extract a mutable pointer is provided only in order to allow to call non-const
      *    methods on the internal UDP instance. Assigning a new UDP via this pointer is undefined behaviour.
      *
+     * .. note::
+     *
+     *    If the internal UDP instance is shared with other problems (see the copy constructor),
+     *    this method will first replace it with a private copy, so that the
+     *    modifications made via the returned pointer are not visible from the other problems.
+     *
+     * .. versionchanged:: 2.12
+     *
+     *    This method is not ``noexcept`` any more, as it might need to copy the internal UDP.
+     *
      * \endverbatim
      *
      * @return a pointer to the internal UDP, or \p nullptr
      * if \p T does not correspond exactly to the original UDP type used
      * in the constructor.
+     *
+     * @throws unspecified any exception thrown by the copying of the internal UDP.
      */
     template <typename T>
-    T *extract() noexcept
+    T *extract()
     {
         auto p = dynamic_cast<detail::prob_inner<T> *>(ptr());
         return p == nullptr ? nullptr : &(p->m_value);
@@ -1203,10 +1406,24 @@ public:
     // Fitness.
     vector_double fitness(const vector_double &) const;
 
+    // Fitness into a caller-provided vector.
+    void fitness_into(const vector_double &, vector_double &) const;
+
+    /// Check if the UDP can write the fitness into a caller-provided buffer.
+    /**
+     * @return \p true if the UDP satisfies pagmo::has_fitness_into, \p false otherwise.
+     */
+    bool has_fitness_into() const
+    {
+        return m_has_fitness_into;
+    }
+
 private:
 #if !defined(PAGMO_DOXYGEN_INVOKED)
-    // Make friends with the batch_fitness() invocation helper.
+    // Make friends with the fitness()/batch_fitness() invocation helpers.
     friend PAGMO_DLL_PUBLIC vector_double detail::prob_invoke_mem_batch_fitness(const problem &, const vector_double &);
+    friend PAGMO_DLL_PUBLIC vector_double detail::prob_invoke_mem_fitness(const problem &, const vector_double &);
+    friend PAGMO_DLL_PUBLIC void detail::prob_invoke_mem_fitness_into(const problem &, const double *, double *);
 #endif
 
 public:
@@ -1258,6 +1475,28 @@ public:
         return m_has_gradient;
     }
 
+    // Fitness and gradient.
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const;
+
+    /// Check if the UDP can compute the fitness and the gradient in a single call.
+    /**
+     * This method will return \p true if the UDP provides a fused <tt>%fitness_and_gradient()</tt> method,
+     * \p false otherwise.
+     *
+     * The availability of the fused method is determined as follows:
+     * - if the UDP does not satisfy pagmo::has_fitness_and_gradient, then this method will always return \p false;
+     * - if the UDP satisfies pagmo::has_fitness_and_gradient but it does not satisfy
+     *   pagmo::override_has_fitness_and_gradient, then this method will always return \p true;
+     * - if the UDP satisfies both pagmo::has_fitness_and_gradient and pagmo::override_has_fitness_and_gradient,
+     *   then this method will return the output of the <tt>%has_fitness_and_gradient()</tt> method of the UDP.
+     *
+     * @return a flag signalling the availability of the fused fitness and gradient computation in the UDP.
+     */
+    bool has_fitness_and_gradient() const
+    {
+        return m_has_fitness_and_gradient;
+    }
+
     // Gradient sparsity pattern.
     sparsity_pattern gradient_sparsity() const;
 
@@ -1481,7 +1720,7 @@ public:
      */
     unsigned long long get_fevals() const
     {
-        return m_fevals.load(std::memory_order_relaxed);
+        return m_evals.load(detail::eval_counters::fevals);
     }
 
     /// Increment the number of fitness evaluations.
@@ -1492,7 +1731,7 @@ public:
      */
     void increment_fevals(unsigned long long n) const
     {
-        m_fevals.fetch_add(n, std::memory_order_relaxed);
+        m_evals.increment(detail::eval_counters::fevals, n);
     }
 
     /// Number of gradient evaluations.
@@ -1505,7 +1744,7 @@ public:
      */
     unsigned long long get_gevals() const
     {
-        return m_gevals.load(std::memory_order_relaxed);
+        return m_evals.load(detail::eval_counters::gevals);
     }
 
     /// Number of hessians evaluations.
@@ -1518,7 +1757,7 @@ public:
      */
     unsigned long long get_hevals() const
     {
-        return m_hevals.load(std::memory_order_relaxed);
+        return m_evals.load(detail::eval_counters::hevals);
     }
 
     // Set the seed for the stochastic variables.
@@ -1600,9 +1839,8 @@ public:
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
-        detail::to_archive(ar, m_ptr, m_fevals.load(std::memory_order_relaxed),
-                           m_gevals.load(std::memory_order_relaxed), m_hevals.load(std::memory_order_relaxed), m_lb,
-                           m_ub, m_nobj, m_nec, m_nic, m_nix, m_c_tol, m_has_batch_fitness, m_has_gradient,
+        detail::to_archive(ar, detail::prob_inner_ptr_saver{m_ptr.get()}, get_fevals(), get_gevals(), get_hevals(),
+                           m_lb, m_ub, m_nobj, m_nec, m_nic, m_nix, m_c_tol, m_has_batch_fitness, m_has_gradient,
                            m_has_gradient_sparsity, m_has_hessians, m_has_hessians_sparsity, m_has_set_seed, m_name,
                            m_gs_dim, m_hs_dim, m_thread_safety);
     }
@@ -1620,15 +1858,19 @@ public:
     {
         // Deserialize in a separate object and move it in later, for exception safety.
         problem tmp_prob;
+        std::unique_ptr<detail::prob_inner_base> tmp_ptr;
         unsigned long long fevals, gevals, hevals;
-        detail::from_archive(ar, tmp_prob.m_ptr, fevals, gevals, hevals, tmp_prob.m_lb, tmp_prob.m_ub, tmp_prob.m_nobj,
+        detail::from_archive(ar, tmp_ptr, fevals, gevals, hevals, tmp_prob.m_lb, tmp_prob.m_ub, tmp_prob.m_nobj,
                              tmp_prob.m_nec, tmp_prob.m_nic, tmp_prob.m_nix, tmp_prob.m_c_tol,
                              tmp_prob.m_has_batch_fitness, tmp_prob.m_has_gradient, tmp_prob.m_has_gradient_sparsity,
                              tmp_prob.m_has_hessians, tmp_prob.m_has_hessians_sparsity, tmp_prob.m_has_set_seed,
                              tmp_prob.m_name, tmp_prob.m_gs_dim, tmp_prob.m_hs_dim, tmp_prob.m_thread_safety);
-        tmp_prob.m_fevals.store(fevals, std::memory_order_relaxed);
-        tmp_prob.m_gevals.store(gevals, std::memory_order_relaxed);
-        tmp_prob.m_hevals.store(hevals, std::memory_order_relaxed);
+        // NOTE: the availability of fitness_into() and fitness_and_gradient() is not
+        // part of the archive, it is recovered from the deserialized UDP.
+        tmp_prob.m_has_fitness_and_gradient = tmp_ptr->has_fitness_and_gradient();
+        tmp_prob.m_has_fitness_into = tmp_ptr->has_fitness_into();
+        tmp_prob.m_ptr = std::move(tmp_ptr);
+        tmp_prob.m_evals.store(fevals, gevals, hevals);
         *this = std::move(tmp_prob);
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
@@ -1641,9 +1883,15 @@ private:
         assert(m_ptr.get() != nullptr);
         return m_ptr.get();
     }
+    // NOTE: the UDP instance might be shared with other problems (see
+    // the copy constructor). Before handing out mutable access to it,
+    // make sure we own a private copy (copy-on-write).
     detail::prob_inner_base *ptr()
     {
         assert(m_ptr.get() != nullptr);
+        if (m_ptr.use_count() > 1) {
+            m_ptr = m_ptr->clone();
+        }
         return m_ptr.get();
     }
 
@@ -1654,14 +1902,15 @@ private:
     void check_hessians_vector(const std::vector<vector_double> &) const;
 
 private:
-    // Pointer to the inner base problem
-    std::unique_ptr<detail::prob_inner_base> m_ptr;
-    // Counter for calls to the fitness
-    mutable std::atomic<unsigned long long> m_fevals;
-    // Counter for calls to the gradient
-    mutable std::atomic<unsigned long long> m_gevals;
-    // Counter for calls to the hessians
-    mutable std::atomic<unsigned long long> m_hevals;
+    // Pointer to the inner base problem.
+    // NOTE: if the UDP opts in via is_shareable_udp and provides
+    // the constant thread safety guarantee, the pointee is shared
+    // among the copies of the problem.
+    std::shared_ptr<detail::prob_inner_base> m_ptr;
+    // Counters for calls to the fitness, gradient and hessians.
+    // NOTE: these are sharded per thread, so that concurrent evaluations
+    // from multiple threads do not contend for the same cache line.
+    detail::eval_counters m_evals;
     // Various problem properties determined at construction time
     // from the concrete problem. These will be constant for the lifetime
     // of problem, but we cannot mark them as such because we want to be
@@ -1675,6 +1924,8 @@ private:
     vector_double m_c_tol;
     bool m_has_batch_fitness;
     bool m_has_gradient;
+    bool m_has_fitness_and_gradient;
+    bool m_has_fitness_into;
     bool m_has_gradient_sparsity;
     bool m_has_hessians;
     bool m_has_hessians_sparsity;
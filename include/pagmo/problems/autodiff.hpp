@@ -0,0 +1,435 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_PROBLEMS_AUTODIFF_HPP
+#define PAGMO_PROBLEMS_AUTODIFF_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/type_traits.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/dual.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Detect a fitness function accepting and returning
+// vectors of the scalar type S.
+template <typename T, typename S>
+class has_scalar_fitness
+{
+    template <typename U>
+    using fitness_t = decltype(std::declval<const U &>().fitness(std::declval<const std::vector<S> &>()));
+    static const bool implementation_defined = std::is_same<std::vector<S>, detected_t<fitness_t, T>>::value;
+
+public:
+    static const bool value = implementation_defined;
+};
+
+template <typename T, typename S>
+const bool has_scalar_fitness<T, S>::value;
+
+} // namespace detail
+
+/// The automatic differentiation meta-problem.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This meta-problem provides exact gradients (and, optionally, exact hessians) for a UDP of type \p T
+ * whose fitness function is a template over the scalar type, that is, a UDP providing a member function
+ * of the form
+ * @code{.unparsed}
+ * template <typename S>
+ * std::vector<S> fitness(const std::vector<S> &) const;
+ * @endcode
+ *
+ * The derivatives are computed via forward-mode automatic differentiation, by evaluating the fitness
+ * function of \p T on pagmo::dual numbers carrying \p N directional derivatives at a time.
+ * The gradient of a problem of dimension \f$ n \f$ thus requires
+ * \f$ \left\lceil n / N \right\rceil \f$ fitness evaluations on dual numbers (rather than the \f$ 2n \f$
+ * fitness evaluations of a central finite difference estimate), and the hessians require
+ * \f$ m \left( m + 1 \right) / 2 \f$ fitness evaluations on nested dual numbers, where
+ * \f$ m = \left\lceil n / N \right\rceil \f$.
+ *
+ * The gradient and hessians sparsity patterns are those of \p T, if available, and dense otherwise.
+ * All the other properties of the problem are those of \p T.
+ */
+template <typename T, std::size_t N = 4>
+class autodiff
+{
+    static_assert(is_udp<T>::value, "The inner problem of autodiff must be a UDP.");
+    static_assert(detail::has_scalar_fitness<T, dual<double, N>>::value
+                      && detail::has_scalar_fitness<T, dual<dual<double, N>, N>>::value,
+                  "The inner problem of autodiff must provide a fitness function templated over the scalar type.");
+
+public:
+    /// The dual number type used for the computation of the gradient.
+    using dual_type = dual<double, N>;
+    /// The nested dual number type used for the computation of the hessians.
+    using dual2_type = dual<dual_type, N>;
+
+    /// Default constructor.
+    /**
+     * The inner problem is default-constructed, and the hessians are not computed.
+     *
+     * @throws unspecified any exception thrown by the other constructor.
+     */
+    autodiff() : autodiff(T{}) {}
+    /// Constructor from UDP.
+    /**
+     * @param p the inner UDP.
+     * @param with_hessians if \p true, the hessians will be computed via automatic differentiation,
+     * otherwise the problem will not provide the hessians.
+     *
+     * @throws unspecified any exception thrown by the constructor of pagmo::problem from \p p.
+     */
+    explicit autodiff(const T &p, bool with_hessians = false) : m_problem(p), m_with_hessians(with_hessians) {}
+
+    /// Fitness.
+    /**
+     * @param dv the input decision vector.
+     *
+     * @return the fitness of \p dv, as computed by the inner problem.
+     *
+     * @throws unspecified any exception thrown by pagmo::problem::fitness().
+     */
+    vector_double fitness(const vector_double &dv) const
+    {
+        return m_problem.fitness(dv);
+    }
+    /// Box-bounds.
+    /**
+     * @return the box bounds of the inner problem.
+     */
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return m_problem.get_bounds();
+    }
+    /// Number of objectives.
+    /**
+     * @return the number of objectives of the inner problem.
+     */
+    vector_double::size_type get_nobj() const
+    {
+        return m_problem.get_nobj();
+    }
+    /// Equality constraint dimension.
+    /**
+     * @return the number of equality constraints of the inner problem.
+     */
+    vector_double::size_type get_nec() const
+    {
+        return m_problem.get_nec();
+    }
+    /// Inequality constraint dimension.
+    /**
+     * @return the number of inequality constraints of the inner problem.
+     */
+    vector_double::size_type get_nic() const
+    {
+        return m_problem.get_nic();
+    }
+    /// Integer dimension.
+    /**
+     * @return the integer dimension of the inner problem.
+     */
+    vector_double::size_type get_nix() const
+    {
+        return m_problem.get_nix();
+    }
+
+    /// Gradient.
+    /**
+     * The Jacobian of the fitness function is computed column-wise, in chunks of \p N columns,
+     * and the elements corresponding to gradient_sparsity() are returned.
+     *
+     * @param dv the input decision vector.
+     *
+     * @return the gradient of the fitness function of the inner problem in \p dv.
+     *
+     * @throws std::invalid_argument if the fitness function of the inner problem returns a vector
+     * with the wrong size.
+     * @throws std::overflow_error in case of (unlikely) overflows.
+     * @throws unspecified any exception thrown by the fitness function of the inner problem, or by memory errors
+     * in standard containers.
+     */
+    vector_double gradient(const vector_double &dv) const
+    {
+        const auto nx = dv.size(), nf = m_problem.get_nf();
+        check_size(nx, nf);
+        const auto &p = udp();
+
+        // Dense Jacobian, in row-major order.
+        vector_double jac(nf * nx);
+        std::vector<dual_type> x(dv.begin(), dv.end());
+        for (decltype(dv.size()) c = 0; c < nx; c += N) {
+            const auto n_dir = std::min(static_cast<decltype(dv.size())>(N), nx - c);
+            // Seed the directions of the current chunk of columns.
+            for (decltype(dv.size()) k = 0; k < n_dir; ++k) {
+                x[c + k].derivs()[k] = 1.;
+            }
+            const auto f = p.fitness(x);
+            check_fitness(f.size(), nf);
+            for (decltype(dv.size()) i = 0; i < nf; ++i) {
+                for (decltype(dv.size()) k = 0; k < n_dir; ++k) {
+                    jac[i * nx + c + k] = f[i].derivs()[k];
+                }
+            }
+            for (decltype(dv.size()) k = 0; k < n_dir; ++k) {
+                x[c + k].derivs()[k] = 0.;
+            }
+        }
+
+        const auto sp = m_problem.gradient_sparsity();
+        vector_double retval;
+        retval.reserve(sp.size());
+        for (const auto &e : sp) {
+            retval.push_back(jac[e.first * nx + e.second]);
+        }
+        return retval;
+    }
+    /// Gradient sparsity pattern.
+    /**
+     * @return the gradient sparsity pattern of the inner problem.
+     *
+     * @throws unspecified any exception thrown by pagmo::problem::gradient_sparsity().
+     */
+    sparsity_pattern gradient_sparsity() const
+    {
+        return m_problem.gradient_sparsity();
+    }
+
+    /// Hessians.
+    /**
+     * The lower triangles of the hessians of the components of the fitness function are computed blockwise,
+     * in blocks of \p N rows and \p N columns, and the elements corresponding to hessians_sparsity() are returned.
+     *
+     * @param dv the input decision vector.
+     *
+     * @return the hessians of the fitness function of the inner problem in \p dv.
+     *
+     * @throws std::invalid_argument if the fitness function of the inner problem returns a vector
+     * with the wrong size.
+     * @throws std::overflow_error in case of (unlikely) overflows.
+     * @throws unspecified any exception thrown by the fitness function of the inner problem, or by memory errors
+     * in standard containers.
+     */
+    std::vector<vector_double> hessians(const vector_double &dv) const
+    {
+        const auto nx = dv.size(), nf = m_problem.get_nf();
+        check_size(nx, nx);
+        const auto &p = udp();
+
+        // Dense hessians, in row-major order. Only the lower triangles are computed.
+        std::vector<vector_double> hs(nf, vector_double(nx * nx));
+        std::vector<dual2_type> x;
+        x.reserve(nx);
+        for (auto v : dv) {
+            x.emplace_back(dual_type(v));
+        }
+        for (decltype(dv.size()) r = 0; r < nx; r += N) {
+            const auto n_rdir = std::min(static_cast<decltype(dv.size())>(N), nx - r);
+            // Seed the outer directions (rows).
+            for (decltype(dv.size()) a = 0; a < n_rdir; ++a) {
+                x[r + a].derivs()[a] = dual_type(1.);
+            }
+            for (decltype(dv.size()) c = 0; c <= r; c += N) {
+                const auto n_cdir = std::min(static_cast<decltype(dv.size())>(N), nx - c);
+                // Seed the inner directions (columns).
+                for (decltype(dv.size()) b = 0; b < n_cdir; ++b) {
+                    x[c + b].value().derivs()[b] = 1.;
+                }
+                const auto f = p.fitness(x);
+                check_fitness(f.size(), nf);
+                for (decltype(dv.size()) l = 0; l < nf; ++l) {
+                    for (decltype(dv.size()) a = 0; a < n_rdir; ++a) {
+                        for (decltype(dv.size()) b = 0; b < n_cdir; ++b) {
+                            hs[l][(r + a) * nx + c + b] = f[l].derivs()[a].derivs()[b];
+                        }
+                    }
+                }
+                for (decltype(dv.size()) b = 0; b < n_cdir; ++b) {
+                    x[c + b].value().derivs()[b] = 0.;
+                }
+            }
+            for (decltype(dv.size()) a = 0; a < n_rdir; ++a) {
+                x[r + a].derivs()[a] = dual_type(0.);
+            }
+        }
+
+        const auto sps = m_problem.hessians_sparsity();
+        std::vector<vector_double> retval(nf);
+        for (decltype(dv.size()) l = 0; l < nf; ++l) {
+            retval[l].reserve(sps[l].size());
+            for (const auto &e : sps[l]) {
+                retval[l].push_back(hs[l][e.first * nx + e.second]);
+            }
+        }
+        return retval;
+    }
+    /// Check if the hessians are available.
+    /**
+     * @return the \p with_hessians flag used on construction.
+     */
+    bool has_hessians() const
+    {
+        return m_with_hessians;
+    }
+    /// Hessians sparsity pattern.
+    /**
+     * @return the hessians sparsity pattern of the inner problem.
+     *
+     * @throws unspecified any exception thrown by pagmo::problem::hessians_sparsity().
+     */
+    std::vector<sparsity_pattern> hessians_sparsity() const
+    {
+        return m_problem.hessians_sparsity();
+    }
+    /// Check if the hessians sparsity is available.
+    /**
+     * @return the \p with_hessians flag used on construction.
+     */
+    bool has_hessians_sparsity() const
+    {
+        return m_with_hessians;
+    }
+
+    /// Set the seed of the inner problem.
+    /**
+     * @param seed the desired seed.
+     *
+     * @throws unspecified any exception thrown by pagmo::problem::set_seed().
+     */
+    void set_seed(unsigned seed)
+    {
+        m_problem.set_seed(seed);
+    }
+    /// Check if the inner problem is stochastic.
+    /**
+     * @return the output of pagmo::problem::has_set_seed() for the inner problem.
+     */
+    bool has_set_seed() const
+    {
+        return m_problem.has_set_seed();
+    }
+    /// Problem name.
+    /**
+     * @return the name of the inner problem, with an added suffix.
+     */
+    std::string get_name() const
+    {
+        return m_problem.get_name() + " [autodiff]";
+    }
+    /// Extra info.
+    /**
+     * @return the extra info of the inner problem, with the number of directions of the dual numbers.
+     */
+    std::string get_extra_info() const
+    {
+        return m_problem.get_extra_info() + "\n\tAutomatic differentiation directions: " + std::to_string(N)
+               + "\n\tHessians: " + (m_with_hessians ? "true" : "false") + "\n";
+    }
+    /// Thread safety level.
+    /**
+     * @return the thread safety level of the inner problem.
+     */
+    thread_safety get_thread_safety() const
+    {
+        return m_problem.get_thread_safety();
+    }
+    /// Getter for the inner problem.
+    /**
+     * @return a const reference to the inner pagmo::problem.
+     */
+    const problem &get_inner_problem() const
+    {
+        return m_problem;
+    }
+
+    /// Serialization support.
+    /**
+     * @param ar the target archive.
+     *
+     * @throws unspecified any exception thrown by the serialization of the inner problem and of primitive types.
+     */
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned)
+    {
+        detail::archive(ar, m_problem, m_with_hessians);
+    }
+
+private:
+    // NOTE: the inner problem is constructed from a T,
+    // thus the extraction never fails.
+    const T &udp() const
+    {
+        return *m_problem.extract<T>();
+    }
+    static void check_size(vector_double::size_type a, vector_double::size_type b)
+    {
+        // LCOV_EXCL_START
+        if (b && a > std::numeric_limits<vector_double::size_type>::max() / b) {
+            pagmo_throw(std::overflow_error,
+                        "Overflow detected in the computation of the size of a Jacobian or hessian in autodiff");
+        }
+        // LCOV_EXCL_STOP
+    }
+    void check_fitness(vector_double::size_type s, vector_double::size_type nf) const
+    {
+        if (s != nf) {
+            pagmo_throw(std::invalid_argument, "The fitness function of the problem '" + m_problem.get_name()
+                                                   + "' returned a vector of size " + std::to_string(s)
+                                                   + " when evaluated on dual numbers, but the fitness dimension is "
+                                                   + std::to_string(nf));
+        }
+    }
+
+    problem m_problem;
+    bool m_with_hessians;
+};
+
+} // namespace pagmo
+
+#endif
@@ -37,12 +37,14 @@ see https://www.gnu.org/licenses/. */
 
 #endif
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
 namespace pagmo
@@ -65,6 +67,12 @@ namespace pagmo
  *
  *    All problems are box-bounded, continuous, single objective problems.
  *
+ * .. note::
+ *
+ *    The rotation and shift data of the problems are immutable and shared among all the
+ *    instances. Copying and serialising a :cpp:class:`~pagmo::cec2013` object thus does not
+ *    involve copying such data.
+ *
  * .. seealso:
  *
  *    http://www.ntu.edu.sg/home/EPNSugan/index_files/CEC2013/CEC2013.htm
@@ -92,9 +100,35 @@ public:
     std::pair<vector_double, vector_double> get_bounds() const;
     // Problem name
     std::string get_name() const;
+
+    /// Returns the origin shift
+    /**
+     * This method will return the origin shift.
+     *
+     * @return The origin shift.
+     */
+    const vector_double &get_origin_shift() const
+    {
+        return *m_origin_shift;
+    }
+
+    /// Returns the rotation matrix
+    /**
+     * This method will return the rotation matrix.
+     *
+     * @return The rotation matrix.
+     */
+    const vector_double &get_rotation_matrix() const
+    {
+        return *m_rotation_matrix;
+    }
+
     // Object serialization
     template <typename Archive>
-    void serialize(Archive &, unsigned);
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 
 private:
     PAGMO_DLL_LOCAL void sphere_func(const double *x, double *f, const unsigned nx, const double *Os, const double *Mr,
@@ -156,9 +190,9 @@ private:
 
     // problem id
     unsigned m_prob_id;
-    // problem data
-    std::vector<double> m_rotation_matrix;
-    std::vector<double> m_origin_shift;
+    // problem data (shared and immutable)
+    std::shared_ptr<const std::vector<double>> m_rotation_matrix;
+    std::shared_ptr<const std::vector<double>> m_origin_shift;
 
     // pre-allocated stuff for speed
     mutable std::vector<double> m_y;
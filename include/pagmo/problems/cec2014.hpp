@@ -42,12 +42,14 @@ see https://www.gnu.org/licenses/. */
 
 #endif
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
 namespace pagmo
@@ -70,6 +72,12 @@ namespace pagmo
  *
  *    All problems are box-bounded, continuous, single objective problems.
  *
+ * .. note::
+ *
+ *    The rotation, shift and shuffle data of the problems are immutable and shared among all the
+ *    instances with the same problem id and dimension. Copying and serialising a
+ *    :cpp:class:`~pagmo::cec2014` object thus does not involve copying such data.
+ *
  * .. seealso:
  *
  *    http://www.ntu.edu.sg/home/EPNSugan/index_files/CEC2014/CEC2014.htm
@@ -99,6 +107,9 @@ public:
     // Fitness computation
     vector_double fitness(const vector_double &) const;
 
+    // Batch fitness computation
+    vector_double batch_fitness(const vector_double &) const;
+
     // Problem name
     std::string get_name() const;
 
@@ -110,14 +121,18 @@ public:
      */
     const vector_double &get_origin_shift() const
     {
-        return m_origin_shift;
+        return *m_origin_shift;
     }
 
     // Object serialization
     template <typename Archive>
-    void serialize(Archive &, unsigned);
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 
 private:
+    PAGMO_DLL_LOCAL void fitness_impl(const double *x, double *f, bool pre_transformed) const;
     /* Sphere */
     PAGMO_DLL_LOCAL void sphere_func(const double *x, double *f, const unsigned nx, const double *Os, const double *Mr,
                                      int s_flag, int r_flag) const;
@@ -229,10 +244,10 @@ private:
     PAGMO_DLL_LOCAL void cf_cal(const double *x, double *f, const unsigned nx, const double *Os, double *delta,
                                 double *bias, double *fit, int cf_num) const;
 
-    // problem data
-    vector_double m_origin_shift;
-    vector_double m_rotation_matrix;
-    std::vector<int> m_shuffle;
+    // problem data (shared and immutable)
+    std::shared_ptr<const vector_double> m_origin_shift;
+    std::shared_ptr<const vector_double> m_rotation_matrix;
+    std::shared_ptr<const std::vector<int>> m_shuffle;
 
     // auxiliary vectors
     mutable vector_double m_z;
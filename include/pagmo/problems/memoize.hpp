@@ -0,0 +1,250 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_PROBLEMS_MEMOIZE_HPP
+#define PAGMO_PROBLEMS_MEMOIZE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/type_traits.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+// Forward declaration of the LRU cache used by memoize.
+struct memoize_cache;
+
+} // namespace detail
+
+/// The memoize meta-problem.
+/**
+ * This meta-problem wraps a user-defined problem and stores, in a bounded least-recently-used (LRU) cache,
+ * the fitness vectors (and optionally the gradients) computed by the inner problem. When a decision vector
+ * already present in the cache is evaluated again, the stored result is returned without invoking
+ * the inner problem.
+ *
+ * The cache is shared among copies of a pagmo::memoize object and it is protected by a mutex, so that
+ * it can be safely used from multiple threads (e.g., by pagmo::thread_bfe or by the islands of a pagmo::archipelago).
+ * The thread safety level of pagmo::memoize is the one of the inner problem.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    This meta-problem is useful when the evaluation of the fitness is expensive and the same decision vectors
+ *    are evaluated repeatedly (e.g., by local optimisers or by restarting algorithms). For cheap fitness
+ *    functions, the overhead of the cache lookup will likely outweigh the benefits.
+ *
+ * .. note::
+ *
+ *    The counters of fitness evaluations of the outer :cpp:class:`pagmo::problem` will count all the
+ *    fitness evaluations, including those served by the cache, while the counters of the inner problem will
+ *    count only the evaluations actually performed.
+ *
+ * .. warning::
+ *
+ *    Calling :cpp:func:`pagmo::memoize::set_seed()` or the non-const overload of
+ *    :cpp:func:`pagmo::memoize::get_inner_problem()` detaches the cache of this object from its copies
+ *    and empties it, as the results computed by the inner problem might not be valid anymore.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC memoize
+{
+public:
+    // Default constructor.
+    memoize();
+
+private:
+    // Enabler for the ctor from UDP or problem. In this case we also allow construction from type problem.
+    template <typename T>
+    using ctor_enabler = enable_if_t<std::is_constructible<problem, T &&>::value, int>;
+    // Implementation of the generic ctor.
+    void generic_ctor_impl();
+
+public:
+    /// Constructor from problem.
+    /**
+     * \verbatim embed:rst:leading-asterisk
+     * .. note::
+     *
+     *    This constructor is enabled only if ``T`` can be used to construct a :cpp:class:`pagmo::problem`.
+     *
+     * \endverbatim
+     *
+     * Wraps a user-defined problem so that its fitness (and, optionally, its gradient) will be cached.
+     *
+     * @param p a pagmo::problem or a user-defined problem (UDP).
+     * @param capacity the maximum number of entries stored in the cache(s).
+     * @param cache_gradient if \p true, also the gradients computed by the inner problem will be cached.
+     *
+     * @throws std::invalid_argument if \p capacity is zero.
+     * @throws unspecified any exception thrown by the pagmo::problem constructor, or by memory errors
+     * in standard containers.
+     */
+    template <typename T, ctor_enabler<T> = 0>
+    explicit memoize(T &&p, std::size_t capacity = 1000u, bool cache_gradient = false)
+        : m_problem(std::forward<T>(p)), m_capacity(capacity), m_cache_gradient(cache_gradient)
+    {
+        generic_ctor_impl();
+    }
+
+    // Fitness.
+    vector_double fitness(const vector_double &) const;
+
+    // Batch fitness.
+    vector_double batch_fitness(const vector_double &) const;
+
+    // Check if the inner problem can compute fitnesses in batch mode.
+    bool has_batch_fitness() const;
+
+    // Box-bounds.
+    std::pair<vector_double, vector_double> get_bounds() const;
+
+    // Number of objectives.
+    vector_double::size_type get_nobj() const;
+
+    // Equality constraint dimension.
+    vector_double::size_type get_nec() const;
+
+    // Inequality constraint dimension.
+    vector_double::size_type get_nic() const;
+
+    // Integer dimension
+    vector_double::size_type get_nix() const;
+
+    // Checks if the inner problem has gradients.
+    bool has_gradient() const;
+
+    // Gradients.
+    vector_double gradient(const vector_double &) const;
+
+    // Checks if the inner problem has a fused fitness and gradient computation.
+    bool has_fitness_and_gradient() const;
+
+    // Fitness and gradient.
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const;
+
+    // Checks if the inner problem has gradient sparisty implemented.
+    bool has_gradient_sparsity() const;
+
+    // Gradient sparsity.
+    sparsity_pattern gradient_sparsity() const;
+
+    // Checks if the inner problem has hessians.
+    bool has_hessians() const;
+
+    // Hessians.
+    std::vector<vector_double> hessians(const vector_double &) const;
+
+    // Checks if the inner problem has hessians sparisty implemented.
+    bool has_hessians_sparsity() const;
+
+    // Hessians sparsity.
+    std::vector<sparsity_pattern> hessians_sparsity() const;
+
+    // Calls <tt>has_set_seed()</tt> of the inner problem.
+    bool has_set_seed() const;
+
+    // Calls <tt>set_seed()</tt> of the inner problem.
+    void set_seed(unsigned);
+
+    // Problem name
+    std::string get_name() const;
+
+    // Extra info
+    std::string get_extra_info() const;
+
+    // Problem's thread safety level.
+    thread_safety get_thread_safety() const;
+
+    // Getter for the inner problem.
+    const problem &get_inner_problem() const;
+
+    // Getter for the inner problem.
+    problem &get_inner_problem();
+
+    // Cache capacity.
+    std::size_t get_capacity() const;
+
+    // Gradient caching flag.
+    bool get_cache_gradient() const;
+
+    // Number of fitness cache hits.
+    unsigned long long get_hits() const;
+
+    // Number of fitness cache misses.
+    unsigned long long get_misses() const;
+
+    // Number of gradient cache hits.
+    unsigned long long get_gradient_hits() const;
+
+    // Number of gradient cache misses.
+    unsigned long long get_gradient_misses() const;
+
+    // Number of entries currently stored in the fitness cache.
+    std::size_t get_cache_size() const;
+
+    // Clear the cache(s) and reset the counters.
+    void clear_cache();
+
+    // Object serialization
+    template <typename Archive>
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+private:
+    // Inner problem
+    problem m_problem;
+    // Max number of cached entries.
+    std::size_t m_capacity;
+    // Gradient caching flag.
+    bool m_cache_gradient;
+    // The cache (shared among copies).
+    std::shared_ptr<detail::memoize_cache> m_cache;
+};
+
+} // namespace pagmo
+
+PAGMO_S11N_PROBLEM_EXPORT_KEY(pagmo::memoize)
+
+#endif
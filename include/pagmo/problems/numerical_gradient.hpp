@@ -0,0 +1,193 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_PROBLEMS_NUMERICAL_GRADIENT_HPP
+#define PAGMO_PROBLEMS_NUMERICAL_GRADIENT_HPP
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pagmo/bfe.hpp>
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/type_traits.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+/// The numerical gradient meta-problem.
+/**
+ * This meta-problem equips an input problem with a gradient estimated numerically via central
+ * finite differences (see pagmo::estimate_gradient_batch() and pagmo::estimate_gradient_h_batch()).
+ * All the perturbed decision vectors required by the estimation of a gradient are assembled
+ * up front and evaluated in a single call to a pagmo::bfe, so that the estimation can be parallelised.
+ * pagmo::numerical_gradient objects can be used to optimise problems without an analytical gradient
+ * with gradient-based algorithms such as pagmo::nlopt and pagmo::ipopt.
+ *
+ * The gradient is assumed to be dense. The cost of the estimation of a gradient is \f$2n\f$
+ * (or \f$6n\f$, if the high-order formula is used) fitness evaluations, where \f$n\f$ is the dimension
+ * of the problem.
+ */
+class PAGMO_DLL_PUBLIC numerical_gradient
+{
+public:
+    // Default constructor.
+    numerical_gradient();
+
+private:
+    // Enabler for the ctor from UDP or problem. In this case we also allow construction from type problem.
+    template <typename T>
+    using ctor_enabler = enable_if_t<std::is_constructible<problem, T &&>::value, int>;
+    // Implementation of the generic ctor.
+    void generic_ctor_impl();
+
+public:
+    /// Constructor from problem.
+    /**
+     * \verbatim embed:rst:leading-asterisk
+     * .. note::
+     *
+     *    This constructor is enabled only if ``T`` can be used to construct a :cpp:class:`pagmo::problem`.
+     *
+     * \endverbatim
+     *
+     * Wraps a user-defined problem so that its gradient will be estimated numerically.
+     *
+     * @param p a pagmo::problem or a user-defined problem (UDP).
+     * @param dx the relative perturbation used in the finite differences (each component \f$x_i\f$ of the
+     * decision vector will be varied by \f$\max(|x_i|,1) * \f$ \p dx).
+     * @param high_order if \p true, the gradient will be estimated via the 6-point formula of
+     * pagmo::estimate_gradient_h_batch(), otherwise via the 2-point formula of pagmo::estimate_gradient_batch().
+     * @param b the pagmo::bfe that will be used to evaluate the perturbed decision vectors (by default,
+     * a pagmo::default_bfe).
+     *
+     * @throws std::invalid_argument if \p dx is not finite and positive.
+     * @throws unspecified any exception thrown by the pagmo::problem constructor, or by the copy
+     * constructor of pagmo::bfe.
+     */
+    template <typename T, ctor_enabler<T> = 0>
+    explicit numerical_gradient(T &&p, double dx = 1e-8, bool high_order = false, const bfe &b = bfe{})
+        : m_problem(std::forward<T>(p)), m_bfe(b), m_dx(dx), m_high_order(high_order)
+    {
+        generic_ctor_impl();
+    }
+
+    // Fitness.
+    vector_double fitness(const vector_double &) const;
+
+    // Batch fitness.
+    vector_double batch_fitness(const vector_double &) const;
+
+    // Check if the inner problem can compute fitnesses in batch mode.
+    bool has_batch_fitness() const;
+
+    // Box-bounds.
+    std::pair<vector_double, vector_double> get_bounds() const;
+
+    // Number of objectives.
+    vector_double::size_type get_nobj() const;
+
+    // Equality constraint dimension.
+    vector_double::size_type get_nec() const;
+
+    // Inequality constraint dimension.
+    vector_double::size_type get_nic() const;
+
+    // Integer dimension
+    vector_double::size_type get_nix() const;
+
+    // Numerical gradient.
+    vector_double gradient(const vector_double &) const;
+
+    // Checks if the inner problem has hessians.
+    bool has_hessians() const;
+
+    // Hessians.
+    std::vector<vector_double> hessians(const vector_double &) const;
+
+    // Checks if the inner problem has hessians sparisty implemented.
+    bool has_hessians_sparsity() const;
+
+    // Hessians sparsity.
+    std::vector<sparsity_pattern> hessians_sparsity() const;
+
+    // Calls <tt>has_set_seed()</tt> of the inner problem.
+    bool has_set_seed() const;
+
+    // Calls <tt>set_seed()</tt> of the inner problem.
+    void set_seed(unsigned);
+
+    // Problem name
+    std::string get_name() const;
+
+    // Extra info
+    std::string get_extra_info() const;
+
+    // Problem's thread safety level.
+    thread_safety get_thread_safety() const;
+
+    // Getter for the inner problem.
+    const problem &get_inner_problem() const;
+
+    // Getter for the inner problem.
+    problem &get_inner_problem();
+
+    // Getter for the bfe.
+    const bfe &get_bfe() const;
+
+    // Getter for the finite difference step.
+    double get_dx() const;
+
+    // Getter for the high-order flag.
+    bool get_high_order() const;
+
+    // Object serialization
+    template <typename Archive>
+    void serialize(Archive &, unsigned);
+
+private:
+    // Inner problem
+    problem m_problem;
+    // The bfe used to evaluate the perturbed dvs.
+    bfe m_bfe;
+    // Finite difference step.
+    double m_dx;
+    // High-order formula flag.
+    bool m_high_order;
+};
+
+} // namespace pagmo
+
+PAGMO_S11N_PROBLEM_EXPORT_KEY(pagmo::numerical_gradient)
+
+#endif
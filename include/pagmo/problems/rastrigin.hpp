@@ -75,6 +75,9 @@ struct PAGMO_DLL_PUBLIC rastrigin {
     // Fitness computation
     vector_double fitness(const vector_double &) const;
 
+    // Fitness computation into a caller-provided buffer
+    void fitness_into(const double *, double *) const;
+
     // Box-bounds
     std::pair<vector_double, vector_double> get_bounds() const;
 
@@ -63,6 +63,8 @@ struct PAGMO_DLL_PUBLIC rosenbrock {
     rosenbrock(vector_double::size_type dim = 2u);
     // Fitness computation
     vector_double fitness(const vector_double &) const;
+    // Fitness computation into a caller-provided buffer
+    void fitness_into(const double *, double *) const;
 
     // Box-bounds
     std::pair<vector_double, vector_double> get_bounds() const;
@@ -0,0 +1,406 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_PROBLEMS_STATIC_PROBLEM_HPP
+#define PAGMO_PROBLEMS_STATIC_PROBLEM_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/type_traits.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+/// Detect the fixed-dimension fitness function.
+/**
+ * This type trait will be \p true if \p T provides a member function with signature:
+ * @code{.unparsed}
+ * std::array<double, NF> fitness(const std::array<double, NX> &) const;
+ * @endcode
+ */
+template <typename T, std::size_t NX, std::size_t NF>
+class has_static_fitness
+{
+    template <typename U>
+    using fitness_t = decltype(std::declval<const U &>().fitness(std::declval<const std::array<double, NX> &>()));
+    static const bool implementation_defined = std::is_same<std::array<double, NF>, detected_t<fitness_t, T>>::value;
+
+public:
+    /// Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T, std::size_t NX, std::size_t NF>
+const bool has_static_fitness<T, NX, NF>::value;
+
+/// Detect the fixed-dimension bounds.
+/**
+ * This type trait will be \p true if \p T provides a member function with signature:
+ * @code{.unparsed}
+ * std::pair<std::array<double, NX>, std::array<double, NX>> get_bounds() const;
+ * @endcode
+ */
+template <typename T, std::size_t NX>
+class has_static_bounds
+{
+    template <typename U>
+    using get_bounds_t = decltype(std::declval<const U &>().get_bounds());
+    static const bool implementation_defined
+        = std::is_same<std::pair<std::array<double, NX>, std::array<double, NX>>, detected_t<get_bounds_t, T>>::value;
+
+public:
+    /// Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T, std::size_t NX>
+const bool has_static_bounds<T, NX>::value;
+
+/// The static problem meta-problem.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This meta-problem adapts a problem of fixed, compile-time dimensions \p NX (the dimension of the
+ * decision vector) and \p NF (the dimension of the fitness vector) to the dynamic UDP interface of
+ * pagmo::problem.
+ *
+ * The inner problem \p T is written against <tt>std::array</tt> rather than pagmo::vector_double.
+ * It must be default, copy and move constructible, and it must provide the following member functions:
+ * @code{.unparsed}
+ * std::array<double, NF> fitness(const std::array<double, NX> &) const;
+ * std::pair<std::array<double, NX>, std::array<double, NX>> get_bounds() const;
+ * @endcode
+ * It may also provide the <tt>get_nobj()</tt>, <tt>get_nec()</tt>, <tt>get_nic()</tt>, <tt>get_nix()</tt>,
+ * <tt>get_name()</tt> and <tt>get_thread_safety()</tt> member functions, with the same meaning as in a UDP.
+ * These are forwarded by pagmo::static_problem.
+ *
+ * The decision vectors are copied into stack-allocated arrays, and the fitness function of \p T is
+ * invoked directly, so that the compiler can inline it and unroll its loops. Fitness evaluations
+ * do not allocate memory when performed via pagmo::problem::fitness_into() or via pagmo::thread_bfe
+ * (which is the batch evaluator selected by pagmo::default_bfe, if the thread safety level of \p T is
+ * at least thread_safety::basic). Code that knows the type of the problem can also fetch the inner problem
+ * via pagmo::problem::extract() and evaluate <tt>std::array</tt> decision vectors directly.
+ */
+template <std::size_t NX, std::size_t NF, typename T>
+class static_problem
+{
+    static_assert(NX > 0u, "The dimension of a static_problem cannot be zero.");
+    static_assert(NF > 0u, "The fitness dimension of a static_problem cannot be zero.");
+    static_assert(std::is_same<T, uncvref_t<T>>::value && std::is_default_constructible<T>::value
+                      && std::is_copy_constructible<T>::value && std::is_move_constructible<T>::value
+                      && std::is_destructible<T>::value,
+                  "The inner problem of a static_problem must be default, copy and move constructible, and "
+                  "destructible.");
+    static_assert(has_static_fitness<T, NX, NF>::value,
+                  "The inner problem of a static_problem must provide a fitness() member function with the "
+                  "signature std::array<double, NF> fitness(const std::array<double, NX> &) const.");
+    static_assert(has_static_bounds<T, NX>::value,
+                  "The inner problem of a static_problem must provide a get_bounds() member function with the "
+                  "signature std::pair<std::array<double, NX>, std::array<double, NX>> get_bounds() const.");
+
+public:
+    /// The fixed-dimension decision vector type.
+    using x_type = std::array<double, NX>;
+    /// The fixed-dimension fitness vector type.
+    using f_type = std::array<double, NF>;
+
+    /// Default constructor.
+    /**
+     * The inner problem is default-constructed.
+     *
+     * @throws std::invalid_argument if the number of objectives of the inner problem is zero, or if the sum of
+     * the number of objectives and of the equality and inequality constraints of the inner problem differs
+     * from \p NF.
+     * @throws unspecified any exception thrown by the default constructor of \p T.
+     */
+    static_problem() : static_problem(T{}) {}
+    /// Constructor from inner problem.
+    /**
+     * @param p the inner problem.
+     *
+     * @throws std::invalid_argument if the number of objectives of \p p is zero, or if the sum of
+     * the number of objectives and of the equality and inequality constraints of \p p differs from \p NF.
+     * @throws unspecified any exception thrown by the copy constructor of \p T.
+     */
+    explicit static_problem(const T &p) : m_p(p)
+    {
+        check_nf();
+    }
+    /// Constructor from inner problem (move overload).
+    /**
+     * @param p the inner problem.
+     *
+     * @throws std::invalid_argument if the number of objectives of \p p is zero, or if the sum of
+     * the number of objectives and of the equality and inequality constraints of \p p differs from \p NF.
+     * @throws unspecified any exception thrown by the move constructor of \p T.
+     */
+    explicit static_problem(T &&p) : m_p(std::move(p))
+    {
+        check_nf();
+    }
+
+    /// Fitness.
+    /**
+     * @param dv the decision vector, which must have a size of \p NX.
+     *
+     * @return the fitness of \p dv.
+     *
+     * @throws unspecified any exception thrown by the fitness function of the inner problem,
+     * or by memory errors in standard containers.
+     */
+    vector_double fitness(const vector_double &dv) const
+    {
+        vector_double retval(NF);
+        fitness_into(dv.data(), retval.data());
+        return retval;
+    }
+    /// Allocation-free fitness.
+    /**
+     * The decision vector is copied into a stack-allocated array, and the fitness function of the inner
+     * problem is called directly (i.e., it can be inlined).
+     *
+     * @param dv a pointer to the \p NX elements of the decision vector.
+     * @param fv a pointer to the \p NF elements of the output fitness vector.
+     *
+     * @throws unspecified any exception thrown by the fitness function of the inner problem.
+     */
+    void fitness_into(const double *dv, double *fv) const
+    {
+        x_type x;
+        for (std::size_t i = 0; i < NX; ++i) {
+            x[i] = dv[i];
+        }
+        const f_type f = m_p.fitness(x);
+        for (std::size_t i = 0; i < NF; ++i) {
+            fv[i] = f[i];
+        }
+    }
+    /// Box-bounds.
+    /**
+     * @return the box-bounds of the inner problem, converted to pagmo::vector_double.
+     *
+     * @throws unspecified any exception thrown by <tt>get_bounds()</tt> of the inner problem,
+     * or by memory errors in standard containers.
+     */
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        const auto b = m_p.get_bounds();
+        return {vector_double(b.first.begin(), b.first.end()), vector_double(b.second.begin(), b.second.end())};
+    }
+    /// Number of objectives.
+    /**
+     * @return the number of objectives of the inner problem, or 1 if the inner problem
+     * does not provide <tt>get_nobj()</tt>.
+     */
+    vector_double::size_type get_nobj() const
+    {
+        return get_nobj_impl(m_p);
+    }
+    /// Equality constraint dimension.
+    /**
+     * @return the number of equality constraints of the inner problem, or 0 if the inner problem
+     * does not provide <tt>get_nec()</tt>.
+     */
+    vector_double::size_type get_nec() const
+    {
+        return get_nec_impl(m_p);
+    }
+    /// Inequality constraint dimension.
+    /**
+     * @return the number of inequality constraints of the inner problem, or 0 if the inner problem
+     * does not provide <tt>get_nic()</tt>.
+     */
+    vector_double::size_type get_nic() const
+    {
+        return get_nic_impl(m_p);
+    }
+    /// Integer dimension.
+    /**
+     * @return the integer dimension of the inner problem, or 0 if the inner problem
+     * does not provide <tt>get_nix()</tt>.
+     */
+    vector_double::size_type get_nix() const
+    {
+        return get_nix_impl(m_p);
+    }
+    /// Problem name.
+    /**
+     * @return the name of the inner problem, or the mangled name of \p T if the inner problem
+     * does not provide <tt>get_name()</tt>.
+     *
+     * @throws unspecified any exception thrown by <tt>get_name()</tt> of the inner problem.
+     */
+    std::string get_name() const
+    {
+        return get_name_impl(m_p);
+    }
+    /// Extra info.
+    /**
+     * @return a string containing the fixed dimensions \p NX and \p NF.
+     *
+     * @throws unspecified any exception thrown by memory errors in standard classes.
+     */
+    std::string get_extra_info() const
+    {
+        return "\tFixed dimension: " + std::to_string(NX) + "\n\tFixed fitness dimension: " + std::to_string(NF)
+               + "\n";
+    }
+    /// Thread safety level.
+    /**
+     * @return the thread safety level of the inner problem, or thread_safety::basic if the inner problem
+     * does not provide <tt>get_thread_safety()</tt>.
+     */
+    thread_safety get_thread_safety() const
+    {
+        return get_thread_safety_impl(m_p);
+    }
+
+    /// Getter for the inner problem.
+    /**
+     * @return a const reference to the inner problem.
+     */
+    const T &get_inner_problem() const
+    {
+        return m_p;
+    }
+    /// Getter for the inner problem.
+    /**
+     * @return a reference to the inner problem.
+     */
+    T &get_inner_problem()
+    {
+        return m_p;
+    }
+
+    /// Object serialization.
+    /**
+     * This method will serialize the inner problem, which thus needs to be serializable.
+     *
+     * @param ar the target archive.
+     *
+     * @throws unspecified any exception thrown by the serialization of the inner problem.
+     */
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned)
+    {
+        detail::archive(ar, m_p);
+    }
+
+private:
+    void check_nf() const
+    {
+        if (get_nobj() == 0u || get_nobj() + get_nec() + get_nic() != NF) {
+            pagmo_throw(std::invalid_argument,
+                        "The fitness dimension of a static_problem is " + std::to_string(NF)
+                            + ", but the inner problem has " + std::to_string(get_nobj()) + " objectives, "
+                            + std::to_string(get_nec()) + " equality constraints and " + std::to_string(get_nic())
+                            + " inequality constraints");
+        }
+    }
+
+    template <typename U, enable_if_t<has_get_nobj<U>::value, int> = 0>
+    static vector_double::size_type get_nobj_impl(const U &p)
+    {
+        return p.get_nobj();
+    }
+    template <typename U, enable_if_t<!has_get_nobj<U>::value, int> = 0>
+    static vector_double::size_type get_nobj_impl(const U &)
+    {
+        return 1u;
+    }
+    template <typename U, enable_if_t<has_e_constraints<U>::value, int> = 0>
+    static vector_double::size_type get_nec_impl(const U &p)
+    {
+        return p.get_nec();
+    }
+    template <typename U, enable_if_t<!has_e_constraints<U>::value, int> = 0>
+    static vector_double::size_type get_nec_impl(const U &)
+    {
+        return 0u;
+    }
+    template <typename U, enable_if_t<has_i_constraints<U>::value, int> = 0>
+    static vector_double::size_type get_nic_impl(const U &p)
+    {
+        return p.get_nic();
+    }
+    template <typename U, enable_if_t<!has_i_constraints<U>::value, int> = 0>
+    static vector_double::size_type get_nic_impl(const U &)
+    {
+        return 0u;
+    }
+    template <typename U, enable_if_t<has_integer_part<U>::value, int> = 0>
+    static vector_double::size_type get_nix_impl(const U &p)
+    {
+        return p.get_nix();
+    }
+    template <typename U, enable_if_t<!has_integer_part<U>::value, int> = 0>
+    static vector_double::size_type get_nix_impl(const U &)
+    {
+        return 0u;
+    }
+    template <typename U, enable_if_t<has_name<U>::value, int> = 0>
+    static std::string get_name_impl(const U &p)
+    {
+        return p.get_name();
+    }
+    template <typename U, enable_if_t<!has_name<U>::value, int> = 0>
+    static std::string get_name_impl(const U &)
+    {
+        return typeid(U).name();
+    }
+    template <typename U, enable_if_t<has_get_thread_safety<U>::value, int> = 0>
+    static thread_safety get_thread_safety_impl(const U &p)
+    {
+        return p.get_thread_safety();
+    }
+    template <typename U, enable_if_t<!has_get_thread_safety<U>::value, int> = 0>
+    static thread_safety get_thread_safety_impl(const U &)
+    {
+        return thread_safety::basic;
+    }
+
+    T m_p;
+};
+
+} // namespace pagmo
+
+#endif
@@ -60,6 +60,12 @@ public:
                                 const vector_double::size_type &, const vector_double::size_type &,
                                 const vector_double &, const individuals_group_t &) const;
 
+    // In-place replacement.
+    replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &, const individuals_group_t &) const;
+
     std::string get_name() const
     {
         return "Fair replace";
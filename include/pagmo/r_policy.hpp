@@ -42,6 +42,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/detail/make_unique.hpp>
 #include <pagmo/detail/visibility.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
@@ -78,6 +79,26 @@ public:
 template <typename T>
 const bool has_replace<T>::value;
 
+// Check if T has a replace_in_place() member function conforming to the UDRP requirements.
+template <typename T>
+class has_replace_in_place
+{
+    template <typename U>
+    using replace_in_place_t = decltype(std::declval<const U &>().replace_in_place(
+        std::declval<const individuals_view_t &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double::size_type &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double::size_type &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double &>(), std::declval<const individuals_group_t &>()));
+    static const bool implementation_defined
+        = std::is_same<detected_t<replace_in_place_t, T>, replacement_plan_t>::value;
+
+public:
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool has_replace_in_place<T>::value;
+
 namespace detail
 {
 
@@ -119,6 +140,11 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS r_pol_inner_base {
                                         const vector_double::size_type &, const vector_double::size_type &,
                                         const vector_double::size_type &, const vector_double::size_type &,
                                         const vector_double &, const individuals_group_t &) const = 0;
+    virtual bool has_replace_in_place() const = 0;
+    virtual replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                                const vector_double::size_type &, const vector_double::size_type &,
+                                                const vector_double::size_type &, const vector_double::size_type &,
+                                                const vector_double &, const individuals_group_t &) const = 0;
     virtual std::string get_name() const = 0;
     virtual std::string get_extra_info() const = 0;
     template <typename Archive>
@@ -152,6 +178,19 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS r_pol_inner final : r_pol_inner_base {
         return m_value.replace(inds, nx, nix, nobj, nec, nic, tol, mig);
     }
     // Optional methods.
+    virtual bool has_replace_in_place() const override final
+    {
+        return pagmo::has_replace_in_place<T>::value;
+    }
+    virtual replacement_plan_t replace_in_place(const individuals_view_t &inds, const vector_double::size_type &nx,
+                                                const vector_double::size_type &nix,
+                                                const vector_double::size_type &nobj,
+                                                const vector_double::size_type &nec,
+                                                const vector_double::size_type &nic, const vector_double &tol,
+                                                const individuals_group_t &mig) const override final
+    {
+        return replace_in_place_impl(m_value, inds, nx, nix, nobj, nec, nic, tol, mig);
+    }
     virtual std::string get_name() const override final
     {
         return get_name_impl(m_value);
@@ -170,6 +209,28 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS r_pol_inner final : r_pol_inner_base {
     {
         return typeid(U).name();
     }
+    template <typename U, enable_if_t<pagmo::has_replace_in_place<U>::value, int> = 0>
+    static replacement_plan_t replace_in_place_impl(const U &value, const individuals_view_t &inds,
+                                                    const vector_double::size_type &nx,
+                                                    const vector_double::size_type &nix,
+                                                    const vector_double::size_type &nobj,
+                                                    const vector_double::size_type &nec,
+                                                    const vector_double::size_type &nic, const vector_double &tol,
+                                                    const individuals_group_t &mig)
+    {
+        return value.replace_in_place(inds, nx, nix, nobj, nec, nic, tol, mig);
+    }
+    template <typename U, enable_if_t<!pagmo::has_replace_in_place<U>::value, int> = 0>
+    [[noreturn]] static replacement_plan_t
+    replace_in_place_impl(const U &value, const individuals_view_t &, const vector_double::size_type &,
+                          const vector_double::size_type &, const vector_double::size_type &,
+                          const vector_double::size_type &, const vector_double::size_type &, const vector_double &,
+                          const individuals_group_t &)
+    {
+        pagmo_throw(not_implemented_error,
+                    "The replace_in_place() method has been invoked, but it is not implemented in a UDRP of type '"
+                        + get_name_impl(value) + "'");
+    }
     template <typename U, enable_if_t<has_extra_info<U>::value, int> = 0>
     static std::string get_extra_info_impl(const U &value)
     {
@@ -265,6 +326,13 @@ public:
                                 const vector_double::size_type &, const vector_double::size_type &,
                                 const vector_double &, const individuals_group_t &) const;
 
+    // In-place replacement.
+    bool has_replace_in_place() const;
+    replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &, const individuals_group_t &) const;
+
     // Name.
     std::string get_name() const
     {
@@ -305,13 +373,19 @@ private:
         assert(m_ptr.get() != nullptr);
         return m_ptr.get();
     }
-    // Helper to check the inputs and outputs of the replace() function.
-    PAGMO_DLL_LOCAL void verify_replace_input(const individuals_group_t &, const vector_double::size_type &,
+    // Helper to check the inputs and outputs of the replace() and replace_in_place() functions.
+    template <typename Group>
+    PAGMO_DLL_LOCAL void verify_replace_input(const Group &, const vector_double::size_type &,
                                               const vector_double::size_type &, const vector_double::size_type &,
                                               const vector_double::size_type &, const vector_double::size_type &,
                                               const vector_double &, const individuals_group_t &) const;
     PAGMO_DLL_LOCAL void verify_replace_output(const individuals_group_t &, vector_double::size_type,
                                                vector_double::size_type) const;
+    PAGMO_DLL_LOCAL void verify_replace_in_place_output(const replacement_plan_t &, pop_size_t, pop_size_t) const;
+    // Helper to deduce a replacement plan from the output of replace().
+    PAGMO_DLL_LOCAL replacement_plan_t plan_from_replace_output(const individuals_view_t &,
+                                                                const individuals_group_t &,
+                                                                const individuals_group_t &) const;
 
 private:
     // Pointer to the inner base r_pol.
@@ -29,6 +29,12 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_RNG_HPP
 #define PAGMO_RNG_HPP
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
 #include <random>
 
 #include <pagmo/detail/visibility.hpp>
@@ -44,6 +50,304 @@ using random_engine_type = std::mt19937;
 
 } // namespace detail
 
+/// Counter-based random engine
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This class implements the Philox4x32-10 counter-based random number generator
+ * by Salmon, Moraes, Dror and Shaw, 2011. The engine has no internal state other than a 64-bit key
+ * (the seed), a 64-bit stream index and a 64-bit counter: the \f$i\f$-th block of four 32-bit random numbers
+ * of a stream is obtained by applying a keyed bijection to the counter value \f$i\f$.
+ *
+ * As a consequence, engines can be created cheaply and independent streams can be assigned to the tasks of
+ * a parallel computation (e.g., one stream per individual of a population). The random numbers
+ * drawn by each task then depend only on the key and on the stream index, and the result of the computation
+ * does not depend on the number of threads or on the scheduling of the tasks.
+ *
+ * This class satisfies the requirements of a C++ random number engine, and it can thus be used with the
+ * distributions of the standard library. It also provides the bulk generation functions generate(),
+ * generate_canonical() and generate_normal(), which produce the random numbers in blocks and whose
+ * loops can be vectorised by the compiler.
+ */
+class philox4x32
+{
+public:
+    /// The type of the generated numbers.
+    using result_type = std::uint32_t;
+    /// The type of a block of random numbers.
+    using block_type = std::array<result_type, 4>;
+
+    /// Default constructor.
+    /**
+     * Equivalent to constructing from a key and a stream index of zero.
+     */
+    philox4x32() : philox4x32(0u) {}
+    /// Constructor from key and stream index.
+    /**
+     * @param key the key (seed) of the engine.
+     * @param stream the stream index.
+     */
+    // NOTE: initialise the state in the member initializer list (rather than
+    // via seed()), so that the compiler can see that the buffer is initialised
+    // when the call operator is inlined.
+    explicit philox4x32(std::uint64_t key, std::uint64_t stream = 0u)
+        : m_key(key), m_stream(stream), m_counter(0u), m_buffer{}, m_idx(4u)
+    {
+    }
+
+    /// Reset the engine.
+    /**
+     * After a call to this function, the engine will be in the same state
+     * as an engine constructed from \p key and \p stream.
+     *
+     * @param key the key (seed) of the engine.
+     * @param stream the stream index.
+     */
+    void seed(std::uint64_t key = 0u, std::uint64_t stream = 0u)
+    {
+        m_key = key;
+        m_stream = stream;
+        m_counter = 0u;
+        m_buffer = block_type{};
+        m_idx = 4u;
+    }
+
+    /// Minimum value.
+    /**
+     * @return zero.
+     */
+    static constexpr result_type min()
+    {
+        return 0u;
+    }
+    /// Maximum value.
+    /**
+     * @return \f$2^{32}-1\f$.
+     */
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// Generate a random number.
+    /**
+     * @return the next number in the stream.
+     */
+    result_type operator()()
+    {
+        if (m_idx == 4u) {
+            m_buffer = block(m_counter++);
+            m_idx = 0u;
+        }
+        return m_buffer[m_idx++];
+    }
+    /// Advance the engine.
+    /**
+     * This function runs in constant time.
+     *
+     * @param z the number of random numbers to skip.
+     */
+    void discard(unsigned long long z)
+    {
+        const auto pos = position() + z;
+        m_counter = pos / 4u;
+        m_idx = 4u;
+        if (pos % 4u) {
+            m_buffer = block(m_counter++);
+            m_idx = static_cast<unsigned>(pos % 4u);
+        }
+    }
+
+    /// Bulk generation of random numbers.
+    /**
+     * This function writes into \p out the next \p n random numbers of the stream. The result
+     * is the same as invoking the call operator \p n times.
+     *
+     * @param out the output buffer.
+     * @param n the number of random numbers to be generated.
+     */
+    void generate(result_type *out, std::size_t n)
+    {
+        // Consume the buffered numbers first.
+        for (; n && m_idx < 4u; --n) {
+            *out++ = m_buffer[m_idx++];
+        }
+        // Whole blocks.
+        for (; n >= 4u; n -= 4u, out += 4) {
+            const auto b = block(m_counter++);
+            out[0] = b[0];
+            out[1] = b[1];
+            out[2] = b[2];
+            out[3] = b[3];
+        }
+        // Remainder.
+        for (; n; --n) {
+            *out++ = (*this)();
+        }
+    }
+    /// Bulk generation of uniformly-distributed real numbers.
+    /**
+     * This function writes into \p out \p n random numbers uniformly distributed in the \f$\left[0, 1\right)\f$
+     * range, with 53 random bits each. Two 32-bit numbers from the stream are consumed for each output value.
+     *
+     * @param out the output buffer.
+     * @param n the number of random numbers to be generated.
+     */
+    void generate_canonical(double *out, std::size_t n)
+    {
+        // NOTE: the numbers are generated in chunks, in order to bound the size of the temporary storage.
+        constexpr std::size_t chunk = 64;
+        std::array<result_type, 2u * chunk> tmp;
+        while (n) {
+            const auto m = n < chunk ? n : chunk;
+            generate(tmp.data(), 2u * m);
+            for (std::size_t i = 0; i < m; ++i) {
+                out[i] = to_canonical(tmp[2u * i], tmp[2u * i + 1u]);
+            }
+            out += m;
+            n -= m;
+        }
+    }
+    /// Bulk generation of normally-distributed real numbers.
+    /**
+     * This function writes into \p out \p n random numbers drawn from the standard normal distribution,
+     * computed via the Box-Muller transform. Four 32-bit numbers from the stream are consumed for each pair of
+     * output values (if \p n is odd, the second value of the last pair is discarded).
+     *
+     * @param out the output buffer.
+     * @param n the number of random numbers to be generated.
+     */
+    void generate_normal(double *out, std::size_t n)
+    {
+        const double two_pi = 6.283185307179586476925286766559;
+        constexpr std::size_t chunk = 64;
+        std::array<double, 2u * chunk> u;
+        while (n) {
+            const auto m = n < 2u * chunk ? n : 2u * chunk;
+            // Number of pairs.
+            const auto np = (m + 1u) / 2u;
+            generate_canonical(u.data(), 2u * np);
+            for (std::size_t i = 0; i < m / 2u; ++i) {
+                // NOTE: 1 - u is in (0, 1], so that the logarithm is finite.
+                const auto r = std::sqrt(-2. * std::log(1. - u[2u * i])), theta = two_pi * u[2u * i + 1u];
+                out[2u * i] = r * std::cos(theta);
+                out[2u * i + 1u] = r * std::sin(theta);
+            }
+            if (m % 2u) {
+                out[m - 1u] = std::sqrt(-2. * std::log(1. - u[m - 1u])) * std::cos(two_pi * u[m]);
+            }
+            out += m;
+            n -= m;
+        }
+    }
+
+    /// Compute a block of random numbers.
+    /**
+     * @param counter the counter value.
+     *
+     * @return the block of four random numbers with index \p counter in the stream of \p this.
+     */
+    block_type block(std::uint64_t counter) const
+    {
+        return bijection(block_type{{static_cast<result_type>(counter), static_cast<result_type>(counter >> 32),
+                                     static_cast<result_type>(m_stream), static_cast<result_type>(m_stream >> 32)}},
+                         {{static_cast<result_type>(m_key), static_cast<result_type>(m_key >> 32)}});
+    }
+    /// The Philox4x32-10 bijection.
+    /**
+     * @param ctr the counter.
+     * @param key the key.
+     *
+     * @return the output of the Philox4x32-10 bijection for the input counter and key.
+     */
+    static block_type bijection(block_type ctr, std::array<result_type, 2> key)
+    {
+        for (int r = 0; r < 10; ++r) {
+            if (r) {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            const auto p0 = std::uint64_t(0xD2511F53u) * ctr[0], p1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+            ctr = block_type{{static_cast<result_type>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<result_type>(p1),
+                              static_cast<result_type>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<result_type>(p0)}};
+        }
+        return ctr;
+    }
+
+    /// Equality operator.
+    /**
+     * @param a the first operand.
+     * @param b the second operand.
+     *
+     * @return \p true if \p a and \p b will generate the same sequence of numbers, \p false otherwise.
+     */
+    friend bool operator==(const philox4x32 &a, const philox4x32 &b)
+    {
+        return a.m_key == b.m_key && a.m_stream == b.m_stream && a.position() == b.position();
+    }
+    /// Inequality operator.
+    /**
+     * @param a the first operand.
+     * @param b the second operand.
+     *
+     * @return the negation of <tt>a == b</tt>.
+     */
+    friend bool operator!=(const philox4x32 &a, const philox4x32 &b)
+    {
+        return !(a == b);
+    }
+    /// Stream insertion operator.
+    /**
+     * The key, the stream index and the position in the stream are written to \p os.
+     *
+     * @param os the output stream.
+     * @param e the engine.
+     *
+     * @return a reference to \p os.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const philox4x32 &e)
+    {
+        return os << e.m_key << ' ' << e.m_stream << ' ' << e.position();
+    }
+    /// Stream extraction operator.
+    /**
+     * @param is the input stream.
+     * @param e the engine.
+     *
+     * @return a reference to \p is.
+     */
+    friend std::istream &operator>>(std::istream &is, philox4x32 &e)
+    {
+        std::uint64_t key, stream;
+        unsigned long long pos;
+        if (is >> key >> stream >> pos) {
+            e.seed(key, stream);
+            e.discard(pos);
+        }
+        return is;
+    }
+
+private:
+    // Position (in 32-bit words) of the next number in the stream.
+    unsigned long long position() const
+    {
+        return m_idx == 4u ? m_counter * 4u : (m_counter - 1u) * 4u + m_idx;
+    }
+    // Conversion of two 32-bit numbers to a double in [0, 1), using 53 bits.
+    static double to_canonical(result_type a, result_type b)
+    {
+        return static_cast<double>((static_cast<std::uint64_t>(a) << 21) ^ (b >> 11)) / 9007199254740992.;
+    }
+    std::uint64_t m_key;
+    std::uint64_t m_stream;
+    std::uint64_t m_counter;
+    block_type m_buffer;
+    unsigned m_idx;
+};
+
 /// Thread-safe random device
 /**
  * This class intends to be a thread-safe substitute for std::random_device,
@@ -55,6 +55,10 @@ public:
                                const vector_double::size_type &, const vector_double::size_type &,
                                const vector_double::size_type &, const vector_double::size_type &,
                                const vector_double &) const;
+    individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double &) const;
 
     std::string get_name() const
     {
@@ -42,6 +42,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/detail/make_unique.hpp>
 #include <pagmo/detail/visibility.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
@@ -78,6 +79,26 @@ public:
 template <typename T>
 const bool has_select<T>::value;
 
+// Check if T has a select_view() member function conforming to the UDSP requirements.
+template <typename T>
+class has_select_view
+{
+    template <typename U>
+    using select_view_t = decltype(std::declval<const U &>().select_view(
+        std::declval<const individuals_view_t &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double::size_type &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double::size_type &>(), std::declval<const vector_double::size_type &>(),
+        std::declval<const vector_double &>()));
+    static const bool implementation_defined
+        = std::is_same<detected_t<select_view_t, T>, individuals_group_t>::value;
+
+public:
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool has_select_view<T>::value;
+
 namespace detail
 {
 
@@ -119,6 +140,11 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS s_pol_inner_base {
                                        const vector_double::size_type &, const vector_double::size_type &,
                                        const vector_double::size_type &, const vector_double::size_type &,
                                        const vector_double &) const = 0;
+    virtual bool has_select_view() const = 0;
+    virtual individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double &) const = 0;
     virtual std::string get_name() const = 0;
     virtual std::string get_extra_info() const = 0;
     template <typename Archive>
@@ -152,6 +178,19 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS s_pol_inner final : s_pol_inner_base {
         return m_value.select(inds, nx, nix, nobj, nec, nic, tol);
     }
     // Optional methods.
+    virtual bool has_select_view() const override final
+    {
+        return pagmo::has_select_view<T>::value;
+    }
+    virtual individuals_group_t select_view(const individuals_view_t &inds, const vector_double::size_type &nx,
+                                            const vector_double::size_type &nix,
+                                            const vector_double::size_type &nobj,
+                                            const vector_double::size_type &nec,
+                                            const vector_double::size_type &nic,
+                                            const vector_double &tol) const override final
+    {
+        return select_view_impl(m_value, inds, nx, nix, nobj, nec, nic, tol);
+    }
     virtual std::string get_name() const override final
     {
         return get_name_impl(m_value);
@@ -170,6 +209,26 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS s_pol_inner final : s_pol_inner_base {
     {
         return typeid(U).name();
     }
+    template <typename U, enable_if_t<pagmo::has_select_view<U>::value, int> = 0>
+    static individuals_group_t select_view_impl(const U &value, const individuals_view_t &inds,
+                                                const vector_double::size_type &nx,
+                                                const vector_double::size_type &nix,
+                                                const vector_double::size_type &nobj,
+                                                const vector_double::size_type &nec,
+                                                const vector_double::size_type &nic, const vector_double &tol)
+    {
+        return value.select_view(inds, nx, nix, nobj, nec, nic, tol);
+    }
+    template <typename U, enable_if_t<!pagmo::has_select_view<U>::value, int> = 0>
+    [[noreturn]] static individuals_group_t
+    select_view_impl(const U &value, const individuals_view_t &, const vector_double::size_type &,
+                     const vector_double::size_type &, const vector_double::size_type &,
+                     const vector_double::size_type &, const vector_double::size_type &, const vector_double &)
+    {
+        pagmo_throw(not_implemented_error,
+                    "The select_view() method has been invoked, but it is not implemented in a UDSP of type '"
+                        + get_name_impl(value) + "'");
+    }
     template <typename U, enable_if_t<has_extra_info<U>::value, int> = 0>
     static std::string get_extra_info_impl(const U &value)
     {
@@ -265,6 +324,13 @@ public:
                                const vector_double::size_type &, const vector_double::size_type &,
                                const vector_double &) const;
 
+    // Selection from a view.
+    bool has_select_view() const;
+    individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double &) const;
+
     // Name.
     std::string get_name() const
     {
@@ -305,8 +371,9 @@ private:
         assert(m_ptr.get() != nullptr);
         return m_ptr.get();
     }
-    // Helper to check the inputs and outputs of the select() function.
-    PAGMO_DLL_LOCAL void verify_select_input(const individuals_group_t &, const vector_double::size_type &,
+    // Helper to check the inputs and outputs of the select() and select_view() functions.
+    template <typename Group>
+    PAGMO_DLL_LOCAL void verify_select_input(const Group &, const vector_double::size_type &,
                                              const vector_double::size_type &, const vector_double::size_type &,
                                              const vector_double::size_type &, const vector_double::size_type &,
                                              const vector_double &) const;
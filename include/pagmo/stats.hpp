@@ -0,0 +1,166 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_STATS_HPP
+#define PAGMO_STATS_HPP
+
+#include <array>
+#include <iostream>
+#include <utility>
+
+#include <pagmo/detail/visibility.hpp>
+
+namespace pagmo
+{
+
+/// Histogram of non-negative integral samples.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This class accumulates non-negative integral samples (e.g., durations in nanoseconds,
+ * or sizes in bytes) into logarithmic buckets: bucket 0 counts the samples equal to zero, while
+ * bucket :math:`i > 0` counts the samples in the :math:`\left[ 2^{i-1}, 2^i \right)` range.
+ * In addition to the buckets, the histogram keeps track of the number of samples, of their sum
+ * and of their minimum and maximum values.
+ *
+ * Histograms can be merged via the addition operator, and the result is the same as if all
+ * the samples had been recorded in a single histogram.
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC stats_histogram
+{
+public:
+    /// The number of buckets.
+    static constexpr unsigned n_buckets = 65u;
+    /// The type holding the bucket counts.
+    using buckets_t = std::array<unsigned long long, n_buckets>;
+
+    // Default constructor.
+    stats_histogram();
+    // Constructor from bucket counts and summary data.
+    explicit stats_histogram(const buckets_t &, unsigned long long, unsigned long long, unsigned long long);
+
+    // Record a sample.
+    void add(unsigned long long);
+    // Merge another histogram.
+    stats_histogram &operator+=(const stats_histogram &);
+
+    // Getters.
+    unsigned long long get_count() const;
+    unsigned long long get_sum() const;
+    unsigned long long get_min() const;
+    unsigned long long get_max() const;
+    double get_mean() const;
+    const buckets_t &get_buckets() const;
+    // Approximate quantile.
+    unsigned long long quantile(double) const;
+
+    // Bucket helpers.
+    static unsigned bucket_index(unsigned long long);
+    static std::pair<unsigned long long, unsigned long long> bucket_bounds(unsigned);
+
+private:
+    buckets_t m_buckets;
+    unsigned long long m_count;
+    unsigned long long m_sum;
+    unsigned long long m_min;
+    unsigned long long m_max;
+};
+
+// Merge two histograms.
+PAGMO_DLL_PUBLIC stats_histogram operator+(const stats_histogram &, const stats_histogram &);
+
+// Stream operator for stats_histogram.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const stats_histogram &);
+
+/// Island statistics.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This class collects the instrumentation data recorded by an :cpp:class:`~pagmo::island`
+ * when statistics are enabled via :cpp:func:`pagmo::island::set_stats_enabled()`. The
+ * following quantities are recorded:
+ *
+ * - the time (in nanoseconds) each evolution task spent waiting in the island's task queue
+ *   before being executed,
+ * - the wall-clock time (in nanoseconds) of each invocation of the ``run_evolve()``
+ *   method of the UDI,
+ * - the time (in nanoseconds) spent fetching the migrants from the archipelago,
+ *   running the replacement policy and running the selection policy,
+ * - the approximate size (in bytes) of the individuals of each copy of the island's population,
+ * - the number of fitness evaluations performed during the evolutions.
+ *
+ * The statistics of several islands can be merged via the addition operator
+ * (see also :cpp:func:`pagmo::archipelago::get_aggregated_stats()`).
+ *
+ * \endverbatim
+ */
+class PAGMO_DLL_PUBLIC island_stats
+{
+    // The island records the statistics.
+    friend class PAGMO_DLL_PUBLIC island;
+
+public:
+    // Default constructor.
+    island_stats();
+
+    // Merge the statistics of another island.
+    island_stats &operator+=(const island_stats &);
+
+    // Getters.
+    const stats_histogram &get_queue_wait() const;
+    const stats_histogram &get_evolve() const;
+    const stats_histogram &get_migr_pull() const;
+    const stats_histogram &get_migr_replace() const;
+    const stats_histogram &get_migr_select() const;
+    const stats_histogram &get_pop_copy() const;
+    unsigned long long get_fevals() const;
+    double get_fevals_per_second() const;
+
+private:
+    stats_histogram m_queue_wait;
+    stats_histogram m_evolve;
+    stats_histogram m_migr_pull;
+    stats_histogram m_migr_replace;
+    stats_histogram m_migr_select;
+    stats_histogram m_pop_copy;
+    unsigned long long m_fevals;
+};
+
+// Merge the statistics of two islands.
+PAGMO_DLL_PUBLIC island_stats operator+(const island_stats &, const island_stats &);
+
+// Stream operator for island_stats.
+PAGMO_DLL_PUBLIC std::ostream &operator<<(std::ostream &, const island_stats &);
+
+} // namespace pagmo
+
+#endif
@@ -30,6 +30,7 @@ see https://www.gnu.org/licenses/. */
 #define PAGMO_TOPOLOGIES_BASE_BGL_TOPOLOGY_HPP
 
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -55,6 +56,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/detail/visibility.hpp>
 #include <pagmo/s11n.hpp>
+#include <pagmo/topology.hpp>
 #include <pagmo/types.hpp>
 
 namespace pagmo
@@ -96,6 +98,8 @@ class PAGMO_DLL_PUBLIC base_bgl_topology
     PAGMO_DLL_LOCAL void unsafe_check_vertex_indices(std::size_t, Args...) const;
     // Helper to detect adjacent vertices.
     PAGMO_DLL_LOCAL bool unsafe_are_adjacent(std::size_t, std::size_t) const;
+    // Helper to signal that the graph was modified.
+    PAGMO_DLL_LOCAL void unsafe_bump_version();
 
     // A few helpers to set/get the integral graph
     // object. These will lock the mutex, so they
@@ -114,6 +118,7 @@ public:
     std::size_t num_vertices() const;
     bool are_adjacent(std::size_t, std::size_t) const;
     std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const;
+    std::shared_ptr<const topology_csr> to_csr() const;
 
     void add_vertex();
     void add_edge(std::size_t, std::size_t, double = 1.);
@@ -143,6 +148,10 @@ public:
 private:
     mutable std::mutex m_mutex;
     graph_t m_graph;
+    // The version of the graph (increased at every modification)
+    // and the cached CSR snapshot (null if not computed yet).
+    unsigned long long m_version = 0;
+    mutable std::shared_ptr<const topology_csr> m_csr;
 };
 
 } // namespace pagmo
@@ -31,6 +31,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -55,6 +56,7 @@ public:
 
     void push_back();
     std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const;
+    std::shared_ptr<const topology_csr> to_csr() const;
 
     std::string get_name() const;
     std::string get_extra_info() const;
@@ -71,6 +73,9 @@ public:
 private:
     double m_weight;
     std::atomic<std::size_t> m_num_vertices;
+    // The cached CSR snapshot. It must be accessed
+    // via the atomic shared_ptr functions.
+    mutable std::shared_ptr<const topology_csr> m_csr;
 };
 
 } // namespace pagmo
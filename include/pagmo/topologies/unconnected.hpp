@@ -29,12 +29,17 @@ see https://www.gnu.org/licenses/. */
 #ifndef PAGMO_TOPOLOGIES_UNCONNECTED_HPP
 #define PAGMO_TOPOLOGIES_UNCONNECTED_HPP
 
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/serialization/version.hpp>
+
 #include <pagmo/detail/visibility.hpp>
+#include <pagmo/s11n.hpp>
 #include <pagmo/topology.hpp>
 #include <pagmo/types.hpp>
 
@@ -43,22 +48,47 @@ namespace pagmo
 
 // Unconnected topology.
 struct PAGMO_DLL_PUBLIC unconnected {
+    // Default constructor.
+    unconnected();
+    // Copy/move constructors.
+    unconnected(const unconnected &);
+    unconnected(unconnected &&) noexcept;
+    // Copy/move assignment operators.
+    unconnected &operator=(const unconnected &);
+    unconnected &operator=(unconnected &&) noexcept;
     // Get the connections.
     std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const;
-    // Add the next vertex (no-op).
-    void push_back() {}
+    // CSR snapshot.
+    std::shared_ptr<const topology_csr> to_csr() const;
+    // Add the next vertex.
+    void push_back();
     // Name.
     std::string get_name() const
     {
         return "Unconnected";
     }
+    // Number of vertices.
+    std::size_t num_vertices() const;
     // Serialization.
     template <typename Archive>
-    void serialize(Archive &, unsigned);
+    void save(Archive &, unsigned) const;
+    template <typename Archive>
+    void load(Archive &, unsigned);
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+private:
+    std::atomic<std::size_t> m_num_vertices;
+    // The cached CSR snapshot. It must be accessed
+    // via the atomic shared_ptr functions.
+    mutable std::shared_ptr<const topology_csr> m_csr;
 };
 
 } // namespace pagmo
 
 PAGMO_S11N_TOPOLOGY_EXPORT_KEY(pagmo::unconnected)
 
+// NOTE: version 1 added the number of vertices
+// to the serialised state.
+BOOST_CLASS_VERSION(pagmo::unconnected, 1)
+
 #endif
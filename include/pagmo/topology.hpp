@@ -44,6 +44,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/detail/make_unique.hpp>
 #include <pagmo/detail/visibility.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/type_traits.hpp>
 #include <pagmo/types.hpp>
@@ -61,6 +62,34 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+// Immutable snapshot of the connections of a topology
+// in compressed sparse row (CSR) format.
+class PAGMO_DLL_PUBLIC topology_csr
+{
+public:
+    // Default constructor.
+    topology_csr();
+    // Constructor from row offsets, columns, weights and version.
+    explicit topology_csr(std::vector<std::size_t>, std::vector<std::size_t>, vector_double, unsigned long long = 0);
+
+    // Getters.
+    std::size_t num_vertices() const;
+    std::size_t num_edges() const;
+    unsigned long long get_version() const;
+    const std::vector<std::size_t> &get_row_offsets() const;
+    const std::vector<std::size_t> &get_columns() const;
+    const vector_double &get_weights() const;
+
+    // Get the connections to a vertex.
+    std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const;
+
+private:
+    std::vector<std::size_t> m_row_offsets;
+    std::vector<std::size_t> m_columns;
+    vector_double m_weights;
+    unsigned long long m_version;
+};
+
 // Detect the get_connections() method.
 template <typename T>
 class has_get_connections
@@ -94,6 +123,23 @@ public:
 template <typename T>
 const bool has_push_back<T>::value;
 
+// Detect the to_csr() method.
+template <typename T>
+class has_to_csr
+{
+    template <typename U>
+    using to_csr_t = decltype(std::declval<const U &>().to_csr());
+    static const bool implementation_defined
+        = std::is_same<std::shared_ptr<const topology_csr>, detected_t<to_csr_t, T>>::value;
+
+public:
+    // Value of the type trait.
+    static const bool value = implementation_defined;
+};
+
+template <typename T>
+const bool has_to_csr<T>::value;
+
 namespace detail
 {
 
@@ -135,6 +181,8 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS topo_inner_base {
     virtual std::string get_extra_info() const = 0;
     virtual std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const = 0;
     virtual void push_back() = 0;
+    virtual bool has_to_csr() const = 0;
+    virtual std::shared_ptr<const topology_csr> to_csr() const = 0;
     template <typename Archive>
     void serialize(Archive &, unsigned)
     {
@@ -175,6 +223,14 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS topo_inner final : topo_inner_base {
     {
         return get_extra_info_impl(m_value);
     }
+    virtual bool has_to_csr() const override final
+    {
+        return pagmo::has_to_csr<T>::value;
+    }
+    virtual std::shared_ptr<const topology_csr> to_csr() const override final
+    {
+        return to_csr_impl(m_value);
+    }
     // Implementation of the optional methods.
     template <typename U, enable_if_t<has_name<U>::value, int> = 0>
     static std::string get_name_impl(const U &value)
@@ -196,6 +252,16 @@ struct PAGMO_DLL_PUBLIC_INLINE_CLASS topo_inner final : topo_inner_base {
     {
         return "";
     }
+    template <typename U, enable_if_t<pagmo::has_to_csr<U>::value, int> = 0>
+    static std::shared_ptr<const topology_csr> to_csr_impl(const U &value)
+    {
+        return value.to_csr();
+    }
+    template <typename U, enable_if_t<!pagmo::has_to_csr<U>::value, int> = 0>
+    [[noreturn]] static std::shared_ptr<const topology_csr> to_csr_impl(const U &)
+    {
+        pagmo_throw(not_implemented_error, "A CSR snapshot has been requested but it is not implemented in the UDT");
+    }
     // Serialization
     template <typename Archive>
     void serialize(Archive &ar, unsigned)
@@ -293,6 +359,10 @@ public:
     // Get the connections to a vertex.
     std::pair<std::vector<std::size_t>, vector_double> get_connections(std::size_t) const;
 
+    // CSR snapshot.
+    bool has_to_csr() const;
+    std::shared_ptr<const topology_csr> to_csr() const;
+
     // Add a vertex.
     void push_back();
     // Add multiple vertices.
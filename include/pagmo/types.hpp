@@ -57,6 +57,15 @@ typedef std::vector<vector_double>::size_type pop_size_t;
 using individuals_group_t
     = std::tuple<std::vector<unsigned long long>, std::vector<vector_double>, std::vector<vector_double>>;
 
+// A read-only view on a group of individuals (e.g., the individuals
+// of a population), which can be used without copying the group.
+using individuals_view_t = std::tuple<const std::vector<unsigned long long> &, const std::vector<vector_double> &,
+                                      const std::vector<vector_double> &>;
+
+// A plan for the in-place replacement of individuals with migrants: each pair
+// contains the index of the individual to be replaced and the index of the replacing migrant.
+using replacement_plan_t = std::vector<std::pair<pop_size_t, pop_size_t>>;
+
 #endif
 
 } // namespace pagmo
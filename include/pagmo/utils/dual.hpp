@@ -0,0 +1,343 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_UTILS_DUAL_HPP
+#define PAGMO_UTILS_DUAL_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+#include <pagmo/type_traits.hpp>
+
+namespace pagmo
+{
+
+/// Multi-directional dual number.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This class represents a truncated Taylor expansion
+ * \f$ v + \sum_{k=0}^{N-1} d_k \epsilon_k \f$, where \f$ \epsilon_k \epsilon_l = 0 \f$. Propagating
+ * dual numbers through a function computes, in a single evaluation, the value of the function and
+ * its directional derivatives along \p N directions (forward-mode automatic differentiation).
+ *
+ * The scalar type \p T is either \p double or another dual number: nesting dual numbers allows
+ * to compute second order derivatives.
+ *
+ * Dual numbers support the arithmetic and comparison operators (the comparisons act on the values),
+ * and the most common elementary functions, which are found via argument-dependent lookup.
+ * Generic code should thus invoke the elementary functions unqualified, after a <tt>using std::sin;</tt>
+ * (and similar) declaration.
+ */
+template <typename T, std::size_t N>
+class dual
+{
+    static_assert(N > 0u, "The number of directions of a dual number cannot be zero.");
+    // Enabler for the construction from arithmetic types.
+    template <typename U>
+    using arith_enabler = enable_if_t<std::is_arithmetic<U>::value, int>;
+
+public:
+    /// The type of the derivatives.
+    using deriv_type = std::array<T, N>;
+
+    /// Default constructor.
+    /**
+     * The value and the derivatives are initialised to zero.
+     */
+    dual() : m_value(0.), m_derivs(zero_derivs()) {}
+    /// Constructor from a constant value.
+    /**
+     * @param x the value of the dual number, whose derivatives will be set to zero.
+     */
+    dual(const T &x) : m_value(x), m_derivs(zero_derivs()) {}
+    /// Constructor from an arithmetic constant.
+    /**
+     * This constructor allows the implicit conversion of arithmetic constants to nested dual numbers.
+     *
+     * @param x the value of the dual number, whose derivatives will be set to zero.
+     */
+    template <typename U, arith_enabler<U> = 0>
+    dual(U x) : m_value(static_cast<double>(x)), m_derivs(zero_derivs())
+    {
+    }
+    /// Constructor from value and derivatives.
+    /**
+     * @param x the value of the dual number.
+     * @param d the derivatives of the dual number.
+     */
+    dual(const T &x, const deriv_type &d) : m_value(x), m_derivs(d) {}
+
+    /// Value getter.
+    /**
+     * @return a reference to the value.
+     */
+    const T &value() const
+    {
+        return m_value;
+    }
+    /// Value getter (mutable).
+    /**
+     * @return a reference to the value.
+     */
+    T &value()
+    {
+        return m_value;
+    }
+    /// Derivatives getter.
+    /**
+     * @return a reference to the derivatives.
+     */
+    const deriv_type &derivs() const
+    {
+        return m_derivs;
+    }
+    /// Derivatives getter (mutable).
+    /**
+     * @return a reference to the derivatives.
+     */
+    deriv_type &derivs()
+    {
+        return m_derivs;
+    }
+
+    /// Identity operator.
+    /**
+     * @return a copy of \p this.
+     */
+    dual operator+() const
+    {
+        return *this;
+    }
+    /// Negation operator.
+    /**
+     * @return the negation of \p this.
+     */
+    dual operator-() const
+    {
+        dual r(-m_value);
+        for (std::size_t k = 0; k < N; ++k) {
+            r.m_derivs[k] = -m_derivs[k];
+        }
+        return r;
+    }
+
+    /// In-place addition.
+    /**
+     * @param o the addend.
+     *
+     * @return a reference to \p this.
+     */
+    dual &operator+=(const dual &o)
+    {
+        m_value += o.m_value;
+        for (std::size_t k = 0; k < N; ++k) {
+            m_derivs[k] += o.m_derivs[k];
+        }
+        return *this;
+    }
+    /// In-place subtraction.
+    /**
+     * @param o the subtrahend.
+     *
+     * @return a reference to \p this.
+     */
+    dual &operator-=(const dual &o)
+    {
+        m_value -= o.m_value;
+        for (std::size_t k = 0; k < N; ++k) {
+            m_derivs[k] -= o.m_derivs[k];
+        }
+        return *this;
+    }
+    /// In-place multiplication.
+    /**
+     * @param o the multiplicand.
+     *
+     * @return a reference to \p this.
+     */
+    dual &operator*=(const dual &o)
+    {
+        for (std::size_t k = 0; k < N; ++k) {
+            m_derivs[k] = m_derivs[k] * o.m_value + m_value * o.m_derivs[k];
+        }
+        m_value *= o.m_value;
+        return *this;
+    }
+    /// In-place division.
+    /**
+     * @param o the divisor.
+     *
+     * @return a reference to \p this.
+     */
+    dual &operator/=(const dual &o)
+    {
+        const T inv = T(1.) / o.m_value;
+        m_value *= inv;
+        for (std::size_t k = 0; k < N; ++k) {
+            m_derivs[k] = (m_derivs[k] - m_value * o.m_derivs[k]) * inv;
+        }
+        return *this;
+    }
+
+    // NOTE: the binary operators and the elementary functions are implemented
+    // as non-template friends, so that implicit conversions from constants
+    // apply to both arguments, and so that they are found via ADL.
+    friend dual operator+(dual a, const dual &b)
+    {
+        return a += b;
+    }
+    friend dual operator-(dual a, const dual &b)
+    {
+        return a -= b;
+    }
+    friend dual operator*(dual a, const dual &b)
+    {
+        return a *= b;
+    }
+    friend dual operator/(dual a, const dual &b)
+    {
+        return a /= b;
+    }
+    friend bool operator==(const dual &a, const dual &b)
+    {
+        return a.m_value == b.m_value;
+    }
+    friend bool operator!=(const dual &a, const dual &b)
+    {
+        return a.m_value != b.m_value;
+    }
+    friend bool operator<(const dual &a, const dual &b)
+    {
+        return a.m_value < b.m_value;
+    }
+    friend bool operator<=(const dual &a, const dual &b)
+    {
+        return a.m_value <= b.m_value;
+    }
+    friend bool operator>(const dual &a, const dual &b)
+    {
+        return a.m_value > b.m_value;
+    }
+    friend bool operator>=(const dual &a, const dual &b)
+    {
+        return a.m_value >= b.m_value;
+    }
+
+    friend dual sqrt(const dual &a)
+    {
+        using std::sqrt;
+        const T s = sqrt(a.m_value);
+        return a.chain(s, T(.5) / s);
+    }
+    friend dual exp(const dual &a)
+    {
+        using std::exp;
+        const T e = exp(a.m_value);
+        return a.chain(e, e);
+    }
+    friend dual log(const dual &a)
+    {
+        using std::log;
+        return a.chain(log(a.m_value), T(1.) / a.m_value);
+    }
+    friend dual sin(const dual &a)
+    {
+        using std::cos;
+        using std::sin;
+        return a.chain(sin(a.m_value), cos(a.m_value));
+    }
+    friend dual cos(const dual &a)
+    {
+        using std::cos;
+        using std::sin;
+        return a.chain(cos(a.m_value), -sin(a.m_value));
+    }
+    friend dual tan(const dual &a)
+    {
+        using std::tan;
+        const T t = tan(a.m_value);
+        return a.chain(t, T(1.) + t * t);
+    }
+    friend dual atan(const dual &a)
+    {
+        using std::atan;
+        return a.chain(atan(a.m_value), T(1.) / (T(1.) + a.m_value * a.m_value));
+    }
+    friend dual abs(const dual &a)
+    {
+        return a.m_value < T(0.) ? -a : a;
+    }
+    friend dual pow(const dual &a, double e)
+    {
+        using std::pow;
+        return a.chain(pow(a.m_value, e), e * pow(a.m_value, e - 1.));
+    }
+    friend dual pow(const dual &a, const dual &e)
+    {
+        return exp(e * log(a));
+    }
+    friend std::ostream &operator<<(std::ostream &os, const dual &a)
+    {
+        os << a.m_value << " [";
+        for (std::size_t k = 0; k < N; ++k) {
+            os << a.m_derivs[k] << (k + 1u == N ? "]" : ", ");
+        }
+        return os;
+    }
+
+private:
+    static deriv_type zero_derivs()
+    {
+        deriv_type retval;
+        retval.fill(T(0.));
+        return retval;
+    }
+    // Chain rule: the result has value f and derivatives df * m_derivs.
+    dual chain(const T &f, const T &df) const
+    {
+        dual r(f);
+        for (std::size_t k = 0; k < N; ++k) {
+            r.m_derivs[k] = df * m_derivs[k];
+        }
+        return r;
+    }
+
+    T m_value;
+    deriv_type m_derivs;
+};
+
+} // namespace pagmo
+
+#endif
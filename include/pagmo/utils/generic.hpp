@@ -31,6 +31,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <random>
 #include <stdexcept>
@@ -54,6 +55,11 @@ namespace detail
 // Checks that all elements of the problem bounds are not equal
 PAGMO_DLL_PUBLIC bool some_bound_is_equal(const problem &);
 
+// Implementation of the generation of random decision vectors in batch mode, using
+// counter-based streams keyed by the last argument. The bounds are assumed to have been checked.
+PAGMO_DLL_PUBLIC vector_double batch_random_decision_vector_impl(const problem &, vector_double::size_type,
+                                                                 std::uint64_t);
+
 // Check that the lower/upper bounds lb/ub are suitable for the
 // generation of a real number. The boolean flags specify at
 // compile time which checks to run.
@@ -325,10 +331,10 @@ inline vector_double random_decision_vector(const problem &prob, Rng &r_engine)
 template <typename Rng>
 inline vector_double batch_random_decision_vector(const problem &prob, vector_double::size_type n, Rng &r_engine)
 {
-    // NOTE: it is possible in principle to do this in a parallel fashion, e.g., see code
-    // at the commit 13d4182a41e4e71034c6e1085699c5138805d21c. The price to pay however is
-    // the loss of determinism. We can reconsider in the future whether it's worth it
-    // to add an option to this constructor, e.g., par_random, defaulting to false.
+    // NOTE: the decision vectors are generated in parallel. Determinism is preserved
+    // by drawing a single key from r_engine and by generating the i-th decision vector
+    // from the i-th stream of a counter-based engine (see pagmo::philox4x32), so that the
+    // output does not depend on how the work is split among the threads.
 
     // Fetch a few quantities from prob.
     const auto nx = prob.get_nx();
@@ -366,26 +372,8 @@ inline vector_double batch_random_decision_vector(const problem &prob, vector_do
         }
     }
 
-    // Prepare the return value.
-    vector_double out(nx * n);
-
     // Proceed to the random number generation.
-    std::uniform_real_distribution<double> rdist;
-    std::uniform_int_distribution<long long> idist;
-    for (vector_double::size_type i = 0; i < out.size(); i += nx) {
-        for (vector_double::size_type j = 0; j < ncx; ++j) {
-            out[i + j] = (lb[j] == ub[j])
-                             ? lb[j]
-                             : rdist(r_engine, std::uniform_real_distribution<double>::param_type(lb[j], ub[j]));
-        }
-        for (vector_double::size_type j = ncx; j < nx; ++j) {
-            out[i + j] = static_cast<double>(
-                idist(r_engine, std::uniform_int_distribution<long long>::param_type(static_cast<long long>(lb[j]),
-                                                                                     static_cast<long long>(ub[j]))));
-        }
-    }
-
-    return out;
+    return detail::batch_random_decision_vector_impl(prob, n, std::uniform_int_distribution<std::uint64_t>()(r_engine));
 }
 
 // Binomial coefficient
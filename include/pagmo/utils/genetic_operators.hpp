@@ -0,0 +1,63 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#ifndef PAGMO_UTILS_GENETIC_OPERATORS_HPP
+#define PAGMO_UTILS_GENETIC_OPERATORS_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <pagmo/detail/visibility.hpp>
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
+
+namespace pagmo
+{
+
+// Simulated binary crossover of a batch of couples.
+PAGMO_DLL_PUBLIC void sbx_crossover_batch(vector_double &, const std::pair<vector_double, vector_double> &,
+                                          vector_double::size_type, double, double, std::uint64_t);
+
+// Polynomial mutation of a batch of decision vectors.
+PAGMO_DLL_PUBLIC void polynomial_mutation_batch(vector_double &, const std::pair<vector_double, vector_double> &,
+                                                vector_double::size_type, double, double, std::uint64_t);
+
+// Differential evolution trial vector.
+PAGMO_DLL_PUBLIC void de_trial(double *, const std::vector<vector_double> &, vector_double::size_type,
+                               const std::vector<vector_double::size_type> &, const vector_double &, unsigned, double,
+                               double, const std::pair<vector_double, vector_double> &, philox4x32 &);
+
+// Differential evolution trial vectors for a whole population.
+PAGMO_DLL_PUBLIC vector_double de_trial_batch(const std::vector<vector_double> &, const vector_double &, unsigned,
+                                              double, double, const std::pair<vector_double, vector_double> &,
+                                              std::uint64_t);
+
+} // namespace pagmo
+
+#endif
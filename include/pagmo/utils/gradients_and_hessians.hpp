@@ -30,8 +30,10 @@ see https://www.gnu.org/licenses/. */
 #define PAGMO_UTILS_GRADIENTS_AND_HESSIANS_HPP
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <pagmo/exceptions.hpp>
@@ -242,6 +244,198 @@ vector_double estimate_gradient_h(Func f, const vector_double &x, double dx = 1e
     }
     return gradient;
 }
+
+namespace detail
+{
+
+// Determine the size of the vectors returned by a batch functor invoked on n_points
+// decision vectors, given the total size of its output.
+inline vector_double::size_type fd_batch_nf(vector_double::size_type out_size, vector_double::size_type n_points,
+                                            const char *what)
+{
+    assert(n_points > 0u);
+    if (out_size % n_points) {
+        pagmo_throw(std::invalid_argument, "The size of the output of the batch functor (" + std::to_string(out_size)
+                                               + ") is not a multiple of the number of input points ("
+                                               + std::to_string(n_points) + "). Cannot estimate " + what);
+    }
+    return out_size / n_points;
+}
+
+// Append to xs a copy of x in which the j-th component has been replaced by xj.
+inline void fd_append_perturbed(vector_double &xs, const vector_double &x, vector_double::size_type j, double xj)
+{
+    xs.insert(xs.end(), x.begin(), x.end());
+    xs[xs.size() - x.size() + j] = xj;
+}
+
+} // namespace detail
+
+/// Heuristic to estimate the sparsity pattern (batch version)
+/**
+ * This function is equivalent to pagmo::estimate_sparsity(), but, rather than invoking the callable
+ * repeatedly on perturbed points, all the \f$n+1\f$ points required by the estimation are assembled
+ * up front and evaluated with a single call to the batch callable \p bf, which must have the prototype:
+ *
+ * @code{.unparsed}
+ * vector_double bf(const vector_double &)
+ * @endcode
+ *
+ * The input of \p bf is a set of decision vectors stored contiguously (as in pagmo::problem::batch_fitness()),
+ * and its output must be the corresponding fitness vectors, also stored contiguously. This allows to parallelise
+ * the estimation, e.g., via a pagmo::bfe:
+ *
+ * @code{.unparsed}
+ * estimate_sparsity_batch([&prob, &b](const vector_double &xs) { return b(prob, xs); }, x);
+ * @endcode
+ *
+ * @param bf instance of the batch callable object.
+ * @param x decision vector to test the sparisty around.
+ * @param dx To detect the sparsity each component of the input decision vector \p x will be changed by
+ * \f$\max(|x_i|, 1) * \f$ \p dx.
+ * @return the sparsity_pattern of \p bf as detected around \p x.
+ *
+ * @throw std::invalid_argument if the size of the output of \p bf is not a multiple of the number of
+ * input points.
+ * @throw unspecified any exception thrown by \p bf or by memory errors in standard containers.
+ */
+template <typename BFunc>
+sparsity_pattern estimate_sparsity_batch(BFunc bf, const vector_double &x, double dx = 1e-8)
+{
+    const auto n = x.size();
+    // The reference point, followed by the n perturbed points.
+    vector_double xs(x);
+    xs.reserve((n + 1u) * n);
+    for (decltype(x.size()) j = 0u; j < n; ++j) {
+        detail::fd_append_perturbed(xs, x, j, x[j] + std::max(std::abs(x[j]), 1.0) * dx);
+    }
+    const vector_double fs = bf(xs);
+    const auto nf = detail::fd_batch_nf(fs.size(), n + 1u, "a sparsity");
+    sparsity_pattern retval;
+    // NOTE: iterating over i first yields directly the lexicographic order
+    // required by pagmo::problem::gradient_sparsity.
+    for (decltype(fs.size()) i = 0u; i < nf; ++i) {
+        for (decltype(x.size()) j = 0u; j < n; ++j) {
+            if (fs[(j + 1u) * nf + i] != fs[i]) {
+                retval.emplace_back(i, j);
+            }
+        }
+    }
+    return retval;
+}
+
+/// Numerical computation of the gradient (low-order, batch version)
+/**
+ * This function is equivalent to pagmo::estimate_gradient(), but, rather than invoking the callable
+ * repeatedly on perturbed points, all the \f$2n\f$ points required by the central differences are assembled
+ * up front and evaluated with a single call to the batch callable \p bf, which must have the prototype:
+ *
+ * @code{.unparsed}
+ * vector_double bf(const vector_double &)
+ * @endcode
+ *
+ * The input of \p bf is a set of decision vectors stored contiguously (as in pagmo::problem::batch_fitness()),
+ * and its output must be the corresponding fitness vectors, also stored contiguously (see
+ * pagmo::estimate_sparsity_batch() for an example using a pagmo::bfe).
+ *
+ * @param bf instance of the batch callable object.
+ * @param x decision vector around which the gradient is estimated.
+ * @param dx To detect the numerical derivative each component of the input decision vector \p x will be varied by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ * @return the gradient of \p bf approximated around \p x in the format required by pagmo::problem::gradient().
+ *
+ * @throw std::invalid_argument if the size of the output of \p bf is not a multiple of the number of
+ * input points.
+ * @throw unspecified any exception thrown by \p bf or by memory errors in standard containers.
+ */
+template <typename BFunc>
+vector_double estimate_gradient_batch(BFunc bf, const vector_double &x, double dx = 1e-8)
+{
+    const auto n = x.size();
+    if (!n) {
+        return vector_double{};
+    }
+    // The perturbed points are ordered as x + h_0, x - h_0, x + h_1, x - h_1, ...
+    vector_double xs, h(n);
+    xs.reserve(2u * n * n);
+    for (decltype(x.size()) j = 0u; j < n; ++j) {
+        h[j] = std::max(std::abs(x[j]), 1.0) * dx;
+        detail::fd_append_perturbed(xs, x, j, x[j] + h[j]);
+        detail::fd_append_perturbed(xs, x, j, x[j] - h[j]);
+    }
+    const vector_double fs = bf(xs);
+    const auto nf = detail::fd_batch_nf(fs.size(), 2u * n, "a gradient");
+    vector_double gradient(nf * n);
+    for (decltype(x.size()) j = 0u; j < n; ++j) {
+        const auto f_r = fs.data() + 2u * j * nf, f_l = f_r + nf;
+        for (decltype(fs.size()) i = 0u; i < nf; ++i) {
+            gradient[j + i * n] = (f_r[i] - f_l[i]) / 2. / h[j];
+        }
+    }
+    return gradient;
+}
+
+/// Numerical computation of the gradient (high-order, batch version)
+/**
+ * This function is equivalent to pagmo::estimate_gradient_h(), but, rather than invoking the callable
+ * repeatedly on perturbed points, all the \f$6n\f$ points required by the central differences are assembled
+ * up front and evaluated with a single call to the batch callable \p bf, which must have the prototype:
+ *
+ * @code{.unparsed}
+ * vector_double bf(const vector_double &)
+ * @endcode
+ *
+ * The input of \p bf is a set of decision vectors stored contiguously (as in pagmo::problem::batch_fitness()),
+ * and its output must be the corresponding fitness vectors, also stored contiguously (see
+ * pagmo::estimate_sparsity_batch() for an example using a pagmo::bfe).
+ *
+ * @param bf instance of the batch callable object.
+ * @param x decision vector around which the gradient is estimated.
+ * @param dx To detect the numerical derivative each component of the input decision vector \p x will be varied by
+ * \f$\max(|x_i|,1) * \f$ \p dx.
+ * @return the gradient of \p bf approximated around \p x in the format required by pagmo::problem::gradient().
+ *
+ * @throw std::invalid_argument if the size of the output of \p bf is not a multiple of the number of
+ * input points.
+ * @throw unspecified any exception thrown by \p bf or by memory errors in standard containers.
+ */
+template <typename BFunc>
+vector_double estimate_gradient_h_batch(BFunc bf, const vector_double &x, double dx = 1e-2)
+{
+    const auto n = x.size();
+    if (!n) {
+        return vector_double{};
+    }
+    // For each component, the perturbed points are ordered as
+    // x + h, x - h, x + 2h, x - 2h, x + 3h, x - 3h.
+    vector_double xs, h(n);
+    xs.reserve(6u * n * n);
+    for (decltype(x.size()) j = 0u; j < n; ++j) {
+        h[j] = std::max(std::abs(x[j]), 1.0) * dx;
+        for (auto k = 1; k <= 3; ++k) {
+            detail::fd_append_perturbed(xs, x, j, x[j] + k * h[j]);
+            detail::fd_append_perturbed(xs, x, j, x[j] - k * h[j]);
+        }
+    }
+    const vector_double fs = bf(xs);
+    const auto nf = detail::fd_batch_nf(fs.size(), 6u * n, "a gradient");
+    vector_double gradient(nf * n);
+    for (decltype(x.size()) j = 0u; j < n; ++j) {
+        const auto f_r1 = fs.data() + 6u * j * nf, f_l1 = f_r1 + nf, f_r2 = f_l1 + nf, f_l2 = f_r2 + nf,
+                   f_r3 = f_l2 + nf, f_l3 = f_r3 + nf;
+        for (decltype(fs.size()) i = 0u; i < nf; ++i) {
+            double m1 = (f_r1[i] - f_l1[i]) / 2.;
+            double m2 = (f_r2[i] - f_l2[i]) / 4.;
+            double m3 = (f_r3[i] - f_l3[i]) / 6.;
+            double fifteen_m1 = 15. * m1;
+            double six_m2 = 6. * m2;
+            double ten_h = 10. * h[j];
+            gradient[j + i * n] = ((fifteen_m1 - six_m2) + m3) / ten_h;
+        }
+    }
+    return gradient;
+}
+
 } // namespace pagmo
 // namespace pagmo
 
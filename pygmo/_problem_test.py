@@ -70,6 +70,94 @@ class problem_test_case(_ut.TestCase):
         self.run_name_info_tests()
         self.run_thread_safety_tests()
         self.run_pickle_test()
+        self.run_ndarr_tests()
+
+    def run_ndarr_tests(self):
+        # Test the arrays returned by the problem methods, whose
+        # data is owned by the C++ vectors.
+        from numpy import array
+        from .core import problem, rosenbrock, bfe, default_bfe
+        import gc
+
+        prob = problem(rosenbrock(2))
+        f = prob.fitness([1., 1.])
+        self.assertTrue(f.flags.writeable)
+        self.assertTrue(f.flags.c_contiguous)
+        self.assertEqual(f.dtype.name, 'float64')
+        f[0] = 42.
+        self.assertEqual(f[0], 42.)
+        b = bfe(default_bfe())
+        fs = b(prob, array([1., 1., 0., 0.]))
+        del prob
+        gc.collect()
+        self.assertTrue(all(fs == array([0., 1.])))
+        self.assertTrue(all(fs.copy() == fs))
+        prob = problem(rosenbrock(2))
+        self.assertEqual(len(b(prob, array([]))), 0)
+        # Views and non-contiguous arrays are accepted in input.
+        x = array([[1., 0.], [1., 0.]])
+        self.assertTrue(all(prob.fitness(x[:, 0]) == array([0.])))
+        self.assertTrue(all(b(prob, x.T.ravel()[::-1]) == array([1., 0.])))
+        self.assertTrue(all(prob.fitness(array([1, 1])) == array([0.])))
+
+        # The batch_fitness() method of the UDP receives a read-only
+        # view on the decision vectors.
+        class p(object):
+
+            def get_bounds(self):
+                return ([0.], [1.])
+
+            def fitness(self, a):
+                return [a[0]]
+
+            def batch_fitness(self, dvs):
+                assert not dvs.flags.writeable
+                assert dvs.dtype.name == 'float64'
+                try:
+                    dvs[0] = 42.
+                    assert False
+                except ValueError:
+                    pass
+                return dvs * 2.
+
+        prob = problem(p())
+        self.assertTrue(all(prob.batch_fitness(array([.1, .2, .3])) == array([.2, .4, .6])))
+        self.assertEqual(len(prob.batch_fitness(array([]))), 0)
+        self.assertTrue(all(b(prob, array([.5, .25])) == array([1., .5])))
+
+        # The UDP cannot retain the view.
+        class p(object):
+
+            def get_bounds(self):
+                return ([0.], [1.])
+
+            def fitness(self, a):
+                return [a[0]]
+
+            def batch_fitness(self, dvs):
+                self.dvs = dvs[1:]
+                return dvs.copy()
+
+        prob = problem(p())
+        self.assertRaises(RuntimeError, lambda: prob.batch_fitness(array([.1, .2])))
+
+        # Copies can be retained.
+        class p(object):
+
+            def get_bounds(self):
+                return ([0.], [1.])
+
+            def fitness(self, a):
+                return [a[0]]
+
+            def batch_fitness(self, dvs):
+                self.dvs = array(dvs)
+                return self.dvs
+
+        prob = problem(p())
+        self.assertTrue(all(prob.batch_fitness(array([.1, .2])) == array([.1, .2])))
+        self.assertTrue(all(prob.extract(p).dvs == array([.1, .2])))
+        self.assertTrue(prob.extract(p).dvs.flags.writeable)
 
     def run_basic_tests(self):
         # Tests for minimal problem, and mandatory methods.
@@ -36,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -193,6 +194,102 @@ inline bp::object vector_to_ndarr(const std::vector<T> &v)
     return retval;
 }
 
+namespace detail
+{
+
+// Name of the capsules owning the data of the NumPy arrays created
+// from rvalue vectors.
+constexpr const char *vector_capsule_name = "pygmo.vector";
+
+// Destructor of the capsules owning the data of the NumPy arrays created
+// from rvalue vectors.
+template <typename T>
+inline void vector_capsule_dtor(PyObject *caps)
+{
+    delete static_cast<std::vector<T> *>(PyCapsule_GetPointer(caps, vector_capsule_name));
+}
+
+} // namespace detail
+
+// Convert an rvalue vector of arithmetic types into a 1D numpy array, without copying
+// the data. The vector is moved into a capsule which becomes the base object
+// of the array, so that the lifetime of the data is tied to the lifetime of the array.
+template <typename T>
+inline bp::object vector_to_ndarr(std::vector<T> &&v)
+{
+    if (v.empty()) {
+        // NOTE: empty vectors might not have a valid data pointer,
+        // just create a new empty array.
+        return vector_to_ndarr(static_cast<const std::vector<T> &>(v));
+    }
+    // Move the vector to the heap, and hand it over to a capsule.
+    std::unique_ptr<std::vector<T>> ptr(new std::vector<T>(std::move(v)));
+    T *data = ptr->data();
+    npy_intp dims[] = {boost::numeric_cast<npy_intp>(ptr->size())};
+    PyObject *caps = PyCapsule_New(ptr.get(), detail::vector_capsule_name, detail::vector_capsule_dtor<T>);
+    if (!caps) {
+        bp::throw_error_already_set();
+    }
+    // The capsule now owns the vector.
+    ptr.release();
+    bp::object caps_obj{bp::handle<>(caps)};
+    // Create an array on top of the data owned by the capsule.
+    PyObject *ret = PyArray_SimpleNewFromData(1, dims, cpp_npy<T>::value, static_cast<void *>(data));
+    if (!ret) {
+        pygmo_throw(PyExc_RuntimeError,
+                    "couldn't create a NumPy array: the 'PyArray_SimpleNewFromData()' function failed");
+    }
+    bp::object retval{bp::handle<>(ret)};
+    // Set the capsule as base object of the array. NOTE: PyArray_SetBaseObject()
+    // steals a reference to the base object, also in case of errors.
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(ret), bp::incref(caps_obj.ptr()))) {
+        bp::throw_error_already_set();
+    }
+    return retval;
+}
+
+// Create a read-only 1D numpy array viewing the data of a vector of arithmetic types,
+// without copying it. The array does not own the data: the caller must make sure
+// that the array is not used after the destruction of v (see
+// check_ndarr_view_released()).
+template <typename T>
+inline bp::object vector_to_ndarr_view(const std::vector<T> &v)
+{
+    if (v.empty()) {
+        // NOTE: empty vectors might not have a valid data pointer,
+        // just create a new empty read-only array.
+        auto retval = vector_to_ndarr(v);
+        PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(retval.ptr()), NPY_ARRAY_WRITEABLE);
+        return retval;
+    }
+    npy_intp dims[] = {boost::numeric_cast<npy_intp>(v.size())};
+    // NOTE: the const_cast is safe, as NPY_ARRAY_CARRAY_RO does not include
+    // the NPY_ARRAY_WRITEABLE flag and NumPy will thus refuse to write into the array.
+    PyObject *ret = PyArray_New(&PyArray_Type, 1, dims, cpp_npy<T>::value, nullptr,
+                                static_cast<void *>(const_cast<T *>(v.data())), 0, NPY_ARRAY_CARRAY_RO, nullptr);
+    if (!ret) {
+        pygmo_throw(PyExc_RuntimeError, "couldn't create a NumPy array: the 'PyArray_New()' function failed");
+    }
+    return bp::object{bp::handle<>(ret)};
+}
+
+// Check that a view created by vector_to_ndarr_view() and passed to a Python
+// function has not been retained by the function. name is the name of the function,
+// used in the error message.
+inline void check_ndarr_view_released(const bp::object &view, const std::string &name)
+{
+    // NOTE: when the function did not store the view (or a view derived from it)
+    // anywhere, view is the only reference left.
+    if (Py_REFCNT(view.ptr()) != 1) {
+        pygmo_throw(PyExc_RuntimeError,
+                    ("the read-only NumPy array passed to the " + name
+                     + " method has been retained beyond the end of the call: the data of the array is owned "
+                       "by pygmo and it is valid only for the duration of the call. Use numpy.array() to make "
+                       "a copy of the array if you need to store it")
+                        .c_str());
+    }
+}
+
 // Convert a vector of vectors of arithmetic types into a 2D numpy array.
 template <typename T>
 inline bp::object vvector_to_ndarr(const std::vector<std::vector<T>> &v)
@@ -271,13 +368,15 @@ inline Vector obj_to_vector(const bp::object &o)
     using value_t = typename Vector::value_type;
 
     // Check if o is a numpy array.
-    bp::object a = bp::import("numpy").attr("ndarray");
-    if (isinstance(o, a)) {
+    // NOTE: use PyArray_Check() rather than isinstance(), in order to avoid
+    // importing NumPy and calling into Python at every conversion.
+    if (PyArray_Check(o.ptr())) {
         // NOTE: the idea here is that we want to be able to convert
         // from a numpy array of types other than value_t. This is useful
         // because one can then create arrays of other types and have them
         // converted on the fly. If the array is already of the correct type,
-        // this function should not do any copy.
+        // this function should not do any copy: a C-contiguous, aligned array of value_t
+        // is returned as-is by PyArray_FROM_OTF(), and its data is then read directly.
         auto n = PyArray_FROM_OTF(o.ptr(), cpp_npy<value_t>::value, NPY_ARRAY_IN_ARRAY);
         if (!n) {
             bp::throw_error_already_set();
@@ -320,12 +419,10 @@ inline VVector ndarr_to_vvector(PyArrayObject *o)
     const auto size = boost::numeric_cast<size_type>(PyArray_SHAPE(o)[0]);
     VVector retval;
     if (size) {
+        retval.reserve(size);
         auto data = static_cast<value_t *>(PyArray_DATA(o));
         const auto ssize = PyArray_SHAPE(o)[1];
         for (size_type i = 0; i < size; ++i, data += ssize) {
-            // NOTE: here and elsewhere in this header where we
-            // use push_back()/emplace_back(), we should really reserve()
-            // beforeheand.
             retval.push_back(typename VVector::value_type(data, data + ssize));
         }
     }
@@ -339,8 +436,7 @@ inline VVector obj_to_vvector(const bp::object &o)
 {
     using value_t = typename VVector::value_type::value_type;
 
-    bp::object a = bp::import("numpy").attr("ndarray");
-    if (isinstance(o, a)) {
+    if (PyArray_Check(o.ptr())) {
         auto n = PyArray_FROM_OTF(o.ptr(), cpp_npy<value_t>::value, NPY_ARRAY_IN_ARRAY);
         if (!n) {
             bp::throw_error_already_set();
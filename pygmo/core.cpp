@@ -51,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <boost/numeric/conversion/cast.hpp>
@@ -636,7 +637,8 @@ BOOST_PYTHON_MODULE(core)
              pygmo::problem_fitness_docstring().c_str(), (bp::arg("dv")))
         .def("get_bounds", lcast([](const pagmo::problem &p) -> bp::tuple {
                  auto retval = p.get_bounds();
-                 return bp::make_tuple(pygmo::vector_to_ndarr(retval.first), pygmo::vector_to_ndarr(retval.second));
+                 return bp::make_tuple(pygmo::vector_to_ndarr(std::move(retval.first)),
+                                       pygmo::vector_to_ndarr(std::move(retval.second)));
              }),
              pygmo::problem_get_bounds_docstring().c_str())
         .def("get_lb", lcast([](const pagmo::problem &p) { return pygmo::vector_to_ndarr(p.get_lb()); }),
@@ -660,9 +662,9 @@ BOOST_PYTHON_MODULE(core)
              pygmo::problem_has_gradient_sparsity_docstring().c_str())
         .def("hessians", lcast([](const pagmo::problem &p, const bp::object &dv) -> bp::list {
                  bp::list retval;
-                 const auto h = p.hessians(pygmo::obj_to_vector<vector_double>(dv));
-                 for (const auto &v : h) {
-                     retval.append(pygmo::vector_to_ndarr(v));
+                 auto h = p.hessians(pygmo::obj_to_vector<vector_double>(dv));
+                 for (auto &v : h) {
+                     retval.append(pygmo::vector_to_ndarr(std::move(v)));
                  }
                  return retval;
              }),
@@ -913,16 +915,14 @@ BOOST_PYTHON_MODULE(core)
     bp::def("random_decision_vector", lcast([](const pagmo::problem &p) -> bp::object {
                 using reng_t = pagmo::detail::random_engine_type;
                 reng_t tmp_rng(static_cast<reng_t::result_type>(pagmo::random_device::next()));
-                auto retval = random_decision_vector(p, tmp_rng);
-                return pygmo::vector_to_ndarr(retval);
+                return pygmo::vector_to_ndarr(random_decision_vector(p, tmp_rng));
             }),
             pygmo::random_decision_vector_docstring().c_str(), (bp::arg("prob")));
     bp::def("batch_random_decision_vector",
             lcast([](const pagmo::problem &p, pagmo::vector_double::size_type n) -> bp::object {
                 using reng_t = pagmo::detail::random_engine_type;
                 reng_t tmp_rng(static_cast<reng_t::result_type>(pagmo::random_device::next()));
-                auto retval = batch_random_decision_vector(p, n, tmp_rng);
-                return pygmo::vector_to_ndarr(retval);
+                return pygmo::vector_to_ndarr(batch_random_decision_vector(p, n, tmp_rng));
             }),
             pygmo::batch_random_decision_vector_docstring().c_str(), (bp::arg("prob"), bp::arg("n")));
 
@@ -939,16 +939,14 @@ BOOST_PYTHON_MODULE(core)
                 auto f = [&func](const vector_double &x_) {
                     return pygmo::obj_to_vector<vector_double>(func(pygmo::vector_to_ndarr(x_)));
                 };
-                auto retval = estimate_gradient(f, pygmo::obj_to_vector<vector_double>(x), dx);
-                return pygmo::vector_to_ndarr(retval);
+                return pygmo::vector_to_ndarr(estimate_gradient(f, pygmo::obj_to_vector<vector_double>(x), dx));
             }),
             pygmo::estimate_gradient_docstring().c_str(), (bp::arg("callable"), bp::arg("x"), bp::arg("dx") = 1e-8));
     bp::def("estimate_gradient_h", lcast([](const bp::object &func, const bp::object &x, double dx) -> bp::object {
                 auto f = [&func](const vector_double &x_) {
                     return pygmo::obj_to_vector<vector_double>(func(pygmo::vector_to_ndarr(x_)));
                 };
-                auto retval = estimate_gradient_h(f, pygmo::obj_to_vector<vector_double>(x), dx);
-                return pygmo::vector_to_ndarr(retval);
+                return pygmo::vector_to_ndarr(estimate_gradient_h(f, pygmo::obj_to_vector<vector_double>(x), dx));
             }),
             pygmo::estimate_gradient_h_docstring().c_str(), (bp::arg("callable"), bp::arg("x"), bp::arg("dx") = 1e-2));
     // Constrained optimization utilities
@@ -1107,7 +1105,8 @@ BOOST_PYTHON_MODULE(core)
         // Topology methods.
         .def("get_connections", lcast([](const topology &t, std::size_t n) -> bp::tuple {
                  auto ret = t.get_connections(n);
-                 return bp::make_tuple(pygmo::vector_to_ndarr(ret.first), pygmo::vector_to_ndarr(ret.second));
+                 return bp::make_tuple(pygmo::vector_to_ndarr(std::move(ret.first)),
+                                       pygmo::vector_to_ndarr(std::move(ret.second)));
              }),
              pygmo::topology_get_connections_docstring().c_str(), (bp::arg("prob"), bp::arg("dvs")))
         .def("push_back", lcast([](topology &t, unsigned n) { t.push_back(n); }),
@@ -261,6 +261,9 @@ This method will return the fitness vectors of the individuals as a 2D NumPy arr
 Each row of the returned array represents the fitness vector of the individual at the corresponding position in the
 population.
 
+The returned array is always a copy: the fitness vectors are stored as separate, non-contiguous vectors which
+are reallocated when the population is modified, thus they cannot be exposed as a NumPy view.
+
 Returns:
     2D NumPy float array: a deep copy of the fitness vectors of the individuals
 
@@ -280,6 +283,9 @@ This method will return the chromosomes of the individuals as a 2D NumPy array.
 Each row of the returned array represents the chromosome of the individual at the corresponding position in the
 population.
 
+The returned array is always a copy: the chromosomes are stored as separate, non-contiguous vectors which
+are reallocated when the population is modified, thus they cannot be exposed as a NumPy view.
+
 Returns:
     2D NumPy float array: a deep copy of the chromosomes of the individuals
 
@@ -566,6 +572,10 @@ A successful call of this method will increase the internal fitness evaluation c
 
 The ``batch_fitness()`` method of the UDP must be able to take as input the decision vectors as a 1D NumPy array,
 and it must return the fitness vectors as an iterable Python object (e.g., 1D NumPy array, list, tuple, etc.).
+In order to avoid copying large batches of decision vectors, the array passed to the ``batch_fitness()`` method
+of the UDP is a read-only view on data owned by pygmo which is valid only for the duration of the call. The UDP
+must not keep references to the array (or to views derived from it) after the call: if the array needs to be stored,
+a copy must be made (e.g., via :func:`numpy.array()`).
 
 Args:
     dvs (array-like object): the decision vectors (chromosomes) to be evaluated in batch mode
@@ -575,6 +585,7 @@ Returns:
 
 Raises:
     ValueError: if *dvs* and/or the return value are not compatible with the problem's properties
+    RuntimeError: if the ``batch_fitness()`` method of the UDP retains a reference to its input array
     unspecified: any exception thrown by the ``batch_fitness()`` method of the UDP, or by failures at the intersection
       between C++ and Python (e.g., type conversion errors, mismatched function signatures, etc.)
 
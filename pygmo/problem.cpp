@@ -129,7 +129,13 @@ vector_double prob_inner<bp::object>::batch_fitness(const vector_double &dv) con
                      + "': the method is either not present or not callable")
                         .c_str());
     }
-    return pygmo::obj_to_vector<vector_double>(bf(pygmo::vector_to_ndarr(dv)));
+    // NOTE: dv may be large, pass it to the UDP as a read-only view rather than copying it.
+    // dv is guaranteed to exist only for the duration of the call, thus we check
+    // afterwards that the UDP did not retain the view.
+    const auto dv_view = pygmo::vector_to_ndarr_view(dv);
+    auto retval = pygmo::obj_to_vector<vector_double>(bf(dv_view));
+    pygmo::check_ndarr_view_released(dv_view, "batch_fitness()");
+    return retval;
 }
 
 bool prob_inner<bp::object>::has_batch_fitness() const
@@ -209,6 +215,60 @@ vector_double prob_inner<bp::object>::gradient(const vector_double &dv) const
     return pygmo::obj_to_vector<vector_double>(g(pygmo::vector_to_ndarr(dv)));
 }
 
+bool prob_inner<bp::object>::has_fitness_and_gradient() const
+{
+    // Same logic as in C++:
+    // - without a fitness_and_gradient() method, return false;
+    // - with a fitness_and_gradient() and no override, return true;
+    // - with a fitness_and_gradient() and override, return the value from the override.
+    auto fg = pygmo::callable_attribute(m_value, "fitness_and_gradient");
+    if (fg.is_none()) {
+        return false;
+    }
+    auto hfg = pygmo::callable_attribute(m_value, "has_fitness_and_gradient");
+    if (hfg.is_none()) {
+        return true;
+    }
+    return bp::extract<bool>(hfg());
+}
+
+std::pair<vector_double, vector_double> prob_inner<bp::object>::fitness_and_gradient(const vector_double &dv) const
+{
+    auto fg = pygmo::callable_attribute(m_value, "fitness_and_gradient");
+    if (fg.is_none()) {
+        pygmo_throw(PyExc_NotImplementedError,
+                    ("the fitness_and_gradient() method has been invoked, but it is not implemented "
+                     "in the user-defined Python problem '"
+                     + pygmo::str(m_value) + "' of type '" + pygmo::str(pygmo::type(m_value))
+                     + "': the method is either not present or not callable")
+                        .c_str());
+    }
+    bp::tuple tup = bp::extract<bp::tuple>(fg(pygmo::vector_to_ndarr(dv)));
+    if (len(tup) != 2) {
+        pygmo_throw(PyExc_ValueError, ("the fitness and the gradient of the problem must be returned as a tuple of "
+                                       "2 elements, but the detected tuple size is "
+                                       + std::to_string(len(tup)))
+                                          .c_str());
+    }
+    return std::make_pair(pygmo::obj_to_vector<vector_double>(tup[0]), pygmo::obj_to_vector<vector_double>(tup[1]));
+}
+
+// NOTE: Python problems always return their fitness as a new array,
+// thus the raw buffer interface is never available.
+bool prob_inner<bp::object>::has_fitness_into() const
+{
+    return false;
+}
+
+void prob_inner<bp::object>::fitness_into(const double *, double *) const
+{
+    pygmo_throw(PyExc_NotImplementedError,
+                ("the fitness_into() method has been invoked, but it is not available "
+                 "for the user-defined Python problem '"
+                 + pygmo::str(m_value) + "' of type '" + pygmo::str(pygmo::type(m_value)) + "'")
+                    .c_str());
+}
+
 bool prob_inner<bp::object>::has_gradient_sparsity() const
 {
     // Same logic as in C++:
@@ -357,6 +417,11 @@ pagmo::thread_safety prob_inner<bp::object>::get_thread_safety() const
     return pagmo::thread_safety::none;
 }
 
+bool prob_inner<bp::object>::is_shareable() const
+{
+    return false;
+}
+
 } // namespace detail
 
 } // namespace pagmo
@@ -97,6 +97,10 @@ struct prob_inner<bp::object> final : prob_inner_base, pygmo::common_base {
     virtual std::string get_extra_info() const override final;
     virtual bool has_gradient() const override final;
     virtual vector_double gradient(const vector_double &) const override final;
+    virtual bool has_fitness_and_gradient() const override final;
+    virtual std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const override final;
+    virtual bool has_fitness_into() const override final;
+    virtual void fitness_into(const double *, double *) const override final;
     virtual bool has_gradient_sparsity() const override final;
     virtual sparsity_pattern gradient_sparsity() const override final;
     virtual bool has_hessians() const override final;
@@ -107,6 +111,8 @@ struct prob_inner<bp::object> final : prob_inner_base, pygmo::common_base {
     virtual bool has_set_seed() const override final;
     // Hard code no thread safety for python problems.
     virtual pagmo::thread_safety get_thread_safety() const override final;
+    // Python problems are never shared among problem copies.
+    virtual bool is_shareable() const override final;
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
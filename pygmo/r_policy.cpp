@@ -47,6 +47,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/python/tuple.hpp>
 
 #include <pagmo/detail/make_unique.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/r_policy.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
@@ -123,6 +124,24 @@ r_pol_inner<bp::object>::replace(const individuals_group_t &inds, const vector_d
     }
 }
 
+// NOTE: pythonic replacement policies never provide the in-place replacement.
+bool r_pol_inner<bp::object>::has_replace_in_place() const
+{
+    return false;
+}
+
+replacement_plan_t r_pol_inner<bp::object>::replace_in_place(const individuals_view_t &,
+                                                             const vector_double::size_type &,
+                                                             const vector_double::size_type &,
+                                                             const vector_double::size_type &,
+                                                             const vector_double::size_type &,
+                                                             const vector_double::size_type &, const vector_double &,
+                                                             const individuals_group_t &) const
+{
+    pagmo_throw(not_implemented_error,
+                "The replace_in_place() method is not implemented in pythonic replacement policies");
+}
+
 std::string r_pol_inner<bp::object>::get_name() const
 {
     return getter_wrapper<std::string>(m_value, "get_name", pygmo::str(pygmo::type(m_value)));
@@ -76,6 +76,12 @@ struct r_pol_inner<bp::object> final : r_pol_inner_base, pygmo::common_base {
                                         const vector_double::size_type &, const vector_double::size_type &,
                                         const vector_double &, const individuals_group_t &) const override final;
     // Optional methods.
+    virtual bool has_replace_in_place() const override final;
+    virtual replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                                const vector_double::size_type &, const vector_double::size_type &,
+                                                const vector_double::size_type &, const vector_double::size_type &,
+                                                const vector_double &,
+                                                const individuals_group_t &) const override final;
     virtual std::string get_name() const override final;
     virtual std::string get_extra_info() const override final;
     template <typename Archive>
@@ -47,6 +47,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/python/tuple.hpp>
 
 #include <pagmo/detail/make_unique.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/s_policy.hpp>
 #include <pagmo/types.hpp>
@@ -123,6 +124,23 @@ individuals_group_t s_pol_inner<bp::object>::select(const individuals_group_t &i
     }
 }
 
+// NOTE: pythonic selection policies never provide the selection from a view
+// (s_policy::select_view() will fall back to select()).
+bool s_pol_inner<bp::object>::has_select_view() const
+{
+    return false;
+}
+
+individuals_group_t s_pol_inner<bp::object>::select_view(const individuals_view_t &, const vector_double::size_type &,
+                                                         const vector_double::size_type &,
+                                                         const vector_double::size_type &,
+                                                         const vector_double::size_type &,
+                                                         const vector_double::size_type &, const vector_double &) const
+{
+    pagmo_throw(not_implemented_error,
+                "The select_view() method is not implemented in pythonic selection policies");
+}
+
 std::string s_pol_inner<bp::object>::get_name() const
 {
     return getter_wrapper<std::string>(m_value, "get_name", pygmo::str(pygmo::type(m_value)));
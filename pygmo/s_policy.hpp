@@ -76,6 +76,11 @@ struct s_pol_inner<bp::object> final : s_pol_inner_base, pygmo::common_base {
                                        const vector_double::size_type &, const vector_double::size_type &,
                                        const vector_double &) const override final;
     // Optional methods.
+    virtual bool has_select_view() const override final;
+    virtual individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double &) const override final;
     virtual std::string get_name() const override final;
     virtual std::string get_extra_info() const override final;
     template <typename Archive>
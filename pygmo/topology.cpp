@@ -51,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/python/tuple.hpp>
 
 #include <pagmo/detail/make_unique.hpp>
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/topology.hpp>
 #include <pagmo/types.hpp>
@@ -168,6 +169,16 @@ std::string topo_inner<bp::object>::get_extra_info() const
     return getter_wrapper<std::string>(m_value, "get_extra_info", std::string{});
 }
 
+bool topo_inner<bp::object>::has_to_csr() const
+{
+    return false;
+}
+
+std::shared_ptr<const topology_csr> topo_inner<bp::object>::to_csr() const
+{
+    pagmo_throw(not_implemented_error, "A CSR snapshot has been requested but it is not implemented in the UDT");
+}
+
 } // namespace detail
 
 } // namespace pagmo
@@ -78,6 +78,9 @@ struct topo_inner<bp::object> final : topo_inner_base, pygmo::common_base {
     // Optional methods.
     virtual std::string get_name() const override final;
     virtual std::string get_extra_info() const override final;
+    // CSR snapshots are not supported by pythonic topologies.
+    virtual bool has_to_csr() const override final;
+    virtual std::shared_ptr<const topology_csr> to_csr() const override final;
     template <typename Archive>
     void save(Archive &ar, unsigned) const
     {
@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -35,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <pagmo/algorithm.hpp>
@@ -45,6 +47,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
+#include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
@@ -156,8 +159,7 @@ population cmaes::evolve(population pop) const
 
     // Initializing the random number generators
     std::uniform_real_distribution<double> randomly_distributed_number(0., 1.); // to generate a number in [0, 1)
-    std::normal_distribution<double> normally_distributed_number(
-        0., 1.); // to generate a normally distributed number        // Setting coefficients for Selection
+    // Setting coefficients for Selection
     Eigen::VectorXd weights(_(mu));
     for (decltype(weights.rows()) i = 0; i < weights.rows(); ++i) {
         weights(i) = std::log(static_cast<double>(mu) + 0.5) - std::log(static_cast<double>(i) + 1.);
@@ -238,12 +240,13 @@ population cmaes::evolve(population pop) const
     // ----------------------------------------------//
     Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(_(dim));
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
-        // 1 - We generate and evaluate lam new individuals
+        // 1 - We generate and evaluate lam new individuals. The normal deviates of the i-th
+        // individual are drawn in bulk from the i-th stream of a counter-based engine, keyed once per generation.
+        const auto gen_key = std::uniform_int_distribution<std::uint64_t>()(m_e);
         for (decltype(lam) i = 0u; i < lam; ++i) {
             // 1a - we create a randomly normal distributed vector
-            for (decltype(dim) j = 0u; j < dim; ++j) {
-                tmp(_(j)) = normally_distributed_number(m_e);
-            }
+            philox4x32 eng(gen_key, i);
+            eng.generate_normal(tmp.data(), dim);
             // 1b - and store its transformed value in the newpop
             newpop[i] = mean + (sigma * B * D * tmp);
         }
@@ -312,12 +315,15 @@ population cmaes::evolve(population pop) const
             pop.get_problem().set_seed(std::uniform_int_distribution<unsigned>()(m_e));
         }
         // Reinsertion
+        std::vector<vector_double> new_x(lam), new_f(lam);
         for (decltype(lam) i = 0u; i < lam; ++i) {
             for (decltype(dim) j = 0u; j < dim; ++j) {
                 dumb[j] = newpop[i](_(j));
             }
-            pop.set_x(i, dumb);
+            new_f[i] = prob.fitness(dumb);
+            new_x[i] = dumb;
         }
+        pop.assign_batch(std::move(new_x), std::move(new_f));
         counteval += lam;
         // 4 - We extract the elite from this generation.
         std::vector<population::size_type> best_idx(lam);
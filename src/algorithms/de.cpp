@@ -26,10 +26,11 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
-#include <numeric>
 #include <random>
 #include <stdexcept>
 #include <string>
@@ -44,6 +45,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
 
 namespace pagmo
 {
@@ -80,8 +82,6 @@ population de::evolve(population pop) const
                                           // allowed
     auto dim = prob.get_nx();             // This getter does not return a const reference but a copy
     const auto bounds = prob.get_bounds();
-    const auto &lb = bounds.first;
-    const auto &ub = bounds.second;
     auto NP = pop.size();
     auto prob_f_dimension = prob.get_nf();
     auto fevals0 = prob.get_fevals(); // disount for the already made fevals
@@ -116,10 +116,7 @@ population de::evolve(population pop) const
     m_log.clear();
 
     // Some vectors used during evolution are declared.
-    vector_double tmp(dim);                              // contains the mutated candidate
-    std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
-    std::uniform_int_distribution<vector_double::size_type> c_idx(
-        0u, dim - 1u); // to generate a random index for the chromosome
+    vector_double tmp(dim); // contains the mutated candidate
 
     // We extract from pop the chromosomes and fitness associated
     auto popold = pop.get_x();
@@ -133,150 +130,20 @@ population de::evolve(population pop) const
     auto gbfit = fit[best_idx];
     // the best decision vector of a generation
     auto gbIter = gbX;
-    std::vector<vector_double::size_type> r(5); // indexes of 5 selected population members
 
     // Main DE iterations
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
+        // NOTE: the trial vectors depend only on popold and gbIter, hence they can be generated
+        // in a single batch before the loop through the population. The random numbers used to generate
+        // the i-th trial vector are drawn from the i-th stream of a counter-based engine, keyed once per
+        // generation. The trial vectors are forced within the bounds by random reinitialisation.
+        const auto trials = de_trial_batch(popold, gbIter, m_variant, m_F, m_CR, bounds,
+                                           std::uniform_int_distribution<std::uint64_t>()(m_e));
         // Start of the loop through the population
         for (decltype(NP) i = 0u; i < NP; ++i) {
-            /*-----We select at random 5 indexes from the population---------------------------------*/
-            std::vector<vector_double::size_type> idxs(NP);
-            std::iota(idxs.begin(), idxs.end(), vector_double::size_type(0u));
-            for (auto j = 0u; j < 5u; ++j) { // Durstenfeld's algorithm to select 5 indexes at random
-                auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(m_e);
-                r[j] = idxs[idx];
-                std::swap(idxs[idx], idxs[NP - 1u - j]);
-            }
-
-            /*-------DE/best/1/exp--------------------------------------------------------------------*/
-            /*-------The oldest DE variant but still not bad. However, we have found several---------*/
-            /*-------optimization problems where misconvergence occurs.-------------------------------*/
-            if (m_variant == 1u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-
-            /*-------DE/rand/1/exp-------------------------------------------------------------------*/
-            /*-------This is one of my favourite strategies. It works especially well when the-------*/
-            /*-------"gbIter[]"-schemes experience misconvergence. Try e.g. m_F=0.7 and m_CR=0.5---------*/
-            /*-------as a first guess.---------------------------------------------------------------*/
-            else if (m_variant == 2u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                decltype(dim) L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/rand-to-best/1/exp-----------------------------------------------------------*/
-            /*-------This variant seems to be one of the best strategies. Try m_F=0.85 and m_CR=1.------*/
-            /*-------If you get misconvergence try to increase NP. If this doesn't help you----------*/
-            /*-------should play around with all three control variables.----------------------------*/
-            else if (m_variant == 3u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = tmp[n] + m_F * (gbIter[n] - tmp[n]) + m_F * (popold[r[0]][n] - popold[r[1]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/best/2/exp is another powerful variant worth trying--------------------------*/
-            else if (m_variant == 4u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-            /*-------DE/rand/2/exp seems to be a robust optimizer for many functions-------------------*/
-            else if (m_variant == 5u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[4]][n]
-                             + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < m_CR) && (L < dim));
-            }
-
-            /*=======Essentially same strategies but BINOMIAL CROSSOVER===============================*/
-            /*-------DE/best/1/bin--------------------------------------------------------------------*/
-            else if (m_variant == 6u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = gbIter[n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand/1/bin-------------------------------------------------------------------*/
-            else if (m_variant == 7u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + m_F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand-to-best/1/bin-----------------------------------------------------------*/
-            else if (m_variant == 8u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = tmp[n] + m_F * (gbIter[n] - tmp[n]) + m_F * (popold[r[0]][n] - popold[r[1]][n]);
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/best/2/bin--------------------------------------------------------------------*/
-            else if (m_variant == 9u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n]
-                            = gbIter[n] + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-            /*-------DE/rand/2/bin--------------------------------------------------------------------*/
-            else if (m_variant == 10u) {
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {     /* perform Dc binomial trials */
-                    if ((drng(m_e) < m_CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[4]][n]
-                                 + (popold[r[0]][n] + popold[r[1]][n] - popold[r[2]][n] - popold[r[3]][n]) * m_F;
-                    }
-                    n = (n + 1u) % dim;
-                }
-            }
-
-            // Trial mutation now in tmp. force feasibility and see how good this choice really was.
-            // a) feasibility
-            // detail::force_bounds_reflection(tmp, lb, ub); // TODO: check if this choice is better
-            detail::force_bounds_random(tmp, lb, ub, m_e);
+            // a) the trial vector.
+            std::copy(trials.begin() + static_cast<vector_double::difference_type>(i * dim),
+                      trials.begin() + static_cast<vector_double::difference_type>((i + 1u) * dim), tmp.begin());
             // b) how good?
             auto newfitness = prob.fitness(tmp); /* Evaluates tmp[] */
             if (newfitness[0] <= fit[i][0]) {    /* improved objective function value ? */
@@ -160,6 +160,7 @@ struct ipopt_nlp final : Ipopt::TNLP {
 
         // Prepare the dv used for fitness computation.
         m_dv.resize(m_start.size());
+        m_x.resize(m_start.size());
 
         // This will contain the solution.
         m_sol.resize(m_start.size());
@@ -343,12 +344,8 @@ struct ipopt_nlp final : Ipopt::TNLP {
     {
         try {
             assert(n == boost::numeric_cast<Index>(m_prob.get_nx()));
-            // NOTE: the new_x boolean flag will be false if the last call to any of the eval_* function
-            // used the same x value. Probably we can ignore this in favour of the upcoming caches work.
-            (void)new_x;
 
-            std::copy(x, x + n, m_dv.begin());
-            const auto fitness = m_prob.fitness(m_dv);
+            const auto &fitness = fitness_at(n, x, new_x);
             obj_value = fitness[0];
 
             // Update the log if requested.
@@ -394,11 +391,9 @@ struct ipopt_nlp final : Ipopt::TNLP {
     {
         try {
             assert(n == boost::numeric_cast<Index>(m_prob.get_nx()));
-            (void)new_x;
 
-            std::copy(x, x + n, m_dv.begin());
             // Compute the full gradient (this includes the constraints as well).
-            const auto gradient = m_prob.gradient(m_dv);
+            const auto &gradient = gradient_at(n, x, new_x);
 
             if (m_prob.has_gradient_sparsity()) {
                 // Sparse gradient case.
@@ -431,10 +426,8 @@ struct ipopt_nlp final : Ipopt::TNLP {
         try {
             assert(n == boost::numeric_cast<Index>(m_prob.get_nx()));
             assert(m == boost::numeric_cast<Index>(m_prob.get_nc()));
-            (void)new_x;
 
-            std::copy(x, x + n, m_dv.begin());
-            const auto fitness = m_prob.fitness(m_dv);
+            const auto &fitness = fitness_at(n, x, new_x);
 
             // Eq. constraints.
             std::copy(fitness.data() + 1, fitness.data() + 1 + m_prob.get_nec(), g);
@@ -459,11 +452,9 @@ struct ipopt_nlp final : Ipopt::TNLP {
             assert(n == boost::numeric_cast<Index>(m_prob.get_nx()));
             assert(m == boost::numeric_cast<Index>(m_prob.get_nc()));
             assert(nele_jac == boost::numeric_cast<Index>(m_jac_sp.size()));
-            (void)new_x;
 
             if (values) {
-                std::copy(x, x + n, m_dv.begin());
-                const auto gradient = m_prob.gradient(m_dv);
+                const auto &gradient = gradient_at(n, x, new_x);
                 // NOTE: here we need the gradients of the constraints only, so we need to discard the gradient of the
                 // objfun. If the gradient sparsity is user-provided, then the size of the objfun sparse gradient is
                 // m_obj_g_sp.size(), otherwise the gradient is dense and its size is nx.
@@ -493,9 +484,12 @@ struct ipopt_nlp final : Ipopt::TNLP {
             assert(n == boost::numeric_cast<Index>(m_prob.get_nx()));
             assert(m == boost::numeric_cast<Index>(m_prob.get_nc()));
             assert(nele_hess == boost::numeric_cast<Index>(m_lag_sp.size()));
-            (void)new_x;
             (void)new_lambda;
 
+            // NOTE: the new_x flag will be false if the last call to any of the eval_* functions
+            // used the same x value. Hence, we need to update the cached point here as well.
+            update_x(n, x, new_x);
+
             if (!m_prob.has_hessians()) {
                 pagmo_throw(
                     std::invalid_argument,
@@ -611,6 +605,59 @@ struct ipopt_nlp final : Ipopt::TNLP {
         m_status = status;
     }
 
+    // Helpers to compute the fitness and the gradient at x.
+    // NOTE: Ipopt calls eval_f() and eval_g() (and, similarly, eval_grad_f() and eval_jac_g())
+    // separately at the same x, and each of them needs the full fitness (or gradient). Hence,
+    // we cache the fitness and the gradient of the last x, and we recompute them only when
+    // x changes. Ipopt signals a change in x via the new_x flag, which will be false if the last
+    // call to any of the eval_* functions used the same x value. When new_x is true we still
+    // compare x to the cached point, which is cheaper than a fitness evaluation.
+    void update_x(Index n, const Number *x, bool new_x)
+    {
+        if (new_x && !std::equal(x, x + n, m_x.begin())) {
+            m_f_valid = false;
+            m_g_valid = false;
+            std::copy(x, x + n, m_x.begin());
+        }
+    }
+    // If the problem provides a fused fitness_and_gradient() method, fitness and gradient
+    // are computed with a single call the first time either is requested at a new x.
+    void fused_fitness_gradient()
+    {
+        assert(m_prob.has_fitness_and_gradient());
+        auto fg = m_prob.fitness_and_gradient(m_x);
+        m_f = std::move(fg.first);
+        m_g = std::move(fg.second);
+        m_f_valid = true;
+        m_g_valid = true;
+    }
+    const vector_double &fitness_at(Index n, const Number *x, bool new_x)
+    {
+        update_x(n, x, new_x);
+        if (!m_f_valid) {
+            if (m_prob.has_fitness_and_gradient()) {
+                fused_fitness_gradient();
+            } else {
+                m_f = m_prob.fitness(m_x);
+                m_f_valid = true;
+            }
+        }
+        return m_f;
+    }
+    const vector_double &gradient_at(Index n, const Number *x, bool new_x)
+    {
+        update_x(n, x, new_x);
+        if (!m_g_valid) {
+            if (!m_f_valid && m_prob.has_fitness_and_gradient()) {
+                fused_fitness_gradient();
+            } else {
+                m_g = m_prob.gradient(m_x);
+                m_g_valid = true;
+            }
+        }
+        return m_g;
+    }
+
     // Data members.
     // The pagmo problem.
     const problem &m_prob;
@@ -618,6 +665,14 @@ struct ipopt_nlp final : Ipopt::TNLP {
     const vector_double m_start;
     // Temporary dv used for fitness computation.
     vector_double m_dv;
+    // The last x at which the fitness and/or the gradient were requested,
+    // the cached fitness and gradient, and flags signalling if they
+    // refer to m_x.
+    vector_double m_x;
+    vector_double m_f;
+    vector_double m_g;
+    bool m_f_valid = false;
+    bool m_g_valid = false;
     // Dv of the solution.
     vector_double m_sol;
     // Final values of the constraints.
@@ -918,7 +973,10 @@ population ipopt::evolve(population pop) const
     }
 
     // Compute the new fitness vector.
-    const auto new_f = prob.fitness(inlp.m_sol);
+    // NOTE: the solution is usually the last point evaluated during the optimisation,
+    // in which case the fitness is fetched from the cache.
+    const auto new_f = inlp.fitness_at(boost::numeric_cast<detail::ipopt_nlp::Index>(inlp.m_sol.size()),
+                                       inlp.m_sol.data(), true);
 
     // Store the new individual into the population, but only if better.
     if (compare_fc(new_f, old_f, prob.get_nec(), prob.get_c_tol())) {
@@ -346,6 +346,37 @@ struct nlopt_obj {
         }
     }
 
+    // Compute the fitness at x and, if with_grad is true, also the gradient.
+    // NOTE: NLopt invokes the objective function and the constraints functions separately
+    // at the same x, and each of them needs the full fitness. Hence, we cache the fitness and the gradient
+    // of the last x, and we recompute them only when x changes. If the problem provides
+    // a fused fitness_and_gradient() method, it is used to compute both with a single call.
+    const std::pair<vector_double, vector_double> &eval_at(const double *x, bool with_grad)
+    {
+        if (!m_f_valid || !std::equal(x, x + m_dv.size(), m_dv.begin())) {
+            m_f_valid = false;
+            m_g_valid = false;
+            std::copy(x, x + m_dv.size(), m_dv.begin());
+        }
+        if (with_grad && !m_g_valid) {
+            if (!m_f_valid && m_prob.has_fitness_and_gradient()) {
+                m_fg = m_prob.fitness_and_gradient(m_dv);
+            } else {
+                if (!m_f_valid) {
+                    m_fg.first = m_prob.fitness(m_dv);
+                    m_f_valid = true;
+                }
+                m_fg.second = m_prob.gradient(m_dv);
+            }
+            m_f_valid = true;
+            m_g_valid = true;
+        } else if (!m_f_valid) {
+            m_fg.first = m_prob.fitness(m_dv);
+            m_f_valid = true;
+        }
+        return m_fg;
+    }
+
     // Delete all other ctors/assignment ops.
     nlopt_obj(const nlopt_obj &) = delete;
     nlopt_obj(nlopt_obj &&) = delete;
@@ -357,7 +388,12 @@ struct nlopt_obj {
     problem &m_prob;
     sparsity_pattern m_sp;
     std::unique_ptr<std::remove_pointer<::nlopt_opt>::type, void (*)(::nlopt_opt)> m_value;
+    // Decision vector of the last evaluation, and the cached fitness and
+    // gradient. The flags signal if the cached values refer to m_dv.
     vector_double m_dv;
+    std::pair<vector_double, vector_double> m_fg;
+    bool m_f_valid = false;
+    bool m_g_valid = false;
     unsigned m_verbosity;
     unsigned long m_objfun_counter = 0;
     log_type m_log;
@@ -381,14 +417,14 @@ double nlopt_objfun_wrapper(unsigned dim, const double *x, double *grad, void *f
     try {
         // A few shortcuts.
         auto &p = nlo.m_prob;
-        auto &dv = nlo.m_dv;
         const auto verb = nlo.m_verbosity;
         auto &f_count = nlo.m_objfun_counter;
         auto &log = nlo.m_log;
 
         // A couple of sanity checks.
         assert(dim == p.get_nx());
-        assert(dv.size() == dim);
+        assert(nlo.m_dv.size() == dim);
+        (void)dim;
 
         if (grad && !p.has_gradient()) {
             // If grad is not null, it means we are in an algorithm
@@ -401,16 +437,12 @@ double nlopt_objfun_wrapper(unsigned dim, const double *x, double *grad, void *f
                             + p.get_name() + "' does not provide it");
         }
 
-        // Copy the decision vector in our temporary dv vector_double,
-        // for use in the pagmo API.
-        std::copy(x, x + dim, dv.begin());
-
-        // Compute fitness.
-        const auto fitness = p.fitness(dv);
+        // Compute fitness and, if needed, gradient.
+        const auto &fg = nlo.eval_at(x, grad != nullptr);
+        const auto &fitness = fg.first;
 
-        // Compute gradient, if needed.
         if (grad) {
-            const auto gradient = p.gradient(dv);
+            const auto &gradient = fg.second;
 
             if (p.has_gradient_sparsity()) {
                 // Sparse gradient case.
@@ -489,11 +521,11 @@ void nlopt_ineq_c_wrapper(unsigned m, double *result, unsigned dim, const double
     try {
         // A few shortcuts.
         auto &p = nlo.m_prob;
-        auto &dv = nlo.m_dv;
 
         // A couple of sanity checks.
         assert(dim == p.get_nx());
-        assert(dv.size() == dim);
+        assert(nlo.m_dv.size() == dim);
+        (void)dim;
         assert(m == p.get_nic());
         (void)m;
 
@@ -508,18 +540,15 @@ void nlopt_ineq_c_wrapper(unsigned m, double *result, unsigned dim, const double
                                                    + p.get_name() + "' does not provide it");
         }
 
-        // Copy the decision vector in our temporary dv vector_double,
-        // for use in the pagmo API.
-        std::copy(x, x + dim, dv.begin());
-
-        // Compute fitness and write IC to the output.
+        // Compute fitness (and gradient, if requested) and write IC to the output.
         // NOTE: fitness is nobj + nec + nic.
-        const auto fitness = p.fitness(dv);
+        const auto &fg = nlo.eval_at(x, grad != nullptr);
+        const auto &fitness = fg.first;
         nlopt_obj::unchecked_copy(p.get_nic(), fitness.data() + 1 + p.get_nec(), result);
 
         if (grad) {
             // Handle gradient, if requested.
-            const auto gradient = p.gradient(dv);
+            const auto &gradient = fg.second;
 
             if (p.has_gradient_sparsity()) {
                 // Sparse gradient.
@@ -576,11 +605,11 @@ void nlopt_eq_c_wrapper(unsigned m, double *result, unsigned dim, const double *
     try {
         // A few shortcuts.
         auto &p = nlo.m_prob;
-        auto &dv = nlo.m_dv;
 
         // A couple of sanity checks.
         assert(dim == p.get_nx());
-        assert(dv.size() == dim);
+        assert(nlo.m_dv.size() == dim);
+        (void)dim;
         assert(m == p.get_nec());
 
         if (grad && !p.has_gradient()) {
@@ -594,18 +623,15 @@ void nlopt_eq_c_wrapper(unsigned m, double *result, unsigned dim, const double *
                             + p.get_name() + "' does not provide it");
         }
 
-        // Copy the decision vector in our temporary dv vector_double,
-        // for use in the pagmo API.
-        std::copy(x, x + dim, dv.begin());
-
-        // Compute fitness and write EC to the output.
+        // Compute fitness (and gradient, if requested) and write EC to the output.
         // NOTE: fitness is nobj + nec + nic.
-        const auto fitness = p.fitness(dv);
+        const auto &fg = nlo.eval_at(x, grad != nullptr);
+        const auto &fitness = fg.first;
         nlopt_obj::unchecked_copy(p.get_nec(), fitness.data() + 1, result);
 
         if (grad) {
             // Handle gradient, if requested.
-            const auto gradient = p.gradient(dv);
+            const auto &gradient = fg.second;
 
             if (p.has_gradient_sparsity()) {
                 // Sparse gradient case.
@@ -843,7 +869,9 @@ population nlopt::evolve(population pop) const
     }
 
     // Compute the new fitness vector.
-    const auto new_f = prob.fitness(initial_guess);
+    // NOTE: the final x is usually the last point evaluated during the optimisation,
+    // in which case the fitness is fetched from the cache.
+    const auto new_f = no.eval_at(initial_guess.data(), false).first;
 
     // Store the new individual into the population, but only if better.
     if (compare_fc(new_f, old_f, prob.get_nec(), prob.get_c_tol())) {
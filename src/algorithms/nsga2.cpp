@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <limits>
 #include <numeric>
@@ -49,6 +50,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
 #include <pagmo/utils/multi_objective.hpp>
 
 namespace pagmo
@@ -129,8 +131,8 @@ population nsga2::evolve(population pop) const
 
     // Declarations
     std::vector<vector_double::size_type> best_idx(NP), shuffle1(NP), shuffle2(NP);
-    vector_double::size_type parent1_idx, parent2_idx;
-    vector_double child1(dim), child2(dim);
+    const auto bounds = prob.get_bounds();
+    const auto nix = prob.get_nix();
 
     std::iota(shuffle1.begin(), shuffle1.end(), vector_double::size_type(0));
     std::iota(shuffle2.begin(), shuffle2.end(), vector_double::size_type(0));
@@ -202,98 +204,56 @@ population nsga2::evolve(population pop) const
         }
 
         // 3 - We then loop thorugh all individuals with increment 4 to select two pairs of parents that will
-        // each create 2 new offspring
+        // each create 2 new offspring. The parents are copied contiguously in genes, each couple being stored
+        // in two consecutive slots, so that the offspring can be created in place by the batch variation operators.
+        vector_double genes(NP * dim);
+        auto copy_parent = [&genes, &pop, dim](vector_double::size_type parent_idx, vector_double::size_type slot) {
+            std::copy(pop.get_x()[parent_idx].begin(), pop.get_x()[parent_idx].end(),
+                      genes.begin() + static_cast<vector_double::difference_type>(slot * dim));
+        };
+        for (decltype(NP) i = 0u; i < NP; i += 4) {
+            // We select two parents using the shuffled list 1
+            copy_parent(tournament_selection(shuffle1[i], shuffle1[i + 1], ndr, pop_cd), i);
+            copy_parent(tournament_selection(shuffle1[i + 2], shuffle1[i + 3], ndr, pop_cd), i + 1u);
+            // We repeat with the shuffled list 2
+            copy_parent(tournament_selection(shuffle2[i], shuffle2[i + 1], ndr, pop_cd), i + 2u);
+            copy_parent(tournament_selection(shuffle2[i + 2], shuffle2[i + 3], ndr, pop_cd), i + 3u);
+        }
+        // genes now contains NP parents, which are replaced by NP children.
+        sbx_crossover_batch(genes, bounds, nix, m_cr, m_eta_c, std::uniform_int_distribution<std::uint64_t>()(m_e));
+        polynomial_mutation_batch(genes, bounds, nix, m_m, m_eta_m,
+                                  std::uniform_int_distribution<std::uint64_t>()(m_e));
+
+        // 4 - We evaluate the children.
+        vector_double fitnesses;
         if (m_bfe) {
-            // bfe is available:
-            auto n_obj = prob.get_nobj();
-            std::vector<vector_double> poptemp;
-            std::vector<unsigned long> fidtemp;
-            for (decltype(NP) i = 0u; i < NP; i += 4) {
-                // We create two offsprings using the shuffled list 1
-                parent1_idx = tournament_selection(shuffle1[i], shuffle1[i + 1], ndr, pop_cd);
-                parent2_idx = tournament_selection(shuffle1[i + 2], shuffle1[i + 3], ndr, pop_cd);
-                crossover(child1, child2, parent1_idx, parent2_idx, pop);
-                mutate(child1, pop);
-                mutate(child2, pop);
-
-                poptemp.push_back(child1);
-                poptemp.push_back(child2);
-
-                // We repeat with the shuffled list 2
-                parent1_idx = tournament_selection(shuffle2[i], shuffle2[i + 1], ndr, pop_cd);
-                parent2_idx = tournament_selection(shuffle2[i + 2], shuffle2[i + 3], ndr, pop_cd);
-                crossover(child1, child2, parent1_idx, parent2_idx, pop);
-                mutate(child1, pop);
-                mutate(child2, pop);
-                // we use prob to evaluate the fitness so
-                // that its feval counter is correctly updated
-                poptemp.push_back(child1);
-                poptemp.push_back(child2);
-
-            } // poptemp now contains 2NP individuals
-
-            vector_double genes(NP * poptemp[0].size());
-            decltype(genes.size()) pos = 0u;
-            for (population::size_type i = 0; i < NP; ++i) {
-                // I compute the fitness for each new individual which was generated in the
-                // tournament_selection for loop
-                for (decltype(poptemp[i].size()) ii = 0u; ii < poptemp[i].size(); ++ii) {
-                    genes[pos] = poptemp[i][ii];
-                    ++pos;
-                }
-            }
-            // array - now contains 2NP new individuals
-            // run bfe and populate popnew.
-            auto fitnesses = (*m_bfe)(prob, genes);
-
-            // at this point:
-            // genes     is an ordered list of child inputs (not used again)
-            // poptemp   is a structured list of children   (no fitneeses)
-            // fitnesses is an ordered list of fitneeses
-            for (decltype(poptemp.size()) i = 0; i < poptemp.size(); i++) {
-                // slice up the fitnesses into a chunks of length n_obj
-                auto start_pos = fitnesses.begin() + static_cast<std::vector<double>::difference_type>(i * n_obj);
-                auto end_pos = fitnesses.begin() + static_cast<std::vector<double>::difference_type>((i + 1) * n_obj);
-                std::vector<double> f1(start_pos, end_pos);
-                popnew.push_back(poptemp[i], f1);
-            }
+            // bfe is available.
+            fitnesses = (*m_bfe)(prob, genes);
         } else {
-            // bfe not available:
-            for (decltype(NP) i = 0u; i < NP; i += 4) {
-                // We create two offsprings using the shuffled list 1
-                parent1_idx = tournament_selection(shuffle1[i], shuffle1[i + 1], ndr, pop_cd);
-                parent2_idx = tournament_selection(shuffle1[i + 2], shuffle1[i + 3], ndr, pop_cd);
-                crossover(child1, child2, parent1_idx, parent2_idx, pop);
-                mutate(child1, pop);
-                mutate(child2, pop);
-                // we use prob to evaluate the fitness so
-                // that its feval counter is correctly updated
-                auto f1 = prob.fitness(child1);
-                auto f2 = prob.fitness(child2);
-                popnew.push_back(child1, f1);
-                popnew.push_back(child2, f2);
-
-                // We repeat with the shuffled list 2
-                parent1_idx = tournament_selection(shuffle2[i], shuffle2[i + 1], ndr, pop_cd);
-                parent2_idx = tournament_selection(shuffle2[i + 2], shuffle2[i + 3], ndr, pop_cd);
-                crossover(child1, child2, parent1_idx, parent2_idx, pop);
-                mutate(child1, pop);
-                mutate(child2, pop);
-                // we use prob to evaluate the fitness so
-                // that its feval counter is correctly updated
-                f1 = prob.fitness(child1);
-                f2 = prob.fitness(child2);
-                popnew.push_back(child1, f1);
-                popnew.push_back(child2, f2);
-            } // popnew now contains 2NP individuals
+            // bfe not available: we use prob to evaluate the fitness so
+            // that its feval counter is correctly updated.
+            fitnesses.reserve(NP * prob.get_nf());
+            vector_double child(dim);
+            for (decltype(NP) i = 0u; i < NP; ++i) {
+                std::copy(genes.begin() + static_cast<vector_double::difference_type>(i * dim),
+                          genes.begin() + static_cast<vector_double::difference_type>((i + 1u) * dim), child.begin());
+                const auto f = prob.fitness(child);
+                fitnesses.insert(fitnesses.end(), f.begin(), f.end());
+            }
         }
+        // Add the children to popnew in a single batch: popnew now contains 2NP individuals.
+        popnew.append(genes, fitnesses);
+
         // This method returns the sorted N best individuals in the population according to the crowded comparison
         // operator
         best_idx = select_best_N_mo(popnew.get_f(), NP);
         // We insert into the population
+        std::vector<vector_double> new_x(NP), new_f(NP);
         for (population::size_type i = 0; i < NP; ++i) {
-            pop.set_xf(i, popnew.get_x()[best_idx[i]], popnew.get_f()[best_idx[i]]);
+            new_x[i] = popnew.get_x()[best_idx[i]];
+            new_f[i] = popnew.get_f()[best_idx[i]];
         }
+        pop.assign_batch(std::move(new_x), std::move(new_f));
     } // end of main NSGAII loop
     return pop;
 }
@@ -363,156 +323,6 @@ vector_double::size_type nsga2::tournament_selection(vector_double::size_type id
     return ((drng(m_e) > 0.5) ? idx1 : idx2);
 }
 
-void nsga2::crossover(vector_double &child1, vector_double &child2, vector_double::size_type parent1_idx,
-                      vector_double::size_type parent2_idx, const pagmo::population &pop) const
-{
-    // Decision vector dimensions
-    auto D = pop.get_problem().get_nx();
-    auto Di = pop.get_problem().get_nix();
-    auto Dc = pop.get_problem().get_ncx();
-    // Problem bounds
-    const auto bounds = pop.get_problem().get_bounds();
-    const auto &lb = bounds.first;
-    const auto &ub = bounds.second;
-    // Parents decision vectors
-    vector_double parent1 = pop.get_x()[parent1_idx];
-    vector_double parent2 = pop.get_x()[parent2_idx];
-    // declarations
-    double y1, y2, yl, yu, rand01, beta, alpha, betaq, c1, c2;
-    vector_double::size_type site1, site2;
-    // Initialize the child decision vectors
-    child1 = parent1;
-    child2 = parent2;
-    // Random distributions
-    std::uniform_real_distribution<> drng(0., 1.); // to generate a number in [0, 1)
-
-    // This implements a Simulated Binary Crossover SBX and applies it to the non integer part of the decision
-    // vector
-    if (drng(m_e) <= m_cr) {
-        for (decltype(Dc) i = 0u; i < Dc; i++) {
-            if ((drng(m_e) <= 0.5) && (std::abs(parent1[i] - parent2[i])) > 1e-14 && lb[i] != ub[i]) {
-                if (parent1[i] < parent2[i]) {
-                    y1 = parent1[i];
-                    y2 = parent2[i];
-                } else {
-                    y1 = parent2[i];
-                    y2 = parent1[i];
-                }
-                yl = lb[i];
-                yu = ub[i];
-                rand01 = drng(m_e);
-                beta = 1. + (2. * (y1 - yl) / (y2 - y1));
-                alpha = 2. - std::pow(beta, -(m_eta_c + 1.));
-                if (rand01 <= (1. / alpha)) {
-                    betaq = std::pow((rand01 * alpha), (1. / (m_eta_c + 1.)));
-                } else {
-                    betaq = std::pow((1. / (2. - rand01 * alpha)), (1. / (m_eta_c + 1.)));
-                }
-                c1 = 0.5 * ((y1 + y2) - betaq * (y2 - y1));
-
-                beta = 1. + (2. * (yu - y2) / (y2 - y1));
-                alpha = 2. - std::pow(beta, -(m_eta_c + 1.));
-                if (rand01 <= (1. / alpha)) {
-                    betaq = std::pow((rand01 * alpha), (1. / (m_eta_c + 1.)));
-                } else {
-                    betaq = std::pow((1. / (2. - rand01 * alpha)), (1. / (m_eta_c + 1.)));
-                }
-                c2 = 0.5 * ((y1 + y2) + betaq * (y2 - y1));
-
-                if (c1 < lb[i]) c1 = lb[i];
-                if (c2 < lb[i]) c2 = lb[i];
-                if (c1 > ub[i]) c1 = ub[i];
-                if (c2 > ub[i]) c2 = ub[i];
-                if (drng(m_e) <= .5) {
-                    child1[i] = c1;
-                    child2[i] = c2;
-                } else {
-                    child1[i] = c2;
-                    child2[i] = c1;
-                }
-            }
-        }
-    }
-    // This implements two-point binary crossover and applies it to the integer part of the chromosome
-    for (decltype(Dc) i = Dc; i < D; ++i) {
-        // in this loop we are sure Di is at least 1
-        std::uniform_int_distribution<vector_double::size_type> ra_num(0, Di - 1u);
-        if (drng(m_e) <= m_cr) {
-            site1 = ra_num(m_e);
-            site2 = ra_num(m_e);
-            if (site1 > site2) {
-                std::swap(site1, site2);
-            }
-            for (decltype(site1) j = 0u; j < site1; ++j) {
-                child1[j] = parent1[j];
-                child2[j] = parent2[j];
-            }
-            for (decltype(site2) j = site1; j < site2; ++j) {
-                child1[j] = parent2[j];
-                child2[j] = parent1[j];
-            }
-            for (decltype(Di) j = site2; j < Di; ++j) {
-                child1[j] = parent1[j];
-                child2[j] = parent2[j];
-            }
-        } else {
-            child1[i] = parent1[i];
-            child2[i] = parent2[i];
-        }
-    }
-}
-
-void nsga2::mutate(vector_double &child, const pagmo::population &pop) const
-{
-    // Decision vector dimensions
-    auto D = pop.get_problem().get_nx();
-    auto Dc = pop.get_problem().get_ncx();
-    // Problem bounds
-    const auto bounds = pop.get_problem().get_bounds();
-    const auto &lb = bounds.first;
-    const auto &ub = bounds.second;
-    // declarations
-    double rnd, delta1, delta2, mut_pow, deltaq;
-    double y, yl, yu, val, xy;
-    // Random distributions
-    std::uniform_real_distribution<> drng(0., 1.); // to generate a number in [0, 1)
-
-    // This implements the real polinomial mutation and applies it to the non integer part of the decision vector
-    for (decltype(Dc) j = 0u; j < Dc; ++j) {
-        if (drng(m_e) <= m_m && lb[j] != ub[j]) {
-            y = child[j];
-            yl = lb[j];
-            yu = ub[j];
-            delta1 = (y - yl) / (yu - yl);
-            delta2 = (yu - y) / (yu - yl);
-            rnd = drng(m_e);
-            mut_pow = 1. / (m_eta_m + 1.);
-            if (rnd <= 0.5) {
-                xy = 1. - delta1;
-                val = 2. * rnd + (1. - 2. * rnd) * (std::pow(xy, (m_eta_m + 1.)));
-                deltaq = std::pow(val, mut_pow) - 1.;
-            } else {
-                xy = 1. - delta2;
-                val = 2. * (1. - rnd) + 2. * (rnd - 0.5) * (std::pow(xy, (m_eta_m + 1.)));
-                deltaq = 1. - (std::pow(val, mut_pow));
-            }
-            y = y + deltaq * (yu - yl);
-            if (y < yl) y = yl;
-            if (y > yu) y = yu;
-            child[j] = y;
-        }
-    }
-
-    // This implements the integer mutation for an individual
-    for (decltype(D) j = Dc; j < D; ++j) {
-        if (drng(m_e) < m_m) {
-            // We need to draw a random integer in [lb, ub].
-            auto mutated = uniform_integral_from_range(lb[j], ub[j], m_e);
-            child[j] = mutated;
-        }
-    }
-}
-
 } // namespace pagmo
 
 PAGMO_S11N_ALGORITHM_IMPLEMENT(pagmo::nsga2)
@@ -399,10 +399,8 @@ population nspso::evolve(population pop) const
             m_best_dvs[i] = next_pop_dvs[best_next_pop_indices[i]];
             m_best_fit[i] = next_pop_fit[best_next_pop_indices[i]];
         }
-        // 4 - I now copy insert the new population
-        for (decltype(swarm_size) i = 0; i < swarm_size; ++i) {
-            pop.set_xf(i, dvs[i], fit[i]);
-        }
+        // 4 - I now move insert the new population
+        pop.assign_batch(std::move(dvs), std::move(fit));
 
     } // end of main NSPSO loop
     return pop;
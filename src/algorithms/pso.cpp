@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iterator>
 #include <numeric>
@@ -35,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <pagmo/algorithm.hpp>
@@ -42,6 +44,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/population.hpp>
+#include <pagmo/rng.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
@@ -220,14 +223,21 @@ population pso::evolve(population pop) const
 
     double r1 = 0.;
     double r2 = 0.;
+    // Storage for the random numbers drawn in bulk.
+    vector_double rnd(2u * dim);
 
     /* --- Main PSO loop ---
      */
     // For each generation
     for (decltype(m_max_gen) gen = 1u; gen <= m_max_gen; ++gen) {
         best_fit_improved = false;
+        // NOTE: the random numbers used in the velocity update of the p-th particle are drawn from
+        // the p-th stream of a counter-based engine, keyed once per generation. Hence, the velocity
+        // updates do not depend on the order in which they are performed.
+        const auto gen_key = std::uniform_int_distribution<std::uint64_t>()(m_e);
         // For each particle in the swarm
         for (decltype(swarm_size) p = 0u; p < swarm_size; ++p) {
+            philox4x32 eng(gen_key, p);
 
             // identify the current particle's best neighbour
             // . not needed if m_neighb_type == 1 (gbest): best_neighb directly tracked in this function
@@ -239,9 +249,10 @@ population pso::evolve(population pop) const
             /*-------PSO canonical (with inertia weight) ---------------------------------------------*/
             /*-------Original algorithm used in the first PaGMO paper (~2007) ------------------------*/
             if (m_variant == 1u) {
+                eng.generate_canonical(rnd.data(), 2u * dim);
                 for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
-                    r2 = drng(m_e);
+                    r1 = rnd[2u * d];
+                    r2 = rnd[2u * d + 1u];
                     m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
                                 + m_eta2 * r2 * (best_neighb[d] - X[p][d]);
                 }
@@ -251,8 +262,9 @@ population pso::evolve(population pop) const
             /*-------and with equal random weights of social and cognitive components-----------------*/
             /*-------Check with Rastrigin-------------------------------------------------------------*/
             else if (m_variant == 2u) {
+                eng.generate_canonical(rnd.data(), dim);
                 for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
+                    r1 = rnd[d];
                     m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
                                 + m_eta2 * r1 * (best_neighb[d] - X[p][d]);
                 }
@@ -261,8 +273,8 @@ population pso::evolve(population pop) const
             /*-------PSO variant (commonly mistaken in literature for the canonical)----------------*/
             /*-------Same random number for all components------------------------------------------*/
             else if (m_variant == 3u) {
-                r1 = drng(m_e);
-                r2 = drng(m_e);
+                r1 = drng(eng);
+                r2 = drng(eng);
                 for (decltype(dim) d = 0u; d < dim; ++d) {
                     m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
                                 + m_eta2 * r2 * (best_neighb[d] - X[p][d]);
@@ -273,7 +285,7 @@ population pso::evolve(population pop) const
             /*-------Same random number for all components------------------------------------------*/
             /*-------and with equal random weights of social and cognitive components---------------*/
             else if (m_variant == 4u) {
-                r1 = drng(m_e);
+                r1 = drng(eng);
                 for (decltype(dim) d = 0u; d < dim; ++d) {
                     m_V[p][d] = m_omega * m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
                                 + m_eta2 * r1 * (best_neighb[d] - X[p][d]);
@@ -294,9 +306,10 @@ population pso::evolve(population pop) const
              *  This being the canonical PSO of today, this variant is set as the default in PaGMO.
              *-------------------------------------------------------------------------------------*/
             else if (m_variant == 5u) {
+                eng.generate_canonical(rnd.data(), 2u * dim);
                 for (decltype(dim) d = 0u; d < dim; ++d) {
-                    r1 = drng(m_e);
-                    r2 = drng(m_e);
+                    r1 = rnd[2u * d];
+                    r2 = rnd[2u * d + 1u];
                     m_V[p][d] = m_omega
                                 * (m_V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d])
                                    + m_eta2 * r2 * (best_neighb[d] - X[p][d]));
@@ -317,7 +330,7 @@ population pso::evolve(population pop) const
                 for (decltype(dim) d = 0u; d < dim; ++d) {
                     sum_forces = 0.;
                     for (decltype(neighb[p].size()) n = 0u; n < neighb[p].size(); ++n) {
-                        sum_forces += drng(m_e) * acceleration_coefficient * (lbX[neighb[p][n]][d] - X[p][d]);
+                        sum_forces += drng(eng) * acceleration_coefficient * (lbX[neighb[p][n]][d] - X[p][d]);
                     }
                     m_V[p][d] = m_omega * (m_V[p][d] + sum_forces / static_cast<double>(neighb[p].size()));
                 }
@@ -435,10 +448,8 @@ population pso::evolve(population pop) const
         std::cout << "Exit condition -- generations = " << m_max_gen << std::endl;
     }
 
-    // copy particles' positions & velocities back to the main population
-    for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
-        pop.set_xf(i, lbX[i], lbfit[i]);
-    }
+    // move particles' positions & velocities back to the main population
+    pop.assign_batch(std::move(lbX), std::move(lbfit));
     return pop;
 }
 
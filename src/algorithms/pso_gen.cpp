@@ -36,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/serialization/optional.hpp>
@@ -520,10 +521,8 @@ population pso_gen::evolve(population pop) const
         std::cout << "Exit condition -- generations = " << m_max_gen << std::endl;
     }
 
-    // copy particles' positions & velocities back to the main population
-    for (decltype(swarm_size) i = 0u; i < swarm_size; ++i) {
-        pop.set_xf(i, lbX[i], lbfit[i]);
-    }
+    // move particles' positions & velocities back to the main population
+    pop.assign_batch(std::move(lbX), std::move(lbfit));
     return pop;
 }
 
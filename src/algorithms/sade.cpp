@@ -27,6 +27,7 @@ GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -45,6 +46,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
 
 namespace pagmo
 {
@@ -82,8 +84,6 @@ population sade::evolve(population pop) const
                                           // allowed
     auto dim = prob.get_nx();             // This getter does not return a const reference but a copy
     const auto bounds = prob.get_bounds();
-    const auto &lb = bounds.first;
-    const auto &ub = bounds.second;
     auto NP = pop.size();
     auto prob_f_dimension = prob.get_nf();
     auto fevals0 = prob.get_fevals(); // disount for the already made fevals
@@ -121,8 +121,6 @@ population sade::evolve(population pop) const
     vector_double tmp(dim);                              // contains the mutated candidate
     std::uniform_real_distribution<double> drng(0., 1.); // to generate a number in [0, 1)
     std::normal_distribution<double> n_dist(0., 1.);     // to generate a normally distributed number
-    std::uniform_int_distribution<vector_double::size_type> c_idx(
-        0u, dim - 1u); // to generate a random index in the chromosome
     std::uniform_int_distribution<vector_double::size_type> p_idx(0u, NP - 1u); // to generate a random index in pop
 
     // We extract from pop the chromosomes and fitness associated
@@ -164,13 +162,20 @@ population sade::evolve(population pop) const
 
     // Main DE iterations
     for (decltype(m_gen) gen = 1u; gen <= m_gen; ++gen) {
+        // NOTE: the random numbers used to generate the i-th trial vector are drawn from
+        // the i-th stream of a counter-based engine, keyed once per generation.
+        const auto gen_key = std::uniform_int_distribution<std::uint64_t>()(m_e);
         // Start of the loop through the population
         for (decltype(NP) i = 0u; i < NP; ++i) {
+            philox4x32 eng(gen_key, i);
+            // NOTE: the normal distribution may cache a deviate drawn from the previous
+            // engine, reset it so that only the i-th stream is used.
+            n_dist.reset();
             /*-----We select at random 5 indexes from the population---------------------------------*/
             std::vector<vector_double::size_type> idxs(NP);
             std::iota(idxs.begin(), idxs.end(), vector_double::size_type(0u));
             for (auto j = 0u; j < 7u; ++j) { // Durstenfeld's algorithm to select 7 indexes at random
-                auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(m_e);
+                auto idx = std::uniform_int_distribution<vector_double::size_type>(0u, NP - 1u - j)(eng);
                 r[j] = idxs[idx];
                 std::swap(idxs[idx], idxs[NP - 1u - j]);
             }
@@ -178,328 +183,170 @@ population sade::evolve(population pop) const
             // Adapt amplification factor and crossover probability for jDE
             double F = 0., CR = 0.;
             if (m_variant_adptv == 1u) {
-                F = (drng(m_e) < 0.9) ? m_F[i] : drng(m_e) * 0.9 + 0.1;
-                CR = (drng(m_e) < 0.9) ? m_CR[i] : drng(m_e);
+                F = (drng(eng) < 0.9) ? m_F[i] : drng(eng) * 0.9 + 0.1;
+                CR = (drng(eng) < 0.9) ? m_CR[i] : drng(eng);
             }
 
+            // Adapt amplification factor and crossover probability for iDE, according to the DE variant
             /*-------DE/best/1/exp--------------------------------------------------------------------*/
             /*-------The oldest DE variant but still not bad. However, we have found several----------*/
             /*-------optimization problems where misconvergence occurs.-------------------------------*/
             if (m_variant == 1u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
 
             /*-------DE/rand/1/exp-------------------------------------------------------------------*/
             else if (m_variant == 2u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                decltype(dim) L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + F * (popold[r[1]][n] - popold[r[2]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/rand-to-best/1/exp-----------------------------------------------------------*/
             else if (m_variant == 3u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[i] + n_dist(m_e) * 0.5 * (gbIterF - m_F[i]) + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]]);
-                    CR = m_CR[i] + n_dist(m_e) * 0.5 * (gbIterCR - m_CR[i])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]]);
+                    F = m_F[i] + n_dist(eng) * 0.5 * (gbIterF - m_F[i]) + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]]);
+                    CR = m_CR[i] + n_dist(eng) * 0.5 * (gbIterCR - m_CR[i])
+                         + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = tmp[n] + F * (gbIter[n] - tmp[n]) + F * (popold[r[0]][n] - popold[r[1]][n]);
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/best/2/exp is another powerful variant worth trying--------------------------*/
             else if (m_variant == 4u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]])
+                        + n_dist(eng) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
+                         + n_dist(eng) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n]
-                        = gbIter[n] + (popold[r[0]][n] - popold[r[1]][n]) * F + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/rand/2/exp seems to be a robust optimizer for many functions-------------------*/
             else if (m_variant == 5u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[4]] + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
-                    CR = m_CR[r[4]] + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
+                    F = m_F[r[4]] + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]])
+                        + n_dist(eng) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
+                    CR = m_CR[r[4]] + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
+                         + n_dist(eng) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[4]][n] + (popold[r[0]][n] - popold[r[1]][n]) * F
-                             + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
 
             /*=======Essentially same strategies but BINOMIAL CROSSOVER===============================*/
             /*-------DE/best/1/bin--------------------------------------------------------------------*/
             else if (m_variant == 6u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = gbIter[n] + F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
                 }
             }
             /*-------DE/rand/1/bin-------------------------------------------------------------------*/
             else if (m_variant == 7u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + F * (popold[r[1]][n] - popold[r[2]][n]);
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]]);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[r[2]]);
                 }
             }
             /*-------DE/rand-to-best/1/bin-----------------------------------------------------------*/
             else if (m_variant == 8u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[i] + n_dist(m_e) * 0.5 * (gbIterF - m_F[i]) + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]]);
-                    CR = m_CR[i] + n_dist(m_e) * 0.5 * (gbIterCR - m_CR[i])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = tmp[n] + F * (gbIter[n] - tmp[n]) + F * (popold[r[0]][n] - popold[r[1]][n]);
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[i] + n_dist(eng) * 0.5 * (gbIterF - m_F[i]) + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]]);
+                    CR = m_CR[i] + n_dist(eng) * 0.5 * (gbIterCR - m_CR[i])
+                         + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]]);
                 }
             }
             /*-------DE/best/2/bin--------------------------------------------------------------------*/
             else if (m_variant == 9u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = gbIter[n] + (popold[r[0]][n] - popold[r[1]][n]) * F
-                                 + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]])
+                        + n_dist(eng) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
+                         + n_dist(eng) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
                 }
             }
             /*-------DE/rand/2/bin--------------------------------------------------------------------*/
             else if (m_variant == 10u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[4]] + n_dist(m_e) * 0.5 * (m_F[r[0]] - m_F[r[1]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
-                    CR = m_CR[r[4]] + n_dist(m_e) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[4]][n] + (popold[r[0]][n] - popold[r[1]][n]) * F
-                                 + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[r[4]] + n_dist(eng) * 0.5 * (m_F[r[0]] - m_F[r[1]])
+                        + n_dist(eng) * 0.5 * (m_F[r[2]] - m_F[r[3]]);
+                    CR = m_CR[r[4]] + n_dist(eng) * 0.5 * (m_CR[r[0]] - m_CR[r[1]])
+                         + n_dist(eng) * 0.5 * (m_CR[r[2]] - m_CR[r[3]]);
                 }
             }
             /*-------DE/rand/3/exp --------------------------------------------------------------------*/
             else if (m_variant == 11u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(m_e) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
-                    CR = m_CR[r[4]] + n_dist(m_e) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(eng) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
+                    CR = m_CR[r[4]] + n_dist(eng) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[r[2]][n]) * F
-                             + (popold[r[3]][n] - popold[r[4]][n]) * F + (popold[r[5]][n] - popold[r[6]][n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/rand/3/bin --------------------------------------------------------------------*/
             else if (m_variant == 12u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(m_e) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
-                    CR = m_CR[r[4]] + n_dist(m_e) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[r[2]][n]) * F
-                                 + (popold[r[3]][n] - popold[r[4]][n]) * F + (popold[r[5]][n] - popold[r[6]][n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(eng) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
+                    CR = m_CR[r[4]] + n_dist(eng) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
                 }
             }
             /*-------DE/best/3/exp --------------------------------------------------------------------*/
             else if (m_variant == 13u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(m_e) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(eng) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = gbIter[n] + (popold[r[1]][n] - popold[r[2]][n]) * F
-                             + (popold[r[3]][n] - popold[r[4]][n]) * F + (popold[r[5]][n] - popold[r[6]][n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/best/3/bin --------------------------------------------------------------------*/
             else if (m_variant == 14u) {
                 if (m_variant_adptv == 2u) {
-                    F = gbIterF + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[r[2]])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(m_e) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
-                    CR = gbIterCR + n_dist(m_e) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = gbIter[n] + (popold[r[1]][n] - popold[r[2]][n]) * F
-                                 + (popold[r[3]][n] - popold[r[4]][n]) * F + (popold[r[5]][n] - popold[r[6]][n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = gbIterF + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[r[2]])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]) + n_dist(eng) * 0.5 * (m_F[r[5]] - m_F[r[6]]);
+                    CR = gbIterCR + n_dist(eng) * 0.5 * (m_CR[r[0]] + m_CR[r[1]] - m_CR[r[2]] - m_CR[r[3]]);
                 }
             }
             /*-------DE/rand-to-current/2/exp --------------------------------------------------------------------*/
             else if (m_variant == 15u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[i])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[i])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[3]] - m_CR[r[4]]);
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[i])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[i])
+                         + n_dist(eng) * 0.5 * (m_CR[r[3]] - m_CR[r[4]]);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[i][n]) * F
-                             + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/rand-to-current/2/bin --------------------------------------------------------------------*/
             else if (m_variant == 16u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[i])
-                        + n_dist(m_e) * 0.5 * (m_F[r[3]] - m_F[r[4]]);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[i])
-                         + n_dist(m_e) * 0.5 * (m_CR[r[3]] - m_CR[r[4]]);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[i][n]) * F
-                                 + (popold[r[2]][n] - popold[r[3]][n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[i])
+                        + n_dist(eng) * 0.5 * (m_F[r[3]] - m_F[r[4]]);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[i])
+                         + n_dist(eng) * 0.5 * (m_CR[r[3]] - m_CR[r[4]]);
                 }
             }
             /*-------DE/rand-to-best-and-current/2/exp
                --------------------------------------------------------------------*/
             else if (m_variant == 17u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[i])
-                        - n_dist(m_e) * 0.5 * (m_F[r[2]] - gbIterF);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[i])
-                         - n_dist(m_e) * 0.5 * (m_CR[r[3]] - gbIterCR);
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[i])
+                        - n_dist(eng) * 0.5 * (m_F[r[2]] - gbIterF);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[i])
+                         - n_dist(eng) * 0.5 * (m_CR[r[3]] - gbIterCR);
                 }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                auto L = 0u;
-                do {
-                    tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[i][n]) * F - (popold[r[2]][n] - gbIter[n]) * F;
-                    n = (n + 1u) % dim;
-                    ++L;
-                } while ((drng(m_e) < CR) && (L < dim));
             }
             /*-------DE/rand-to-best-and-current/2/bin
                --------------------------------------------------------------------*/
             else if (m_variant == 18u) {
                 if (m_variant_adptv == 2u) {
-                    F = m_F[r[0]] + n_dist(m_e) * 0.5 * (m_F[r[1]] - m_F[i])
-                        - n_dist(m_e) * 0.5 * (m_F[r[2]] - gbIterF);
-                    CR = m_CR[r[0]] + n_dist(m_e) * 0.5 * (m_CR[r[1]] - m_CR[i])
-                         - n_dist(m_e) * 0.5 * (m_CR[r[3]] - gbIterCR);
-                }
-                tmp = popold[i];
-                auto n = c_idx(m_e);
-                for (decltype(dim) L = 0u; L < dim; ++L) {   /* perform Dc binomial trials */
-                    if ((drng(m_e) < CR) || L + 1u == dim) { /* change at least one parameter */
-                        tmp[n] = popold[r[0]][n] + (popold[r[1]][n] - popold[i][n]) * F
-                                 - (popold[r[2]][n] - gbIter[n]) * F;
-                    }
-                    n = (n + 1u) % dim;
+                    F = m_F[r[0]] + n_dist(eng) * 0.5 * (m_F[r[1]] - m_F[i])
+                        - n_dist(eng) * 0.5 * (m_F[r[2]] - gbIterF);
+                    CR = m_CR[r[0]] + n_dist(eng) * 0.5 * (m_CR[r[1]] - m_CR[i])
+                         - n_dist(eng) * 0.5 * (m_CR[r[3]] - gbIterCR);
                 }
             }
 
-            /*==Trial mutation now in tmp. force feasibility and see how good this choice really was.==*/
-            // a) feasibility
-            for (decltype(dim) j = 0u; j < dim; ++j) {
-                if ((tmp[j] < lb[j]) || (tmp[j] > ub[j])) {
-                    tmp[j] = uniform_real_from_range(lb[j], ub[j], m_e);
-                }
-            }
+            /*==Trial vector. We compute it, force feasibility and see how good this choice really was.==*/
+            // a) trial vector and feasibility
+            de_trial(tmp.data(), popold, i, r, gbIter, m_variant, F, CR, bounds, eng);
             // b) how good?
             auto newfitness = prob.fitness(tmp); /* Evaluates tmp[] */
             if (newfitness[0] <= fit[i][0]) {    /* improved objective function value ? */
@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <limits>
 #include <numeric>
@@ -50,6 +51,7 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
 
 namespace pagmo
 {
@@ -276,9 +278,12 @@ population sga::evolve(population pop) const
         std::sort(best_idxs.begin(), best_idxs.end(), [&FNEW](vector_double::size_type a, vector_double::size_type b) {
             return detail::less_than_f(FNEW[a][0], FNEW[b][0]);
         });
+        std::vector<vector_double> new_x(NP), new_f(NP);
         for (decltype(NP) j = 0u; j < NP; ++j) {
-            pop.set_xf(j, XNEW[best_idxs[j]], FNEW[best_idxs[j]]);
+            new_x[j] = std::move(XNEW[best_idxs[j]]);
+            new_f[j] = std::move(FNEW[best_idxs[j]]);
         }
+        pop.assign_batch(std::move(new_x), std::move(new_f));
     }
     return pop;
 }
@@ -390,15 +395,25 @@ void sga::perform_crossover(std::vector<vector_double> &X, const std::pair<vecto
     std::vector<vector_double::size_type> all_idx(X.size()); // stores indexes to then select one at random
     std::iota(all_idx.begin(), all_idx.end(), vector_double::size_type(0u));
     std::uniform_real_distribution<> drng(0., 1.);
+    // The random numbers used to recombine the i-th couple (or to create the i-th child) are drawn from
+    // the i-th stream of a counter-based engine, keyed once per call.
+    const auto key = std::uniform_int_distribution<std::uint64_t>()(m_e);
     // We need different loops if the crossover type is "sbx"" as this method creates two offsprings per
     // selected couple.
     if (m_crossover == detail::sga_crossover::SBX) {
         assert(X.size() % 2u == 0u);
         std::shuffle(X.begin(), X.end(), m_e);
-        for (decltype(X.size()) i = 0u; i < X.size(); i += 2) {
-            auto children = sbx_crossover_impl(X[i], X[i + 1], bounds, dim_i);
-            X[i] = children.first;
-            X[i + 1] = children.second;
+        // The couples are recombined in a single batch: we copy them contiguously, apply
+        // the batch crossover operator and copy back the offsprings.
+        vector_double dvs;
+        dvs.reserve(X.size() * dim);
+        for (const auto &x : X) {
+            dvs.insert(dvs.end(), x.begin(), x.end());
+        }
+        sbx_crossover_batch(dvs, bounds, dim_i, m_cr, m_eta_c, key);
+        for (decltype(X.size()) i = 0u; i < X.size(); ++i) {
+            std::copy(dvs.begin() + static_cast<vector_double::difference_type>(i * dim),
+                      dvs.begin() + static_cast<vector_double::difference_type>((i + 1u) * dim), X[i].begin());
         }
     } else {
         auto XCOPY = X;
@@ -407,28 +422,29 @@ void sga::perform_crossover(std::vector<vector_double> &X, const std::pair<vecto
             1, all_idx.size() - 1);
         // Start of main loop through the X
         for (decltype(X.size()) i = 0u; i < X.size(); ++i) {
+            philox4x32 eng(key, i);
             // 1 - we select a mating partner
             std::swap(all_idx[0], all_idx[i]);
-            auto partner_idx = rnd_skip_first_idx(m_e);
+            auto partner_idx = rnd_skip_first_idx(eng);
             // 2 - We rename these chromosomes for code clarity
             auto &child = X[i];
             const auto &parent2 = XCOPY[all_idx[partner_idx]];
             // 3 - We perform crossover according to the selected method
             switch (m_crossover) {
                 case (detail::sga_crossover::EXPONENTIAL): {
-                    auto n = rnd_gene_idx(m_e);
+                    auto n = rnd_gene_idx(eng);
                     decltype(dim) L = 0u;
                     do {
                         child[n] = parent2[n];
                         n = (n + 1u) % dim;
                         L++;
-                    } while ((drng(m_e) < m_cr) && (L < dim));
+                    } while ((drng(eng) < m_cr) && (L < dim));
                     break;
                 }
                 case (detail::sga_crossover::BINOMIAL): {
-                    auto n = rnd_gene_idx(m_e);
+                    auto n = rnd_gene_idx(eng);
                     for (decltype(dim) L = 0u; L < dim; ++L) {    /* performs D binomial trials */
-                        if ((drng(m_e) < m_cr) || L + 1 == dim) { /* changes at least one parameter */
+                        if ((drng(eng) < m_cr) || L + 1 == dim) { /* changes at least one parameter */
                             child[n] = parent2[n];
                         }
                         n = (n + 1) % dim;
@@ -436,8 +452,8 @@ void sga::perform_crossover(std::vector<vector_double> &X, const std::pair<vecto
                     break;
                 }
                 case (detail::sga_crossover::SINGLE): {
-                    if (drng(m_e) < m_cr) {
-                        auto n = rnd_gene_idx(m_e);
+                    if (drng(eng) < m_cr) {
+                        auto n = rnd_gene_idx(eng);
                         for (decltype(dim) j = n; j < dim; ++j) {
                             child[j] = parent2[j];
                         }
@@ -478,11 +494,14 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
     // This will contain the indexes of the genes to be mutated
     std::vector<vector_double::size_type> to_be_mutated(dim);
     std::iota(to_be_mutated.begin(), to_be_mutated.end(), vector_double::size_type(0u));
+    // The i-th chromosome is mutated using the i-th stream of a counter-based engine, keyed once per call.
+    const auto key = std::uniform_int_distribution<std::uint64_t>()(m_e);
     // Then we start tha main loop through the population
     for (decltype(X.size()) i = 0u; i < X.size(); ++i) {
+        philox4x32 eng(key, i);
         // We select the indexes to be mutated (the first N of to_be_mutated)
-        std::shuffle(to_be_mutated.begin(), to_be_mutated.end(), m_e);
-        auto N = std::binomial_distribution<vector_double::size_type>(dim, m_m)(m_e);
+        std::shuffle(to_be_mutated.begin(), to_be_mutated.end(), eng);
+        auto N = std::binomial_distribution<vector_double::size_type>(dim, m_m)(eng);
         // We ensure at least one is mutated if m_m > 0
         // if (m_m > 0. and N == 0u) N = 1;
         // We apply the mutation scheme
@@ -492,11 +511,11 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
                 for (decltype(N) j = 0u; j < N; ++j) {
                     auto gene_idx = to_be_mutated[j];
                     if (gene_idx < dimc) {
-                        X[i][gene_idx] = uniform_real_from_range(lb[gene_idx], ub[gene_idx], m_e);
+                        X[i][gene_idx] = uniform_real_from_range(lb[gene_idx], ub[gene_idx], eng);
                     } else {
                         rnd_lb_ub.param(std::uniform_int_distribution<int>::param_type(static_cast<int>(lb[gene_idx]),
                                                                                        static_cast<int>(ub[gene_idx])));
-                        X[i][gene_idx] = static_cast<double>(rnd_lb_ub(m_e));
+                        X[i][gene_idx] = static_cast<double>(rnd_lb_ub(eng));
                     }
                 }
                 break;
@@ -507,9 +526,9 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
                     auto gene_idx = to_be_mutated[j];
                     auto std = (ub[gene_idx] - lb[gene_idx]) * m_param_m;
                     if (gene_idx < dimc) {
-                        X[i][gene_idx] += normal(m_e) * std;
+                        X[i][gene_idx] += normal(eng) * std;
                     } else {
-                        X[i][gene_idx] += std::round(normal(m_e) * std);
+                        X[i][gene_idx] += std::round(normal(eng) * std);
                     }
                 }
                 break;
@@ -519,7 +538,7 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
                 for (decltype(N) j = 0u; j < N; ++j) {
                     auto gene_idx = to_be_mutated[j];
                     if (gene_idx < dimc) {
-                        double u = drng(m_e);
+                        double u = drng(eng);
                         if (u <= 0.5) {
                             auto delta_l = std::pow(2. * u, 1. / (1. + m_param_m)) - 1.;
                             X[i][gene_idx] += delta_l * (X[i][gene_idx] - lb[gene_idx]);
@@ -530,7 +549,7 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
                     } else {
                         rnd_lb_ub.param(std::uniform_int_distribution<int>::param_type(static_cast<int>(lb[gene_idx]),
                                                                                        static_cast<int>(ub[gene_idx])));
-                        X[i][gene_idx] = static_cast<double>(rnd_lb_ub(m_e));
+                        X[i][gene_idx] = static_cast<double>(rnd_lb_ub(eng));
                     }
                 }
                 break;
@@ -541,101 +560,6 @@ void sga::perform_mutation(std::vector<vector_double> &X, const std::pair<vector
     }
 }
 
-std::pair<vector_double, vector_double> sga::sbx_crossover_impl(const vector_double &parent1,
-                                                                const vector_double &parent2,
-                                                                const std::pair<vector_double, vector_double> &bounds,
-                                                                vector_double::size_type Di) const
-{
-    // Decision vector dimensions
-    auto D = parent1.size();
-    auto Dc = D - Di;
-    // Problem bounds
-    const auto &lb = bounds.first;
-    const auto &ub = bounds.second;
-    // declarations
-    double y1, y2, yl, yu, rand01, beta, alpha, betaq, c1, c2;
-    vector_double::size_type site1, site2;
-    // Initialize the child decision vectors
-    auto child1 = parent1;
-    auto child2 = parent2;
-    // Random distributions
-    std::uniform_real_distribution<> drng(0., 1.); // to generate a number in [0, 1)
-
-    // This implements a Simulated Binary Crossover SBX and applies it to the non integer part of the decision
-    // vector
-    if (drng(m_e) <= m_cr) {
-        for (decltype(Dc) i = 0u; i < Dc; i++) {
-            if ((drng(m_e) <= 0.5) && (std::abs(parent1[i] - parent2[i])) > 1e-14 && lb[i] != ub[i]) {
-                if (parent1[i] < parent2[i]) {
-                    y1 = parent1[i];
-                    y2 = parent2[i];
-                } else {
-                    y1 = parent2[i];
-                    y2 = parent1[i];
-                }
-                yl = lb[i];
-                yu = ub[i];
-                rand01 = drng(m_e);
-                beta = 1. + (2. * (y1 - yl) / (y2 - y1));
-                alpha = 2. - std::pow(beta, -(m_eta_c + 1.));
-                if (rand01 <= (1. / alpha)) {
-                    betaq = std::pow((rand01 * alpha), (1. / (m_eta_c + 1.)));
-                } else {
-                    betaq = std::pow((1. / (2. - rand01 * alpha)), (1. / (m_eta_c + 1.)));
-                }
-                c1 = 0.5 * ((y1 + y2) - betaq * (y2 - y1));
-                beta = 1. + (2. * (yu - y2) / (y2 - y1));
-                alpha = 2. - std::pow(beta, -(m_eta_c + 1.));
-                if (rand01 <= (1. / alpha)) {
-                    betaq = std::pow((rand01 * alpha), (1. / (m_eta_c + 1.)));
-                } else {
-                    betaq = std::pow((1. / (2. - rand01 * alpha)), (1. / (m_eta_c + 1.)));
-                }
-                c2 = 0.5 * ((y1 + y2) + betaq * (y2 - y1));
-                if (c1 < lb[i]) c1 = lb[i];
-                if (c2 < lb[i]) c2 = lb[i];
-                if (c1 > ub[i]) c1 = ub[i];
-                if (c2 > ub[i]) c2 = ub[i];
-                if (drng(m_e) <= .5) {
-                    child1[i] = c1;
-                    child2[i] = c2;
-                } else {
-                    child1[i] = c2;
-                    child2[i] = c1;
-                }
-            }
-        }
-    }
-    // This implements two-point binary crossover and applies it to the integer part of the chromosome
-    for (decltype(Dc) i = Dc; i < D; ++i) {
-        // in this loop we are sure Di is at least 1
-        std::uniform_int_distribution<vector_double::size_type> ra_num(0, Di - 1u);
-        if (drng(m_e) <= m_cr) {
-            site1 = ra_num(m_e);
-            site2 = ra_num(m_e);
-            if (site1 > site2) {
-                std::swap(site1, site2);
-            }
-            for (decltype(site1) j = 0u; j < site1; ++j) {
-                child1[j] = parent1[j];
-                child2[j] = parent2[j];
-            }
-            for (decltype(site2) j = site1; j < site2; ++j) {
-                child1[j] = parent2[j];
-                child2[j] = parent1[j];
-            }
-            for (decltype(Di) j = site2; j < Di; ++j) {
-                child1[j] = parent1[j];
-                child2[j] = parent2[j];
-            }
-        } else {
-            child1[i] = parent1[i];
-            child2[i] = parent2[i];
-        }
-    }
-    return std::make_pair(std::move(child1), std::move(child2));
-}
-
 } // namespace pagmo
 
 PAGMO_S11N_ALGORITHM_IMPLEMENT(pagmo::sga)
@@ -35,6 +35,7 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <pagmo/algorithm.hpp>
@@ -219,6 +220,7 @@ population xnes::evolve(population pop) const
             pop.get_problem().set_seed(std::uniform_int_distribution<unsigned>()(m_e));
         }
         // 1 - We generate lam new individuals using the current probability distribution
+        std::vector<vector_double> new_x(lam), new_f(lam);
         for (decltype(lam) i = 0u; i < lam; ++i) {
             // 1a - we create a randomly normal distributed vector
             for (decltype(dim) j = 0u; j < dim; ++j) {
@@ -240,8 +242,10 @@ population xnes::evolve(population pop) const
             for (decltype(dim) j = 0u; j < dim; ++j) {
                 dumb[j] = x[i](_(j));
             }
-            pop.set_x(i, dumb);
+            new_f[i] = prob.fitness(dumb);
+            new_x[i] = dumb;
         }
+        pop.assign_batch(std::move(new_x), std::move(new_f));
 
         // 2 - Check the exit conditions and logs
         // Exit condition on xtol
@@ -29,26 +29,33 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/optional.hpp>
 
 #include <pagmo/archipelago.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/island.hpp>
+#include <pagmo/stats.hpp>
 #include <pagmo/topology.hpp>
 #include <pagmo/types.hpp>
 
@@ -61,6 +68,156 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+/// Constructor.
+/**
+ * @param mt the migration type.
+ * @param mh the migrant handling policy.
+ * @param gen_interval the minimum number of generations between two consecutive migrations into an island.
+ * @param time_interval the minimum wall-clock time (in seconds) between two consecutive migrations into an island.
+ * @param mailbox_size the maximum number of groups of migrants that can be stored in the mailbox of an island.
+ * @param max_staleness the maximum age (in seconds) of a group of migrants in a mailbox. Older migrants
+ * will be discarded without being delivered.
+ *
+ * @throws std::invalid_argument if:
+ * - \p gen_interval or \p mailbox_size are zero,
+ * - \p time_interval is negative or not finite,
+ * - \p max_staleness is not positive or NaN.
+ */
+migration_scheduler::migration_scheduler(migration_type mt, migrant_handling mh, unsigned gen_interval,
+                                         double time_interval, std::size_t mailbox_size, double max_staleness)
+    : m_migr_type(mt), m_migr_handling(mh), m_gen_interval(gen_interval), m_time_interval(time_interval),
+      m_mailbox_size(mailbox_size), m_max_staleness(max_staleness)
+{
+    if (!gen_interval) {
+        pagmo_throw(std::invalid_argument, "The generation interval of a migration scheduler cannot be zero");
+    }
+    if (!std::isfinite(time_interval) || time_interval < 0.) {
+        pagmo_throw(std::invalid_argument,
+                    "The time interval of a migration scheduler must be finite and non-negative, but a value of "
+                        + std::to_string(time_interval) + " was provided instead");
+    }
+    if (!mailbox_size) {
+        pagmo_throw(std::invalid_argument, "The mailbox size of a migration scheduler cannot be zero");
+    }
+    if (std::isnan(max_staleness) || max_staleness <= 0.) {
+        pagmo_throw(std::invalid_argument,
+                    "The maximum staleness of a migration scheduler must be positive, but a value of "
+                        + std::to_string(max_staleness) + " was provided instead");
+    }
+}
+
+/// Get the migration type.
+/**
+ * @return the migration type.
+ */
+migration_type migration_scheduler::get_migration_type() const
+{
+    return m_migr_type;
+}
+
+/// Get the migrant handling policy.
+/**
+ * @return the migrant handling policy.
+ */
+migrant_handling migration_scheduler::get_migrant_handling() const
+{
+    return m_migr_handling;
+}
+
+/// Get the generation interval.
+/**
+ * @return the minimum number of generations between two consecutive migrations into an island.
+ */
+unsigned migration_scheduler::get_gen_interval() const
+{
+    return m_gen_interval;
+}
+
+/// Get the time interval.
+/**
+ * @return the minimum wall-clock time (in seconds) between two consecutive migrations into an island.
+ */
+double migration_scheduler::get_time_interval() const
+{
+    return m_time_interval;
+}
+
+/// Get the mailbox size.
+/**
+ * @return the maximum number of groups of migrants that can be stored in the mailbox of an island.
+ */
+std::size_t migration_scheduler::get_mailbox_size() const
+{
+    return m_mailbox_size;
+}
+
+/// Get the maximum staleness.
+/**
+ * @return the maximum age (in seconds) of a group of migrants in a mailbox.
+ */
+double migration_scheduler::get_max_staleness() const
+{
+    return m_max_staleness;
+}
+
+/// Stream operator for pagmo::migration_scheduler.
+/**
+ * @param os the target stream.
+ * @param ms the migration scheduler that will be streamed.
+ *
+ * @return a reference to \p os.
+ *
+ * @throws unspecified any exception thrown by the streaming of primitive types.
+ */
+std::ostream &operator<<(std::ostream &os, const migration_scheduler &ms)
+{
+    stream(os, "\tMigration type: ", ms.get_migration_type(), "\n");
+    stream(os, "\tMigrant handling policy: ", ms.get_migrant_handling(), "\n");
+    stream(os, "\tGeneration interval: ", ms.get_gen_interval(), "\n");
+    stream(os, "\tTime interval: ", ms.get_time_interval(), "\n");
+    stream(os, "\tMailbox size: ", ms.get_mailbox_size(), "\n");
+    stream(os, "\tMaximum staleness: ", ms.get_max_staleness(), "\n");
+    return os;
+}
+
+namespace detail
+{
+
+struct migration_mailbox {
+    using clock_type = std::chrono::steady_clock;
+    // A group of migrants in the mailbox, tagged with
+    // a sequence number and the time of insertion.
+    struct entry {
+        unsigned long long seq;
+        clock_type::time_point ts;
+        individuals_group_t inds;
+    };
+    // Remove the entries older than max_staleness.
+    void prune(const clock_type::time_point &now, double max_staleness)
+    {
+        while (!entries.empty()
+               && std::chrono::duration<double>(now - entries.front().ts).count() > max_staleness) {
+            entries.pop_front();
+        }
+    }
+
+    std::mutex mutex;
+    // Outgoing state: the migrants selected by the island, in
+    // order of insertion, and the sequence number of the next entry.
+    std::deque<entry> entries;
+    unsigned long long next_seq = 1;
+    // For each destination island, the sequence number of the last
+    // entry delivered through the connection towards it.
+    std::unordered_map<archipelago::size_type, unsigned long long> cursors;
+    // Incoming state: the number of generations since the last
+    // migration into the island, and the time of the last migration.
+    unsigned long long n_gen = 0;
+    bool has_migrated = false;
+    clock_type::time_point last_migr;
+};
+
+} // namespace detail
+
 // NOTE: same utility method as in pagmo::island, see there.
 void archipelago::wait_check_ignore()
 {
@@ -114,6 +271,10 @@ archipelago::archipelago(const archipelago &other)
     // Migration type and migrant handling policy.
     m_migr_type.store(other.m_migr_type.load(std::memory_order_relaxed), std::memory_order_relaxed);
     m_migr_handling.store(other.m_migr_handling.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    // Migration scheduler. The mailboxes are not copied:
+    // push_back() gave each island an empty one.
+    m_sched = other.get_migration_scheduler_ptr();
 }
 
 /// Move constructor.
@@ -148,9 +309,11 @@ archipelago::archipelago(archipelago &&other) noexcept
     m_idx_map = std::move(other.m_idx_map);
     other.m_idx_map.clear();
 
-    // Move over the migrants, clear other.
+    // Move over the migrants and the mailboxes, clear other.
     m_migrants = std::move(other.m_migrants);
     other.m_migrants.clear();
+    m_mailboxes = std::move(other.m_mailboxes);
+    other.m_mailboxes.clear();
 
     // Move over the migration log, clear other.
     m_migr_log = std::move(other.m_migr_log);
@@ -163,6 +326,9 @@ archipelago::archipelago(archipelago &&other) noexcept
     // Migration type and migrant handling policy.
     m_migr_type.store(other.m_migr_type.load(std::memory_order_relaxed), std::memory_order_relaxed);
     m_migr_handling.store(other.m_migr_handling.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    // Migration scheduler.
+    m_sched = std::move(other.m_sched);
 }
 
 /// Copy assignment.
@@ -216,9 +382,11 @@ archipelago &archipelago::operator=(archipelago &&other) noexcept
         m_idx_map = std::move(other.m_idx_map);
         other.m_idx_map.clear();
 
-        // Move over the migrants, clear other.
+        // Move over the migrants and the mailboxes, clear other.
         m_migrants = std::move(other.m_migrants);
         other.m_migrants.clear();
+        m_mailboxes = std::move(other.m_mailboxes);
+        other.m_mailboxes.clear();
 
         // Move over the migration log, clear other.
         m_migr_log = std::move(other.m_migr_log);
@@ -230,6 +398,9 @@ archipelago &archipelago::operator=(archipelago &&other) noexcept
         // Migration type and migrant handling policy.
         m_migr_type.store(other.m_migr_type.load(std::memory_order_relaxed), std::memory_order_relaxed);
         m_migr_handling.store(other.m_migr_handling.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        // Migration scheduler.
+        m_sched = std::move(other.m_sched);
     }
     return *this;
 }
@@ -252,6 +423,7 @@ archipelago::~archipelago()
                        [this](const std::unique_ptr<island> &iptr) { return iptr->m_ptr->archi_ptr == this; }));
     assert(m_idx_map.size() == m_islands.size());
     assert(m_migrants.size() == m_islands.size());
+    assert(m_mailboxes.size() == m_islands.size());
 #if !defined(NDEBUG)
     for (size_type i = 0; i < m_islands.size(); ++i) {
         // Ensure that the vectors in the migrant db have
@@ -259,6 +431,9 @@ archipelago::~archipelago()
         assert(std::get<0>(m_migrants[i]).size() == std::get<1>(m_migrants[i]).size());
         assert(std::get<1>(m_migrants[i]).size() == std::get<2>(m_migrants[i]).size());
 
+        // Ensure the mailboxes have been created.
+        assert(m_mailboxes[i]);
+
         // Ensure the map of indices is correct.
         assert(m_idx_map.find(m_islands[i].get()) != m_idx_map.end());
         assert(m_idx_map.find(m_islands[i].get())->second == i);
@@ -344,8 +519,14 @@ void archipelago::evolve(unsigned n)
  */
 void archipelago::wait() noexcept
 {
+    // NOTE: create the wait RAII object only once for the whole
+    // archipelago, rather than once per island as in island::wait().
+    // In Python, this means that the GIL is released only once, rather
+    // than being re-acquired and released for each island.
+    auto iwr = detail::wait_raii_getter();
+    (void)iwr;
     for (const auto &iptr : m_islands) {
-        iptr->wait();
+        iptr->wait_impl();
     }
 }
 
@@ -364,12 +545,18 @@ void archipelago::wait() noexcept
  */
 void archipelago::wait_check()
 {
+    // NOTE: same as in wait().
+    auto iwr = detail::wait_raii_getter();
+    (void)iwr;
     for (auto it = m_islands.begin(); it != m_islands.end(); ++it) {
         try {
-            (*it)->wait_check();
+            (*it)->wait_check_impl();
         } catch (...) {
             for (it = it + 1; it != m_islands.end(); ++it) {
-                (*it)->wait_check_ignore();
+                try {
+                    (*it)->wait_check_impl();
+                } catch (...) {
+                }
             }
             throw;
         }
@@ -440,32 +627,63 @@ evolve_status archipelago::status() const
 
 /// Get the fitness vectors of the islands' champions.
 /**
+ * The champions are read from the islands' summaries (see island::get_summary()), thus
+ * this method does not copy the islands' populations.
+ *
  * @return a collection of the fitness vectors of the islands' champions.
  *
- * @throws unspecified any exception thrown by population::champion_f() or
+ * @throws unspecified any exception thrown by island_summary::get_champion_f() or
  * by memory errors in standard containers.
  */
 std::vector<vector_double> archipelago::get_champions_f() const
 {
     std::vector<vector_double> retval;
     for (const auto &isl_ptr : m_islands) {
-        retval.emplace_back(isl_ptr->get_population().champion_f());
+        retval.emplace_back(isl_ptr->get_summary_ptr()->get_champion_f());
     }
     return retval;
 }
 
 /// Get the decision vectors of the islands' champions.
 /**
+ * The champions are read from the islands' summaries (see island::get_summary()), thus
+ * this method does not copy the islands' populations.
+ *
  * @return a collection of the decision vectors of the islands' champions.
  *
- * @throws unspecified any exception thrown by population::champion_x() or
+ * @throws unspecified any exception thrown by island_summary::get_champion_x() or
  * by memory errors in standard containers.
  */
 std::vector<vector_double> archipelago::get_champions_x() const
 {
     std::vector<vector_double> retval;
     for (const auto &isl_ptr : m_islands) {
-        retval.emplace_back(isl_ptr->get_population().champion_x());
+        retval.emplace_back(isl_ptr->get_summary_ptr()->get_champion_x());
+    }
+    return retval;
+}
+
+/// Get the summaries of the islands.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This method returns the summaries of the islands (see :cpp:func:`pagmo::island::get_summary()`),
+ * without copying the islands' populations. It is safe to call this method while the archipelago is evolving.
+ *
+ * \endverbatim
+ *
+ * @return a collection of the islands' summaries.
+ *
+ * @throws unspecified any exception thrown by island::get_summary() or
+ * by memory errors in standard containers.
+ */
+std::vector<island_summary> archipelago::get_summaries() const
+{
+    std::vector<island_summary> retval;
+    retval.reserve(m_islands.size());
+    for (const auto &isl_ptr : m_islands) {
+        retval.push_back(*isl_ptr->get_summary_ptr());
     }
     return retval;
 }
@@ -497,9 +715,12 @@ void archipelago::push_back_impl(std::unique_ptr<island> &&new_island)
         pagmo_throw(std::overflow_error, "cannot add a new island to an archipelago due to an overflow condition");
     }
     // LCOV_EXCL_STOP
+    // Create the new mailbox.
+    auto new_mailbox = std::make_shared<detail::migration_mailbox>();
     {
         std::lock_guard<std::mutex> lock(m_migrants_mutex);
         m_migrants.reserve(m_migrants.size() + 1u);
+        m_mailboxes.reserve(m_mailboxes.size() + 1u);
     }
 
     // Map the new island idx.
@@ -511,14 +732,15 @@ void archipelago::push_back_impl(std::unique_ptr<island> &&new_island)
         m_idx_map.emplace(new_island.get(), m_islands.size());
     }
 
-    // Add an empty entry to the migrants db.
+    // Add an empty entry to the migrants db, and the new mailbox.
     try {
         std::lock_guard<std::mutex> lock(m_migrants_mutex);
         m_migrants.emplace_back();
+        m_mailboxes.push_back(std::move(new_mailbox));
     } catch (...) {
         // LCOV_EXCL_START
         // NOTE: we get here only if the lock throws, because we made space for the
-        // new migrants above already. Better to abort in such case, as we have no
+        // new migrants and mailbox above already. Better to abort in such case, as we have no
         // reasonable path for recovering from this.
         std::cerr << "An unrecoverable error arose while adding an island to the archipelago, aborting now."
                   << std::endl;
@@ -533,6 +755,10 @@ void archipelago::push_back_impl(std::unique_ptr<island> &&new_island)
     // If this fails, we will have a possibly *bad* topology in the archi, but this can
     // always happen via a bogus set_topology() and there's nothing we can do about it.
     m_topology.push_back();
+
+    // NOTE: adding a vertex may rewire existing connections
+    // (e.g., in a ring topology).
+    prune_mailbox_cursors();
 }
 
 // Get the index of an island.
@@ -697,6 +923,9 @@ void archipelago::set_topology(topology topo)
     // sure there's no interaction with the UDT happening.
     wait_check_ignore();
     m_topology = std::move(topo);
+    // The connections may have changed: erase the delivery
+    // cursors of the migration scheduler which became stale.
+    prune_mailbox_cursors();
 }
 
 namespace detail
@@ -753,6 +982,58 @@ std::pair<std::vector<archipelago::size_type>, vector_double> archipelago::get_i
                                                std::is_same<std::size_t, size_type>{});
 }
 
+// Get the list of connections to the island at index i, re-using
+// the CSR snapshot csr of the topology if possible. conns and csr are supposed
+// to come from a previous invocation of this function (or to be empty).
+// If the topology hands out the same snapshot as before, conns
+// will be left untouched, otherwise csr will be replaced by
+// the new snapshot and conns will be re-extracted from it.
+// If the topology does not provide CSR snapshots, the connections
+// will be fetched via get_connections().
+void archipelago::get_island_connections(size_type i, std::shared_ptr<const topology_csr> &csr,
+                                         std::pair<std::vector<size_type>, vector_double> &conns) const
+{
+    // NOTE: like get_connections(), has_to_csr() and to_csr()
+    // are required to be thread-safe.
+    if (!m_topology.has_to_csr()) {
+        csr.reset();
+        conns = get_island_connections(i);
+        return;
+    }
+
+    auto new_csr = m_topology.to_csr();
+    if (new_csr == csr) {
+        // The topology did not change.
+        return;
+    }
+
+    const auto idx = boost::numeric_cast<std::size_t>(i);
+    if (idx >= new_csr->num_vertices()) {
+        // NOTE: the island is not in the snapshot. This can happen, e.g., if the
+        // topology was set without adding the vertices for the existing islands.
+        // Let get_connections() deal with this case, so that the behaviour
+        // is the same as without snapshots.
+        csr.reset();
+        conns = get_island_connections(i);
+        return;
+    }
+
+    const auto &ro = new_csr->get_row_offsets();
+    const auto &cols = new_csr->get_columns();
+    const auto &ws = new_csr->get_weights();
+
+    // NOTE: clear() preserves the capacity, thus
+    // no allocation will be needed in the common case.
+    conns.first.clear();
+    conns.second.clear();
+    for (auto k = ro[idx]; k < ro[idx + 1u]; ++k) {
+        conns.first.push_back(boost::numeric_cast<size_type>(cols[k]));
+        conns.second.push_back(ws[k]);
+    }
+
+    csr = std::move(new_csr);
+}
+
 /// Get the migration type.
 /**
  * @return the migration type for this archipelago.
@@ -768,7 +1049,16 @@ migration_type archipelago::get_migration_type() const
  */
 void archipelago::set_migration_type(migration_type mt)
 {
+    std::lock_guard<std::mutex> lock(m_sched_mutex);
     m_migr_type.store(mt, std::memory_order_relaxed);
+    if (m_sched) {
+        // Keep the active migration scheduler consistent.
+        m_sched = std::make_shared<const migration_scheduler>(mt, m_sched->get_migrant_handling(),
+                                                              m_sched->get_gen_interval(),
+                                                              m_sched->get_time_interval(),
+                                                              m_sched->get_mailbox_size(),
+                                                              m_sched->get_max_staleness());
+    }
 }
 
 /// Get the migrant handling policy.
@@ -786,7 +1076,382 @@ migrant_handling archipelago::get_migrant_handling() const
  */
 void archipelago::set_migrant_handling(migrant_handling mh)
 {
+    std::lock_guard<std::mutex> lock(m_sched_mutex);
     m_migr_handling.store(mh, std::memory_order_relaxed);
+    if (m_sched) {
+        // Keep the active migration scheduler consistent.
+        m_sched = std::make_shared<const migration_scheduler>(m_sched->get_migration_type(), mh,
+                                                              m_sched->get_gen_interval(),
+                                                              m_sched->get_time_interval(),
+                                                              m_sched->get_mailbox_size(),
+                                                              m_sched->get_max_staleness());
+    }
+}
+
+/// Set a migration scheduler.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This method will activate the asynchronous migration scheme described by *ms*
+ * (see :cpp:class:`~pagmo::migration_scheduler`). The migration type and the migrant
+ * handling policy of the archipelago will be set to the ones of *ms*.
+ *
+ * The scheduler can be set while the archipelago is evolving: the islands will
+ * pick it up at the next generation.
+ * \endverbatim
+ *
+ * @param ms the migration scheduler.
+ *
+ * @throws unspecified any exception thrown by threading primitives or by memory allocation errors.
+ */
+void archipelago::set_migration_scheduler(const migration_scheduler &ms)
+{
+    auto new_sched = std::make_shared<const migration_scheduler>(ms);
+
+    std::lock_guard<std::mutex> lock(m_sched_mutex);
+    m_sched = std::move(new_sched);
+    m_migr_type.store(ms.get_migration_type(), std::memory_order_relaxed);
+    m_migr_handling.store(ms.get_migrant_handling(), std::memory_order_relaxed);
+}
+
+/// Unset the migration scheduler.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * After a call to this method, the archipelago will go back to the default migration scheme.
+ * \endverbatim
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+void archipelago::unset_migration_scheduler()
+{
+    std::lock_guard<std::mutex> lock(m_sched_mutex);
+    m_sched.reset();
+}
+
+/// Get the migration scheduler.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ * \endverbatim
+ *
+ * @return a copy of the active migration scheduler, or an empty optional
+ * if no migration scheduler is active.
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+boost::optional<migration_scheduler> archipelago::get_migration_scheduler() const
+{
+    const auto ptr = get_migration_scheduler_ptr();
+    if (ptr) {
+        return *ptr;
+    }
+    return boost::none;
+}
+
+/// Enable or disable the instrumentation of the islands.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This method will invoke :cpp:func:`pagmo::island::set_stats_enabled()` on all the islands
+ * currently in the archipelago. Islands added to the archipelago afterwards will retain their
+ * own instrumentation flag.
+ *
+ * It is safe to call this method while the archipelago is evolving.
+ * \endverbatim
+ *
+ * @param on the new value of the instrumentation flag.
+ */
+void archipelago::set_stats_enabled(bool on)
+{
+    for (const auto &isl_ptr : m_islands) {
+        isl_ptr->set_stats_enabled(on);
+    }
+}
+
+/// Get the instrumentation data of the islands.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * It is safe to call this method while the archipelago is evolving.
+ * \endverbatim
+ *
+ * @return a vector containing the instrumentation data of each island, in the
+ * same order as the islands in the archipelago.
+ *
+ * @throws unspecified any exception thrown by pagmo::island::get_stats() or
+ * by memory errors in standard containers.
+ */
+std::vector<island_stats> archipelago::get_stats() const
+{
+    std::vector<island_stats> retval;
+    retval.reserve(m_islands.size());
+    for (const auto &isl_ptr : m_islands) {
+        retval.emplace_back(isl_ptr->get_stats());
+    }
+    return retval;
+}
+
+/// Get the aggregated instrumentation data of the islands.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * It is safe to call this method while the archipelago is evolving.
+ * \endverbatim
+ *
+ * @return the merge of the instrumentation data of all the islands.
+ *
+ * @throws unspecified any exception thrown by pagmo::island::get_stats().
+ */
+island_stats archipelago::get_aggregated_stats() const
+{
+    island_stats retval;
+    for (const auto &isl_ptr : m_islands) {
+        retval += isl_ptr->get_stats();
+    }
+    return retval;
+}
+
+/// Reset the instrumentation data of the islands.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * It is safe to call this method while the archipelago is evolving.
+ * \endverbatim
+ *
+ * @throws unspecified any exception thrown by pagmo::island::reset_stats().
+ */
+void archipelago::reset_stats()
+{
+    for (const auto &isl_ptr : m_islands) {
+        isl_ptr->reset_stats();
+    }
+}
+
+// Get a pointer to the active migration scheduler (null if there is none).
+std::shared_ptr<const migration_scheduler> archipelago::get_migration_scheduler_ptr() const
+{
+    std::lock_guard<std::mutex> lock(m_sched_mutex);
+    return m_sched;
+}
+
+// Assign to this the deserialised parts of an archipelago. This is used
+// both in the deserialisation via Boost and when loading checkpoints.
+void archipelago::assign_parts(container_t &&islands, migrants_db_t &&migrants, migration_log_t &&migr_log,
+                               topology &&topo, migration_type migr_type, migrant_handling migr_handling,
+                               std::shared_ptr<const migration_scheduler> &&sched)
+{
+    // The tmp archi. This is def-cted and idle, we will be able to move-in data without
+    // worrying about synchronization.
+    archipelago tmp;
+
+    // Map the islands to indices.
+    idx_map_t tmp_idx_map;
+    for (size_type i = 0; i < islands.size(); ++i) {
+        tmp_idx_map.emplace(islands[i].get(), i);
+    }
+
+    // Fresh mailboxes for the islands.
+    auto tmp_mailboxes = make_mailboxes(islands.size());
+
+    // From now on, everything is noexcept. Thus, there is
+    // no danger that tmp is destructed while in an inconsistent
+    // state.
+    tmp.m_islands = std::move(islands);
+    tmp.m_idx_map = std::move(tmp_idx_map);
+    tmp.m_migrants = std::move(migrants);
+    tmp.m_migr_log = std::move(migr_log);
+    tmp.m_topology = std::move(topo);
+    tmp.m_migr_type.store(migr_type, std::memory_order_relaxed);
+    tmp.m_migr_handling.store(migr_handling, std::memory_order_relaxed);
+    tmp.m_sched = std::move(sched);
+    tmp.m_mailboxes = std::move(tmp_mailboxes);
+
+    // NOTE: this final assignment will take care of setting the islands' archi pointers
+    // appropriately via archi's move assignment operator.
+    *this = std::move(tmp);
+}
+
+// Create n empty mailboxes.
+std::vector<std::shared_ptr<detail::migration_mailbox>> archipelago::make_mailboxes(size_type n)
+{
+    std::vector<std::shared_ptr<detail::migration_mailbox>> retval;
+    retval.reserve(n);
+    for (size_type i = 0; i < n; ++i) {
+        retval.push_back(std::make_shared<detail::migration_mailbox>());
+    }
+    return retval;
+}
+
+// Get the mailbox of the island at index i.
+std::shared_ptr<detail::migration_mailbox> archipelago::get_mailbox(size_type i) const
+{
+    std::lock_guard<std::mutex> lock(m_migrants_mutex);
+
+    if (i >= m_mailboxes.size()) {
+        pagmo_throw(std::out_of_range, "cannot access the mailbox of the island at index " + std::to_string(i)
+                                           + ": the archipelago has only " + std::to_string(m_mailboxes.size())
+                                           + " mailboxes");
+    }
+
+    return m_mailboxes[i];
+}
+
+// Erase the delivery cursors of the connections which are not
+// in the topology anymore. This is meant to be called after
+// the topology has changed. Stale cursors only waste memory,
+// thus any error is ignored and the cursors are left in place.
+void archipelago::prune_mailbox_cursors() noexcept
+{
+    try {
+        std::vector<std::shared_ptr<detail::migration_mailbox>> mboxes;
+        {
+            std::lock_guard<std::mutex> lock(m_migrants_mutex);
+            mboxes = m_mailboxes;
+        }
+
+        // Cache of the (sorted) sources of the destination islands
+        // appearing in the cursors.
+        std::unordered_map<size_type, std::vector<size_type>> sources;
+        for (size_type src = 0; src < mboxes.size(); ++src) {
+            auto &mbox = *mboxes[src];
+            std::lock_guard<std::mutex> lock(mbox.mutex);
+            for (auto it = mbox.cursors.begin(); it != mbox.cursors.end();) {
+                auto s_it = sources.find(it->first);
+                if (s_it == sources.end()) {
+                    auto tmp = get_island_connections(it->first).first;
+                    std::sort(tmp.begin(), tmp.end());
+                    s_it = sources.emplace(it->first, std::move(tmp)).first;
+                }
+                if (std::binary_search(s_it->second.begin(), s_it->second.end(), src)) {
+                    ++it;
+                } else {
+                    it = mbox.cursors.erase(it);
+                }
+            }
+        }
+        // LCOV_EXCL_START
+    } catch (...) {
+    }
+    // LCOV_EXCL_STOP
+}
+
+// Push a copy of the migrants selected by island i into its mailbox.
+void archipelago::push_migrants(size_type i, const migration_scheduler &ms, const individuals_group_t &inds)
+{
+    // Don't do anything if there are no migrants.
+    if (std::get<0>(inds).empty()) {
+        return;
+    }
+
+    const auto mbox = get_mailbox(i);
+    const auto now = detail::migration_mailbox::clock_type::now();
+
+    // NOTE: copy the migrants before locking.
+    individuals_group_t tmp(inds);
+
+    std::lock_guard<std::mutex> lock(mbox->mutex);
+    mbox->prune(now, ms.get_max_staleness());
+    mbox->entries.push_back(detail::migration_mailbox::entry{mbox->next_seq++, now, std::move(tmp)});
+    while (mbox->entries.size() > ms.get_mailbox_size()) {
+        mbox->entries.pop_front();
+    }
+}
+
+// Fetch the fresh migrants for island i from the mailboxes of the islands in conns.
+// The return value pairs the indices of the source islands to the migrants
+// coming from them. An empty return value means that no migration took place.
+std::vector<std::pair<archipelago::size_type, individuals_group_t>>
+archipelago::pull_migrants(size_type i, const migration_scheduler &ms,
+                           const std::pair<std::vector<size_type>, vector_double> &conns, std::mt19937 &eng)
+{
+    std::vector<std::pair<size_type, individuals_group_t>> retval;
+
+    const auto now = detail::migration_mailbox::clock_type::now();
+
+    // Check first if it's time to migrate into island i.
+    {
+        const auto dst = get_mailbox(i);
+        std::lock_guard<std::mutex> lock(dst->mutex);
+
+        if (dst->n_gen < std::numeric_limits<unsigned long long>::max()) {
+            ++dst->n_gen;
+        }
+        if (dst->n_gen < ms.get_gen_interval()
+            || (dst->has_migrated
+                && std::chrono::duration<double>(now - dst->last_migr).count() < ms.get_time_interval())) {
+            return retval;
+        }
+
+        dst->n_gen = 0;
+        dst->has_migrated = true;
+        dst->last_migr = now;
+    }
+
+    // Select the sources, following the same logic
+    // of the default migration scheme.
+    std::vector<size_type> sources;
+    if (ms.get_migration_type() == migration_type::p2p) {
+        if (conns.first.size()) {
+            std::uniform_int_distribution<decltype(conns.first.size())> idx_dist(0, conns.first.size() - 1u);
+            const auto idx = idx_dist(eng);
+            if (std::uniform_real_distribution<>{}(eng) < conns.second[idx]) {
+                sources.push_back(conns.first[idx]);
+            }
+        }
+    } else {
+        for (decltype(conns.first.size()) j = 0; j < conns.first.size(); ++j) {
+            if (std::uniform_real_distribution<>{}(eng) < conns.second[j]) {
+                sources.push_back(conns.first[j]);
+            }
+        }
+    }
+
+    for (const auto src_idx : sources) {
+        // NOTE: we never hold the locks of two mailboxes
+        // at the same time, thus there's no danger of deadlocks.
+        const auto src = get_mailbox(src_idx);
+        individuals_group_t inds;
+
+        {
+            std::lock_guard<std::mutex> lock(src->mutex);
+            src->prune(now, ms.get_max_staleness());
+
+            // Collect the entries which were not delivered
+            // yet through the src_idx -> i connection.
+            auto &cursor = src->cursors[i];
+            for (auto it = src->entries.begin(); it != src->entries.end();) {
+                if (it->seq > cursor) {
+                    cursor = it->seq;
+                    const auto &cur = it->inds;
+                    std::get<0>(inds).insert(std::get<0>(inds).end(), std::get<0>(cur).begin(),
+                                             std::get<0>(cur).end());
+                    std::get<1>(inds).insert(std::get<1>(inds).end(), std::get<1>(cur).begin(),
+                                             std::get<1>(cur).end());
+                    std::get<2>(inds).insert(std::get<2>(inds).end(), std::get<2>(cur).begin(),
+                                             std::get<2>(cur).end());
+                    if (ms.get_migrant_handling() == migrant_handling::evict) {
+                        // Evicted migrants are delivered only once.
+                        it = src->entries.erase(it);
+                        continue;
+                    }
+                }
+                ++it;
+            }
+        }
+
+        if (!std::get<0>(inds).empty()) {
+            retval.emplace_back(src_idx, std::move(inds));
+        }
+    }
+
+    return retval;
 }
 
 /// Stream operator.
@@ -809,6 +1474,10 @@ std::ostream &operator<<(std::ostream &os, const archipelago &archi)
     stream(os, "Topology: ", archi.get_topology().get_name(), "\n");
     stream(os, "Migration type: ", archi.get_migration_type(), "\n");
     stream(os, "Migrant handling policy: ", archi.get_migrant_handling(), "\n");
+    const auto sched = archi.get_migration_scheduler();
+    if (sched) {
+        stream(os, "Migration scheduler:\n", *sched);
+    }
     stream(os, "Status: ", archi.status(), "\n\n");
     stream(os, "Islands summaries:\n\n");
     detail::table t({"#", "Type", "Algo", "Prob", "Size", "Status"}, "\t");
@@ -85,6 +85,15 @@ vector_double thread_bfe::operator()(const problem &p, const vector_double &dvs)
         assert(end <= n_dvs);
         (void)n_dvs;
 
+        if (prob.has_fitness_into()) {
+            // The UDP can read the dvs and write the fitnesses
+            // in place: no temporary storage is needed.
+            for (; begin != end; ++begin) {
+                detail::prob_invoke_mem_fitness_into(prob, dvs.data() + begin * n_dim, retval.data() + begin * f_dim);
+            }
+            return;
+        }
+
         // Temporary dv that will be used for fitness evaluation.
         vector_double tmp_dv(n_dim);
         for (; begin != end; ++begin) {
@@ -98,7 +107,12 @@ vector_double thread_bfe::operator()(const problem &p, const vector_double &dvs)
                 in_ptr, in_ptr + n_dim, tmp_dv.begin()
 #endif
             );
-            const auto fv = prob.fitness(tmp_dv);
+            // NOTE: tmp_dv has the correct size by construction, thus
+            // we can skip the checks on the input and use the trusted
+            // fitness entry point. The output must be checked before writing
+            // it into retval though.
+            const auto fv = detail::prob_invoke_mem_fitness(prob, tmp_dv);
+            detail::prob_check_fv(prob, fv.data(), fv.size());
             assert(fv.size() == f_dim);
             std::copy(
 #if defined(_MSC_VER)
@@ -0,0 +1,728 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/algorithm.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/checkpoint.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/island.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/r_policy.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/s_policy.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+#if defined(PAGMO_WITH_ZLIB)
+
+#include <zlib.h>
+
+#endif
+
+#if defined(PAGMO_WITH_MMAP)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for checkpoint_compression.
+std::ostream &operator<<(std::ostream &os, checkpoint_compression c)
+{
+    switch (c) {
+        case checkpoint_compression::none:
+            os << "none";
+            break;
+        case checkpoint_compression::zlib:
+            os << "zlib";
+            break;
+        default:
+            os << "unknown";
+    }
+    return os;
+}
+
+#endif
+
+namespace detail
+{
+
+namespace
+{
+
+// NOTE: the columns are written as raw bytes, hence we require
+// the in-memory representation of the individuals' data to be
+// the canonical one.
+static_assert(sizeof(double) == 8u && std::numeric_limits<double>::is_iec559, "Unsupported floating-point type.");
+static_assert(sizeof(unsigned long long) == 8u, "Unsupported integral type.");
+
+// The layout of a checkpoint is the following:
+//
+// - the magic string "PAGMOCKP",
+// - the format version and the compression flag (two 32-bit unsigned integers),
+// - an endianness marker (a 64-bit unsigned integer),
+// - the number of islands (a 64-bit unsigned integer),
+// - for each island:
+//   - a block containing the Boost serialisation of the UDI, the algorithm, the r/s policies,
+//     the problem, the champion, the random engine and the seed of the population,
+//   - the population size, the problem dimension and the fitness dimension
+//     (three 64-bit unsigned integers),
+//   - three blocks containing respectively the IDs, the decision vectors (row-major)
+//     and the fitness vectors (row-major) of the population,
+// - a block containing the Boost serialisation of the archipelago's migration data
+//   (migrants database, migration log, topology, migration type, migrant handling
+//   policy and migration scheduler).
+//
+// Each block is stored as its uncompressed size and its stored size (two 64-bit unsigned integers),
+// followed by the stored bytes. If compression is active, the blocks containing the columns
+// are byte-shuffled before being compressed (i.e., the first bytes of all the elements are stored contiguously,
+// then the second bytes, etc.), which greatly improves the compression ratio of floating-point data.
+constexpr char ckp_magic[] = {'P', 'A', 'G', 'M', 'O', 'C', 'K', 'P'};
+constexpr std::uint32_t ckp_version = 1;
+constexpr std::uint64_t ckp_endian_marker = 0x0102030405060708ull;
+
+[[noreturn]] void ckp_invalid(const std::string &msg)
+{
+    pagmo_throw(std::invalid_argument, "Invalid archipelago checkpoint: " + msg);
+}
+
+#if !defined(PAGMO_WITH_ZLIB)
+
+[[noreturn]] void ckp_zlib_unavailable()
+{
+    pagmo_throw(not_implemented_error, "Compression of archipelago checkpoints requires pagmo to be built with "
+                                       "zlib support (see the PAGMO_WITH_ZLIB build option)");
+}
+
+#endif
+
+template <typename T>
+void ckp_write(std::ostream &os, const T &x)
+{
+    os.write(reinterpret_cast<const char *>(&x), sizeof(T));
+}
+
+#if defined(PAGMO_WITH_ZLIB)
+
+// Byte-(un)shuffling of a buffer made of elements of size esize.
+std::vector<char> ckp_shuffle(const char *data, std::size_t size, std::size_t esize)
+{
+    assert(size % esize == 0u);
+    const auto n = size / esize;
+    std::vector<char> retval(size);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t b = 0; b < esize; ++b) {
+            retval[b * n + i] = data[i * esize + b];
+        }
+    }
+    return retval;
+}
+
+void ckp_unshuffle(const char *data, std::size_t size, std::size_t esize, char *out)
+{
+    assert(size % esize == 0u);
+    const auto n = size / esize;
+    for (std::size_t b = 0; b < esize; ++b) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i * esize + b] = data[b * n + i];
+        }
+    }
+}
+
+#endif
+
+// Write a block of size bytes, made of elements of size esize.
+void ckp_write_block(std::ostream &os, const char *data, std::size_t size, std::size_t esize,
+                     checkpoint_compression comp)
+{
+    if (comp == checkpoint_compression::none) {
+        ckp_write(os, static_cast<std::uint64_t>(size));
+        ckp_write(os, static_cast<std::uint64_t>(size));
+        os.write(data, static_cast<std::streamsize>(size));
+        return;
+    }
+
+#if defined(PAGMO_WITH_ZLIB)
+    if (size > std::numeric_limits<uLong>::max()) {
+        pagmo_throw(std::overflow_error, "A block of " + std::to_string(size)
+                                             + " bytes is too large to be compressed in an archipelago checkpoint");
+    }
+    std::vector<char> shuffled;
+    if (esize > 1u) {
+        shuffled = ckp_shuffle(data, size, esize);
+        data = shuffled.data();
+    }
+    auto out_size = compressBound(static_cast<uLong>(size));
+    std::vector<char> out(out_size);
+    if (compress2(reinterpret_cast<Bytef *>(out.data()), &out_size, reinterpret_cast<const Bytef *>(data),
+                  static_cast<uLong>(size), Z_DEFAULT_COMPRESSION)
+        != Z_OK) {
+        pagmo_throw(std::runtime_error, "The compression of a block of an archipelago checkpoint failed");
+    }
+    ckp_write(os, static_cast<std::uint64_t>(size));
+    ckp_write(os, static_cast<std::uint64_t>(out_size));
+    os.write(out.data(), static_cast<std::streamsize>(out_size));
+#else
+    (void)data;
+    (void)esize;
+    ckp_zlib_unavailable();
+#endif
+}
+
+// Boost serialisation of a set of objects into a block.
+template <typename... Args>
+void ckp_write_s11n_block(std::ostream &os, checkpoint_compression comp, const Args &... args)
+{
+    std::ostringstream oss;
+    {
+        boost::archive::binary_oarchive oa(oss);
+        to_archive(oa, args...);
+    }
+    const auto str = oss.str();
+    ckp_write_block(os, str.data(), str.size(), 1, comp);
+}
+
+// A bounds-checked cursor into a checkpoint held in memory.
+class ckp_reader
+{
+public:
+    explicit ckp_reader(const char *begin, std::size_t size, bool compressed)
+        : m_cur(begin), m_end(begin + size), m_compressed(compressed)
+    {
+    }
+    void set_compressed(bool c)
+    {
+        m_compressed = c;
+    }
+    const char *read_bytes(std::size_t n)
+    {
+        if (n > static_cast<std::size_t>(m_end - m_cur)) {
+            ckp_invalid("the data is truncated");
+        }
+        const auto retval = m_cur;
+        m_cur += n;
+        return retval;
+    }
+    template <typename T>
+    T read()
+    {
+        T retval;
+        std::memcpy(&retval, read_bytes(sizeof(T)), sizeof(T));
+        return retval;
+    }
+    std::size_t read_size()
+    {
+        const auto s = read<std::uint64_t>();
+        if (s > std::numeric_limits<std::size_t>::max()) {
+            ckp_invalid("a size is too large");
+        }
+        return static_cast<std::size_t>(s);
+    }
+    // Read a block made of elements of size esize. If the block is not compressed,
+    // the returned pointer points directly into the checkpoint's data, otherwise
+    // it points into buf.
+    std::pair<const char *, std::size_t> read_block(std::size_t esize, std::vector<char> &buf)
+    {
+        const auto raw_size = read_size();
+        const auto stored_size = read_size();
+        const auto data = read_bytes(stored_size);
+        if (!m_compressed) {
+            if (raw_size != stored_size) {
+                ckp_invalid("inconsistent block sizes");
+            }
+            return {data, raw_size};
+        }
+#if defined(PAGMO_WITH_ZLIB)
+        if (raw_size > std::numeric_limits<uLong>::max() || stored_size > std::numeric_limits<uLong>::max()
+            || raw_size % esize) {
+            ckp_invalid("inconsistent block sizes");
+        }
+        std::vector<char> inflated(raw_size);
+        auto out_size = static_cast<uLongf>(raw_size);
+        if (uncompress(reinterpret_cast<Bytef *>(inflated.data()), &out_size, reinterpret_cast<const Bytef *>(data),
+                       static_cast<uLong>(stored_size))
+                != Z_OK
+            || out_size != raw_size) {
+            ckp_invalid("the decompression of a block failed");
+        }
+        if (esize > 1u) {
+            buf.resize(raw_size);
+            ckp_unshuffle(inflated.data(), raw_size, esize, buf.data());
+        } else {
+            buf = std::move(inflated);
+        }
+        return {buf.data(), raw_size};
+#else
+        (void)esize;
+        (void)buf;
+        ckp_zlib_unavailable();
+#endif
+    }
+    // Read a block containing Boost-serialised objects.
+    template <typename... Args>
+    void read_s11n_block(Args &... args)
+    {
+        std::vector<char> buf;
+        const auto blk = read_block(1, buf);
+        std::istringstream iss(std::string(blk.first, blk.second));
+        try {
+            boost::archive::binary_iarchive ia(iss);
+            from_archive(ia, args...);
+        } catch (const boost::archive::archive_exception &e) {
+            ckp_invalid(std::string("the deserialisation of a block failed (") + e.what() + ")");
+        }
+    }
+    bool at_end() const
+    {
+        return m_cur == m_end;
+    }
+
+private:
+    const char *m_cur;
+    const char *m_end;
+    bool m_compressed;
+};
+
+// Check that a column block contains n * dim elements of type T.
+template <typename T>
+void ckp_check_column(std::size_t blk_size, std::size_t n, std::size_t dim)
+{
+    if (dim && n > std::numeric_limits<std::size_t>::max() / dim) {
+        ckp_invalid("the size of a population is too large");
+    }
+    if (n * dim > std::numeric_limits<std::size_t>::max() / sizeof(T) || blk_size != n * dim * sizeof(T)) {
+        ckp_invalid("the size of a column is inconsistent with the size of the population");
+    }
+}
+
+// Rebuild the rows of a matrix from a row-major column block.
+std::vector<vector_double> ckp_rows(const char *data, std::size_t n, std::size_t dim)
+{
+    std::vector<vector_double> retval(n, vector_double(dim));
+    for (std::size_t i = 0; i < n; ++i) {
+        if (dim) {
+            std::memcpy(retval[i].data(), data + i * dim * sizeof(double), dim * sizeof(double));
+        }
+    }
+    return retval;
+}
+
+} // namespace
+
+// The implementation of the archipelago checkpoints.
+struct archi_checkpoint {
+    static void save(const archipelago &archi, std::ostream &os, checkpoint_compression comp)
+    {
+        if (comp != checkpoint_compression::none && comp != checkpoint_compression::zlib) {
+            pagmo_throw(std::invalid_argument, "Invalid compression scheme specified for an archipelago checkpoint");
+        }
+#if !defined(PAGMO_WITH_ZLIB)
+        if (comp == checkpoint_compression::zlib) {
+            ckp_zlib_unavailable();
+        }
+#endif
+
+        // The header.
+        os.write(ckp_magic, sizeof(ckp_magic));
+        ckp_write(os, ckp_version);
+        ckp_write(os, static_cast<std::uint32_t>(comp));
+        ckp_write(os, ckp_endian_marker);
+        ckp_write(os, static_cast<std::uint64_t>(archi.size()));
+
+        std::vector<char> buf;
+        for (const auto &isl_ptr : archi.m_islands) {
+            const auto &isl = *isl_ptr;
+            // NOTE: fetch the pointers to the current population and algorithm,
+            // so that we avoid copying the population.
+            const auto pop_ptr = isl.get_population_ptr();
+            const auto algo_ptr = isl.get_algorithm_ptr();
+            const auto &pop = *pop_ptr;
+
+            ckp_write_s11n_block(os, comp, isl.m_ptr->isl_ptr, *algo_ptr, isl.get_r_policy(), isl.get_s_policy(),
+                                 pop.m_prob, pop.m_champion_x, pop.m_champion_f, pop.m_e, pop.m_seed);
+
+            const auto n = pop.m_ID.size();
+            const auto nx = pop.m_prob.get_nx();
+            const auto nf = pop.m_prob.get_nf();
+            ckp_write(os, static_cast<std::uint64_t>(n));
+            ckp_write(os, static_cast<std::uint64_t>(nx));
+            ckp_write(os, static_cast<std::uint64_t>(nf));
+
+            // The IDs.
+            ckp_write_block(os, reinterpret_cast<const char *>(pop.m_ID.data()), n * sizeof(unsigned long long),
+                            sizeof(unsigned long long), comp);
+
+            // The decision and fitness vectors, flattened in row-major order.
+            const auto write_rows = [&os, &buf, n, comp](const std::vector<vector_double> &rows,
+                                                         vector_double::size_type dim) {
+                buf.resize(n * dim * sizeof(double));
+                for (std::size_t i = 0; i < n; ++i) {
+                    assert(rows[i].size() == dim);
+                    if (dim) {
+                        std::memcpy(buf.data() + i * dim * sizeof(double), rows[i].data(), dim * sizeof(double));
+                    }
+                }
+                ckp_write_block(os, buf.data(), buf.size(), sizeof(double), comp);
+            };
+            write_rows(pop.m_x, nx);
+            write_rows(pop.m_f, nf);
+        }
+
+        // The migration data.
+        const auto sched = archi.get_migration_scheduler();
+        const bool has_sched = static_cast<bool>(sched);
+        if (has_sched) {
+            ckp_write_s11n_block(os, comp, archi.get_migrants_db(), archi.get_migration_log(), archi.get_topology(),
+                                 archi.get_migration_type(), archi.get_migrant_handling(), has_sched, *sched);
+        } else {
+            ckp_write_s11n_block(os, comp, archi.get_migrants_db(), archi.get_migration_log(), archi.get_topology(),
+                                 archi.get_migration_type(), archi.get_migrant_handling(), has_sched);
+        }
+
+        if (!os) {
+            pagmo_throw(std::runtime_error, "An I/O error was raised while writing an archipelago checkpoint");
+        }
+    }
+    static void load(archipelago &archi, const char *data, std::size_t size)
+    {
+        ckp_reader r(data, size, false);
+
+        // The header.
+        if (std::memcmp(r.read_bytes(sizeof(ckp_magic)), ckp_magic, sizeof(ckp_magic))) {
+            ckp_invalid("the data does not start with the expected magic string");
+        }
+        const auto version = r.read<std::uint32_t>();
+        if (version != ckp_version) {
+            ckp_invalid("unsupported format version " + std::to_string(version));
+        }
+        const auto comp = r.read<std::uint32_t>();
+        if (comp == static_cast<std::uint32_t>(checkpoint_compression::zlib)) {
+#if !defined(PAGMO_WITH_ZLIB)
+            ckp_zlib_unavailable();
+#endif
+            r.set_compressed(true);
+        } else if (comp != static_cast<std::uint32_t>(checkpoint_compression::none)) {
+            ckp_invalid("unknown compression scheme " + std::to_string(comp));
+        }
+        if (r.read<std::uint64_t>() != ckp_endian_marker) {
+            ckp_invalid("the checkpoint was created on a platform with a different byte order");
+        }
+        const auto n_islands = r.read_size();
+
+        // The islands.
+        archipelago::container_t islands;
+        std::vector<char> buf;
+        for (std::size_t i = 0; i < n_islands; ++i) {
+            island tmp_isl;
+            population tmp_pop;
+            // NOTE: no need to lock access to these, as there is no evolution going on in tmp_isl.
+            r.read_s11n_block(tmp_isl.m_ptr->isl_ptr, *tmp_isl.m_ptr->algo, tmp_isl.m_ptr->r_pol,
+                              tmp_isl.m_ptr->s_pol, tmp_pop.m_prob, tmp_pop.m_champion_x, tmp_pop.m_champion_f,
+                              tmp_pop.m_e, tmp_pop.m_seed);
+
+            const auto n = r.read_size();
+            const auto nx = r.read_size();
+            const auto nf = r.read_size();
+            if (nx != tmp_pop.m_prob.get_nx() || nf != tmp_pop.m_prob.get_nf()) {
+                ckp_invalid("the dimensions of the population of island " + std::to_string(i)
+                            + " are inconsistent with its problem");
+            }
+
+            auto blk = r.read_block(sizeof(unsigned long long), buf);
+            ckp_check_column<unsigned long long>(blk.second, n, 1);
+            std::vector<unsigned long long> ID(n);
+            if (n) {
+                std::memcpy(ID.data(), blk.first, blk.second);
+            }
+
+            blk = r.read_block(sizeof(double), buf);
+            ckp_check_column<double>(blk.second, n, nx);
+            auto x = ckp_rows(blk.first, n, nx);
+
+            blk = r.read_block(sizeof(double), buf);
+            ckp_check_column<double>(blk.second, n, nf);
+            auto f = ckp_rows(blk.first, n, nf);
+
+            // NOTE: the individuals are moved in all at once, so that tmp_pop is never
+            // in an inconsistent state.
+            tmp_pop.m_ID = std::move(ID);
+            tmp_pop.m_x = std::move(x);
+            tmp_pop.m_f = std::move(f);
+            *tmp_isl.m_ptr->pop = std::move(tmp_pop);
+
+            islands.push_back(detail::make_unique<island>(std::move(tmp_isl)));
+        }
+
+        // The migration data.
+        archipelago::migrants_db_t migrants;
+        archipelago::migration_log_t migr_log;
+        topology topo;
+        migration_type migr_type;
+        migrant_handling migr_handling;
+        bool has_sched;
+        std::shared_ptr<const migration_scheduler> sched;
+        {
+            std::vector<char> sbuf;
+            const auto blk = r.read_block(1, sbuf);
+            std::istringstream iss(std::string(blk.first, blk.second));
+            try {
+                boost::archive::binary_iarchive ia(iss);
+                from_archive(ia, migrants, migr_log, topo, migr_type, migr_handling, has_sched);
+                if (has_sched) {
+                    migration_scheduler ms;
+                    ia >> ms;
+                    sched = std::make_shared<const migration_scheduler>(ms);
+                }
+            } catch (const boost::archive::archive_exception &e) {
+                ckp_invalid(std::string("the deserialisation of the migration data failed (") + e.what() + ")");
+            }
+        }
+        if (migrants.size() != islands.size()) {
+            ckp_invalid("the size of the migrants database is inconsistent with the number of islands");
+        }
+        if (!r.at_end()) {
+            ckp_invalid("unexpected trailing data");
+        }
+
+        archi.assign_parts(std::move(islands), std::move(migrants), std::move(migr_log), std::move(topo), migr_type,
+                           migr_handling, std::move(sched));
+    }
+};
+
+} // namespace detail
+
+/// Save an archipelago checkpoint.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This function will write into the stream *os* a binary checkpoint of the archipelago *archi*, which
+ * can later be restored via :cpp:func:`pagmo::load_checkpoint()`. Differently from the Boost
+ * serialisation of an archipelago, the individuals of each population are stored in a columnar layout
+ * (IDs, decision vectors and fitness vectors in three contiguous blocks), so that large populations can be
+ * written and read back with a handful of bulk memory copies. The other components of the archipelago
+ * (UDIs, algorithms, problems, topology, etc.) are stored via Boost serialisation.
+ *
+ * If *comp* is :cpp:enumerator:`pagmo::checkpoint_compression::zlib`, the blocks of the checkpoint are
+ * byte-shuffled and compressed with zlib. This option is available only if pagmo was built
+ * with zlib support.
+ *
+ * Checkpoints are not portable across platforms with different byte orders.
+ *
+ * .. note::
+ *
+ *    The islands of *archi* are saved one after the other without stopping ongoing evolutions: if *archi*
+ *    is evolving, the checkpoint will contain a mix of the states of the islands at different times.
+ *    Call :cpp:func:`pagmo::archipelago::wait()` beforehand in order to save a consistent snapshot.
+ *
+ * \endverbatim
+ *
+ * @param archi the archipelago to be saved.
+ * @param os the output stream.
+ * @param comp the compression scheme.
+ *
+ * @throws std::invalid_argument if \p comp is not a valid compression scheme.
+ * @throws not_implemented_error if \p comp is pagmo::checkpoint_compression::zlib and pagmo was
+ * built without zlib support.
+ * @throws std::overflow_error if a block is too large to be compressed.
+ * @throws std::runtime_error if an I/O error occurs or if the compression fails.
+ * @throws unspecified any exception thrown by the Boost serialisation of the archipelago's components,
+ * or by memory errors in standard containers.
+ */
+void save_checkpoint(const archipelago &archi, std::ostream &os, checkpoint_compression comp)
+{
+    detail::archi_checkpoint::save(archi, os, comp);
+}
+
+/// Save an archipelago checkpoint to file.
+/**
+ * This function is equivalent to the stream overload of save_checkpoint(), with the checkpoint
+ * written to the file \p filename (which will be overwritten if it already exists).
+ *
+ * @param archi the archipelago to be saved.
+ * @param filename the name of the output file.
+ * @param comp the compression scheme.
+ *
+ * @throws std::runtime_error if the file cannot be opened for writing.
+ * @throws unspecified any exception thrown by the stream overload of save_checkpoint().
+ */
+void save_checkpoint(const archipelago &archi, const std::string &filename, checkpoint_compression comp)
+{
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "Unable to open the file '" + filename + "' for writing a checkpoint");
+    }
+    save_checkpoint(archi, ofs, comp);
+    ofs.close();
+    if (!ofs) {
+        pagmo_throw(std::runtime_error, "An I/O error was raised while writing the checkpoint file '" + filename + "'");
+    }
+}
+
+/// Load an archipelago checkpoint.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This function will read from the stream *is* a checkpoint created by :cpp:func:`pagmo::save_checkpoint()`,
+ * and it will assign the restored archipelago to *archi*, after any ongoing evolution in *archi*
+ * has finished. The content of the stream is read until end-of-file.
+ *
+ * If an error occurs, *archi* is left unmodified.
+ *
+ * \endverbatim
+ *
+ * @param archi the destination archipelago.
+ * @param is the input stream.
+ *
+ * @throws std::invalid_argument if the content of \p is is not a valid checkpoint.
+ * @throws not_implemented_error if the checkpoint is compressed and pagmo was built
+ * without zlib support.
+ * @throws std::runtime_error if an I/O error occurs.
+ * @throws unspecified any exception thrown by the Boost deserialisation of the archipelago's components,
+ * or by memory errors in standard containers.
+ */
+void load_checkpoint(archipelago &archi, std::istream &is)
+{
+    std::vector<char> buf{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    if (is.bad()) {
+        pagmo_throw(std::runtime_error, "An I/O error was raised while reading an archipelago checkpoint");
+    }
+    detail::archi_checkpoint::load(archi, buf.data(), buf.size());
+}
+
+#if defined(PAGMO_WITH_MMAP)
+
+namespace detail
+{
+
+namespace
+{
+
+// RAII wrappers for a file descriptor and a read-only memory mapping.
+struct ckp_fd {
+    ~ckp_fd()
+    {
+        if (fd != -1) {
+            ::close(fd);
+        }
+    }
+    int fd;
+};
+
+struct ckp_mapping {
+    ~ckp_mapping()
+    {
+        if (addr != MAP_FAILED) {
+            ::munmap(addr, size);
+        }
+    }
+    void *addr;
+    std::size_t size;
+};
+
+} // namespace
+
+} // namespace detail
+
+#endif
+
+/// Load an archipelago checkpoint from file.
+/**
+ * This function is equivalent to the stream overload of load_checkpoint(), with the checkpoint
+ * read from the file \p filename. On POSIX platforms, the file is memory-mapped, so that
+ * the (uncompressed) columns of the populations are copied directly from the page cache
+ * into the restored individuals.
+ *
+ * @param archi the destination archipelago.
+ * @param filename the name of the input file.
+ *
+ * @throws std::runtime_error if the file cannot be opened or read.
+ * @throws unspecified any exception thrown by the stream overload of load_checkpoint().
+ */
+void load_checkpoint(archipelago &archi, const std::string &filename)
+{
+#if defined(PAGMO_WITH_MMAP)
+    detail::ckp_fd fd{::open(filename.c_str(), O_RDONLY)};
+    if (fd.fd == -1) {
+        pagmo_throw(std::runtime_error, "Unable to open the file '" + filename + "' for reading a checkpoint");
+    }
+    struct ::stat st;
+    if (::fstat(fd.fd, &st) == -1 || st.st_size < 0) {
+        pagmo_throw(std::runtime_error, "Unable to determine the size of the checkpoint file '" + filename + "'");
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    if (!size) {
+        // NOTE: empty files cannot be mapped.
+        detail::archi_checkpoint::load(archi, nullptr, 0);
+        return;
+    }
+    detail::ckp_mapping m{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.fd, 0), size};
+    if (m.addr == MAP_FAILED) {
+        pagmo_throw(std::runtime_error, "Unable to memory-map the checkpoint file '" + filename + "'");
+    }
+    detail::archi_checkpoint::load(archi, static_cast<const char *>(m.addr), size);
+#else
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs) {
+        pagmo_throw(std::runtime_error, "Unable to open the file '" + filename + "' for reading a checkpoint");
+    }
+    load_checkpoint(archi, ifs);
+#endif
+}
+
+} // namespace pagmo
@@ -30,9 +30,6 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <string>
 
-#include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
-
 #include <pagmo/detail/bfe_impl.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
@@ -61,16 +58,16 @@ void bfe_check_input_dvs(const problem &p, const vector_double &dvs)
                                                + ", is not an exact multiple of the dimension of the problem, "
                                                + std::to_string(n_dim));
     }
-    // Check all the decision vectors, using the same function employed
+    // Check the decision vectors, using the same function employed
     // in pagmo::problem for dv checking.
-    using range_t = tbb::blocked_range<decltype(dvs.size())>;
-    tbb::parallel_for(range_t(0, n_dvs), [&p, &dvs, n_dim](const range_t &range) {
-        for (auto i = range.begin(); i != range.end(); ++i) {
-            // NOTE: prob_check_dv only fetches cached data from p,
-            // and it is thus thread-safe.
-            prob_check_dv(p, dvs.data() + i * n_dim, n_dim);
-        }
-    });
+    // NOTE: prob_check_dv() checks only the size of a decision vector, and all
+    // the decision vectors in dvs have the same size. Hence, checking the
+    // first one is enough, and we avoid a (parallel) loop over the whole batch.
+    // If prob_check_dv() ever starts checking the values of the decision vector,
+    // this must be turned back into a loop.
+    if (n_dvs) {
+        prob_check_dv(p, dvs.data(), n_dim);
+    }
 }
 
 // Check the fitness vectors fvs produced by a bfe for problem p with input
@@ -102,16 +99,13 @@ void bfe_check_output_fvs(const problem &p, const vector_double &dvs, const vect
                 + std::to_string(n_fvs) + ", differs from the number of input decision vectors, "
                 + std::to_string(n_dvs));
     }
-    // Check all the fitness vectors, using the same function employed
+    // Check the fitness vectors, using the same function employed
     // in pagmo::problem for fv checking.
-    using range_t = tbb::blocked_range<decltype(fvs.size())>;
-    tbb::parallel_for(range_t(0, n_fvs), [&p, &fvs, f_dim](const range_t &range) {
-        for (auto i = range.begin(); i != range.end(); ++i) {
-            // NOTE: prob_check_fv only fetches cached data from p,
-            // and it is thus thread-safe.
-            prob_check_fv(p, fvs.data() + i * f_dim, f_dim);
-        }
-    });
+    // NOTE: as in bfe_check_input_dvs(), checking the first
+    // fitness vector is enough.
+    if (n_fvs) {
+        prob_check_fv(p, fvs.data(), f_dim);
+    }
 }
 
 } // namespace detail
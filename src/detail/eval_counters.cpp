@@ -0,0 +1,191 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+
+#include <pagmo/detail/eval_counters.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// The number of shards: the hardware concurrency, capped to max_shards.
+unsigned eval_counters_n_shards() noexcept
+{
+    static const unsigned n = std::max(1u, std::min(eval_counters::max_shards, std::thread::hardware_concurrency()));
+    return n;
+}
+
+// Counter used to assign the shards to the threads.
+std::atomic<unsigned> eval_counters_thread_counter{0};
+
+// The shard index of the calling thread.
+unsigned eval_counters_shard_idx() noexcept
+{
+    static thread_local const unsigned idx
+        = eval_counters_thread_counter.fetch_add(1u, std::memory_order_relaxed) % eval_counters_n_shards();
+    return idx;
+}
+
+} // namespace
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+constexpr unsigned eval_counters::max_shards;
+constexpr unsigned eval_counters::shard_size;
+
+#endif
+
+struct eval_counters::shard {
+    std::atomic<unsigned long long> c[3];
+    char pad[shard_size - 3u * sizeof(std::atomic<unsigned long long>)];
+};
+
+struct eval_counters::shard_block {
+    shard_block()
+        // NOTE: allocate an extra shard in order to be able to align
+        // the shards to shard_size.
+        : m_storage(new unsigned char[(eval_counters_n_shards() + 1u) * shard_size])
+    {
+        static_assert(sizeof(shard) == shard_size, "Invalid shard size.");
+
+        const auto n = eval_counters_n_shards();
+        void *ptr = m_storage.get();
+        std::size_t space = (n + 1u) * shard_size;
+        ptr = std::align(shard_size, n * shard_size, ptr, space);
+        assert(ptr != nullptr);
+        m_shards = static_cast<shard *>(ptr);
+        for (unsigned i = 0; i < n; ++i) {
+            // NOTE: value-initialisation zeroes out the counters.
+            ::new (static_cast<void *>(m_shards + i)) shard();
+        }
+    }
+
+    // NOTE: the shards are trivially destructible.
+    std::unique_ptr<unsigned char[]> m_storage;
+    shard *m_shards;
+};
+
+eval_counters::eval_counters() noexcept : m_base{{0u}, {0u}, {0u}}, m_block(nullptr) {}
+
+eval_counters::eval_counters(const eval_counters &other) noexcept
+    : m_base{{other.load(fevals)}, {other.load(gevals)}, {other.load(hevals)}}, m_block(nullptr)
+{
+}
+
+eval_counters::eval_counters(eval_counters &&other) noexcept
+    : m_base{{other.m_base[fevals].load(std::memory_order_relaxed)},
+             {other.m_base[gevals].load(std::memory_order_relaxed)},
+             {other.m_base[hevals].load(std::memory_order_relaxed)}},
+      m_block(other.m_block.exchange(nullptr, std::memory_order_acq_rel))
+{
+}
+
+eval_counters &eval_counters::operator=(eval_counters &&other) noexcept
+{
+    if (this != &other) {
+        for (auto t : {fevals, gevals, hevals}) {
+            m_base[t].store(other.m_base[t].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        delete m_block.exchange(other.m_block.exchange(nullptr, std::memory_order_acq_rel),
+                                std::memory_order_acq_rel);
+    }
+    return *this;
+}
+
+eval_counters::~eval_counters()
+{
+    delete m_block.load(std::memory_order_relaxed);
+}
+
+// Fetch the shards, allocating them if needed.
+eval_counters::shard_block *eval_counters::get_block() const
+{
+    auto retval = m_block.load(std::memory_order_acquire);
+    if (retval) {
+        return retval;
+    }
+
+    std::unique_ptr<shard_block> new_block(new shard_block);
+    if (m_block.compare_exchange_strong(retval, new_block.get(), std::memory_order_acq_rel)) {
+        return new_block.release();
+    }
+    // NOTE: another thread allocated the shards in the meantime,
+    // retval now points to them.
+    return retval;
+}
+
+void eval_counters::increment(counter_type t, unsigned long long n) const
+{
+    if (eval_counters_n_shards() == 1u) {
+        m_base[t].fetch_add(n, std::memory_order_relaxed);
+    } else {
+        get_block()->m_shards[eval_counters_shard_idx()].c[t].fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+unsigned long long eval_counters::load(counter_type t) const noexcept
+{
+    auto retval = m_base[t].load(std::memory_order_relaxed);
+    if (const auto block = m_block.load(std::memory_order_acquire)) {
+        for (unsigned i = 0; i < eval_counters_n_shards(); ++i) {
+            retval += block->m_shards[i].c[t].load(std::memory_order_relaxed);
+        }
+    }
+    return retval;
+}
+
+// NOTE: this is not atomic with respect to concurrent increments.
+void eval_counters::store(unsigned long long fe, unsigned long long ge, unsigned long long he) noexcept
+{
+    if (const auto block = m_block.load(std::memory_order_acquire)) {
+        for (unsigned i = 0; i < eval_counters_n_shards(); ++i) {
+            for (auto &c : block->m_shards[i].c) {
+                c.store(0u, std::memory_order_relaxed);
+            }
+        }
+    }
+    m_base[fevals].store(fe, std::memory_order_relaxed);
+    m_base[gevals].store(ge, std::memory_order_relaxed);
+    m_base[hevals].store(he, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+} // namespace pagmo
@@ -0,0 +1,545 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pagmo/detail/make_unique.hpp>
+#include <pagmo/eval_tracing.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/stats.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// The currently installed tracer.
+std::atomic<eval_tracer *> current_eval_tracer{nullptr};
+
+// Counter used to assign thread slots.
+std::atomic<unsigned> eval_trace_thread_counter{0};
+
+const char *eval_type_name(eval_type t)
+{
+    switch (t) {
+        case eval_type::fitness:
+            return "fitness";
+        case eval_type::batch_fitness:
+            return "batch_fitness";
+        case eval_type::gradient:
+            return "gradient";
+        default:
+            return "hessians";
+    }
+}
+
+// Lock-free min/max updates.
+void atomic_store_min(std::atomic<unsigned long long> &a, unsigned long long x)
+{
+    auto cur = a.load(std::memory_order_relaxed);
+    while (x < cur && !a.compare_exchange_weak(cur, x, std::memory_order_relaxed)) {
+    }
+}
+
+void atomic_store_max(std::atomic<unsigned long long> &a, unsigned long long x)
+{
+    auto cur = a.load(std::memory_order_relaxed);
+    while (x > cur && !a.compare_exchange_weak(cur, x, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+} // namespace detail
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for eval_type.
+std::ostream &operator<<(std::ostream &os, eval_type t)
+{
+    return os << detail::eval_type_name(t);
+}
+
+#endif
+
+eval_tracer::~eval_tracer() {}
+
+/// Install an evaluation tracer.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * The tracer is not owned by pagmo: the caller must ensure that it outlives all the evaluations
+ * which might invoke it, that is, it must not be destroyed before it has been uninstalled (by passing
+ * ``nullptr`` to this function) and all the evaluations in flight have completed.
+ *
+ * If pagmo was built without the ``PAGMO_WITH_EVAL_TRACING`` option, the tracer will be stored but
+ * never invoked.
+ *
+ * \endverbatim
+ *
+ * @param t a pointer to the tracer that will be installed, or \p nullptr to disable tracing.
+ *
+ * @return a pointer to the previously-installed tracer.
+ */
+eval_tracer *set_eval_tracer(eval_tracer *t) noexcept
+{
+    return detail::current_eval_tracer.exchange(t, std::memory_order_acq_rel);
+}
+
+/// Get the installed evaluation tracer.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ * \endverbatim
+ *
+ * @return a pointer to the currently-installed tracer, or \p nullptr if no tracer is installed.
+ */
+eval_tracer *get_eval_tracer() noexcept
+{
+    return detail::current_eval_tracer.load(std::memory_order_acquire);
+}
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+constexpr unsigned eval_trace_collector::n_thread_slots;
+constexpr unsigned eval_trace_collector::n_eval_types;
+
+#endif
+
+// NOTE: the impl struct has no user-provided constructors, so that
+// value-initialisation zeroes out all the atomic counters.
+struct eval_trace_collector::impl {
+    // Lock-free latency histogram.
+    struct latency_hist {
+        std::array<std::atomic<unsigned long long>, stats_histogram::n_buckets> buckets;
+        std::atomic<unsigned long long> sum;
+        std::atomic<unsigned long long> min;
+        std::atomic<unsigned long long> max;
+    };
+    // Per-thread counters.
+    struct thread_slot {
+        std::array<std::atomic<unsigned long long>, n_eval_types> counts;
+        std::array<std::atomic<unsigned long long>, n_eval_types> times;
+        // NOTE: padding to avoid false sharing between the counters
+        // of different threads.
+        char pad[64];
+    };
+    // A slot in the ring buffer of samples.
+    struct sample_slot {
+        // NOTE: this flag is used as a try-lock by the writers, which
+        // drop the sample if the slot is busy.
+        std::atomic<bool> busy;
+        bool valid;
+        sample s;
+    };
+
+    std::array<latency_hist, n_eval_types> hists;
+    std::array<thread_slot, n_thread_slots> threads;
+    std::unique_ptr<sample_slot[]> samples;
+    std::size_t sample_capacity;
+    unsigned long long sample_interval;
+    std::atomic<unsigned long long> n_evals;
+    std::atomic<unsigned long long> n_dropped;
+};
+
+/// Constructor.
+/**
+ * @param sample_capacity the capacity of the ring buffer of samples. If zero, no sample
+ * will be taken.
+ * @param sample_interval the sampling interval: a sample is taken every \p sample_interval evaluations.
+ *
+ * @throws std::invalid_argument if \p sample_interval is zero.
+ * @throws unspecified any exception thrown by memory allocation errors.
+ */
+eval_trace_collector::eval_trace_collector(std::size_t sample_capacity, unsigned long long sample_interval)
+{
+    if (!sample_interval) {
+        pagmo_throw(std::invalid_argument, "The sampling interval of an evaluation trace collector cannot be zero");
+    }
+
+    m_impl = detail::make_unique<impl>();
+    for (auto &h : m_impl->hists) {
+        h.min.store(std::numeric_limits<unsigned long long>::max(), std::memory_order_relaxed);
+    }
+    if (sample_capacity) {
+        m_impl->samples.reset(new impl::sample_slot[sample_capacity]());
+    }
+    m_impl->sample_capacity = sample_capacity;
+    m_impl->sample_interval = sample_interval;
+}
+
+/// Destructor.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    The collector must be uninstalled (see :cpp:func:`pagmo::set_eval_tracer()`) before its destruction.
+ *
+ * \endverbatim
+ */
+eval_trace_collector::~eval_trace_collector() {}
+
+/// The recording function.
+/**
+ * This function is invoked by pagmo::problem after each evaluation, if the collector is installed.
+ * It never locks and never throws: if a sample cannot be recorded (because the slot in the ring
+ * buffer is being written by another thread, or because of memory allocation errors), it is dropped.
+ *
+ * @param t the type of evaluation.
+ * @param ns the latency of the evaluation in nanoseconds.
+ * @param dv a pointer to the input decision vector(s).
+ * @param dv_size the size of the input decision vector(s).
+ * @param out a pointer to the output of the evaluation (may be null).
+ * @param out_size the size of the output.
+ */
+void eval_trace_collector::record(eval_type t, unsigned long long ns, const double *dv, std::size_t dv_size,
+                                  const double *out, std::size_t out_size) noexcept
+{
+    const auto ti = static_cast<unsigned>(t);
+    assert(ti < n_eval_types);
+
+    // Latency histogram.
+    auto &h = m_impl->hists[ti];
+    h.buckets[stats_histogram::bucket_index(ns)].fetch_add(1u, std::memory_order_relaxed);
+    h.sum.fetch_add(ns, std::memory_order_relaxed);
+    detail::atomic_store_min(h.min, ns);
+    detail::atomic_store_max(h.max, ns);
+
+    // Per-thread counters.
+    const auto slot_idx = thread_slot();
+    auto &ts = m_impl->threads[slot_idx];
+    ts.counts[ti].fetch_add(1u, std::memory_order_relaxed);
+    ts.times[ti].fetch_add(ns, std::memory_order_relaxed);
+
+    // Sampling.
+    if (!m_impl->sample_capacity) {
+        return;
+    }
+    const auto n = m_impl->n_evals.fetch_add(1u, std::memory_order_relaxed);
+    if (n % m_impl->sample_interval) {
+        return;
+    }
+    auto &slot = m_impl->samples[static_cast<std::size_t>((n / m_impl->sample_interval) % m_impl->sample_capacity)];
+    if (slot.busy.exchange(true, std::memory_order_acquire)) {
+        m_impl->n_dropped.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+    try {
+        // NOTE: after the first round in the ring buffer, the vectors
+        // will usually have enough capacity already, and no allocation will take place.
+        slot.s.dv.assign(dv, dv + dv_size);
+        if (out) {
+            slot.s.out.assign(out, out + out_size);
+        } else {
+            slot.s.out.clear();
+        }
+        slot.s.seq = n;
+        slot.s.type = t;
+        slot.s.thread = slot_idx;
+        slot.s.ns = ns;
+        slot.valid = true;
+        // LCOV_EXCL_START
+    } catch (...) {
+        slot.valid = false;
+        m_impl->n_dropped.fetch_add(1u, std::memory_order_relaxed);
+    }
+    // LCOV_EXCL_STOP
+    slot.busy.store(false, std::memory_order_release);
+}
+
+/// Get the latency histogram.
+/**
+ * The histogram is a snapshot of the lock-free counters. If evaluations are being recorded
+ * concurrently, the snapshot might be slightly inconsistent (e.g., the sum might not include a
+ * sample which is already counted in the buckets).
+ *
+ * @param t the type of evaluation.
+ *
+ * @return a histogram of the latencies (in nanoseconds) of the evaluations of type \p t.
+ *
+ * @throws unspecified any exception thrown by the constructor of pagmo::stats_histogram.
+ */
+stats_histogram eval_trace_collector::get_latency(eval_type t) const
+{
+    const auto &h = m_impl->hists[static_cast<unsigned>(t)];
+
+    stats_histogram::buckets_t buckets;
+    for (unsigned i = 0; i < stats_histogram::n_buckets; ++i) {
+        buckets[i] = h.buckets[i].load(std::memory_order_relaxed);
+    }
+
+    // NOTE: with concurrent writers, min/max might not have been updated yet
+    // for samples already in the buckets. Clamp them to the buckets' ranges.
+    unsigned first = stats_histogram::n_buckets, last = 0;
+    for (unsigned i = 0; i < stats_histogram::n_buckets; ++i) {
+        if (buckets[i]) {
+            first = std::min(first, i);
+            last = i;
+        }
+    }
+    if (first == stats_histogram::n_buckets) {
+        return stats_histogram{};
+    }
+    const auto fb = stats_histogram::bucket_bounds(first), lb = stats_histogram::bucket_bounds(last);
+    const auto min = std::max(fb.first, std::min(fb.second, h.min.load(std::memory_order_relaxed)));
+    const auto max = std::max(lb.first, std::min(lb.second, h.max.load(std::memory_order_relaxed)));
+
+    return stats_histogram(buckets, h.sum.load(std::memory_order_relaxed), min, max);
+}
+
+/// Get the per-thread evaluation counts.
+/**
+ * @return a vector of size pagmo::eval_trace_collector::n_thread_slots containing, for each
+ * thread slot, the number of evaluations of each type.
+ *
+ * @throws unspecified any exception thrown by memory allocation errors.
+ */
+std::vector<eval_trace_collector::thread_counters_t> eval_trace_collector::get_thread_counts() const
+{
+    std::vector<thread_counters_t> retval(n_thread_slots);
+    for (unsigned i = 0; i < n_thread_slots; ++i) {
+        for (unsigned j = 0; j < n_eval_types; ++j) {
+            retval[i][j] = m_impl->threads[i].counts[j].load(std::memory_order_relaxed);
+        }
+    }
+    return retval;
+}
+
+/// Get the per-thread evaluation times.
+/**
+ * @return a vector of size pagmo::eval_trace_collector::n_thread_slots containing, for each
+ * thread slot, the total time (in nanoseconds) spent in evaluations of each type.
+ *
+ * @throws unspecified any exception thrown by memory allocation errors.
+ */
+std::vector<eval_trace_collector::thread_counters_t> eval_trace_collector::get_thread_times() const
+{
+    std::vector<thread_counters_t> retval(n_thread_slots);
+    for (unsigned i = 0; i < n_thread_slots; ++i) {
+        for (unsigned j = 0; j < n_eval_types; ++j) {
+            retval[i][j] = m_impl->threads[i].times[j].load(std::memory_order_relaxed);
+        }
+    }
+    return retval;
+}
+
+/// Get the samples.
+/**
+ * This function waits for the writers of the ring buffer slots it is reading (if any),
+ * and it should not be called from the hot path.
+ *
+ * @return the samples currently stored in the ring buffer, sorted by sequence number.
+ *
+ * @throws unspecified any exception thrown by memory allocation errors.
+ */
+std::vector<eval_trace_collector::sample> eval_trace_collector::get_samples() const
+{
+    std::vector<sample> retval;
+    for (std::size_t i = 0; i < m_impl->sample_capacity; ++i) {
+        auto &slot = m_impl->samples[i];
+        while (slot.busy.exchange(true, std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        try {
+            if (slot.valid) {
+                retval.push_back(slot.s);
+            }
+            // LCOV_EXCL_START
+        } catch (...) {
+            slot.busy.store(false, std::memory_order_release);
+            throw;
+        }
+        // LCOV_EXCL_STOP
+        slot.busy.store(false, std::memory_order_release);
+    }
+    std::sort(retval.begin(), retval.end(), [](const sample &a, const sample &b) { return a.seq < b.seq; });
+    return retval;
+}
+
+/// Get the number of dropped samples.
+/**
+ * @return the number of samples which were not recorded because of contention or memory allocation errors.
+ */
+unsigned long long eval_trace_collector::get_n_dropped_samples() const
+{
+    return m_impl->n_dropped.load(std::memory_order_relaxed);
+}
+
+/// Get the sample capacity.
+/**
+ * @return the capacity of the ring buffer of samples.
+ */
+std::size_t eval_trace_collector::get_sample_capacity() const
+{
+    return m_impl->sample_capacity;
+}
+
+/// Get the sampling interval.
+/**
+ * @return the sampling interval.
+ */
+unsigned long long eval_trace_collector::get_sample_interval() const
+{
+    return m_impl->sample_interval;
+}
+
+/// Thread slot.
+/**
+ * @return the index of the per-thread slot of the calling thread.
+ */
+unsigned eval_trace_collector::thread_slot() noexcept
+{
+    static thread_local const unsigned slot
+        = detail::eval_trace_thread_counter.fetch_add(1u, std::memory_order_relaxed) % n_thread_slots;
+    return slot;
+}
+
+/// Dump the latency histograms in CSV format.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * The output contains a header line followed by one line for each non-empty bucket of the latency
+ * histograms, with the columns ``eval,bucket_min_ns,bucket_max_ns,count``.
+ *
+ * \endverbatim
+ *
+ * @param os the target stream.
+ * @param c the collector.
+ *
+ * @throws unspecified any exception thrown by the stream operators of fundamental types or by
+ * pagmo::eval_trace_collector::get_latency().
+ */
+void dump_eval_trace_csv(std::ostream &os, const eval_trace_collector &c)
+{
+    os << "eval,bucket_min_ns,bucket_max_ns,count\n";
+    for (unsigned j = 0; j < eval_trace_collector::n_eval_types; ++j) {
+        const auto t = static_cast<eval_type>(j);
+        const auto h = c.get_latency(t);
+        for (unsigned i = 0; i < stats_histogram::n_buckets; ++i) {
+            if (h.get_buckets()[i]) {
+                const auto b = stats_histogram::bucket_bounds(i);
+                os << t << ',' << b.first << ',' << b.second << ',' << h.get_buckets()[i] << '\n';
+            }
+        }
+    }
+}
+
+/// Dump the samples in CSV format.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * The output contains a header line followed by one line for each sample, with the columns
+ * ``seq,eval,thread,ns,dv,out``. The ``dv`` and ``out`` columns contain the components of the
+ * vectors separated by spaces.
+ *
+ * \endverbatim
+ *
+ * @param os the target stream.
+ * @param c the collector.
+ *
+ * @throws unspecified any exception thrown by the stream operators of fundamental types or by
+ * pagmo::eval_trace_collector::get_samples().
+ */
+void dump_eval_trace_samples_csv(std::ostream &os, const eval_trace_collector &c)
+{
+    auto print_vector = [&os](const vector_double &v) {
+        for (decltype(v.size()) i = 0; i < v.size(); ++i) {
+            if (i) {
+                os << ' ';
+            }
+            os << v[i];
+        }
+    };
+
+    const auto old_prec = os.precision(std::numeric_limits<double>::max_digits10);
+    os << "seq,eval,thread,ns,dv,out\n";
+    for (const auto &s : c.get_samples()) {
+        os << s.seq << ',' << s.type << ',' << s.thread << ',' << s.ns << ',';
+        print_vector(s.dv);
+        os << ',';
+        print_vector(s.out);
+        os << '\n';
+    }
+    os.precision(old_prec);
+}
+
+/// Dump the per-thread times in folded stack format.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * The output contains one line ``pagmo;thread_<slot>;<eval> <ns>`` for each thread slot and
+ * evaluation type with a nonzero total time, where ``<ns>`` is the total time in nanoseconds. This is the
+ * format accepted by flame graph tools such as ``flamegraph.pl``.
+ *
+ * \endverbatim
+ *
+ * @param os the target stream.
+ * @param c the collector.
+ *
+ * @throws unspecified any exception thrown by the stream operators of fundamental types or by
+ * pagmo::eval_trace_collector::get_thread_times().
+ */
+void dump_eval_trace_folded(std::ostream &os, const eval_trace_collector &c)
+{
+    const auto times = c.get_thread_times();
+    for (decltype(times.size()) i = 0; i < times.size(); ++i) {
+        for (unsigned j = 0; j < eval_trace_collector::n_eval_types; ++j) {
+            if (times[i][j]) {
+                os << "pagmo;thread_" << i << ';' << static_cast<eval_type>(j) << ' ' << times[i][j] << '\n';
+            }
+        }
+    }
+}
+
+} // namespace pagmo
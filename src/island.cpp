@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <pagmo/config.hpp>
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
@@ -43,6 +44,7 @@ see https://www.gnu.org/licenses/. */
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -61,7 +63,9 @@ see https://www.gnu.org/licenses/. */
 #include <pagmo/r_policy.hpp>
 #include <pagmo/rng.hpp>
 #include <pagmo/s_policy.hpp>
+#include <pagmo/stats.hpp>
 #include <pagmo/threading.hpp>
+#include <pagmo/topology.hpp>
 #include <pagmo/types.hpp>
 
 #if defined(PAGMO_WITH_FORK_ISLAND)
@@ -132,6 +136,36 @@ bool future_running(const std::future<void> &f)
     return f.wait_for(std::chrono::duration<int>::zero()) != std::future_status::ready;
 }
 
+namespace
+{
+
+// A stopwatch used in the instrumentation of the island.
+// If the instrumentation is disabled, the clock is never queried.
+class stats_stopwatch
+{
+public:
+    explicit stats_stopwatch(bool on)
+        : m_on(on), m_start(on ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{})
+    {
+    }
+    explicit operator bool() const
+    {
+        return m_on;
+    }
+    // Elapsed time in nanoseconds.
+    unsigned long long elapsed() const
+    {
+        return static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+    }
+
+private:
+    bool m_on;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace
+
 } // namespace detail
 
 namespace detail
@@ -151,6 +185,22 @@ boost::any default_wait_raii_getter()
 // will have no effect.
 std::function<boost::any()> wait_raii_getter = &default_wait_raii_getter;
 
+boost::any island_gte(const population &pop)
+{
+    if (pop.get_problem().get_thread_safety() >= thread_safety::basic) {
+        return boost::any{};
+    }
+    return gte_getter();
+}
+
+boost::any island_gte(const algorithm &algo, const population &pop)
+{
+    if (algo.get_thread_safety() >= thread_safety::basic) {
+        return island_gte(pop);
+    }
+    return gte_getter();
+}
+
 namespace
 {
 
@@ -228,6 +278,94 @@ std::ostream &operator<<(std::ostream &os, evolve_status es)
 
 #endif
 
+/// Default constructor.
+/**
+ * The default constructor initialises an empty summary, with no champion and all counters set to zero.
+ */
+island_summary::island_summary() : m_fevals(0), m_evolutions(0), m_pop_size(0), m_nobj(1), m_stochastic(false) {}
+
+// Check that the champion is available.
+void island_summary::check_champion() const
+{
+    // NOTE: same checks as in population::champion_x/f().
+    if (m_nobj > 1u) {
+        pagmo_throw(std::invalid_argument,
+                    "The Champion of a population can only be extracted in single objective problems");
+    }
+    if (m_stochastic) {
+        pagmo_throw(std::invalid_argument,
+                    "The Champion of a population can only be extracted for non stochastic problems");
+    }
+}
+
+/// Get the champion's decision vector.
+/**
+ * @return the decision vector of the champion of the population.
+ *
+ * @throws std::invalid_argument if the population's problem is multi-objective or stochastic.
+ */
+vector_double island_summary::get_champion_x() const
+{
+    check_champion();
+    return m_champion_x;
+}
+
+/// Get the champion's fitness vector.
+/**
+ * @return the fitness vector of the champion of the population.
+ *
+ * @throws std::invalid_argument if the population's problem is multi-objective or stochastic.
+ */
+vector_double island_summary::get_champion_f() const
+{
+    check_champion();
+    return m_champion_f;
+}
+
+/// Get the number of fitness evaluations.
+/**
+ * @return the number of fitness evaluations of the population's problem.
+ */
+unsigned long long island_summary::get_fevals() const
+{
+    return m_fevals;
+}
+
+/// Get the number of evolutions.
+/**
+ * @return the number of evolutions completed by the island before the publication of the summary.
+ */
+unsigned long long island_summary::get_evolutions() const
+{
+    return m_evolutions;
+}
+
+/// Get the population size.
+/**
+ * @return the size of the population.
+ */
+population::size_type island_summary::get_population_size() const
+{
+    return m_pop_size;
+}
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+// Stream operator for island_summary.
+std::ostream &operator<<(std::ostream &os, const island_summary &s)
+{
+    stream(os, "Population size:\t", s.get_population_size(), '\n');
+    stream(os, "Fitness evaluations:\t", s.get_fevals(), '\n');
+    stream(os, "Evolutions:\t\t", s.get_evolutions(), '\n');
+    if (s.m_nobj == 1u && !s.m_stochastic && s.get_population_size()) {
+        stream(os, "Champion decision vector:\t", s.m_champion_x, '\n');
+        stream(os, "Champion fitness:\t", s.m_champion_f, '\n');
+    }
+    return os;
+}
+
+#endif
+
 // NOTE: the idea in the move members and the dtor is that
 // we want to wait *and* erase any future in the island, before doing
 // the move/destruction. Thus we use this small wrapper.
@@ -268,6 +406,8 @@ island::island(const island &other)
 {
     // NOTE: the idata_t ctor will set the archi ptr to null. The archi ptr is never copied.
     assert(m_ptr->archi_ptr == nullptr);
+    // NOTE: the instrumentation flag is copied, the instrumentation data is not.
+    m_ptr->stats_enabled.store(other.get_stats_enabled(), std::memory_order_relaxed);
 }
 
 /// Move constructor.
@@ -342,10 +482,17 @@ void island::evolve(unsigned n)
     // in flight which we cannot wait upon.
     m_ptr->futures.emplace_back();
     try {
+        // Start measuring the time spent in the task queue, if needed.
+        const detail::stats_stopwatch queue_sw(get_stats_enabled());
+
         // Move assign a new future provided by the enqueue() method.
         // NOTE: enqueue either returns a valid future, or throws without
         // having enqueued any task.
-        m_ptr->futures.back() = m_ptr->queue.enqueue([this, n]() {
+        m_ptr->futures.back() = m_ptr->queue.enqueue([this, n, queue_sw]() {
+            if (queue_sw) {
+                this->record_stat(&island_stats::m_queue_wait, queue_sw.elapsed());
+            }
+
             // Random engine for use in the migration logic.
             // Wrap it in an optional so that, if we don't need
             // it, we don't waste CPU/memory.
@@ -358,7 +505,16 @@ void island::evolve(unsigned n)
             // in an archi. Otherwise, this variable will be unused.
             const auto isl_idx = aptr ? aptr->get_island_idx(*this) : 0u;
 
+            // The connections towards this island, and the CSR snapshot
+            // of the topology they were extracted from (if available). The connections
+            // are re-extracted only when the topology hands out a new snapshot.
+            std::shared_ptr<const topology_csr> topo_csr;
+            std::pair<std::vector<archipelago::size_type>, vector_double> connections;
+
             for (auto i = 0u; i < n; ++i) {
+                // Check if the instrumentation is enabled for this generation.
+                const auto stats_on = this->get_stats_enabled();
+
                 if (aptr) {
                     // If the island is in an archi, before
                     // launching the evolution migrate the
@@ -368,7 +524,7 @@ void island::evolve(unsigned n)
                     // towards this.
                     // NOTE: the get_island_connections() helper will take care
                     // of converting topology indices to island indices.
-                    const auto connections = aptr->get_island_connections(isl_idx);
+                    aptr->get_island_connections(isl_idx, topo_csr, connections);
                     assert(connections.first.size() == connections.second.size());
 
                     // Do something only if we actually have connections.
@@ -378,8 +534,9 @@ void island::evolve(unsigned n)
                             migr_eng.emplace(static_cast<std::mt19937::result_type>(random_device::next()));
                         }
 
-                        // Fetch the migration type and the migrant handling policy
-                        // from the archipelago.
+                        // Fetch the migration scheduler, the migration type and the migrant handling
+                        // policy from the archipelago.
+                        const auto sched = aptr->get_migration_scheduler_ptr();
                         const auto mt = aptr->get_migration_type();
                         const auto mh = aptr->get_migrant_handling();
 
@@ -399,7 +556,78 @@ void island::evolve(unsigned n)
                             return retval;
                         };
 
-                        if (mt == migration_type::p2p) {
+                        // Helper to run the replacement policy on the migrants coming from the
+                        // islands in split_migrants, which pairs source island indices to groups
+                        // of candidate migrants, and to log the migration.
+                        auto replace_migrants
+                            = [this, aptr, isl_idx, stats_on, &group_to_map](
+                                  const std::vector<std::pair<archipelago::size_type, individuals_group_t>>
+                                      &split_migrants) {
+                                  // Group of candidate migrants from the all
+                                  // the islands in split_migrants.
+                                  individuals_group_t migrants;
+                                  for (const auto &p : split_migrants) {
+                                      std::get<0>(migrants).insert(std::get<0>(migrants).end(),
+                                                                   std::get<0>(p.second).begin(),
+                                                                   std::get<0>(p.second).end());
+                                      std::get<1>(migrants).insert(std::get<1>(migrants).end(),
+                                                                   std::get<1>(p.second).begin(),
+                                                                   std::get<1>(p.second).end());
+                                      std::get<2>(migrants).insert(std::get<2>(migrants).end(),
+                                                                   std::get<2>(p.second).begin(),
+                                                                   std::get<2>(p.second).end());
+                                  }
+
+                                  const detail::stats_stopwatch replace_sw(stats_on);
+
+                                  // Run the replacement policy.
+                                  auto new_inds = this->replace_with_migrants(migrants);
+
+                                  if (replace_sw) {
+                                      this->record_stat(&island_stats::m_migr_replace, replace_sw.elapsed());
+                                  }
+
+                                  // Compute the migration timestamp.
+                                  const std::chrono::duration<double> mig_ts
+                                      = std::chrono::steady_clock::now() - detail::initial_timestamp;
+
+                                  // Turn the inserted migrants into an ID -> (dv, fv) map in order to build the log.
+                                  const auto new_inds_map = group_to_map(std::move(new_inds));
+
+                                  // Build the migration log.
+                                  archipelago::migration_log_t mlog;
+                                  for (const auto &p : split_migrants) {
+                                      const auto src_idx = p.first;
+
+                                      for (auto mig_ID : std::get<0>(p.second)) {
+                                          const auto it = new_inds_map.find(mig_ID);
+
+                                          if (it != new_inds_map.end()) {
+                                              mlog.emplace_back(mig_ts.count(), mig_ID, it->second.first,
+                                                                it->second.second, src_idx, isl_idx);
+                                          }
+                                      }
+                                  }
+
+                                  // Append it.
+                                  aptr->append_migration_log(mlog);
+                              };
+
+                        if (sched) {
+                            // Scheduled migration: fetch the fresh migrants
+                            // from the mailboxes of the connecting islands.
+                            const detail::stats_stopwatch pull_sw(stats_on);
+                            const auto split_migrants
+                                = aptr->pull_migrants(isl_idx, *sched, connections, *migr_eng);
+                            if (pull_sw) {
+                                this->record_stat(&island_stats::m_migr_pull, pull_sw.elapsed());
+                            }
+
+                            // Run the replacement only if there's something new.
+                            if (!split_migrants.empty()) {
+                                replace_migrants(split_migrants);
+                            }
+                        } else if (mt == migration_type::p2p) {
                             // Point-to-point migration.
 
                             // Pick a random island among the islands connecting to this.
@@ -412,27 +640,28 @@ void island::evolve(unsigned n)
                                 const auto src_idx = connections.first[conn_idx];
 
                                 // Extract or copy the candidate migrants from the archipelago.
+                                const detail::stats_stopwatch pull_sw(stats_on);
                                 const auto migrants = (mh == migrant_handling::preserve)
                                                           ? aptr->get_migrants(src_idx)
                                                           : aptr->extract_migrants(src_idx);
+                                if (pull_sw) {
+                                    this->record_stat(&island_stats::m_migr_pull, pull_sw.elapsed());
+                                }
 
-                                // Extract the migration data from this island.
-                                const auto mig_data = this->get_migration_data();
+                                const detail::stats_stopwatch replace_sw(stats_on);
 
                                 // Run the replacement policy.
-                                auto new_inds = this->m_ptr->r_pol.replace(std::get<0>(mig_data), std::get<1>(mig_data),
-                                                                           std::get<2>(mig_data), std::get<3>(mig_data),
-                                                                           std::get<4>(mig_data), std::get<5>(mig_data),
-                                                                           std::get<6>(mig_data), migrants);
+                                auto new_inds = this->replace_with_migrants(migrants);
 
-                                // Set the new individuals.
-                                this->set_individuals(new_inds);
+                                if (replace_sw) {
+                                    this->record_stat(&island_stats::m_migr_replace, replace_sw.elapsed());
+                                }
 
                                 // Compute the migration timestamp.
                                 const std::chrono::duration<double> mig_ts
                                     = std::chrono::steady_clock::now() - detail::initial_timestamp;
 
-                                // Turn new_inds into an ID -> (dv, fv) map in order to build the log.
+                                // Turn the inserted migrants into an ID -> (dv, fv) map in order to build the log.
                                 const auto new_inds_map = group_to_map(std::move(new_inds));
 
                                 // Build the migration log.
@@ -452,17 +681,11 @@ void island::evolve(unsigned n)
                         } else {
                             // Broadcast migration.
 
-                            // Group of candidate migrants from the all
-                            // the islands connecting to this.
-                            // We will build this below iteratively.
-                            individuals_group_t migrants;
-
                             // Vector to pair source island indices to the corresponding
-                            // candidate migrants. This will contain the same set of individuals
-                            // as migrants, but split according to the source island. This is needed
-                            // to build the migration log.
+                            // candidate migrants.
                             std::vector<std::pair<archipelago::size_type, individuals_group_t>> split_migrants;
 
+                            const detail::stats_stopwatch pull_sw(stats_on);
                             for (decltype(connections.first.size()) j = 0; j < connections.first.size(); ++j) {
                                 // Throw the dice against the migration probability.
                                 if (std::uniform_real_distribution<>{}(*migr_eng) < connections.second[j]) {
@@ -474,81 +697,61 @@ void island::evolve(unsigned n)
                                                             ? aptr->get_migrants(src_idx)
                                                             : aptr->extract_migrants(src_idx);
 
-                                    // Add them to the global migrants vector.
-                                    std::get<0>(migrants).insert(std::get<0>(migrants).end(),
-                                                                 std::get<0>(cur_migrants).begin(),
-                                                                 std::get<0>(cur_migrants).end());
-                                    std::get<1>(migrants).insert(std::get<1>(migrants).end(),
-                                                                 std::get<1>(cur_migrants).begin(),
-                                                                 std::get<1>(cur_migrants).end());
-                                    std::get<2>(migrants).insert(std::get<2>(migrants).end(),
-                                                                 std::get<2>(cur_migrants).begin(),
-                                                                 std::get<2>(cur_migrants).end());
-
-                                    // Add them to split_migrants too.
                                     split_migrants.emplace_back(src_idx, std::move(cur_migrants));
                                 }
                             }
-
-                            // Extract the migration data from this island.
-                            const auto mig_data = this->get_migration_data();
-
-                            // Run the replacement policy.
-                            auto new_inds = this->m_ptr->r_pol.replace(std::get<0>(mig_data), std::get<1>(mig_data),
-                                                                       std::get<2>(mig_data), std::get<3>(mig_data),
-                                                                       std::get<4>(mig_data), std::get<5>(mig_data),
-                                                                       std::get<6>(mig_data), migrants);
-
-                            // Set the new individuals.
-                            this->set_individuals(new_inds);
-
-                            // Compute the migration timestamp.
-                            const std::chrono::duration<double> mig_ts
-                                = std::chrono::steady_clock::now() - detail::initial_timestamp;
-
-                            // Turn new_inds into an ID -> (dv, fv) map in order to build the log.
-                            const auto new_inds_map = group_to_map(std::move(new_inds));
-
-                            // Build the migration log.
-                            archipelago::migration_log_t mlog;
-                            for (const auto &p : split_migrants) {
-                                const auto src_idx = p.first;
-
-                                for (auto mig_ID : std::get<0>(p.second)) {
-                                    const auto it = new_inds_map.find(mig_ID);
-
-                                    if (it != new_inds_map.end()) {
-                                        mlog.emplace_back(mig_ts.count(), mig_ID, it->second.first, it->second.second,
-                                                          src_idx, isl_idx);
-                                    }
-                                }
+                            if (pull_sw) {
+                                this->record_stat(&island_stats::m_migr_pull, pull_sw.elapsed());
                             }
 
-                            // Append it.
-                            aptr->append_migration_log(mlog);
+                            replace_migrants(split_migrants);
                         }
                     }
                 }
 
-                // Run the evolution.
+                // Run the evolution. If the instrumentation is enabled,
+                // record the wall-clock time and the number of fitness evaluations.
+                const auto fevals_before = stats_on ? this->get_population_ptr()->get_problem().get_fevals() : 0u;
+                const detail::stats_stopwatch evolve_sw(stats_on);
                 this->m_ptr->isl_ptr->run_evolve(*this);
+                this->m_ptr->n_evolutions.fetch_add(1u, std::memory_order_relaxed);
+                this->publish_summary();
+                if (evolve_sw) {
+                    const auto evolve_time = evolve_sw.elapsed();
+                    const auto fevals_after = this->get_population_ptr()->get_problem().get_fevals();
+
+                    std::lock_guard<std::mutex> lock(this->m_ptr->stats_mutex);
+                    this->m_ptr->stats.m_evolve.add(evolve_time);
+                    // NOTE: the population might have been replaced by a population
+                    // with fewer evaluations in the meantime (e.g., via set_population()).
+                    if (fevals_after >= fevals_before) {
+                        this->m_ptr->stats.m_fevals += fevals_after - fevals_before;
+                    }
+                }
 
                 if (aptr) {
                     // If the island is in an archi, after evolution select
                     // the migrating individuals and place them in the archi's migrants
                     // database.
-
-                    // Extract the migration data from this island.
-                    const auto mig_data = this->get_migration_data();
+                    const detail::stats_stopwatch select_sw(stats_on);
 
                     // Select the individuals to place into the archi's
                     // migration database.
-                    auto mig_inds = this->m_ptr->s_pol.select(
-                        std::get<0>(mig_data), std::get<1>(mig_data), std::get<2>(mig_data), std::get<3>(mig_data),
-                        std::get<4>(mig_data), std::get<5>(mig_data), std::get<6>(mig_data));
+                    auto mig_inds = this->select_migrants();
+
+                    // If a migration scheduler is active, push them
+                    // also into the island's mailbox.
+                    const auto sched = aptr->get_migration_scheduler_ptr();
+                    if (sched) {
+                        aptr->push_migrants(isl_idx, *sched, mig_inds);
+                    }
 
                     // Place them in the database.
                     aptr->set_migrants(isl_idx, std::move(mig_inds));
+
+                    if (select_sw) {
+                        this->record_stat(&island_stats::m_migr_select, select_sw.elapsed());
+                    }
                 }
             }
         });
@@ -579,6 +782,11 @@ void island::wait_check()
 {
     auto iwr = detail::wait_raii_getter();
     (void)iwr;
+    wait_check_impl();
+}
+
+void island::wait_check_impl()
+{
     for (auto it = m_ptr->futures.begin(); it != m_ptr->futures.end(); ++it) {
         assert(it->valid());
         try {
@@ -616,6 +824,11 @@ void island::wait()
     // will still re-throw the first exception, and status() will still return idle_error.
     auto iwr = detail::wait_raii_getter();
     (void)iwr;
+    wait_impl();
+}
+
+void island::wait_impl()
+{
     const auto it_f = m_ptr->futures.end();
     auto it_first_exc = it_f;
     for (auto it = m_ptr->futures.begin(); it != it_f; ++it) {
@@ -778,6 +991,8 @@ population island::get_population() const
         new_pop_ptr = m_ptr->pop;
     }
 
+    record_pop_copy(*new_pop_ptr);
+
     return *new_pop_ptr;
 }
 
@@ -795,12 +1010,28 @@ void island::set_population(const population &pop)
     // Same pattern as in set_algorithm().
     auto new_pop_ptr = std::make_shared<population>(pop);
 
+    record_pop_copy(pop);
+
+    reset_population_ptr(std::move(new_pop_ptr));
+}
+
+// Replace the current population with the population pointed to by new_pop_ptr,
+// and publish its summary. new_pop_ptr must not be shared with anybody else.
+void island::reset_population_ptr(std::shared_ptr<population> new_pop_ptr)
+{
+    // Prepare the summary of the new population.
+    auto new_summary = make_summary(*new_pop_ptr);
+
     std::shared_ptr<population> old_ptr;
 
     {
         std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
         old_ptr = m_ptr->pop;
         m_ptr->pop = new_pop_ptr;
+        // NOTE: the summary is published while holding the lock,
+        // so that the published summary always refers to the current population.
+        new_summary->m_evolutions = m_ptr->n_evolutions.load(std::memory_order_relaxed);
+        std::atomic_store(&m_ptr->summary, std::shared_ptr<const island_summary>(std::move(new_summary)));
     }
 }
 
@@ -863,6 +1094,89 @@ std::string island::get_extra_info() const
     return m_ptr->isl_ptr->get_extra_info();
 }
 
+/// Enable or disable the instrumentation.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * When the instrumentation is enabled, the island records timing and size information about its
+ * evolution tasks, its migrations and the copies of its population (see :cpp:class:`~pagmo::island_stats`).
+ * The instrumentation is disabled by default. When disabled, the only overhead is the check of an atomic
+ * flag at the beginning of each generation and in the population getter and setter.
+ *
+ * Enabling or disabling the instrumentation does not reset the data recorded so far. Evolution tasks
+ * which are already running will pick up the change at their next generation. The instrumentation flag is
+ * preserved by the copy constructor, while the recorded data is not.
+ *
+ * It is safe to call this method while the island is evolving.
+ * \endverbatim
+ *
+ * @param on the new value of the instrumentation flag.
+ */
+void island::set_stats_enabled(bool on)
+{
+    m_ptr->stats_enabled.store(on, std::memory_order_relaxed);
+}
+
+/// Check if the instrumentation is enabled.
+/**
+ * It is safe to call this method while the island is evolving.
+ *
+ * @return \p true if the instrumentation is enabled, \p false otherwise.
+ */
+bool island::get_stats_enabled() const
+{
+    return m_ptr->stats_enabled.load(std::memory_order_relaxed);
+}
+
+/// Get the instrumentation data.
+/**
+ * It is safe to call this method while the island is evolving.
+ *
+ * @return a copy of the data recorded while the instrumentation was enabled.
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+island_stats island::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(m_ptr->stats_mutex);
+    return m_ptr->stats;
+}
+
+/// Reset the instrumentation data.
+/**
+ * It is safe to call this method while the island is evolving.
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+void island::reset_stats()
+{
+    std::lock_guard<std::mutex> lock(m_ptr->stats_mutex);
+    m_ptr->stats = island_stats{};
+}
+
+/// Get the summary.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * This method returns the last :cpp:class:`~pagmo::island_summary` published by the island.
+ * Differently from :cpp:func:`~pagmo::island::get_population()`, this method does not copy
+ * the island's population, and, after the first publication, it does not acquire any lock.
+ *
+ * It is safe to call this method while the island is evolving.
+ *
+ * \endverbatim
+ *
+ * @return a copy of the last published summary.
+ *
+ * @throws unspecified any exception thrown by threading primitives or by memory errors in standard containers.
+ */
+island_summary island::get_summary() const
+{
+    return *get_summary_ptr();
+}
+
 #if !defined(PAGMO_DOXYGEN_INVOKED)
 
 // Stream operator for pagmo::island.
@@ -911,33 +1225,123 @@ island::migration_data_t island::get_migration_data() const
 
     {
         // NOTE: this helper is called from the separate
-        // thread of execution within pagmo::island. We need to protect
-        // with a gte.
-        auto gte = detail::gte_getter();
-        (void)gte;
-
-        // Get a copy of the population.
-        auto tmp_pop(get_population());
-
-        // Move out the individuals.
-        std::get<0>(std::get<0>(retval)) = std::move(tmp_pop.m_ID);
-        std::get<1>(std::get<0>(retval)) = std::move(tmp_pop.m_x);
-        std::get<2>(std::get<0>(retval)) = std::move(tmp_pop.m_f);
+        // thread of execution within pagmo::island. If the problem
+        // is pythonic, we need to protect with a gte, as the
+        // destruction of pop_ptr might end up destroying the population.
+        // NOTE: the gte must be created before pop_ptr, so that it is destroyed after.
+        boost::any gte;
+
+        // Get a reference to the current population.
+        const auto pop_ptr = get_population_ptr();
+        gte = detail::island_gte(*pop_ptr);
+
+        // Copy out the individuals. NOTE: the population
+        // pointed to by pop_ptr is never modified while we
+        // hold a reference to it (see replace_with_migrants()),
+        // no need to make a full copy of it (including the problem).
+        std::get<0>(std::get<0>(retval)) = pop_ptr->get_ID();
+        std::get<1>(std::get<0>(retval)) = pop_ptr->get_x();
+        std::get<2>(std::get<0>(retval)) = pop_ptr->get_f();
 
         // nx, nix, nobj, nec, nic.
-        std::get<1>(retval) = tmp_pop.get_problem().get_nx();
-        std::get<2>(retval) = tmp_pop.get_problem().get_nix();
-        std::get<3>(retval) = tmp_pop.get_problem().get_nobj();
-        std::get<4>(retval) = tmp_pop.get_problem().get_nec();
-        std::get<5>(retval) = tmp_pop.get_problem().get_nic();
+        const auto &prob = pop_ptr->get_problem();
+        std::get<1>(retval) = prob.get_nx();
+        std::get<2>(retval) = prob.get_nix();
+        std::get<3>(retval) = prob.get_nobj();
+        std::get<4>(retval) = prob.get_nec();
+        std::get<5>(retval) = prob.get_nic();
 
         // The vector of tolerances.
-        std::get<6>(retval) = tmp_pop.get_problem().get_c_tol();
+        std::get<6>(retval) = prob.get_c_tol();
+    }
+
+    return retval;
+}
+
+// Get a reference to the current algorithm.
+// NOTE: the returned algorithm is never modified
+// by the island, set_algorithm() replaces the pointer.
+std::shared_ptr<const algorithm> island::get_algorithm_ptr() const
+{
+    std::lock_guard<std::mutex> lock(m_ptr->algo_mutex);
+    return m_ptr->algo;
+}
+
+// Get a reference to the current population.
+std::shared_ptr<const population> island::get_population_ptr() const
+{
+    std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
+    return m_ptr->pop;
+}
+
+// Record a sample in one of the histograms of the instrumentation data.
+void island::record_stat(stats_histogram island_stats::*h, unsigned long long x) const
+{
+    std::lock_guard<std::mutex> lock(m_ptr->stats_mutex);
+    (m_ptr->stats.*h).add(x);
+}
+
+// Record the size of a copy of the population, if the instrumentation is enabled.
+void island::record_pop_copy(const population &pop) const
+{
+    if (get_stats_enabled()) {
+        // NOTE: we count only the individuals, i.e., the IDs and the
+        // decision/fitness vectors.
+        const auto &prob = pop.get_problem();
+        const auto size = static_cast<unsigned long long>(pop.size())
+                          * (sizeof(unsigned long long) + (prob.get_nx() + prob.get_nf()) * sizeof(double));
+        record_stat(&island_stats::m_pop_copy, size);
     }
+}
 
+// Build the summary of a population. The number of evolutions
+// is left to the caller.
+std::shared_ptr<island_summary> island::make_summary(const population &pop)
+{
+    auto retval = std::make_shared<island_summary>();
+    retval->m_champion_x = pop.m_champion_x;
+    retval->m_champion_f = pop.m_champion_f;
+    retval->m_fevals = pop.m_prob.get_fevals();
+    retval->m_pop_size = pop.size();
+    retval->m_nobj = pop.m_prob.get_nobj();
+    retval->m_stochastic = pop.m_prob.is_stochastic();
     return retval;
 }
 
+// Fetch the last published summary. If no summary has been published yet
+// (e.g., in a newly-constructed or deserialised island), a summary of
+// the current population is built and published on the fly.
+std::shared_ptr<const island_summary> island::get_summary_ptr() const
+{
+    auto retval = std::atomic_load(&m_ptr->summary);
+    if (retval) {
+        return retval;
+    }
+
+    std::shared_ptr<island_summary> new_summary;
+    {
+        std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
+        new_summary = make_summary(*m_ptr->pop);
+        new_summary->m_evolutions = m_ptr->n_evolutions.load(std::memory_order_relaxed);
+    }
+    retval = std::move(new_summary);
+    // NOTE: if another summary was published in the meantime, use it.
+    std::shared_ptr<const island_summary> expected;
+    if (!std::atomic_compare_exchange_strong(&m_ptr->summary, &expected, retval)) {
+        return expected;
+    }
+    return retval;
+}
+
+// Publish the summary of the current population.
+void island::publish_summary()
+{
+    std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
+    auto new_summary = make_summary(*m_ptr->pop);
+    new_summary->m_evolutions = m_ptr->n_evolutions.load(std::memory_order_relaxed);
+    std::atomic_store(&m_ptr->summary, std::shared_ptr<const island_summary>(std::move(new_summary)));
+}
+
 // Set all the individuals in the population.
 void island::set_individuals(const individuals_group_t &inds)
 {
@@ -947,21 +1351,134 @@ void island::set_individuals(const individuals_group_t &inds)
     {
         // NOTE: this helper is called from the separate
         // thread of execution within pagmo::island. We need to protect
-        // with a gte.
-        auto gte = detail::gte_getter();
-        (void)gte;
+        // with a gte if the problem is pythonic.
+        boost::any gte;
 
         // Get out a copy of the population.
-        auto tmp_pop(get_population());
+        const auto pop_ptr = get_population_ptr();
+        gte = detail::island_gte(*pop_ptr);
+        auto new_pop_ptr = std::make_shared<population>(*pop_ptr);
+        record_pop_copy(*new_pop_ptr);
 
         // Move in the individuals.
-        tmp_pop.m_ID = std::move(std::get<0>(tmp_inds));
-        tmp_pop.m_x = std::move(std::get<1>(tmp_inds));
-        tmp_pop.m_f = std::move(std::get<2>(tmp_inds));
+        new_pop_ptr->m_ID = std::move(std::get<0>(tmp_inds));
+        new_pop_ptr->m_x = std::move(std::get<1>(tmp_inds));
+        new_pop_ptr->m_f = std::move(std::get<2>(tmp_inds));
 
         // Set the new population.
-        set_population(tmp_pop);
+        reset_population_ptr(std::move(new_pop_ptr));
+    }
+}
+
+// Select the migrants from the current population via the selection policy.
+// NOTE: the selection policy operates on a view of the individuals of
+// the current population, which is never modified while we are holding
+// a reference to it. Thus, only the selected individuals are copied.
+individuals_group_t island::select_migrants() const
+{
+    // NOTE: as in get_migration_data(), protect with a gte
+    // if the problem is pythonic.
+    boost::any gte;
+
+    const auto pop_ptr = get_population_ptr();
+    gte = detail::island_gte(*pop_ptr);
+
+    const auto &prob = pop_ptr->get_problem();
+    return m_ptr->s_pol.select_view(individuals_view_t(pop_ptr->get_ID(), pop_ptr->get_x(), pop_ptr->get_f()),
+                                    prob.get_nx(), prob.get_nix(), prob.get_nobj(), prob.get_nec(), prob.get_nic(),
+                                    prob.get_c_tol());
+}
+
+// Replace individuals in the current population with the input migrants
+// via the replacement policy. The migrants which were inserted into the
+// population are returned.
+individuals_group_t island::replace_with_migrants(const individuals_group_t &mig)
+{
+    individuals_group_t retval;
+
+    if (!m_ptr->r_pol.has_replace_in_place()) {
+        // The replacement policy does not support in-place replacement:
+        // copy out the individuals, run the replacement policy and
+        // set the new individuals.
+        const auto mig_data = get_migration_data();
+        const auto new_inds
+            = m_ptr->r_pol.replace(std::get<0>(mig_data), std::get<1>(mig_data), std::get<2>(mig_data),
+                                   std::get<3>(mig_data), std::get<4>(mig_data), std::get<5>(mig_data),
+                                   std::get<6>(mig_data), mig);
+        set_individuals(new_inds);
+
+        // The inserted migrants are the individuals in new_inds
+        // whose IDs are among the IDs of the migrants.
+        const std::unordered_set<unsigned long long> mig_IDs(std::get<0>(mig).begin(), std::get<0>(mig).end());
+        for (decltype(std::get<0>(new_inds).size()) i = 0; i < std::get<0>(new_inds).size(); ++i) {
+            if (mig_IDs.count(std::get<0>(new_inds)[i])) {
+                std::get<0>(retval).push_back(std::get<0>(new_inds)[i]);
+                std::get<1>(retval).push_back(std::get<1>(new_inds)[i]);
+                std::get<2>(retval).push_back(std::get<2>(new_inds)[i]);
+            }
+        }
+
+        return retval;
     }
+
+    // NOTE: as in get_migration_data(), protect with a gte
+    // if the problem is pythonic.
+    boost::any gte;
+
+    // Compute the replacement plan on a view of the current population.
+    const auto pop_ptr = get_population_ptr();
+    gte = detail::island_gte(*pop_ptr);
+    const auto &prob = pop_ptr->get_problem();
+    const auto plan = m_ptr->r_pol.replace_in_place(
+        individuals_view_t(pop_ptr->get_ID(), pop_ptr->get_x(), pop_ptr->get_f()), prob.get_nx(), prob.get_nix(),
+        prob.get_nobj(), prob.get_nec(), prob.get_nic(), prob.get_c_tol(), mig);
+
+    if (plan.empty()) {
+        return retval;
+    }
+
+    for (const auto &p : plan) {
+        std::get<0>(retval).push_back(std::get<0>(mig)[p.second]);
+        std::get<1>(retval).push_back(std::get<1>(mig)[p.second]);
+        std::get<2>(retval).push_back(std::get<2>(mig)[p.second]);
+    }
+
+    // Helper to apply the plan to a population.
+    auto apply_plan = [&plan, &mig](population &pop) {
+        for (const auto &p : plan) {
+            pop.m_ID[p.first] = std::get<0>(mig)[p.second];
+            pop.m_x[p.first] = std::get<1>(mig)[p.second];
+            pop.m_f[p.first] = std::get<2>(mig)[p.second];
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_ptr->pop_mutex);
+        // If the population has not been replaced in the meantime and
+        // we hold the only other reference to it, nobody can be reading it
+        // (new references can be obtained only while holding pop_mutex).
+        // In such case, we can write the migrants directly into it.
+        if (m_ptr->pop == pop_ptr && m_ptr->pop.use_count() == 2) {
+            // NOTE: synchronise with the release of the references
+            // held by other threads.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            apply_plan(*m_ptr->pop);
+
+            auto new_summary = make_summary(*m_ptr->pop);
+            new_summary->m_evolutions = m_ptr->n_evolutions.load(std::memory_order_relaxed);
+            std::atomic_store(&m_ptr->summary, std::shared_ptr<const island_summary>(std::move(new_summary)));
+
+            return retval;
+        }
+    }
+
+    // Otherwise, fall back to copy-on-write.
+    auto new_pop_ptr = std::make_shared<population>(*pop_ptr);
+    record_pop_copy(*new_pop_ptr);
+    apply_plan(*new_pop_ptr);
+    reset_population_ptr(std::move(new_pop_ptr));
+
+    return retval;
 }
 
 } // namespace pagmo
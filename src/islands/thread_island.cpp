@@ -29,8 +29,9 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <utility>
 
+#include <boost/any.hpp>
+
 #include <pagmo/algorithm.hpp>
-#include <pagmo/detail/gte_getter.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/island.hpp>
 #include <pagmo/islands/thread_island.hpp>
@@ -70,16 +71,27 @@ void thread_island::run_evolve(island &isl) const
         // thread of execution within pagmo::island. Since
         // we need to extract copies of algorithm and population,
         // which may be implemented in Python, we need to protect
-        // with a gte.
-        auto gte = detail::gte_getter();
-        (void)gte;
+        // with a gte. The gte is not needed (and it is not created) if
+        // algorithm and problem are not pythonic: this way, the evolution
+        // of C++ islands never locks the Python interpreter.
+        boost::any gte;
+
+        // Get references to the current algo/pop of isl, and use
+        // them to decide whether we need the gte or not.
+        // NOTE: we cannot just check the thread safety levels
+        // and then use isl.get_algorithm()/isl.get_population(), as the
+        // algo/pop might be replaced concurrently in the meantime.
+        const auto algo_ptr = isl.get_algorithm_ptr();
+        const auto pop_ptr = isl.get_population_ptr();
+        gte = detail::island_gte(*algo_ptr, *pop_ptr);
 
         // Get copies of algo/pop from isl.
         // NOTE: in case of exceptions, any pythonic object
         // existing within this scope will be destroyed before the gte,
         // while it is still safe to call into Python.
-        auto tmp_algo(isl.get_algorithm());
-        auto tmp_pop(isl.get_population());
+        auto tmp_algo(*algo_ptr);
+        auto tmp_pop(*pop_ptr);
+        isl.record_pop_copy(tmp_pop);
 
         // Check the thread safety levels.
         if (tmp_algo.get_thread_safety() < thread_safety::basic) {
@@ -36,6 +36,7 @@ see https://www.gnu.org/licenses/. */
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <pagmo/bfe.hpp>
 #include <pagmo/detail/custom_comparisons.hpp>
@@ -50,6 +51,28 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+namespace detail
+{
+
+namespace
+{
+
+// Split a batch of contiguously stored vectors of size n into separate vectors.
+std::vector<vector_double> batch_to_vectors(const vector_double &v, vector_double::size_type n)
+{
+    assert(n > 0u && v.size() % n == 0u);
+    std::vector<vector_double> retval;
+    retval.reserve(v.size() / n);
+    for (auto it = v.begin(); it != v.end(); it += static_cast<vector_double::difference_type>(n)) {
+        retval.emplace_back(it, it + static_cast<vector_double::difference_type>(n));
+    }
+    return retval;
+}
+
+} // namespace
+
+} // namespace detail
+
 /// Default constructor
 /**
  * Constructs an empty population with a default-constructed problem.
@@ -62,19 +85,25 @@ population::population() : population(problem{}, 0u, 0u) {}
 void population::prob_ctor_impl(size_type pop_size)
 {
     // NOTE: generate the random decision vectors in temporary storage,
-    // and only at the end move them into the population. This ensures
-    // that, for a given rng seed, the generated dvs are identical
-    // to those generated in the constructor from bfe.
-    std::vector<std::pair<vector_double, vector_double>> tmp(pop_size);
-    for (size_type i = 0u; i < pop_size; ++i) {
-        tmp[i].first = random_decision_vector();
-        tmp[i].second = m_prob.fitness(tmp[i].first);
+    // and only at the end move them into the population. Generating them
+    // in batch mode ensures that, for a given rng seed, the generated dvs
+    // are identical to those generated in the constructor from bfe.
+    // NOTE: batch_random_decision_vector() checks the bounds even if no dv
+    // is generated. Skip it for empty populations, so that problems with
+    // non-finite bounds can still be used to construct an empty population.
+    if (!pop_size) {
+        return;
     }
-    // Move the generated dvs/fvs into the population. push_back()
-    // will take care of generating the IDs, updating the champion, etc.
+    auto xs = detail::batch_to_vectors(batch_random_decision_vector(m_prob, pop_size, m_e), m_prob.get_nx());
+    std::vector<vector_double> fs(pop_size);
     for (size_type i = 0u; i < pop_size; ++i) {
-        push_back(std::move(tmp[i].first), std::move(tmp[i].second));
+        // NOTE: UDPs implementing fitness_into() will write the fitness
+        // directly into the storage allocated here.
+        m_prob.fitness_into(xs[i], fs[i]);
     }
+    // Move the generated dvs/fvs into the population. append()
+    // will take care of generating the IDs, updating the champion, etc.
+    append(std::move(xs), std::move(fs));
 }
 
 // Implementation of the ctor from bfe. Distinguish the two cases
@@ -92,14 +121,7 @@ void population::constructor_from_bfe_impl(const bfe &b, size_type pop_size, con
     assert(pop_size == 0u || fvs.size() % pop_size == 0u);
 
     // Add the dvs/fvs to the population.
-    const auto nx = m_prob.get_nx();
-    const auto nf = m_prob.get_nf();
-    assert(dvs.size() % nx == 0u);
-    assert(fvs.size() % nf == 0u);
-    for (size_type i = 0; i < pop_size; ++i) {
-        push_back(vector_double(dvs.data() + i * nx, dvs.data() + (i + 1u) * nx),
-                  vector_double(fvs.data() + i * nf, fvs.data() + (i + 1u) * nf));
-    }
+    append(dvs, fvs);
 }
 
 /// Defaulted copy constructor.
@@ -234,6 +256,87 @@ void population::push_back(vector_double &&x, vector_double &&f)
     push_back_impl(std::move(x), std::move(f));
 }
 
+/// Adds a batch of decision vectors/fitness vectors to the population.
+/**
+ * Appends to the population the decision vectors stored contiguously in \p dvs, with the fitness vectors
+ * stored contiguously in \p fvs, using the same layout of the input and output of pagmo::bfe.
+ * A new unique identifier is created for each newly born individual, and the champion
+ * is updated once for the whole batch.
+ *
+ * The result is the same as calling push_back() on each individual of the batch, in order. In case
+ * of exceptions, the population will not be altered.
+ *
+ * @param dvs the decision vectors to be added to the population.
+ * @param fvs the fitness vectors corresponding to the decision vectors.
+ *
+ * @throws std::invalid_argument if the size of \p dvs is not a multiple of the problem's dimension,
+ * if the size of \p fvs is not a multiple of the fitness dimension, or if the number of
+ * decision vectors differs from the number of fitness vectors.
+ * @throws unspecified any exception thrown by the other overload.
+ */
+void population::append(const vector_double &dvs, const vector_double &fvs)
+{
+    const auto nx = m_prob.get_nx(), nf = m_prob.get_nf();
+    if (dvs.size() % nx || fvs.size() % nf) {
+        pagmo_throw(std::invalid_argument,
+                    "Trying to add a batch of decision vectors of size " + std::to_string(dvs.size())
+                        + " and a batch of fitness vectors of size " + std::to_string(fvs.size())
+                        + ", while the problem's dimension is " + std::to_string(nx)
+                        + " and the problem's fitness dimension is " + std::to_string(nf));
+    }
+    append(detail::batch_to_vectors(dvs, nx), detail::batch_to_vectors(fvs, nf));
+}
+
+/// Adds a batch of decision vectors/fitness vectors to the population (move overload).
+/**
+ * Appends to the population the decision vectors \p xs, with fitness vectors \p fs. The vectors
+ * will be moved into the population. A new unique identifier is created for each newly born individual,
+ * and the champion is updated once for the whole batch.
+ *
+ * The result is the same as calling push_back() on each individual of the batch, in order. In case
+ * of exceptions, the population will not be altered.
+ *
+ * @param xs the decision vectors to be added to the population.
+ * @param fs the fitness vectors corresponding to the decision vectors.
+ *
+ * @throws std::overflow_error if the addition of the batch to the population would overflow the
+ * population size limit.
+ * @throws std::invalid_argument if the sizes of \p xs and \p fs differ, or if the size of any
+ * element of \p xs (resp. \p fs) differs from the problem's dimension (resp. fitness dimension).
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+void population::append(std::vector<vector_double> &&xs, std::vector<vector_double> &&fs)
+{
+    check_batch(xs, fs);
+    const auto n = xs.size();
+    // LCOV_EXCL_START
+    if (n > std::numeric_limits<decltype(m_ID.size())>::max() - m_ID.size()
+        || n > std::numeric_limits<decltype(m_x.size())>::max() - m_x.size()) {
+        pagmo_throw(std::overflow_error, "Cannot add " + std::to_string(n)
+                                             + " new individuals to this population: the maximum number of "
+                                               "individuals per population would be exceeded");
+    }
+    // LCOV_EXCL_STOP
+
+    // Generate the new IDs, in the same order as push_back().
+    std::vector<unsigned long long> new_ids(n);
+    std::uniform_int_distribution<unsigned long long> id_dist;
+    for (auto &id : new_ids) {
+        id = id_dist(m_e);
+    }
+    // Reserve space in the vectors.
+    m_ID.reserve(m_ID.size() + n);
+    m_x.reserve(m_x.size() + n);
+    m_f.reserve(m_f.size() + n);
+
+    // update_champion_batch() either throws before modfying anything, or it completes successfully.
+    // The rest is noexcept.
+    update_champion_batch(xs, fs);
+    m_ID.insert(m_ID.end(), new_ids.begin(), new_ids.end());
+    std::move(xs.begin(), xs.end(), std::back_inserter(m_x));
+    std::move(fs.begin(), fs.end(), std::back_inserter(m_f));
+}
+
 /// Creates a random decision vector
 /**
  * Creates a random decision vector within the problem's bounds.
@@ -541,6 +644,72 @@ void population::set_x(size_type i, const vector_double &x)
     set_xf(i, x, m_prob.fitness(x));
 }
 
+/// Sets the decision vectors and fitnesses of the first individuals.
+/**
+ * Sets the decision vectors and the fitnesses of the first \f$n\f$ individuals of the population
+ * to the decision vectors stored contiguously in \p dvs and to the fitness vectors stored contiguously
+ * in \p fvs, using the same layout of the input and output of pagmo::bfe. No fitness evaluation
+ * is triggered, the IDs of the individuals are not changed and the champion is updated once for the whole batch.
+ *
+ * The result is the same as calling set_xf() on each of the first \f$n\f$ individuals, in order.
+ * In case of exceptions, the population will not be altered.
+ *
+ * @param dvs the new decision vectors.
+ * @param fvs the new fitness vectors.
+ *
+ * @throws std::invalid_argument if the size of \p dvs is not a multiple of the problem's dimension,
+ * or if the size of \p fvs is not a multiple of the fitness dimension.
+ * @throws unspecified any exception thrown by the other overload.
+ */
+void population::assign_batch(const vector_double &dvs, const vector_double &fvs)
+{
+    const auto nx = m_prob.get_nx(), nf = m_prob.get_nf();
+    if (dvs.size() % nx || fvs.size() % nf) {
+        pagmo_throw(std::invalid_argument,
+                    "Trying to set a batch of decision vectors of size " + std::to_string(dvs.size())
+                        + " and a batch of fitness vectors of size " + std::to_string(fvs.size())
+                        + ", while the problem's dimension is " + std::to_string(nx)
+                        + " and the problem's fitness dimension is " + std::to_string(nf));
+    }
+    assign_batch(detail::batch_to_vectors(dvs, nx), detail::batch_to_vectors(fvs, nf));
+}
+
+/// Sets the decision vectors and fitnesses of the first individuals (move overload).
+/**
+ * Sets the decision vectors and the fitnesses of the first \f$n\f$ individuals of the population,
+ * where \f$n\f$ is the size of \p xs, to the vectors in \p xs and \p fs, which will be moved
+ * into the population. No fitness evaluation is triggered, the IDs of the individuals are not changed
+ * and the champion is updated once for the whole batch.
+ *
+ * The result is the same as calling set_xf() on each of the first \f$n\f$ individuals, in order.
+ * In case of exceptions, the population will not be altered.
+ *
+ * @param xs the new decision vectors.
+ * @param fs the new fitness vectors.
+ *
+ * @throws std::invalid_argument if either:
+ * - the sizes of \p xs and \p fs differ,
+ * - the size of \p xs is larger than the population size,
+ * - the size of any element of \p xs (resp. \p fs) differs from the problem's dimension
+ *   (resp. fitness dimension).
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+void population::assign_batch(std::vector<vector_double> &&xs, std::vector<vector_double> &&fs)
+{
+    check_batch(xs, fs);
+    if (xs.size() > size()) {
+        pagmo_throw(std::invalid_argument, "Trying to set a batch of " + std::to_string(xs.size())
+                                               + " individuals, while the population has size: "
+                                               + std::to_string(size()));
+    }
+
+    // update_champion_batch() either throws before modfying anything, or it completes successfully.
+    // The rest is noexcept.
+    update_champion_batch(xs, fs);
+    std::move(xs.begin(), xs.end(), m_x.begin());
+    std::move(fs.begin(), fs.end(), m_f.begin());
+}
+
 /// Streaming operator for pagmo::population.
 /**
  * @param os target stream.
@@ -613,23 +782,67 @@ void population::update_champion(vector_double x, vector_double f)
         return;
     }
     // If the champion does not exist create it, otherwise update it if worse than the new solution
-    if (m_champion_x.size() == 0u) {
+    if (m_champion_x.size() == 0u || champion_less(f, m_champion_f)) {
         m_champion_x = std::move(x);
         m_champion_f = std::move(f);
-    } else if (m_prob.get_nc() == 0u) { // unconstrained
+    }
+}
+
+// Returns true if the fitness f is better than the fitness g, according to the criterion
+// used to update the champion.
+bool population::champion_less(const vector_double &f, const vector_double &g) const
+{
+    if (m_prob.get_nc() == 0u) { // unconstrained
         // NOTE: make sure to use the custom comparison less_than_f(),
         // so that we handle NaN correctly (i.e., a fitness of NaN is
         // considered worse than any other value).
-        if (detail::less_than_f(f[0], m_champion_f[0])) {
-            m_champion_x = std::move(x);
-            m_champion_f = std::move(f);
+        return detail::less_than_f(f[0], g[0]);
+    }
+    // constrained
+    return compare_fc(f, g, m_prob.get_nec(), m_prob.get_c_tol());
+}
+
+// Checks on the input of the batch API.
+void population::check_batch(const std::vector<vector_double> &xs, const std::vector<vector_double> &fs) const
+{
+    if (xs.size() != fs.size()) {
+        pagmo_throw(std::invalid_argument, "A batch of " + std::to_string(xs.size())
+                                               + " decision vectors was provided together with a batch of "
+                                               + std::to_string(fs.size()) + " fitness vectors");
+    }
+    const auto nx = m_prob.get_nx(), nf = m_prob.get_nf();
+    for (decltype(xs.size()) i = 0; i < xs.size(); ++i) {
+        if (xs[i].size() != nx) {
+            pagmo_throw(std::invalid_argument, "The decision vector at position " + std::to_string(i)
+                                                   + " in a batch has dimension: " + std::to_string(xs[i].size())
+                                                   + ", while the problem's dimension is: " + std::to_string(nx));
         }
-    } else { // constrained
-        if (compare_fc(f, m_champion_f, m_prob.get_nec(), m_prob.get_c_tol())) {
-            m_champion_x = std::move(x);
-            m_champion_f = std::move(f);
+        if (fs[i].size() != nf) {
+            pagmo_throw(std::invalid_argument,
+                        "The fitness vector at position " + std::to_string(i)
+                            + " in a batch has dimension: " + std::to_string(fs[i].size())
+                            + ", while the problem's fitness has dimension: " + std::to_string(nf));
+        }
+    }
+}
+
+// Update the champion with a batch of individuals. The result is the same
+// as calling update_champion() on each individual of the batch, in order,
+// but at most one copy of the decision and fitness vectors is performed.
+void population::update_champion_batch(const std::vector<vector_double> &xs, const std::vector<vector_double> &fs)
+{
+    assert(xs.size() == fs.size());
+    if (m_prob.get_nobj() != 1u || xs.empty()) {
+        return;
+    }
+    // Locate the first best individual in the batch.
+    decltype(xs.size()) best = 0;
+    for (decltype(xs.size()) i = 1; i < xs.size(); ++i) {
+        if (champion_less(fs[i], fs[best])) {
+            best = i;
         }
     }
+    update_champion(xs[best], fs[best]);
 }
 
 // Small helper to erase all individuals from a population.
@@ -32,6 +32,7 @@ see https://www.gnu.org/licenses/. */
 #include <cmath>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <string>
@@ -40,7 +41,9 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <pagmo/config.hpp>
 #include <pagmo/detail/bfe_impl.hpp>
+#include <pagmo/eval_tracing.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/io.hpp>
 #include <pagmo/problem.hpp>
@@ -186,6 +189,13 @@ void problem::generic_ctor_impl()
     m_has_batch_fitness = ptr()->has_batch_fitness();
     // 5 - Presence of gradient and its sparsity.
     m_has_gradient = ptr()->has_gradient();
+    m_has_fitness_and_gradient = ptr()->has_fitness_and_gradient();
+    if (m_has_fitness_and_gradient && !m_has_gradient) {
+        pagmo_throw(std::invalid_argument,
+                    "The UDP '" + ptr()->get_name()
+                        + "' provides a fused fitness and gradient computation, but it does not provide the gradient");
+    }
+    m_has_fitness_into = ptr()->has_fitness_into();
     m_has_gradient_sparsity = ptr()->has_gradient_sparsity();
     // 6 - Presence of Hessians and their sparsity.
     m_has_hessians = ptr()->has_hessians();
@@ -241,6 +251,12 @@ void problem::generic_ctor_impl()
 /**
  * The copy constructor will deep copy the input problem \p other.
  *
+ * If the UDP of \p other opts in via pagmo::is_shareable_udp and its thread safety level is
+ * thread_safety::constant, the internal UDP will not be copied. Instead, the UDP instance will be
+ * shared between \p other and \p this, and it will be copied only if mutable access to it is requested
+ * (e.g., via the non-const overload of extract() or via set_seed()). The counters of fitness, gradient and hessians
+ * evaluations and the other properties of the problem are always copied.
+ *
  * @param other the problem to be copied.
  *
  * @throws unspecified any exception thrown by:
@@ -248,11 +264,13 @@ void problem::generic_ctor_impl()
  * - the copying of the internal UDP.
  */
 problem::problem(const problem &other)
-    : m_ptr(other.ptr()->clone()), m_fevals(other.m_fevals.load(std::memory_order_relaxed)),
-      m_gevals(other.m_gevals.load(std::memory_order_relaxed)),
-      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_lb(other.m_lb), m_ub(other.m_ub),
-      m_nobj(other.m_nobj), m_nec(other.m_nec), m_nic(other.m_nic), m_nix(other.m_nix), m_c_tol(other.m_c_tol),
+    : m_ptr(other.m_thread_safety == thread_safety::constant && other.ptr()->is_shareable()
+                ? other.m_ptr
+                : std::shared_ptr<detail::prob_inner_base>(other.ptr()->clone())),
+      m_evals(other.m_evals), m_lb(other.m_lb), m_ub(other.m_ub), m_nobj(other.m_nobj), m_nec(other.m_nec),
+      m_nic(other.m_nic), m_nix(other.m_nix), m_c_tol(other.m_c_tol),
       m_has_batch_fitness(other.m_has_batch_fitness), m_has_gradient(other.m_has_gradient),
+      m_has_fitness_and_gradient(other.m_has_fitness_and_gradient), m_has_fitness_into(other.m_has_fitness_into),
       m_has_gradient_sparsity(other.m_has_gradient_sparsity), m_has_hessians(other.m_has_hessians),
       m_has_hessians_sparsity(other.m_has_hessians_sparsity), m_has_set_seed(other.m_has_set_seed),
       m_name(other.m_name), m_gs_dim(other.m_gs_dim), m_hs_dim(other.m_hs_dim), m_thread_safety(other.m_thread_safety)
@@ -264,12 +282,11 @@ problem::problem(const problem &other)
  * @param other the problem from which \p this will be move-constructed.
  */
 problem::problem(problem &&other) noexcept
-    : m_ptr(std::move(other.m_ptr)), m_fevals(other.m_fevals.load(std::memory_order_relaxed)),
-      m_gevals(other.m_gevals.load(std::memory_order_relaxed)),
-      m_hevals(other.m_hevals.load(std::memory_order_relaxed)), m_lb(std::move(other.m_lb)),
+    : m_ptr(std::move(other.m_ptr)), m_evals(std::move(other.m_evals)), m_lb(std::move(other.m_lb)),
       m_ub(std::move(other.m_ub)), m_nobj(other.m_nobj), m_nec(other.m_nec), m_nic(other.m_nic), m_nix(other.m_nix),
       m_c_tol(std::move(other.m_c_tol)), m_has_batch_fitness(other.m_has_batch_fitness),
-      m_has_gradient(other.m_has_gradient), m_has_gradient_sparsity(other.m_has_gradient_sparsity),
+      m_has_gradient(other.m_has_gradient), m_has_fitness_and_gradient(other.m_has_fitness_and_gradient),
+      m_has_fitness_into(other.m_has_fitness_into), m_has_gradient_sparsity(other.m_has_gradient_sparsity),
       m_has_hessians(other.m_has_hessians), m_has_hessians_sparsity(other.m_has_hessians_sparsity),
       m_has_set_seed(other.m_has_set_seed), m_name(std::move(other.m_name)), m_gs_dim(other.m_gs_dim),
       m_hs_dim(other.m_hs_dim), m_thread_safety(std::move(other.m_thread_safety))
@@ -286,9 +303,7 @@ problem &problem::operator=(problem &&other) noexcept
 {
     if (this != &other) {
         m_ptr = std::move(other.m_ptr);
-        m_fevals.store(other.m_fevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
-        m_gevals.store(other.m_gevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
-        m_hevals.store(other.m_hevals.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_evals = std::move(other.m_evals);
         m_lb = std::move(other.m_lb);
         m_ub = std::move(other.m_ub);
         m_nobj = other.m_nobj;
@@ -298,6 +313,8 @@ problem &problem::operator=(problem &&other) noexcept
         m_c_tol = std::move(other.m_c_tol);
         m_has_batch_fitness = other.m_has_batch_fitness;
         m_has_gradient = other.m_has_gradient;
+        m_has_fitness_and_gradient = other.m_has_fitness_and_gradient;
+        m_has_fitness_into = other.m_has_fitness_into;
         m_has_gradient_sparsity = other.m_has_gradient_sparsity;
         m_has_hessians = other.m_has_hessians;
         m_has_hessians_sparsity = other.m_has_hessians_sparsity;
@@ -358,11 +375,21 @@ vector_double problem::fitness(const vector_double &dv) const
     // NOTE: the check uses UDP properties cached on construction. This is const and thread-safe.
     detail::prob_check_dv(*this, dv.data(), dv.size());
 
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
+
     // 2 - computes the fitness
     // NOTE: the thread safety here depends on the thread safety of the UDP. We make sure in the
     // parallel init methods that we never invoke this method concurrently if the UDP is not
     // sufficiently thread-safe.
-    vector_double retval(ptr()->fitness(dv));
+    vector_double retval;
+    if (m_has_fitness_into) {
+        retval.resize(get_nf());
+        ptr()->fitness_into(dv.data(), retval.data());
+    } else {
+        retval = ptr()->fitness(dv);
+    }
 
     // 3 - checks the fitness vector
     // NOTE: as above, we are just making sure the fitness length is consistent with the fitness
@@ -373,9 +400,67 @@ vector_double problem::fitness(const vector_double &dv) const
     // NOTE: this is an atomic variable, thread-safe.
     increment_fevals(1);
 
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    tt.record(eval_type::fitness, dv.data(), dv.size(), retval.data(), retval.size());
+#endif
+
     return retval;
 }
 
+/// Fitness into a caller-provided vector.
+/**
+ * This method will compute the fitness of the input decision vector \p dv, and it will write it into \p fv.
+ * \p fv will be resized to get_nf() if needed, so that, if \p fv is reused across multiple calls, no memory
+ * allocation takes place after the first call.
+ *
+ * If the UDP satisfies pagmo::has_fitness_into, the fitness will be written directly into \p fv by the
+ * <tt>%fitness_into()</tt> method of the UDP, which receives a pointer to the get_nx() elements of \p dv and a
+ * pointer to the get_nf() elements of \p fv. Otherwise, the fitness will be computed via the
+ * <tt>%fitness()</tt> method of the UDP and then moved into \p fv.
+ *
+ * The sanity checks and the increase of the fitness evaluation counter are the same
+ * as in problem::fitness().
+ *
+ * @param dv the decision vector.
+ * @param fv the output fitness vector.
+ *
+ * @throws std::invalid_argument if either
+ * - the length of \p dv differs from the value returned by get_nx(), or
+ * - the length of the fitness vector returned by the <tt>%fitness()</tt> method of the UDP differs
+ *   from the the value returned by get_nf().
+ * @throws unspecified any exception thrown by the <tt>%fitness()</tt> or <tt>%fitness_into()</tt> methods of the UDP,
+ * or by memory errors in standard containers. If an exception is thrown, the content of \p fv is unspecified.
+ */
+void problem::fitness_into(const vector_double &dv, vector_double &fv) const
+{
+    // 1 - checks the decision vector.
+    detail::prob_check_dv(*this, dv.data(), dv.size());
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
+
+    // 2 - computes the fitness.
+    if (m_has_fitness_into) {
+        fv.resize(get_nf());
+        ptr()->fitness_into(dv.data(), fv.data());
+    } else {
+        auto tmp(ptr()->fitness(dv));
+        // 3 - checks the fitness vector.
+        // NOTE: a fitness_into() method writes by definition
+        // get_nf() elements, thus the check is needed only here.
+        detail::prob_check_fv(*this, tmp.data(), tmp.size());
+        fv = std::move(tmp);
+    }
+
+    // 4 - increments fitness evaluation counter.
+    increment_fevals(1);
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    tt.record(eval_type::fitness, dv.data(), dv.size(), fv.data(), fv.size());
+#endif
+}
+
 /// Batch fitness.
 /**
  * This method implements the evaluation of multiple decision vectors in batch mode
@@ -413,6 +498,10 @@ vector_double problem::batch_fitness(const vector_double &dvs) const
     // Check the input dvs.
     detail::bfe_check_input_dvs(*this, dvs);
 
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
+
     // Invoke the batch fitness function of the UDP, and
     // increase the fevals counter as well.
     auto retval = detail::prob_invoke_mem_batch_fitness(*this, dvs);
@@ -420,6 +509,10 @@ vector_double problem::batch_fitness(const vector_double &dvs) const
     // Check the produced vector of fitnesses.
     detail::bfe_check_output_fvs(*this, dvs, retval);
 
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    tt.record(eval_type::batch_fitness, dvs.data(), dvs.size(), retval.data(), retval.size());
+#endif
+
     return retval;
 }
 
@@ -455,12 +548,77 @@ vector_double problem::gradient(const vector_double &dv) const
 {
     // 1 - checks the decision vector
     detail::prob_check_dv(*this, dv.data(), dv.size());
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
     // 2 - compute the gradients
     vector_double retval(ptr()->gradient(dv));
     // 3 - checks the gradient vector
     check_gradient_vector(retval);
     // 4 - increments gradient evaluation counter
-    m_gevals.fetch_add(1u, std::memory_order_relaxed);
+    m_evals.increment(detail::eval_counters::gevals, 1);
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    tt.record(eval_type::gradient, dv.data(), dv.size(), retval.data(), retval.size());
+#endif
+    return retval;
+}
+
+/// Fitness and gradient.
+/**
+ * This method will compute both the fitness and the gradient of the input decision vector \p dv.
+ *
+ * If problem::has_fitness_and_gradient() returns \p true, \p dv will be forwarded to the
+ * <tt>%fitness_and_gradient()</tt> method of the UDP after sanity checks, and the returned fitness
+ * and gradient will be checked as in problem::fitness() and problem::gradient(). This allows UDPs which
+ * compute the fitness and the gradient from the same intermediate results (e.g., the solution of an adjoint
+ * problem) to avoid repeating the computation. Otherwise, this method is equivalent to calling
+ * problem::gradient() and problem::fitness().
+ *
+ * A successful call of this method will increase both the internal fitness evaluation counter (see
+ * problem::get_fevals()) and the internal gradient evaluation counter (see problem::get_gevals()).
+ *
+ * @param dv the decision vector.
+ *
+ * @return a pair containing the fitness and the gradient of \p dv.
+ *
+ * @throws std::invalid_argument if either:
+ * - the length of \p dv differs from the value returned by get_nx(), or
+ * - the length of the returned fitness vector differs from the the value returned by get_nf(), or
+ * - the returned gradient vector does not have the same size as the vector returned by
+ *   problem::gradient_sparsity().
+ * @throws not_implemented_error if the UDP does not satisfy pagmo::has_gradient and
+ * problem::has_fitness_and_gradient() returns \p false.
+ * @throws unspecified any exception thrown by the <tt>%fitness()</tt>, <tt>%gradient()</tt> or
+ * <tt>%fitness_and_gradient()</tt> methods of the UDP.
+ */
+std::pair<vector_double, vector_double> problem::fitness_and_gradient(const vector_double &dv) const
+{
+    if (!m_has_fitness_and_gradient) {
+        // NOTE: compute the gradient first, so that we do not waste a fitness
+        // evaluation if the gradient is not available.
+        auto grad = gradient(dv);
+        return std::make_pair(fitness(dv), std::move(grad));
+    }
+    // 1 - checks the decision vector
+    detail::prob_check_dv(*this, dv.data(), dv.size());
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
+    // 2 - compute fitness and gradient
+    auto retval = ptr()->fitness_and_gradient(dv);
+    // 3 - check the fitness and the gradient
+    detail::prob_check_fv(*this, retval.first.data(), retval.first.size());
+    check_gradient_vector(retval.second);
+    // 4 - increment the counters
+    increment_fevals(1);
+    m_evals.increment(detail::eval_counters::gevals, 1);
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    // NOTE: record one event per counter, so that the tracer's counts
+    // match get_fevals() and get_gevals(). Both events report the
+    // duration of the fused call.
+    tt.record(eval_type::fitness, dv.data(), dv.size(), retval.first.data(), retval.first.size());
+    tt.record(eval_type::gradient, dv.data(), dv.size(), retval.second.data(), retval.second.size());
+#endif
     return retval;
 }
 
@@ -538,12 +696,19 @@ std::vector<vector_double> problem::hessians(const vector_double &dv) const
 {
     // 1 - checks the decision vector
     detail::prob_check_dv(*this, dv.data(), dv.size());
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const detail::eval_trace_timer tt;
+#endif
     // 2 - computes the hessians
     auto retval(ptr()->hessians(dv));
     // 3 - checks the hessians
     check_hessians_vector(retval);
     // 4 - increments hessians evaluation counter
-    m_hevals.fetch_add(1u, std::memory_order_relaxed);
+    m_evals.increment(detail::eval_counters::hevals, 1);
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    // NOTE: the hessians are not contiguous in memory, they are not reported.
+    tt.record(eval_type::hessians, dv.data(), dv.size(), nullptr, 0);
+#endif
     return retval;
 }
 
@@ -950,6 +1115,64 @@ vector_double prob_invoke_mem_batch_fitness(const problem &p, const vector_doubl
     return retval;
 }
 
+// Small helper for the invocation of the UDP's fitness() *without* checks.
+// This is the trusted counterpart of problem::fitness(), meant for hot loops
+// in which dv is known to be compatible with p (e.g., because it was
+// validated by a batch check, or because it has the same size as a decision vector
+// which was already evaluated via problem::fitness()), and in which the UDP is trusted
+// to return fitness vectors of the correct size. Only the fevals counter and
+// the evaluation tracing hooks are kept.
+vector_double prob_invoke_mem_fitness(const problem &p, const vector_double &dv)
+{
+    assert(dv.size() == p.get_nx());
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    const eval_trace_timer tt;
+#endif
+
+    auto retval(p.ptr()->fitness(dv));
+
+    p.increment_fevals(1);
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    tt.record(eval_type::fitness, dv.data(), dv.size(), retval.data(), retval.size());
+#endif
+
+    return retval;
+}
+
+// Small helper for the invocation of the UDP's fitness() *without* checks on the input
+// decision vector, reading from and writing to raw buffers. dv must point to p.get_nx()
+// elements and fv to p.get_nf() writable elements. If the UDP implements fitness_into(),
+// the fitness is written directly into fv, otherwise the fitness is computed via
+// a temporary copy of dv, checked and then copied into fv.
+void prob_invoke_mem_fitness_into(const problem &p, const double *dv, double *fv)
+{
+    if (p.m_has_fitness_into) {
+#if defined(PAGMO_WITH_EVAL_TRACING)
+        const eval_trace_timer tt;
+#endif
+
+        p.ptr()->fitness_into(dv, fv);
+
+        p.increment_fevals(1);
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+        tt.record(eval_type::fitness, dv, p.get_nx(), fv, p.get_nf());
+#endif
+    } else {
+        const auto tmp = prob_invoke_mem_fitness(p, vector_double(dv, dv + p.get_nx()));
+        prob_check_fv(p, tmp.data(), tmp.size());
+        std::copy(
+#if defined(_MSC_VER)
+            tmp.begin(), tmp.end(), stdext::make_checked_array_iterator(fv, tmp.size())
+#else
+            tmp.begin(), tmp.end(), fv
+#endif
+        );
+    }
+}
+
 } // namespace detail
 
 } // namespace pagmo
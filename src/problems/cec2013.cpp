@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -66,10 +67,14 @@ cec2013::cec2013(unsigned prob_id, unsigned dim)
                     "Error: CEC2013 Test functions are only defined for prob_id in [1, 28], a prob_id of "
                         + std::to_string(prob_id) + " was detected.");
     }
-    m_origin_shift = detail::cec2013_data::shift_data;
+    // NOTE: the problem data is immutable, hence we just point into the static tables
+    // without taking ownership.
+    m_origin_shift = std::shared_ptr<const std::vector<double>>(std::shared_ptr<const std::vector<double>>{},
+                                                                &detail::cec2013_data::shift_data);
     auto it = detail::cec2013_data::MD.find(dim);
     assert(it != detail::cec2013_data::MD.end());
-    m_rotation_matrix = it->second;
+    m_rotation_matrix = std::shared_ptr<const std::vector<double>>(std::shared_ptr<const std::vector<double>>{},
+                                                                   &it->second);
 }
 
 /// Fitness computation
@@ -86,115 +91,115 @@ vector_double cec2013::fitness(const vector_double &x) const
     vector_double f(1);
     switch (m_prob_id) {
         case 1:
-            sphere_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            sphere_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += -1400.0;
             break;
         case 2:
-            ellips_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            ellips_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -1300.0;
             break;
         case 3:
-            bent_cigar_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            bent_cigar_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -1200.0;
             break;
         case 4:
-            discus_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            discus_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -1100.0;
             break;
         case 5:
-            dif_powers_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            dif_powers_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += -1000.0;
             break;
         case 6:
-            rosenbrock_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            rosenbrock_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -900.0;
             break;
         case 7:
-            schaffer_F7_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            schaffer_F7_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -800.0;
             break;
         case 8:
-            ackley_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            ackley_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -700.0;
             break;
         case 9:
-            weierstrass_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            weierstrass_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -600.0;
             break;
         case 10:
-            griewank_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            griewank_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -500.0;
             break;
         case 11:
-            rastrigin_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            rastrigin_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += -400.0;
             break;
         case 12:
-            rastrigin_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            rastrigin_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -300.0;
             break;
         case 13:
-            step_rastrigin_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            step_rastrigin_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += -200.0;
             break;
         case 14:
-            schwefel_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            schwefel_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += -100.0;
             break;
         case 15:
-            schwefel_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            schwefel_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 100.0;
             break;
         case 16:
-            katsuura_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            katsuura_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 200.0;
             break;
         case 17:
-            bi_rastrigin_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            bi_rastrigin_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += 300.0;
             break;
         case 18:
-            bi_rastrigin_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            bi_rastrigin_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 400.0;
             break;
         case 19:
-            grie_rosen_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            grie_rosen_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 500.0;
             break;
         case 20:
-            escaffer6_func(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            escaffer6_func(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 600.0;
             break;
         case 21:
-            cf01(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf01(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 700.0;
             break;
         case 22:
-            cf02(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 0);
+            cf02(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 0);
             f[0] += 800.0;
             break;
         case 23:
-            cf03(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf03(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 900.0;
             break;
         case 24:
-            cf04(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf04(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 1000.0;
             break;
         case 25:
-            cf05(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf05(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 1100.0;
             break;
         case 26:
-            cf06(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf06(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 1200.0;
             break;
         case 27:
-            cf07(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf07(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 1300.0;
             break;
         case 28:
-            cf08(&x[0], &f[0], nx, &m_origin_shift[0], &m_rotation_matrix[0], 1);
+            cf08(&x[0], &f[0], nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 1400.0;
             break;
     }
@@ -312,18 +317,37 @@ std::string cec2013::get_name() const
     return retval;
 }
 
-/// Object serialization
+/// Save to archive.
 /**
- * This method will save/load \p this into the archive \p ar.
+ * This method will save \p this into the archive \p ar.
  *
  * @param ar target archive.
  *
  * @throws unspecified any exception thrown by the serialization of primitive types.
  */
 template <typename Archive>
-void cec2013::serialize(Archive &ar, unsigned)
+void cec2013::save(Archive &ar, unsigned) const
 {
-    detail::archive(ar, m_prob_id, m_rotation_matrix, m_origin_shift, m_y, m_z);
+    // NOTE: the problem data is fully determined by the problem id and the dimension,
+    // thus we serialise only those and we re-fetch the data upon deserialisation.
+    detail::to_archive(ar, m_prob_id, static_cast<unsigned>(m_z.size()));
+}
+
+/// Load from archive.
+/**
+ * This method will load \p this from the archive \p ar.
+ *
+ * @param ar source archive.
+ *
+ * @throws unspecified any exception thrown by the deserialization of primitive types
+ * or by the constructor.
+ */
+template <typename Archive>
+void cec2013::load(Archive &ar, unsigned)
+{
+    unsigned prob_id, dim;
+    detail::from_archive(ar, prob_id, dim);
+    *this = cec2013(prob_id, dim);
 }
 
 // For the coverage analysis we do not cover the code below as its derived from a third party source
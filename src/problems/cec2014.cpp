@@ -26,18 +26,35 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <pagmo/config.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
 #include <pagmo/problems/cec2014.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/types.hpp>
 
+#if defined(PAGMO_WITH_EIGEN3)
+
+#include <pagmo/detail/eigen.hpp>
+
+#endif
+
 #include "cec2014_data.hpp"
 
 namespace pagmo
@@ -51,6 +68,72 @@ constexpr double INF = 1.0e99;
 constexpr double E = 2.7182818284590452353602874713526625;
 constexpr double PI = 3.1415926535897932384626433832795029;
 
+// The shift data stored in the static tables contains rows of 100 elements, of which
+// only the first dim elements are used. The trimmed-down version is computed once per
+// (prob_id, dim) pair and then shared among all the cec2014 instances.
+std::shared_ptr<const vector_double> get_shared_origin_shift(unsigned func_num, unsigned dim)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<unsigned, unsigned>, std::shared_ptr<const vector_double>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &retval = cache[std::make_pair(func_num, dim)];
+    if (!retval) {
+        const auto &shift_data = detail::cec2014_data::shift_data.find(func_num)->second;
+        // Uses first dim elements of each line for multidimensional functions (id > 23)
+        auto origin_shift = std::make_shared<vector_double>();
+        origin_shift->reserve(shift_data.size());
+        for (decltype(shift_data.size()) i = 0; i < shift_data.size(); ++i) {
+            if (i % 100u < dim) {
+                origin_shift->push_back(shift_data[i]);
+            }
+        }
+        retval = std::move(origin_shift);
+    }
+    return retval;
+}
+
+// Number of decision vectors per block in the batch fitness evaluation.
+constexpr std::size_t batch_block_size = 64u;
+
+// Shift and rotate a block of n decision vectors, stored contiguously in xs, into zs.
+// This computes zs = (xs - Os) * Mr^T, where xs and zs are n x nx row-major matrices.
+// NOTE: differently from sr_func(), the shrinking to the original search range is not applied.
+void batch_shift_rotate(const double *xs, double *zs, std::size_t n, unsigned nx, const double *Os, const double *Mr)
+{
+    vector_double ys(n * nx);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (unsigned j = 0; j < nx; ++j) {
+            ys[i * nx + j] = xs[i * nx + j] - Os[j];
+        }
+    }
+#if defined(PAGMO_WITH_EIGEN3)
+    using mat_t = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    const Eigen::Map<const mat_t> Y(ys.data(), static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(nx));
+    const Eigen::Map<const mat_t> M(Mr, static_cast<Eigen::Index>(nx), static_cast<Eigen::Index>(nx));
+    Eigen::Map<mat_t> Z(zs, static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(nx));
+    Z.noalias() = Y * M.transpose();
+#else
+    // Blocked fallback: each row of the rotation matrix is loaded once per
+    // block of decision vectors, and reused for all of them.
+    constexpr std::size_t block = 8u;
+    for (std::size_t ib = 0; ib < n; ib += block) {
+        const auto ie = std::min(ib + block, n);
+        for (unsigned k = 0; k < nx; ++k) {
+            const double *m_row = Mr + static_cast<std::size_t>(k) * nx;
+            for (auto i = ib; i < ie; ++i) {
+                const double *y_row = ys.data() + i * nx;
+                double acc = 0;
+                for (unsigned j = 0; j < nx; ++j) {
+                    acc += y_row[j] * m_row[j];
+                }
+                zs[i * nx + k] = acc;
+            }
+        }
+    }
+#endif
+}
+
 } // namespace
 
 cec2014::cec2014(unsigned prob_id, unsigned dim) : m_z(dim), m_y(dim), func_num(prob_id)
@@ -71,33 +154,20 @@ cec2014::cec2014(unsigned prob_id, unsigned dim) : m_z(dim), m_y(dim), func_num(
     }
 
     /* Load Rotation Matrix */
-    auto rotation_func_it = detail::cec2014_data::rotation_data.find(func_num);
-    auto rotation_data_dim = rotation_func_it->second;
-    auto rotation_dim_it = rotation_data_dim.find(dim);
-    m_rotation_matrix = rotation_dim_it->second;
+    // NOTE: the rotation and shuffle data are used as-is, hence we just point
+    // into the static tables without taking ownership.
+    const auto &rotation_data_dim = detail::cec2014_data::rotation_data.find(func_num)->second;
+    m_rotation_matrix = std::shared_ptr<const vector_double>(std::shared_ptr<const vector_double>{},
+                                                             &rotation_data_dim.find(dim)->second);
 
     /* Load shift_data */
-    auto loader_it = detail::cec2014_data::shift_data.find(func_num);
-    m_origin_shift = loader_it->second;
-
-    // Uses first dim elements of each line for multidimensional functions (id > 23)
-    auto it = m_origin_shift.begin();
-    int i = -1;
-    while (it != m_origin_shift.end()) {
-        i++;
-        if ((i % 100) >= static_cast<int>(dim)) {
-            it = m_origin_shift.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    m_origin_shift = get_shared_origin_shift(func_num, dim);
 
     /* Load shuffle data */
     if (((func_num >= 17) && (func_num <= 22)) || (func_num == 29) || (func_num == 30)) {
-        auto shuffle_func_it = detail::cec2014_data::shuffle_data.find(func_num);
-        auto shuffle_data_dim = shuffle_func_it->second;
-        auto shuffle_dim_it = shuffle_data_dim.find(dim);
-        m_shuffle = shuffle_dim_it->second;
+        const auto &shuffle_data_dim = detail::cec2014_data::shuffle_data.find(func_num)->second;
+        m_shuffle = std::shared_ptr<const std::vector<int>>(std::shared_ptr<const std::vector<int>>{},
+                                                            &shuffle_data_dim.find(dim)->second);
     }
 }
 
@@ -126,131 +196,202 @@ std::pair<vector_double, vector_double> cec2014::get_bounds() const
 vector_double cec2014::fitness(const vector_double &x) const
 {
     vector_double f(1);
+    fitness_impl(x.data(), f.data(), false);
+    return f;
+}
+
+/// Batch fitness computation
+/**
+ * Computes the fitnesses of a batch of decision vectors stored contiguously in \p xs
+ * (see problem::batch_fitness()).
+ *
+ * For the problems whose definition involves a single shift and rotation of the whole
+ * decision vector (that is, all the problems except the composition functions and the
+ * non-rotated problems 8 and 10), the shift and rotation are applied to blocks of decision
+ * vectors at once as a matrix-matrix product. If pagmo was built with Eigen3 support, the
+ * product is computed via Eigen, otherwise a cache-blocked implementation is used.
+ * The blocks are processed in parallel.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    Because of the different order of the floating-point operations, the fitnesses computed by this
+ *    method may differ from the output of :cpp:func:`~pagmo::cec2014::fitness()` in the last few bits.
+ *
+ * \endverbatim
+ *
+ * @param xs the input decision vectors.
+ *
+ * @return the fitnesses of \p xs.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers or by
+ * threading primitives.
+ */
+vector_double cec2014::batch_fitness(const vector_double &xs) const
+{
+    const auto nx = static_cast<unsigned>(m_z.size());
+    // NOTE: the input is assumed to be sane, as it is checked by problem::batch_fitness().
+    assert(xs.size() % nx == 0u);
+    const auto n_dvs = xs.size() / nx;
+    const bool pre_transform = !((func_num == 8u) || (func_num == 10u) || (func_num >= 23u));
+
+    vector_double retval(n_dvs);
+
+    using range_t = tbb::blocked_range<decltype(xs.size())>;
+    tbb::parallel_for(
+        range_t(0, n_dvs, batch_block_size), [this, &xs, &retval, nx, pre_transform](const range_t &range) {
+            // NOTE: the fitness functions use the auxiliary vectors as scratch space,
+            // thus we need a local copy of the problem. The copy is cheap, as the
+            // problem data is shared.
+            const cec2014 local(*this);
+            const auto x_ptr = xs.data() + range.begin() * nx;
+            const auto n = range.end() - range.begin();
+            if (pre_transform) {
+                // Shift and rotate the whole block at once, then evaluate
+                // the rest of the function on the transformed vectors.
+                vector_double zs(n * nx);
+                batch_shift_rotate(x_ptr, zs.data(), n, nx, m_origin_shift->data(), m_rotation_matrix->data());
+                for (decltype(xs.size()) i = 0; i < n; ++i) {
+                    local.fitness_impl(zs.data() + i * nx, retval.data() + range.begin() + i, true);
+                }
+            } else {
+                for (decltype(xs.size()) i = 0; i < n; ++i) {
+                    local.fitness_impl(x_ptr + i * nx, retval.data() + range.begin() + i, false);
+                }
+            }
+        });
+
+    return retval;
+}
+
+void cec2014::fitness_impl(const double *x, double *f, bool pre_transformed) const
+{
     auto nx = static_cast<unsigned>(m_z.size());
+    // NOTE: if the input has already been shifted and rotated, we must only apply
+    // the shrinking to the original search range.
+    const int s_flag = pre_transformed ? 0 : 1, r_flag = s_flag;
     switch (func_num) {
         case 1:
-            ellips_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            ellips_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 100.0;
             break;
         case 2:
-            bent_cigar_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            bent_cigar_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 200.0;
             break;
         case 3:
-            discus_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            discus_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 300.0;
             break;
         case 4:
-            rosenbrock_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            rosenbrock_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 400.0;
             break;
         case 5:
-            ackley_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            ackley_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 500.0;
             break;
         case 6:
-            weierstrass_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            weierstrass_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 600.0;
             break;
         case 7:
-            griewank_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            griewank_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 700.0;
             break;
         case 8:
-            rastrigin_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 0);
+            rastrigin_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 0);
             f[0] += 800.0;
             break;
         case 9:
-            rastrigin_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            rastrigin_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 900.0;
             break;
         case 10:
-            schwefel_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 0);
+            schwefel_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1, 0);
             f[0] += 1000.0;
             break;
         case 11:
-            schwefel_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            schwefel_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1100.0;
             break;
         case 12:
-            katsuura_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            katsuura_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1200.0;
             break;
         case 13:
-            happycat_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            happycat_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1300.0;
             break;
         case 14:
-            hgbat_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            hgbat_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1400.0;
             break;
         case 15:
-            grie_rosen_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            grie_rosen_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1500.0;
             break;
         case 16:
-            escaffer6_func(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1, 1);
+            escaffer6_func(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), s_flag, r_flag);
             f[0] += 1600.0;
             break;
         case 17:
-            hf01(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf01(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 1700.0;
             break;
         case 18:
-            hf02(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf02(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 1800.0;
             break;
         case 19:
-            hf03(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf03(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 1900.0;
             break;
         case 20:
-            hf04(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf04(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 2000.0;
             break;
         case 21:
-            hf05(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf05(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 2100.0;
             break;
         case 22:
-            hf06(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1, 1);
+            hf06(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), s_flag, r_flag);
             f[0] += 2200.0;
             break;
         case 23:
-            cf01(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf01(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2300.0;
             break;
         case 24:
-            cf02(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf02(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2400.0;
             break;
         case 25:
-            cf03(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf03(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2500.0;
             break;
         case 26:
-            cf04(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf04(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2600.0;
             break;
         case 27:
-            cf05(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf05(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2700.0;
             break;
         case 28:
-            cf06(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), 1);
+            cf06(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), 1);
             f[0] += 2800.0;
             break;
         case 29:
-            cf07(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1);
+            cf07(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1);
             f[0] += 2900.0;
             break;
         case 30:
-            cf08(x.data(), f.data(), nx, m_origin_shift.data(), m_rotation_matrix.data(), m_shuffle.data(), 1);
+            cf08(x, f, nx, m_origin_shift->data(), m_rotation_matrix->data(), m_shuffle->data(), 1);
             f[0] += 3000.0;
             break;
     }
-
-    return f;
 }
 
 /// Problem name
@@ -356,18 +497,37 @@ std::string cec2014::get_name() const
     return retval;
 }
 
-/// Object serialization
+/// Save to archive.
 /**
- * This method will save/load \p this into the archive \p ar.
+ * This method will save \p this into the archive \p ar.
  *
  * @param ar target archive.
  *
  * @throws unspecified any exception thrown by the serialization of primitive types.
  */
 template <typename Archive>
-void cec2014::serialize(Archive &ar, unsigned)
+void cec2014::save(Archive &ar, unsigned) const
+{
+    // NOTE: the problem data is fully determined by the problem id and the dimension,
+    // thus we serialise only those and we re-fetch the data upon deserialisation.
+    detail::to_archive(ar, func_num, static_cast<unsigned>(m_z.size()));
+}
+
+/// Load from archive.
+/**
+ * This method will load \p this from the archive \p ar.
+ *
+ * @param ar source archive.
+ *
+ * @throws unspecified any exception thrown by the deserialization of primitive types
+ * or by the constructor.
+ */
+template <typename Archive>
+void cec2014::load(Archive &ar, unsigned)
 {
-    detail::archive(ar, func_num, m_rotation_matrix, m_origin_shift, m_shuffle, m_y, m_z);
+    unsigned prob_id, dim;
+    detail::from_archive(ar, prob_id, dim);
+    *this = cec2014(prob_id, dim);
 }
 
 // For the coverage analysis we do not cover the code below as its derived from a third party source
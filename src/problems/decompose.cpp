@@ -26,6 +26,7 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <algorithm>
 #include <cmath>
 #include <initializer_list>
 #include <numeric>
@@ -267,12 +268,16 @@ void decompose::set_seed(unsigned seed)
 /// Problem's thread safety level.
 /**
  * The thread safety of a meta-problem is defined by the thread safety of the inner pagmo::problem.
+ * If the adaptation of the ideal point is active, the reference point is modified
+ * by the fitness evaluations, and the thread safety level cannot be higher than thread_safety::basic.
  *
- * @return the thread safety level of the inner pagmo::problem.
+ * @return the thread safety level of the inner pagmo::problem, capped to thread_safety::basic
+ * if the adaptation of the ideal point is active.
  */
 thread_safety decompose::get_thread_safety() const
 {
-    return m_problem.get_thread_safety();
+    return m_adapt_ideal ? std::min(m_problem.get_thread_safety(), thread_safety::basic)
+                         : m_problem.get_thread_safety();
 }
 
 /// Getter for the inner problem.
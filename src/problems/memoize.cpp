@@ -0,0 +1,755 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pagmo/detail/custom_comparisons.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/memoize.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=const"
+#endif
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// A bounded LRU map from decision vectors to vectors of doubles.
+// NOTE: this class is not thread-safe, the synchronisation
+// is provided by memoize_cache.
+class lru_vf_map
+{
+    using key_ref = std::reference_wrapper<const vector_double>;
+    struct key_hash {
+        std::size_t operator()(const key_ref &k) const
+        {
+            return hash_vf<double>{}(k.get());
+        }
+    };
+    struct key_equal {
+        bool operator()(const key_ref &a, const key_ref &b) const
+        {
+            return equal_to_vf<double>{}(a.get(), b.get());
+        }
+    };
+    // The entries, sorted from the most recently used to the least recently used.
+    using list_t = std::list<std::pair<vector_double, vector_double>>;
+
+public:
+    explicit lru_vf_map(std::size_t capacity) : m_capacity(capacity)
+    {
+        assert(m_capacity > 0u);
+    }
+    // Look up x. If found, copy the associated value into out,
+    // mark the entry as the most recently used one and return true.
+    bool get(const vector_double &x, vector_double &out)
+    {
+        const auto it = m_map.find(std::cref(x));
+        if (it == m_map.end()) {
+            return false;
+        }
+        m_list.splice(m_list.begin(), m_list, it->second);
+        out = it->second->second;
+        return true;
+    }
+    // Insert or update the value associated to x, evicting the least
+    // recently used entry if the capacity is exceeded.
+    void put(const vector_double &x, const vector_double &v)
+    {
+        const auto it = m_map.find(std::cref(x));
+        if (it != m_map.end()) {
+            it->second->second = v;
+            m_list.splice(m_list.begin(), m_list, it->second);
+            return;
+        }
+        m_list.emplace_front(x, v);
+        try {
+            // NOTE: the key of the map refers to the (stable) storage of the list node.
+            m_map.emplace(std::cref(m_list.front().first), m_list.begin());
+        } catch (...) {
+            m_list.pop_front();
+            throw;
+        }
+        if (m_list.size() > m_capacity) {
+            m_map.erase(std::cref(m_list.back().first));
+            m_list.pop_back();
+        }
+    }
+    std::size_t size() const
+    {
+        return m_list.size();
+    }
+    void clear()
+    {
+        m_map.clear();
+        m_list.clear();
+    }
+
+private:
+    std::size_t m_capacity;
+    list_t m_list;
+    std::unordered_map<key_ref, list_t::iterator, key_hash, key_equal> m_map;
+};
+
+} // namespace
+
+// The cache used by memoize: an LRU map for the fitnesses,
+// one for the gradients, the hit/miss counters and a mutex
+// protecting the maps.
+struct memoize_cache {
+    explicit memoize_cache(std::size_t capacity)
+        : m_fitness(capacity), m_gradient(capacity), m_hits(0), m_misses(0), m_ghits(0), m_gmisses(0)
+    {
+    }
+    std::mutex m_mutex;
+    lru_vf_map m_fitness;
+    lru_vf_map m_gradient;
+    std::atomic<unsigned long long> m_hits;
+    std::atomic<unsigned long long> m_misses;
+    std::atomic<unsigned long long> m_ghits;
+    std::atomic<unsigned long long> m_gmisses;
+};
+
+} // namespace detail
+
+/// Default constructor.
+/**
+ * The constructor will initialize a pagmo::memoize wrapping a default-constructed pagmo::problem,
+ * with a cache capacity of 1000 entries and no gradient caching.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+memoize::memoize() : m_capacity(1000u), m_cache_gradient(false)
+{
+    generic_ctor_impl();
+}
+
+void memoize::generic_ctor_impl()
+{
+    if (!m_capacity) {
+        pagmo_throw(std::invalid_argument, "The capacity of the cache of a memoize problem cannot be zero");
+    }
+    m_cache = std::make_shared<detail::memoize_cache>(m_capacity);
+}
+
+/// Fitness.
+/**
+ * If \p x is in the cache, the stored fitness is returned. Otherwise, the fitness computation is
+ * forwarded to the inner problem and the result is stored in the cache.
+ *
+ * @param x the decision vector.
+ *
+ * @return the fitness of \p x.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers,
+ * threading primitives, or by problem::fitness().
+ */
+vector_double memoize::fitness(const vector_double &x) const
+{
+    vector_double retval;
+    {
+        std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+        if (m_cache->m_fitness.get(x, retval)) {
+            ++m_cache->m_hits;
+            return retval;
+        }
+    }
+    ++m_cache->m_misses;
+    // NOTE: the inner problem is invoked without holding the lock,
+    // so that concurrent evaluations of different points can proceed.
+    retval = m_problem.fitness(x);
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    m_cache->m_fitness.put(x, retval);
+    return retval;
+}
+
+/// Batch fitness.
+/**
+ * The decision vectors in \p xs which are not in the cache are evaluated in a single call
+ * to the batch fitness function of the inner problem, and the results are stored in the cache.
+ *
+ * @param xs the input decision vectors.
+ *
+ * @return the fitnesses of \p xs.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers,
+ * threading primitives, or by problem::batch_fitness().
+ */
+vector_double memoize::batch_fitness(const vector_double &xs) const
+{
+    const auto nx = m_problem.get_nx();
+    const auto nf = m_problem.get_nf();
+    // Assume xs is sane.
+    assert(xs.size() % nx == 0u);
+    const auto n_dvs = xs.size() / nx;
+
+    vector_double retval(n_dvs * nf), x(nx), f;
+    // The missing dvs and their indices in xs.
+    vector_double xs_missing;
+    std::vector<vector_double::size_type> missing_idx;
+    {
+        std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+        for (decltype(xs.size()) i = 0; i < n_dvs; ++i) {
+            std::copy(xs.data() + i * nx, xs.data() + (i + 1u) * nx, x.data());
+            if (m_cache->m_fitness.get(x, f)) {
+                assert(f.size() == nf);
+                std::copy(f.begin(), f.end(), retval.data() + i * nf);
+            } else {
+                missing_idx.push_back(i);
+                xs_missing.insert(xs_missing.end(), x.begin(), x.end());
+            }
+        }
+    }
+    m_cache->m_hits += n_dvs - missing_idx.size();
+    if (missing_idx.empty()) {
+        return retval;
+    }
+    m_cache->m_misses += missing_idx.size();
+
+    // Invoke batch_fitness() from m_problem on the missing dvs.
+    // NOTE: in non-debug mode, use the helper that avoids calling the checks in m_problem.batch_fitness().
+    // The memoize metaproblem does not change the dimensionality of the problem
+    // or of the fitness, thus all the checks run by m_problem.batch_fitness()
+    // are redundant.
+#if defined(NDEBUG)
+    const auto fs_missing = detail::prob_invoke_mem_batch_fitness(m_problem, xs_missing);
+#else
+    const auto fs_missing = m_problem.batch_fitness(xs_missing);
+#endif
+
+    f.resize(nf);
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    for (decltype(missing_idx.size()) j = 0; j < missing_idx.size(); ++j) {
+        const auto i = missing_idx[j];
+        std::copy(fs_missing.data() + j * nf, fs_missing.data() + (j + 1u) * nf, retval.data() + i * nf);
+        std::copy(xs_missing.data() + j * nx, xs_missing.data() + (j + 1u) * nx, x.data());
+        std::copy(fs_missing.data() + j * nf, fs_missing.data() + (j + 1u) * nf, f.data());
+        m_cache->m_fitness.put(x, f);
+    }
+    return retval;
+}
+
+/// Check if the inner problem can compute fitnesses in batch mode.
+/**
+ * @return the output of the <tt>has_batch_fitness()</tt> member function invoked
+ * by the inner problem.
+ */
+bool memoize::has_batch_fitness() const
+{
+    return m_problem.has_batch_fitness();
+}
+
+/// Box-bounds.
+/**
+ * @return the box-bounds of the inner problem.
+ *
+ * @throws unspecified any exception thrown by problem::get_bounds().
+ */
+std::pair<vector_double, vector_double> memoize::get_bounds() const
+{
+    return m_problem.get_bounds();
+}
+
+/// Number of objectives.
+/**
+ * @return the number of objectives of the inner problem.
+ */
+vector_double::size_type memoize::get_nobj() const
+{
+    return m_problem.get_nobj();
+}
+
+/// Equality constraint dimension.
+/**
+ * @return the number of equality constraints of the inner problem.
+ */
+vector_double::size_type memoize::get_nec() const
+{
+    return m_problem.get_nec();
+}
+
+/// Inequality constraint dimension.
+/**
+ * @return the number of inequality constraints of the inner problem.
+ */
+vector_double::size_type memoize::get_nic() const
+{
+    return m_problem.get_nic();
+}
+
+/// Integer dimension
+/**
+ * @return the integer dimension of the inner problem.
+ */
+vector_double::size_type memoize::get_nix() const
+{
+    return m_problem.get_nix();
+}
+
+/// Checks if the inner problem has gradients.
+/**
+ * The <tt>has_gradient()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the gradient in the inner problem.
+ */
+bool memoize::has_gradient() const
+{
+    return m_problem.has_gradient();
+}
+
+/// Gradients.
+/**
+ * If gradient caching was requested upon construction and \p x is in the gradient cache,
+ * the stored gradient is returned. Otherwise, the gradient computation is forwarded to the inner problem
+ * (and, if gradient caching is active, the result is stored in the cache).
+ *
+ * @param x the decision vector.
+ *
+ * @return the gradient of the fitness function.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers,
+ * threading primitives, or by <tt>problem::gradient()</tt>.
+ */
+vector_double memoize::gradient(const vector_double &x) const
+{
+    if (!m_cache_gradient) {
+        return m_problem.gradient(x);
+    }
+    vector_double retval;
+    {
+        std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+        if (m_cache->m_gradient.get(x, retval)) {
+            ++m_cache->m_ghits;
+            return retval;
+        }
+    }
+    ++m_cache->m_gmisses;
+    retval = m_problem.gradient(x);
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    m_cache->m_gradient.put(x, retval);
+    return retval;
+}
+
+/// Checks if the inner problem has a fused fitness and gradient computation.
+/**
+ * The <tt>has_fitness_and_gradient()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the fused fitness and gradient computation in the inner problem.
+ */
+bool memoize::has_fitness_and_gradient() const
+{
+    return m_problem.has_fitness_and_gradient();
+}
+
+/// Fitness and gradient.
+/**
+ * The fitness and the gradient of \p x are looked up in the cache(s). If the fitness is not in the cache,
+ * both the fitness and the gradient are computed via problem::fitness_and_gradient() of the inner problem.
+ * Otherwise, only the gradient is computed (if not cached) via problem::gradient(). The results
+ * are then stored in the cache(s).
+ *
+ * @param x the decision vector.
+ *
+ * @return the fitness and the gradient of \p x.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers,
+ * threading primitives, problem::fitness_and_gradient() or problem::gradient().
+ */
+std::pair<vector_double, vector_double> memoize::fitness_and_gradient(const vector_double &x) const
+{
+    std::pair<vector_double, vector_double> retval;
+    bool f_hit, g_hit = false;
+    {
+        std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+        f_hit = m_cache->m_fitness.get(x, retval.first);
+        if (m_cache_gradient) {
+            g_hit = m_cache->m_gradient.get(x, retval.second);
+        }
+    }
+    ++(f_hit ? m_cache->m_hits : m_cache->m_misses);
+    if (m_cache_gradient) {
+        ++(g_hit ? m_cache->m_ghits : m_cache->m_gmisses);
+    }
+    if (f_hit && g_hit) {
+        return retval;
+    }
+    if (f_hit) {
+        retval.second = m_problem.gradient(x);
+    } else {
+        retval = m_problem.fitness_and_gradient(x);
+    }
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    if (!f_hit) {
+        m_cache->m_fitness.put(x, retval.first);
+    }
+    if (m_cache_gradient) {
+        m_cache->m_gradient.put(x, retval.second);
+    }
+    return retval;
+}
+
+/// Checks if the inner problem has gradient sparisty implemented.
+/**
+ * The <tt>has_gradient_sparsity()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the gradient sparisty in the inner problem.
+ */
+bool memoize::has_gradient_sparsity() const
+{
+    return m_problem.has_gradient_sparsity();
+}
+
+/// Gradient sparsity.
+/**
+ * The <tt>gradient_sparsity</tt> computation is forwarded to the inner problem.
+ *
+ * @return the gradient sparsity of the inner problem.
+ */
+sparsity_pattern memoize::gradient_sparsity() const
+{
+    return m_problem.gradient_sparsity();
+}
+
+/// Checks if the inner problem has hessians.
+/**
+ * The <tt>has_hessians()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the hessians in the inner problem.
+ */
+bool memoize::has_hessians() const
+{
+    return m_problem.has_hessians();
+}
+
+/// Hessians.
+/**
+ * The <tt>hessians()</tt> computation is forwarded to the inner problem (hessians are never cached).
+ *
+ * @param x the decision vector.
+ *
+ * @return the hessians of the fitness function computed at \p x.
+ *
+ * @throws unspecified any exception thrown by problem::hessians().
+ */
+std::vector<vector_double> memoize::hessians(const vector_double &x) const
+{
+    return m_problem.hessians(x);
+}
+
+/// Checks if the inner problem has hessians sparisty implemented.
+/**
+ * The <tt>has_hessians_sparsity()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the hessians sparisty in the inner problem.
+ */
+bool memoize::has_hessians_sparsity() const
+{
+    return m_problem.has_hessians_sparsity();
+}
+
+/// Hessians sparsity.
+/**
+ * The <tt>hessians_sparsity()</tt> computation is forwarded to the inner problem.
+ *
+ * @return the hessians sparsity of the inner problem.
+ */
+std::vector<sparsity_pattern> memoize::hessians_sparsity() const
+{
+    return m_problem.hessians_sparsity();
+}
+
+/// Calls <tt>has_set_seed()</tt> of the inner problem.
+/**
+ * Calls the method <tt>has_set_seed()</tt> of the inner problem.
+ *
+ * @return a flag signalling wether the inner problem is stochastic.
+ */
+bool memoize::has_set_seed() const
+{
+    return m_problem.has_set_seed();
+}
+
+/// Calls <tt>set_seed()</tt> of the inner problem.
+/**
+ * Calls the method <tt>set_seed()</tt> of the inner problem. Since the cached values are not valid
+ * anymore after a change of seed, \p this will be given a new, empty cache (the cache shared
+ * with the copies of \p this is left untouched).
+ *
+ * @param seed seed to be set.
+ *
+ * @throws unspecified any exception thrown by the method <tt>set_seed()</tt> of the inner problem,
+ * or by memory errors in standard containers.
+ */
+void memoize::set_seed(unsigned seed)
+{
+    m_problem.set_seed(seed);
+    m_cache = std::make_shared<detail::memoize_cache>(m_capacity);
+}
+
+/// Problem name
+/**
+ * This method will add <tt>[memoized]</tt> to the name provided by the inner problem.
+ *
+ * @return a string containing the problem name.
+ *
+ * @throws unspecified any exception thrown by <tt>problem::get_name()</tt> or memory errors in standard classes.
+ */
+std::string memoize::get_name() const
+{
+    return m_problem.get_name() + " [memoized]";
+}
+
+/// Extra info
+/**
+ * This method will append a description of the state of the cache (capacity, size and
+ * hit/miss counters) to the extra info provided by the inner problem.
+ *
+ * @return a string containing extra info on the problem.
+ *
+ * @throws unspecified any exception thrown by problem::get_extra_info(), the public interface of
+ * \p std::ostringstream or memory errors in standard classes.
+ */
+std::string memoize::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\n\tCache capacity: " << m_capacity;
+    oss << "\n\tCache size: " << get_cache_size();
+    oss << "\n\tFitness cache hits: " << get_hits();
+    oss << "\n\tFitness cache misses: " << get_misses();
+    if (m_cache_gradient) {
+        oss << "\n\tGradient cache hits: " << get_gradient_hits();
+        oss << "\n\tGradient cache misses: " << get_gradient_misses();
+    }
+    return m_problem.get_extra_info() + oss.str();
+}
+
+/// Problem's thread safety level.
+/**
+ * The thread safety of a meta-problem is defined by the thread safety of the inner pagmo::problem.
+ *
+ * @return the thread safety level of the inner pagmo::problem.
+ */
+thread_safety memoize::get_thread_safety() const
+{
+    return m_problem.get_thread_safety();
+}
+
+/// Getter for the inner problem.
+/**
+ * Returns a const reference to the inner pagmo::problem.
+ *
+ * @return a const reference to the inner pagmo::problem.
+ */
+const problem &memoize::get_inner_problem() const
+{
+    return m_problem;
+}
+
+/// Getter for the inner problem.
+/**
+ * Returns a reference to the inner pagmo::problem.
+ *
+ * Since the inner problem may be modified via the returned reference, the cached values
+ * cannot be trusted anymore: as in memoize::set_seed(), \p this will be given a new, empty cache
+ * (the cache shared with the copies of \p this is left untouched).
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    The ability to extract a non const reference is provided only in order to allow to call
+ *    non-const methods on the internal :cpp:class:`pagmo::problem` instance. Assigning a new
+ *    :cpp:class:`pagmo::problem` via this reference is undefined behaviour. If the non-const
+ *    methods alter the fitness of the inner problem after the cache of ``this`` has been
+ *    populated again, :cpp:func:`pagmo::memoize::clear_cache()` must be called afterwards.
+ *
+ * \endverbatim
+ *
+ * @return a reference to the inner pagmo::problem.
+ *
+ * @throws unspecified any exception thrown by memory errors in standard containers.
+ */
+problem &memoize::get_inner_problem()
+{
+    m_cache = std::make_shared<detail::memoize_cache>(m_capacity);
+    return m_problem;
+}
+
+/// Cache capacity.
+/**
+ * @return the maximum number of entries that can be stored in the fitness (or gradient) cache.
+ */
+std::size_t memoize::get_capacity() const
+{
+    return m_capacity;
+}
+
+/// Gradient caching flag.
+/**
+ * @return \p true if the gradients are cached, \p false otherwise.
+ */
+bool memoize::get_cache_gradient() const
+{
+    return m_cache_gradient;
+}
+
+/// Number of fitness cache hits.
+/**
+ * @return the number of fitness evaluations served by the cache.
+ */
+unsigned long long memoize::get_hits() const
+{
+    return m_cache->m_hits.load();
+}
+
+/// Number of fitness cache misses.
+/**
+ * @return the number of fitness evaluations forwarded to the inner problem.
+ */
+unsigned long long memoize::get_misses() const
+{
+    return m_cache->m_misses.load();
+}
+
+/// Number of gradient cache hits.
+/**
+ * @return the number of gradient evaluations served by the cache.
+ */
+unsigned long long memoize::get_gradient_hits() const
+{
+    return m_cache->m_ghits.load();
+}
+
+/// Number of gradient cache misses.
+/**
+ * @return the number of gradient evaluations forwarded to the inner problem while
+ * gradient caching is active.
+ */
+unsigned long long memoize::get_gradient_misses() const
+{
+    return m_cache->m_gmisses.load();
+}
+
+/// Number of entries currently stored in the fitness cache.
+/**
+ * @return the number of entries currently stored in the fitness cache.
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+std::size_t memoize::get_cache_size() const
+{
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    return m_cache->m_fitness.size();
+}
+
+/// Clear the cache(s) and reset the counters.
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    As the cache is shared among copies of a :cpp:class:`pagmo::memoize` object, this
+ *    method will clear the cache for all the copies of ``this``.
+ *
+ * \endverbatim
+ *
+ * @throws unspecified any exception thrown by threading primitives.
+ */
+void memoize::clear_cache()
+{
+    std::lock_guard<std::mutex> lock(m_cache->m_mutex);
+    m_cache->m_fitness.clear();
+    m_cache->m_gradient.clear();
+    m_cache->m_hits.store(0);
+    m_cache->m_misses.store(0);
+    m_cache->m_ghits.store(0);
+    m_cache->m_gmisses.store(0);
+}
+
+/// Save to archive.
+/**
+ * This method will save \p this into the archive \p ar. The content of the cache
+ * is not saved.
+ *
+ * @param ar target archive.
+ *
+ * @throws unspecified any exception thrown by the serialization of the inner problem and of primitive types.
+ */
+template <typename Archive>
+void memoize::save(Archive &ar, unsigned) const
+{
+    detail::to_archive(ar, m_problem, m_capacity, m_cache_gradient);
+}
+
+/// Load from archive.
+/**
+ * This method will load a pagmo::memoize from \p ar into \p this. \p this will
+ * be given a new, empty cache.
+ *
+ * @param ar source archive.
+ *
+ * @throws unspecified any exception thrown by the deserialization of the inner problem and of primitive types,
+ * or by memory errors in standard containers.
+ */
+template <typename Archive>
+void memoize::load(Archive &ar, unsigned)
+{
+    memoize tmp;
+    detail::from_archive(ar, tmp.m_problem, tmp.m_capacity, tmp.m_cache_gradient);
+    tmp.generic_ctor_impl();
+    *this = std::move(tmp);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_PROBLEM_IMPLEMENT(pagmo::memoize)
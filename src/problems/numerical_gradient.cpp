@@ -0,0 +1,378 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/bfe.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/numerical_gradient.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/gradients_and_hessians.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=const"
+#endif
+
+namespace pagmo
+{
+
+/// Default constructor.
+/**
+ * The constructor will initialize a pagmo::numerical_gradient wrapping a default-constructed pagmo::problem,
+ * using a default-constructed pagmo::bfe and the low-order formula with a step of \f$10^{-8}\f$.
+ */
+numerical_gradient::numerical_gradient() : m_dx(1e-8), m_high_order(false) {}
+
+void numerical_gradient::generic_ctor_impl()
+{
+    if (!std::isfinite(m_dx) || m_dx <= 0.) {
+        pagmo_throw(std::invalid_argument,
+                    "The finite difference step of a numerical_gradient problem must be finite and positive, but a "
+                    "value of "
+                        + std::to_string(m_dx) + " was provided instead");
+    }
+}
+
+/// Fitness.
+/**
+ * The fitness computation is forwarded to the inner problem.
+ *
+ * @param x the decision vector.
+ *
+ * @return the fitness of \p x.
+ *
+ * @throws unspecified any exception thrown by problem::fitness().
+ */
+vector_double numerical_gradient::fitness(const vector_double &x) const
+{
+    return m_problem.fitness(x);
+}
+
+/// Batch fitness.
+/**
+ * The batch fitness computation is forwarded to the inner problem.
+ *
+ * @param xs the input decision vectors.
+ *
+ * @return the fitnesses of \p xs.
+ *
+ * @throws unspecified any exception thrown by problem::batch_fitness().
+ */
+vector_double numerical_gradient::batch_fitness(const vector_double &xs) const
+{
+    // NOTE: in non-debug mode, use the helper that avoids calling the checks in m_problem.batch_fitness().
+    // The numerical_gradient metaproblem does not change the dimensionality of the problem
+    // or of the fitness, thus all the checks run by m_problem.batch_fitness()
+    // are redundant.
+#if defined(NDEBUG)
+    return detail::prob_invoke_mem_batch_fitness(m_problem, xs);
+#else
+    return m_problem.batch_fitness(xs);
+#endif
+}
+
+/// Check if the inner problem can compute fitnesses in batch mode.
+/**
+ * @return the output of the <tt>has_batch_fitness()</tt> member function invoked
+ * by the inner problem.
+ */
+bool numerical_gradient::has_batch_fitness() const
+{
+    return m_problem.has_batch_fitness();
+}
+
+/// Box-bounds.
+/**
+ * @return the box-bounds of the inner problem.
+ *
+ * @throws unspecified any exception thrown by problem::get_bounds().
+ */
+std::pair<vector_double, vector_double> numerical_gradient::get_bounds() const
+{
+    return m_problem.get_bounds();
+}
+
+/// Number of objectives.
+/**
+ * @return the number of objectives of the inner problem.
+ */
+vector_double::size_type numerical_gradient::get_nobj() const
+{
+    return m_problem.get_nobj();
+}
+
+/// Equality constraint dimension.
+/**
+ * @return the number of equality constraints of the inner problem.
+ */
+vector_double::size_type numerical_gradient::get_nec() const
+{
+    return m_problem.get_nec();
+}
+
+/// Inequality constraint dimension.
+/**
+ * @return the number of inequality constraints of the inner problem.
+ */
+vector_double::size_type numerical_gradient::get_nic() const
+{
+    return m_problem.get_nic();
+}
+
+/// Integer dimension
+/**
+ * @return the integer dimension of the inner problem.
+ */
+vector_double::size_type numerical_gradient::get_nix() const
+{
+    return m_problem.get_nix();
+}
+
+/// Numerical gradient.
+/**
+ * The (dense) gradient of the fitness of the inner problem is estimated around \p x via central finite
+ * differences. All the perturbed decision vectors are evaluated with a single call to the pagmo::bfe
+ * stored in \p this.
+ *
+ * @param x the decision vector.
+ *
+ * @return the estimated gradient of the fitness function.
+ *
+ * @throws unspecified any exception thrown by pagmo::estimate_gradient_batch(),
+ * pagmo::estimate_gradient_h_batch() or by the call operator of pagmo::bfe.
+ */
+vector_double numerical_gradient::gradient(const vector_double &x) const
+{
+    auto bf = [this](const vector_double &xs) { return m_bfe(m_problem, xs); };
+    return m_high_order ? estimate_gradient_h_batch(bf, x, m_dx) : estimate_gradient_batch(bf, x, m_dx);
+}
+
+/// Checks if the inner problem has hessians.
+/**
+ * The <tt>has_hessians()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the hessians in the inner problem.
+ */
+bool numerical_gradient::has_hessians() const
+{
+    return m_problem.has_hessians();
+}
+
+/// Hessians.
+/**
+ * The <tt>hessians()</tt> computation is forwarded to the inner problem.
+ *
+ * @param x the decision vector.
+ *
+ * @return the hessians of the fitness function computed at \p x.
+ *
+ * @throws unspecified any exception thrown by problem::hessians().
+ */
+std::vector<vector_double> numerical_gradient::hessians(const vector_double &x) const
+{
+    return m_problem.hessians(x);
+}
+
+/// Checks if the inner problem has hessians sparisty implemented.
+/**
+ * The <tt>has_hessians_sparsity()</tt> computation is forwarded to the inner problem.
+ *
+ * @return a flag signalling the availability of the hessians sparisty in the inner problem.
+ */
+bool numerical_gradient::has_hessians_sparsity() const
+{
+    return m_problem.has_hessians_sparsity();
+}
+
+/// Hessians sparsity.
+/**
+ * The <tt>hessians_sparsity()</tt> computation is forwarded to the inner problem.
+ *
+ * @return the hessians sparsity of the inner problem.
+ */
+std::vector<sparsity_pattern> numerical_gradient::hessians_sparsity() const
+{
+    return m_problem.hessians_sparsity();
+}
+
+/// Calls <tt>has_set_seed()</tt> of the inner problem.
+/**
+ * Calls the method <tt>has_set_seed()</tt> of the inner problem.
+ *
+ * @return a flag signalling wether the inner problem is stochastic.
+ */
+bool numerical_gradient::has_set_seed() const
+{
+    return m_problem.has_set_seed();
+}
+
+/// Calls <tt>set_seed()</tt> of the inner problem.
+/**
+ * Calls the method <tt>set_seed()</tt> of the inner problem.
+ *
+ * @param seed seed to be set.
+ *
+ * @throws unspecified any exception thrown by the method <tt>set_seed()</tt> of the inner problem.
+ */
+void numerical_gradient::set_seed(unsigned seed)
+{
+    m_problem.set_seed(seed);
+}
+
+/// Problem name
+/**
+ * This method will add <tt>[numerical gradient]</tt> to the name provided by the inner problem.
+ *
+ * @return a string containing the problem name.
+ *
+ * @throws unspecified any exception thrown by <tt>problem::get_name()</tt> or memory errors in standard classes.
+ */
+std::string numerical_gradient::get_name() const
+{
+    return m_problem.get_name() + " [numerical gradient]";
+}
+
+/// Extra info
+/**
+ * This method will append a description of the finite differences settings to the extra info provided
+ * by the inner problem.
+ *
+ * @return a string containing extra info on the problem.
+ *
+ * @throws unspecified any exception thrown by problem::get_extra_info(), the public interface of
+ * \p std::ostringstream or memory errors in standard classes.
+ */
+std::string numerical_gradient::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\n\tFinite difference step: " << m_dx;
+    oss << "\n\tFormula: " << (m_high_order ? "high-order (6 points)" : "low-order (2 points)");
+    oss << "\n\tBatch evaluator: " << m_bfe.get_name();
+    return m_problem.get_extra_info() + oss.str();
+}
+
+/// Problem's thread safety level.
+/**
+ * The thread safety of this meta-problem is the minimum between the thread safety of the inner pagmo::problem
+ * and the thread safety of the pagmo::bfe.
+ *
+ * @return the thread safety level of \p this.
+ */
+thread_safety numerical_gradient::get_thread_safety() const
+{
+    return std::min(m_problem.get_thread_safety(), m_bfe.get_thread_safety());
+}
+
+/// Getter for the inner problem.
+/**
+ * Returns a const reference to the inner pagmo::problem.
+ *
+ * @return a const reference to the inner pagmo::problem.
+ */
+const problem &numerical_gradient::get_inner_problem() const
+{
+    return m_problem;
+}
+
+/// Getter for the inner problem.
+/**
+ * Returns a reference to the inner pagmo::problem.
+ *
+ * \verbatim embed:rst:leading-asterisk
+ * .. note::
+ *
+ *    The ability to extract a non const reference is provided only in order to allow to call
+ *    non-const methods on the internal :cpp:class:`pagmo::problem` instance. Assigning a new
+ *    :cpp:class:`pagmo::problem` via this reference is undefined behaviour.
+ *
+ * \endverbatim
+ *
+ * @return a reference to the inner pagmo::problem.
+ */
+problem &numerical_gradient::get_inner_problem()
+{
+    return m_problem;
+}
+
+/// Getter for the bfe.
+/**
+ * @return a const reference to the pagmo::bfe used to evaluate the perturbed decision vectors.
+ */
+const bfe &numerical_gradient::get_bfe() const
+{
+    return m_bfe;
+}
+
+/// Getter for the finite difference step.
+/**
+ * @return the relative step used in the finite differences.
+ */
+double numerical_gradient::get_dx() const
+{
+    return m_dx;
+}
+
+/// Getter for the high-order flag.
+/**
+ * @return \p true if the high-order formula is used, \p false otherwise.
+ */
+bool numerical_gradient::get_high_order() const
+{
+    return m_high_order;
+}
+
+/// Object serialization
+/**
+ * This method will save/load \p this into/from the archive \p ar.
+ *
+ * @param ar target archive.
+ *
+ * @throws unspecified any exception thrown by the serialization of the inner problem, of the bfe
+ * and of primitive types.
+ */
+template <typename Archive>
+void numerical_gradient::serialize(Archive &ar, unsigned)
+{
+    detail::archive(ar, m_problem, m_bfe, m_dx, m_high_order);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_PROBLEM_IMPLEMENT(pagmo::numerical_gradient)
@@ -61,14 +61,26 @@ rastrigin::rastrigin(unsigned dim) : m_dim(dim)
  */
 vector_double rastrigin::fitness(const vector_double &x) const
 {
-    vector_double f(1, 0.);
+    vector_double f(1);
+    fitness_into(x.data(), f.data());
+    return f;
+}
+
+/// Fitness computation into a caller-provided buffer
+/**
+ * Computes the fitness for this UDP without allocating memory.
+ *
+ * @param x a pointer to the \p m_dim elements of the decision vector.
+ * @param f a pointer to the output fitness (of size 1).
+ */
+void rastrigin::fitness_into(const double *x, double *f) const
+{
     const auto omega = 2. * pagmo::detail::pi();
-    auto n = x.size();
-    for (decltype(n) i = 0u; i < n; ++i) {
+    f[0] = 0.;
+    for (decltype(m_dim) i = 0u; i < m_dim; ++i) {
         f[0] += x[i] * x[i] - 10. * std::cos(omega * x[i]);
     }
-    f[0] += 10. * static_cast<double>(n);
-    return f;
+    f[0] += 10. * static_cast<double>(m_dim);
 }
 
 /// Box-bounds
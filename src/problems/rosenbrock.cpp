@@ -57,12 +57,26 @@ rosenbrock::rosenbrock(vector_double::size_type dim) : m_dim(dim)
  * @return the fitness of \p x.
  */
 vector_double rosenbrock::fitness(const vector_double &x) const
+{
+    vector_double retval(1);
+    fitness_into(x.data(), retval.data());
+    return retval;
+}
+
+/// Fitness computation into a caller-provided buffer
+/**
+ * Computes the fitness for this UDP without allocating memory.
+ *
+ * @param x a pointer to the \p m_dim elements of the decision vector.
+ * @param f a pointer to the output fitness (of size 1).
+ */
+void rosenbrock::fitness_into(const double *x, double *f) const
 {
     double retval = 0.;
     for (decltype(m_dim) i = 0u; i < m_dim - 1u; ++i) {
         retval += 100. * (x[i] * x[i] - x[i + 1]) * (x[i] * x[i] - x[i + 1]) + (x[i] - 1) * (x[i] - 1);
     }
-    return {retval};
+    f[0] = retval;
 }
 
 /// Box-bounds
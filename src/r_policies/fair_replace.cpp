@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -36,6 +37,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/variant/get.hpp>
+#include <boost/variant/variant.hpp>
 
 #include <pagmo/detail/base_sr_policy.hpp>
 #include <pagmo/detail/custom_comparisons.hpp>
@@ -59,6 +61,77 @@ namespace pagmo
 // Default constructor: absolute rate, 1 individual.
 fair_replace::fair_replace() : fair_replace(1) {}
 
+namespace
+{
+
+// Establish how many individuals we want to migrate from the migrants into
+// the input individuals, given the migration rate and the sizes of the two groups.
+pop_size_t fair_replace_n_migr(const boost::variant<pop_size_t, double> &migr_rate, pop_size_t inds_size,
+                               pop_size_t mig_size)
+{
+    pop_size_t candidate;
+
+    if (migr_rate.which()) {
+        // Fractional migration rate: scale it by the number
+        // of input individuals.
+        // NOTE: use std::min() to make absolutely sure we don't exceed inds_size
+        // due to FP shenanigans.
+        candidate = std::min(
+            boost::numeric_cast<pop_size_t>(boost::get<double>(migr_rate) * static_cast<double>(inds_size)),
+            inds_size);
+    } else {
+        // Absolute migration rate: check that it's not higher than the input population size.
+        candidate = boost::get<pop_size_t>(migr_rate);
+        if (candidate > inds_size) {
+            pagmo_throw(
+                std::invalid_argument,
+                "The absolute migration rate (" + std::to_string(candidate)
+                    + ") in a 'fair_replace' replacement policy is larger than the number of input individuals ("
+                    + std::to_string(inds_size) + ")");
+        }
+    }
+
+    // We cannot migrate more individuals than we have available
+    // in mig, so clamp the candidate value.
+    return std::min(candidate, mig_size);
+}
+
+// Build a replacement plan from the selection of the best inds_size individuals
+// in a merged population consisting of the inds_size input individuals followed by
+// the migrants at the indices mig_ind_sort[0], ..., mig_ind_sort[n_migr - 1].
+// The first inds_size elements of merged_ind_sort are the indices, in the merged
+// population, of the individuals which survive the replacement.
+template <typename Idx0, typename Idx1>
+replacement_plan_t fair_replace_make_plan(const Idx0 &merged_ind_sort, const Idx1 &mig_ind_sort, pop_size_t inds_size,
+                                          pop_size_t n_migr)
+{
+    // Flag the survivors in the merged population.
+    std::vector<char> kept(boost::numeric_cast<std::vector<char>::size_type>(inds_size + n_migr));
+    for (pop_size_t i = 0; i < inds_size; ++i) {
+        kept[merged_ind_sort[i]] = 1;
+    }
+
+    // The number of discarded input individuals is equal to the number
+    // of surviving migrants: pair them in order of appearance.
+    replacement_plan_t retval;
+    pop_size_t i = 0, j = inds_size;
+    while (true) {
+        for (; i < inds_size && kept[i]; ++i) {
+        }
+        for (; j < inds_size + n_migr && !kept[j]; ++j) {
+        }
+        if (i == inds_size || j == inds_size + n_migr) {
+            break;
+        }
+        retval.emplace_back(i++, mig_ind_sort[j++ - inds_size]);
+    }
+    assert(i == inds_size);
+
+    return retval;
+}
+
+} // namespace
+
 // Implementation of the replacement.
 individuals_group_t fair_replace::replace(const individuals_group_t &inds, const vector_double::size_type &,
                                           const vector_double::size_type &, const vector_double::size_type &nobj,
@@ -76,33 +149,7 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
     const auto mig_size = std::get<1>(mig).size();
 
     // Establish how many individuals we want to migrate from mig into inds.
-    const auto n_migr = [this, inds_size, mig_size]() -> pop_size_t {
-        pop_size_t candidate;
-
-        if (this->m_migr_rate.which()) {
-            // Fractional migration rate: scale it by the number
-            // of input individuals.
-            // NOTE: use std::min() to make absolutely sure we don't exceed inds_size
-            // due to FP shenanigans.
-            candidate = std::min(
-                boost::numeric_cast<pop_size_t>(boost::get<double>(m_migr_rate) * static_cast<double>(inds_size)),
-                inds_size);
-        } else {
-            // Absolute migration rate: check that it's not higher than the input population size.
-            candidate = boost::get<pop_size_t>(m_migr_rate);
-            if (candidate > inds_size) {
-                pagmo_throw(
-                    std::invalid_argument,
-                    "The absolute migration rate (" + std::to_string(candidate)
-                        + ") in a 'fair_replace' replacement policy is larger than the number of input individuals ("
-                        + std::to_string(inds_size) + ")");
-            }
-        }
-
-        // We cannot migrate more individuals than we have available
-        // in mig, so clamp the candidate value.
-        return std::min(candidate, mig_size);
-    }();
+    const auto n_migr = fair_replace_n_migr(m_migr_rate, inds_size, mig_size);
 
     // Make extra sure that the number of individuals selected
     // for migration is not larger than mig_size.
@@ -220,6 +267,95 @@ individuals_group_t fair_replace::replace(const individuals_group_t &inds, const
     }
 }
 
+// Implementation of the in-place replacement.
+// NOTE: the selection criteria are the same as in replace(), but the
+// survivors may differ from those returned by replace() when individuals and
+// migrants have the same fitness (the sorting algorithms are not stable
+// and the two implementations sort different sets), and the surviving
+// individuals keep their positions in the population instead of being
+// reordered. Only the fitness vectors are copied (in the constrained and
+// multi-objective cases).
+replacement_plan_t fair_replace::replace_in_place(const individuals_view_t &inds, const vector_double::size_type &,
+                                                  const vector_double::size_type &,
+                                                  const vector_double::size_type &nobj,
+                                                  const vector_double::size_type &nec,
+                                                  const vector_double::size_type &nic, const vector_double &tol,
+                                                  const individuals_group_t &mig) const
+{
+    if (nobj > 1u && (nic || nec)) {
+        pagmo_throw(std::invalid_argument, "The 'fair_replace' replacement policy is unable to deal with "
+                                           "multiobjective constrained optimisation problems");
+    }
+
+    const auto &inds_f = std::get<2>(inds);
+    const auto &mig_f = std::get<2>(mig);
+
+    // Cache the sizes of the input pop and the migrants.
+    const auto inds_size = std::get<1>(inds).size();
+    const auto mig_size = std::get<1>(mig).size();
+
+    // Establish how many individuals we want to migrate from mig into inds.
+    const auto n_migr = fair_replace_n_migr(m_migr_rate, inds_size, mig_size);
+    assert(n_migr <= mig_size);
+
+    if (nobj == 1u && !nic && !nec) {
+        // Single-objective, unconstrained.
+
+        // Move (indirectly) the top n_migr migrants to the front.
+        std::vector<pop_size_t> mig_ind_sort;
+        mig_ind_sort.resize(boost::numeric_cast<decltype(mig_ind_sort.size())>(mig_size));
+        std::iota(mig_ind_sort.begin(), mig_ind_sort.end(), pop_size_t(0));
+        std::nth_element(mig_ind_sort.begin(), mig_ind_sort.begin() + static_cast<std::ptrdiff_t>(n_migr),
+                         mig_ind_sort.end(), [&mig_f](pop_size_t idx1, pop_size_t idx2) {
+                             return detail::less_than_f(mig_f[idx1][0], mig_f[idx2][0]);
+                         });
+
+        // Move (indirectly) the top inds_size individuals of the merged
+        // population to the front. The merged population is never built
+        // explicitly.
+        auto merged_f = [&inds_f, &mig_f, &mig_ind_sort, inds_size](pop_size_t idx) -> double {
+            return idx < inds_size ? inds_f[idx][0] : mig_f[mig_ind_sort[idx - inds_size]][0];
+        };
+        std::vector<pop_size_t> merged_ind_sort;
+        merged_ind_sort.resize(boost::numeric_cast<decltype(merged_ind_sort.size())>(inds_size + n_migr));
+        std::iota(merged_ind_sort.begin(), merged_ind_sort.end(), pop_size_t(0));
+        std::nth_element(merged_ind_sort.begin(), merged_ind_sort.begin() + static_cast<std::ptrdiff_t>(inds_size),
+                         merged_ind_sort.end(), [&merged_f](pop_size_t idx1, pop_size_t idx2) {
+                             return detail::less_than_f(merged_f(idx1), merged_f(idx2));
+                         });
+
+        return fair_replace_make_plan(merged_ind_sort, mig_ind_sort, inds_size, n_migr);
+    } else if (nobj == 1u && (nic || nec)) {
+        // Single-objective, constrained.
+
+        // Sort indirectly the input migrants, taking into accounts
+        // constraints satisfaction and tolerances.
+        const auto mig_ind_sort = sort_population_con(mig_f, nec, tol);
+
+        // Build the fitness vectors of the merged population.
+        auto merged_f(inds_f);
+        for (pop_size_t i = 0; i < n_migr; ++i) {
+            merged_f.push_back(mig_f[mig_ind_sort[i]]);
+        }
+
+        return fair_replace_make_plan(sort_population_con(merged_f, nec, tol), mig_ind_sort, inds_size, n_migr);
+    } else {
+        // Multi-objective, unconstrained.
+        assert(nobj > 1u && !nic && !nec);
+
+        // Get the best n_migr migrants.
+        const auto mig_ind_sort = select_best_N_mo(mig_f, n_migr);
+
+        // Build the fitness vectors of the merged population.
+        auto merged_f(inds_f);
+        for (pop_size_t i = 0; i < n_migr; ++i) {
+            merged_f.push_back(mig_f[mig_ind_sort[i]]);
+        }
+
+        return fair_replace_make_plan(select_best_N_mo(merged_f, inds_size), mig_ind_sort, inds_size, n_migr);
+    }
+}
+
 // Extra info.
 std::string fair_replace::get_extra_info() const
 {
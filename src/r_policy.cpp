@@ -27,12 +27,15 @@ GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <pagmo/exceptions.hpp>
 #include <pagmo/r_policies/fair_replace.hpp>
@@ -81,8 +84,9 @@ r_policy &r_policy::operator=(const r_policy &other)
     return *this = r_policy(other);
 }
 
-// Verify the input arguments for the replace() function.
-void r_policy::verify_replace_input(const individuals_group_t &inds, const vector_double::size_type &nx,
+// Verify the input arguments for the replace() and replace_in_place() functions.
+template <typename Group>
+void r_policy::verify_replace_input(const Group &inds, const vector_double::size_type &nx,
                                     const vector_double::size_type &nix, const vector_double::size_type &nobj,
                                     const vector_double::size_type &nec, const vector_double::size_type &nic,
                                     const vector_double &tol, const individuals_group_t &mig) const
@@ -224,6 +228,141 @@ individuals_group_t r_policy::replace(const individuals_group_t &inds, const vec
     return retval;
 }
 
+// Verify the output of replace_in_place().
+void r_policy::verify_replace_in_place_output(const replacement_plan_t &plan, pop_size_t inds_size,
+                                              pop_size_t mig_size) const
+{
+    // Verify that the indices are within bounds, and that no individual
+    // is replaced twice and no migrant is used twice.
+    std::vector<char> inds_flags(inds_size), mig_flags(mig_size);
+    for (const auto &p : plan) {
+        if (p.first >= inds_size || p.second >= mig_size) {
+            pagmo_throw(std::invalid_argument,
+                        "an invalid replacement plan was returned by a replacement policy of type '" + get_name()
+                            + "': the plan contains the pair of indices (" + std::to_string(p.first) + ", "
+                            + std::to_string(p.second) + "), but the number of individuals is "
+                            + std::to_string(inds_size) + " and the number of migrants is "
+                            + std::to_string(mig_size));
+        }
+        if (inds_flags[p.first] || mig_flags[p.second]) {
+            pagmo_throw(std::invalid_argument,
+                        "an invalid replacement plan was returned by a replacement policy of type '" + get_name()
+                            + "': the plan contains duplicate individual or migrant indices");
+        }
+        inds_flags[p.first] = 1;
+        mig_flags[p.second] = 1;
+    }
+}
+
+// Deduce a replacement plan from the output new_inds of replace(). The individuals
+// are matched by ID: the individuals in inds which are not in new_inds are replaced,
+// in order, by the migrants which are in new_inds but not in inds.
+replacement_plan_t r_policy::plan_from_replace_output(const individuals_view_t &inds,
+                                                      const individuals_group_t &new_inds,
+                                                      const individuals_group_t &mig) const
+{
+    const auto &inds_IDs = std::get<0>(inds);
+    const auto &new_IDs = std::get<0>(new_inds);
+    const auto &mig_IDs = std::get<0>(mig);
+
+    if (new_IDs.size() != inds_IDs.size()) {
+        pagmo_throw(std::invalid_argument,
+                    "the replace() method of a replacement policy of type '" + get_name()
+                        + "' changed the number of individuals from " + std::to_string(inds_IDs.size()) + " to "
+                        + std::to_string(new_IDs.size())
+                        + ", thus the replacement cannot be expressed as a replacement plan");
+    }
+
+    // Count the occurrences of the IDs in new_inds.
+    std::unordered_map<unsigned long long, pop_size_t> new_count;
+    for (const auto &id : new_IDs) {
+        ++new_count[id];
+    }
+
+    // The individuals of inds which are in new_inds are kept
+    // (as many times as they appear in new_inds), the others are replaced.
+    std::vector<pop_size_t> replaced;
+    for (decltype(inds_IDs.size()) i = 0; i < inds_IDs.size(); ++i) {
+        const auto it = new_count.find(inds_IDs[i]);
+        if (it != new_count.end() && it->second) {
+            --it->second;
+        } else {
+            replaced.push_back(i);
+        }
+    }
+
+    // Map the IDs of the migrants to their indices. The indices
+    // are stored in reverse order, so that they can be popped
+    // from the back in the original order.
+    std::unordered_map<unsigned long long, std::vector<pop_size_t>> mig_idx;
+    for (auto j = mig_IDs.size(); j > 0u; --j) {
+        mig_idx[mig_IDs[j - 1u]].push_back(j - 1u);
+    }
+
+    // The remaining individuals of new_inds must be migrants.
+    replacement_plan_t retval;
+    auto r_it = replaced.begin();
+    for (const auto &id : new_IDs) {
+        auto &count = new_count[id];
+        if (!count) {
+            continue;
+        }
+        --count;
+        const auto m_it = mig_idx.find(id);
+        if (m_it == mig_idx.end() || m_it->second.empty()) {
+            pagmo_throw(std::invalid_argument,
+                        "the replace() method of a replacement policy of type '" + get_name()
+                            + "' returned an individual with ID " + std::to_string(id)
+                            + " which is neither in the original group nor among the migrants, thus the "
+                              "replacement cannot be expressed as a replacement plan");
+        }
+        // NOTE: the number of remaining individuals in new_inds is equal
+        // to the number of replaced individuals, as new_inds and inds
+        // have the same size.
+        assert(r_it != replaced.end());
+        retval.emplace_back(*r_it++, m_it->second.back());
+        m_it->second.pop_back();
+    }
+
+    return retval;
+}
+
+// Check if the UDRP provides the in-place replacement.
+bool r_policy::has_replace_in_place() const
+{
+    return ptr()->has_replace_in_place();
+}
+
+// Compute the in-place replacement of individuals in the view inds with the input migrants mig.
+// NOTE: if the UDRP does not provide replace_in_place(), the view will be copied
+// into a group of individuals which is then passed to replace().
+replacement_plan_t r_policy::replace_in_place(const individuals_view_t &inds, const vector_double::size_type &nx,
+                                              const vector_double::size_type &nix,
+                                              const vector_double::size_type &nobj,
+                                              const vector_double::size_type &nec,
+                                              const vector_double::size_type &nic, const vector_double &tol,
+                                              const individuals_group_t &mig) const
+{
+    if (!ptr()->has_replace_in_place()) {
+        // The UDRP does not provide replace_in_place(): copy the individuals in
+        // the view into a group, run replace() and deduce the plan from its output.
+        const auto new_inds = replace(individuals_group_t(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds)),
+                                      nx, nix, nobj, nec, nic, tol, mig);
+        return plan_from_replace_output(inds, new_inds, mig);
+    }
+
+    // Verify the input.
+    verify_replace_input(inds, nx, nix, nobj, nec, nic, tol, mig);
+
+    // Call the replace_in_place() method from the UDRP.
+    auto retval = ptr()->replace_in_place(inds, nx, nix, nobj, nec, nic, tol, mig);
+
+    // Verify the output.
+    verify_replace_in_place_output(retval, std::get<0>(inds).size(), std::get<0>(mig).size());
+
+    return retval;
+}
+
 // Extra info.
 std::string r_policy::get_extra_info() const
 {
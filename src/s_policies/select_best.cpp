@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -36,6 +37,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/variant/get.hpp>
+#include <boost/variant/variant.hpp>
 
 #include <pagmo/detail/base_sr_policy.hpp>
 #include <pagmo/detail/custom_comparisons.hpp>
@@ -59,11 +61,35 @@ namespace pagmo
 // Default constructor: absolute migration rate, 1 individual.
 select_best::select_best() : select_best(1) {}
 
-// Implementation of the selection.
-individuals_group_t select_best::select(const individuals_group_t &inds, const vector_double::size_type &,
-                                        const vector_double::size_type &, const vector_double::size_type &nobj,
-                                        const vector_double::size_type &nec, const vector_double::size_type &nic,
-                                        const vector_double &tol) const
+namespace
+{
+
+// Copy into a new group the individuals of inds at the indices
+// stored in the first n_migr elements of inds_ind_sort.
+template <typename Group, typename Idx>
+individuals_group_t select_best_copy_out(const Group &inds, const Idx &inds_ind_sort, pop_size_t n_migr)
+{
+    individuals_group_t retval;
+    std::get<0>(retval).reserve(n_migr);
+    std::get<1>(retval).reserve(n_migr);
+    std::get<2>(retval).reserve(n_migr);
+    for (pop_size_t i = 0; i < n_migr; ++i) {
+        std::get<0>(retval).push_back(std::get<0>(inds)[inds_ind_sort[i]]);
+        std::get<1>(retval).push_back(std::get<1>(inds)[inds_ind_sort[i]]);
+        std::get<2>(retval).push_back(std::get<2>(inds)[inds_ind_sort[i]]);
+    }
+
+    return retval;
+}
+
+// Implementation of the selection, shared by select() and select_view().
+// NOTE: Group is either individuals_group_t or individuals_view_t, that is,
+// a tuple of vectors or a tuple of references to vectors. Only the
+// selected individuals are copied.
+template <typename Group>
+individuals_group_t select_best_impl(const Group &inds, const boost::variant<pop_size_t, double> &migr_rate,
+                                     const vector_double::size_type &nobj, const vector_double::size_type &nec,
+                                     const vector_double::size_type &nic, const vector_double &tol)
 {
     if (nobj > 1u && (nic || nec)) {
         pagmo_throw(std::invalid_argument, "The 'Select best' selection policy is unable to deal with "
@@ -75,18 +101,18 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
     const auto inds_size = std::get<1>(inds).size();
 
     // Establish how many individuals we want to select from inds.
-    const auto n_migr = [this, inds_size]() -> pop_size_t {
-        if (this->m_migr_rate.which()) {
+    const auto n_migr = [&migr_rate, inds_size]() -> pop_size_t {
+        if (migr_rate.which()) {
             // Fractional migration rate: scale it by the number
             // of input individuals.
             // NOTE: use std::min() to make absolutely sure we don't exceed inds_size
             // due to FP shenanigans.
             return std::min(
-                boost::numeric_cast<pop_size_t>(boost::get<double>(m_migr_rate) * static_cast<double>(inds_size)),
+                boost::numeric_cast<pop_size_t>(boost::get<double>(migr_rate) * static_cast<double>(inds_size)),
                 inds_size);
         } else {
             // Absolute migration rate: check that it's not higher than the input population size.
-            const auto candidate = boost::get<pop_size_t>(m_migr_rate);
+            const auto candidate = boost::get<pop_size_t>(migr_rate);
             if (candidate > inds_size) {
                 pagmo_throw(
                     std::invalid_argument,
@@ -111,25 +137,18 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
         // Single-objective, unconstrained.
 
         // Sort (indirectly) the input individuals according to their fitness.
+        // NOTE: we only need the best n_migr individuals, thus
+        // a partial sort is enough.
         std::vector<pop_size_t> inds_ind_sort;
         inds_ind_sort.resize(boost::numeric_cast<decltype(inds_ind_sort.size())>(inds_size));
         std::iota(inds_ind_sort.begin(), inds_ind_sort.end(), pop_size_t(0));
-        std::sort(inds_ind_sort.begin(), inds_ind_sort.end(), [&inds](pop_size_t idx1, pop_size_t idx2) {
-            return detail::less_than_f(std::get<2>(inds)[idx1][0], std::get<2>(inds)[idx2][0]);
-        });
+        std::partial_sort(inds_ind_sort.begin(), inds_ind_sort.begin() + static_cast<std::ptrdiff_t>(n_migr),
+                          inds_ind_sort.end(), [&inds](pop_size_t idx1, pop_size_t idx2) {
+                              return detail::less_than_f(std::get<2>(inds)[idx1][0], std::get<2>(inds)[idx2][0]);
+                          });
 
         // Create and return the output pop.
-        individuals_group_t retval;
-        std::get<0>(retval).reserve(n_migr);
-        std::get<1>(retval).reserve(n_migr);
-        std::get<2>(retval).reserve(n_migr);
-        for (pop_size_t i = 0; i < n_migr; ++i) {
-            std::get<0>(retval).push_back(std::get<0>(inds)[inds_ind_sort[i]]);
-            std::get<1>(retval).push_back(std::get<1>(inds)[inds_ind_sort[i]]);
-            std::get<2>(retval).push_back(std::get<2>(inds)[inds_ind_sort[i]]);
-        }
-
-        return retval;
+        return select_best_copy_out(inds, inds_ind_sort, n_migr);
     } else if (nobj == 1u && (nic || nec)) {
         // Single-objective, constrained.
 
@@ -138,17 +157,7 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
         const auto inds_ind_sort = sort_population_con(std::get<2>(inds), nec, tol);
 
         // Create and return the output pop.
-        individuals_group_t retval;
-        std::get<0>(retval).reserve(n_migr);
-        std::get<1>(retval).reserve(n_migr);
-        std::get<2>(retval).reserve(n_migr);
-        for (pop_size_t i = 0; i < n_migr; ++i) {
-            std::get<0>(retval).push_back(std::get<0>(inds)[inds_ind_sort[i]]);
-            std::get<1>(retval).push_back(std::get<1>(inds)[inds_ind_sort[i]]);
-            std::get<2>(retval).push_back(std::get<2>(inds)[inds_ind_sort[i]]);
-        }
-
-        return retval;
+        return select_best_copy_out(inds, inds_ind_sort, n_migr);
     } else {
         // Multi-objective, unconstrained.
         assert(nobj > 1u && !nic && !nec);
@@ -157,20 +166,30 @@ individuals_group_t select_best::select(const individuals_group_t &inds, const v
         const auto inds_ind_sort = select_best_N_mo(std::get<2>(inds), n_migr);
 
         // Create and return the output pop.
-        individuals_group_t retval;
-        std::get<0>(retval).reserve(n_migr);
-        std::get<1>(retval).reserve(n_migr);
-        std::get<2>(retval).reserve(n_migr);
-        for (pop_size_t i = 0; i < n_migr; ++i) {
-            std::get<0>(retval).push_back(std::get<0>(inds)[inds_ind_sort[i]]);
-            std::get<1>(retval).push_back(std::get<1>(inds)[inds_ind_sort[i]]);
-            std::get<2>(retval).push_back(std::get<2>(inds)[inds_ind_sort[i]]);
-        }
-
-        return retval;
+        return select_best_copy_out(inds, inds_ind_sort, n_migr);
     }
 }
 
+} // namespace
+
+// Implementation of the selection.
+individuals_group_t select_best::select(const individuals_group_t &inds, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &nobj,
+                                        const vector_double::size_type &nec, const vector_double::size_type &nic,
+                                        const vector_double &tol) const
+{
+    return select_best_impl(inds, m_migr_rate, nobj, nec, nic, tol);
+}
+
+// Implementation of the selection from a view.
+individuals_group_t select_best::select_view(const individuals_view_t &inds, const vector_double::size_type &,
+                                             const vector_double::size_type &, const vector_double::size_type &nobj,
+                                             const vector_double::size_type &nec, const vector_double::size_type &nic,
+                                             const vector_double &tol) const
+{
+    return select_best_impl(inds, m_migr_rate, nobj, nec, nic, tol);
+}
+
 // Extra info.
 std::string select_best::get_extra_info() const
 {
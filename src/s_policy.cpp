@@ -81,11 +81,12 @@ s_policy &s_policy::operator=(const s_policy &other)
     return *this = s_policy(other);
 }
 
-// Verify the input arguments for the select() function.
+// Verify the input arguments for the select() and select_view() functions.
 // NOTE: these verification functions are very similar
 // to those in r_policy. Perhaps in the future we can
 // factor them out.
-void s_policy::verify_select_input(const individuals_group_t &inds, const vector_double::size_type &nx,
+template <typename Group>
+void s_policy::verify_select_input(const Group &inds, const vector_double::size_type &nx,
                                    const vector_double::size_type &nix, const vector_double::size_type &nobj,
                                    const vector_double::size_type &nec, const vector_double::size_type &nic,
                                    const vector_double &tol) const
@@ -207,6 +208,38 @@ individuals_group_t s_policy::select(const individuals_group_t &inds, const vect
     return retval;
 }
 
+// Check if the UDSP provides the selection from a view.
+bool s_policy::has_select_view() const
+{
+    return ptr()->has_select_view();
+}
+
+// Select individuals in the view inds.
+// NOTE: if the UDSP does not provide select_view(), the view
+// will be copied into a group of individuals which is then
+// passed to select().
+individuals_group_t s_policy::select_view(const individuals_view_t &inds, const vector_double::size_type &nx,
+                                          const vector_double::size_type &nix, const vector_double::size_type &nobj,
+                                          const vector_double::size_type &nec, const vector_double::size_type &nic,
+                                          const vector_double &tol) const
+{
+    if (!ptr()->has_select_view()) {
+        return select(individuals_group_t(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds)), nx, nix, nobj,
+                      nec, nic, tol);
+    }
+
+    // Verify the input.
+    verify_select_input(inds, nx, nix, nobj, nec, nic, tol);
+
+    // Call the select_view() method from the UDSP.
+    auto retval = ptr()->select_view(inds, nx, nix, nobj, nec, nic, tol);
+
+    // Verify the output.
+    verify_select_output(retval, nx, nobj + nec + nic);
+
+    return retval;
+}
+
 // Extra info.
 std::string s_policy::get_extra_info() const
 {
@@ -0,0 +1,433 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/io.hpp>
+#include <pagmo/stats.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+#if !defined(PAGMO_DOXYGEN_INVOKED)
+
+constexpr unsigned stats_histogram::n_buckets;
+
+#endif
+
+/// Default constructor.
+/**
+ * The default constructor initialises an empty histogram.
+ */
+stats_histogram::stats_histogram()
+    : m_buckets(), m_count(0), m_sum(0), m_min(std::numeric_limits<unsigned long long>::max()), m_max(0)
+{
+}
+
+/// Constructor from bucket counts and summary data.
+/**
+ * This constructor can be used to build a histogram from data accumulated elsewhere
+ * (e.g., in lock-free counters). The number of samples is computed as the sum of the bucket counts.
+ *
+ * @param buckets the bucket counts.
+ * @param sum the sum of the samples.
+ * @param min the smallest sample.
+ * @param max the largest sample.
+ *
+ * @throws std::invalid_argument if the histogram is not empty and \p min is larger than \p max,
+ * or if \p min or \p max are not consistent with the bucket counts.
+ */
+stats_histogram::stats_histogram(const buckets_t &buckets, unsigned long long sum, unsigned long long min,
+                                 unsigned long long max)
+    : stats_histogram()
+{
+    unsigned long long count = 0;
+    for (auto c : buckets) {
+        count += c;
+    }
+
+    if (count) {
+        if (min > max || !buckets[bucket_index(min)] || !buckets[bucket_index(max)]) {
+            pagmo_throw(std::invalid_argument, "Cannot construct a histogram from bucket counts: the minimum ("
+                                                   + std::to_string(min) + ") and maximum (" + std::to_string(max)
+                                                   + ") values are not consistent with the bucket counts");
+        }
+        m_buckets = buckets;
+        m_count = count;
+        m_sum = sum;
+        m_min = min;
+        m_max = max;
+    }
+}
+
+/// Record a sample.
+/**
+ * @param x the sample that will be recorded.
+ */
+void stats_histogram::add(unsigned long long x)
+{
+    ++m_buckets[bucket_index(x)];
+    ++m_count;
+    m_sum += x;
+    m_min = std::min(m_min, x);
+    m_max = std::max(m_max, x);
+}
+
+/// Merge another histogram.
+/**
+ * @param other the histogram that will be merged into \p this.
+ *
+ * @return a reference to \p this.
+ */
+stats_histogram &stats_histogram::operator+=(const stats_histogram &other)
+{
+    for (unsigned i = 0; i < n_buckets; ++i) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    return *this;
+}
+
+/// Get the number of samples.
+/**
+ * @return the number of samples recorded in the histogram.
+ */
+unsigned long long stats_histogram::get_count() const
+{
+    return m_count;
+}
+
+/// Get the sum of the samples.
+/**
+ * @return the sum of the samples recorded in the histogram.
+ */
+unsigned long long stats_histogram::get_sum() const
+{
+    return m_sum;
+}
+
+/// Get the smallest sample.
+/**
+ * @return the smallest sample recorded in the histogram, or zero if the histogram is empty.
+ */
+unsigned long long stats_histogram::get_min() const
+{
+    return m_count ? m_min : 0u;
+}
+
+/// Get the largest sample.
+/**
+ * @return the largest sample recorded in the histogram, or zero if the histogram is empty.
+ */
+unsigned long long stats_histogram::get_max() const
+{
+    return m_max;
+}
+
+/// Get the mean of the samples.
+/**
+ * @return the mean of the samples recorded in the histogram, or zero if the histogram is empty.
+ */
+double stats_histogram::get_mean() const
+{
+    return m_count ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.;
+}
+
+/// Get the buckets.
+/**
+ * @return a reference to the bucket counts.
+ */
+const stats_histogram::buckets_t &stats_histogram::get_buckets() const
+{
+    return m_buckets;
+}
+
+/// Approximate quantile.
+/**
+ * The quantile is computed from the bucket counts, and it is thus
+ * accurate only up to a factor of 2. The returned value is always in the range
+ * spanned by the smallest and largest samples.
+ *
+ * @param q the desired quantile.
+ *
+ * @return an upper bound for the <tt>q</tt>-th quantile of the samples recorded in the histogram,
+ * or zero if the histogram is empty.
+ *
+ * @throws std::invalid_argument if \p q is not in the [0, 1] range.
+ */
+unsigned long long stats_histogram::quantile(double q) const
+{
+    if (!(q >= 0. && q <= 1.)) {
+        pagmo_throw(std::invalid_argument, "The quantile of a histogram must be in the [0, 1] range, but a value of "
+                                               + std::to_string(q) + " was provided instead");
+    }
+
+    if (!m_count) {
+        return 0;
+    }
+
+    // The rank of the desired sample (1-based).
+    const auto rank = std::max(1ull, static_cast<unsigned long long>(std::ceil(q * static_cast<double>(m_count))));
+
+    unsigned long long cum = 0;
+    for (unsigned i = 0; i < n_buckets; ++i) {
+        cum += m_buckets[i];
+        if (cum >= rank) {
+            return std::max(m_min, std::min(m_max, bucket_bounds(i).second));
+        }
+    }
+
+    // LCOV_EXCL_START
+    return m_max;
+    // LCOV_EXCL_STOP
+}
+
+/// Bucket index.
+/**
+ * @param x a sample.
+ *
+ * @return the index of the bucket in which \p x would be recorded.
+ */
+unsigned stats_histogram::bucket_index(unsigned long long x)
+{
+    unsigned retval = 0;
+    for (; x; x >>= 1) {
+        ++retval;
+    }
+    return retval;
+}
+
+/// Bucket bounds.
+/**
+ * @param idx the index of a bucket.
+ *
+ * @return the smallest and largest values which are recorded in the bucket at index \p idx.
+ *
+ * @throws std::invalid_argument if \p idx is not less than pagmo::stats_histogram::n_buckets.
+ */
+std::pair<unsigned long long, unsigned long long> stats_histogram::bucket_bounds(unsigned idx)
+{
+    if (idx >= n_buckets) {
+        pagmo_throw(std::invalid_argument, "Invalid bucket index " + std::to_string(idx) + ": the number of buckets is "
+                                               + std::to_string(n_buckets));
+    }
+    if (!idx) {
+        return {0, 0};
+    }
+    const auto lower = 1ull << (idx - 1u);
+    // NOTE: lower * 2 - 1 is computed as lower - 1 + lower to avoid
+    // overflow in the last bucket.
+    return {lower, lower - 1u + lower};
+}
+
+/// Merge two histograms.
+/**
+ * @param a the first histogram.
+ * @param b the second histogram.
+ *
+ * @return a histogram containing the samples of both \p a and \p b.
+ */
+stats_histogram operator+(const stats_histogram &a, const stats_histogram &b)
+{
+    auto retval(a);
+    retval += b;
+    return retval;
+}
+
+/// Stream operator for pagmo::stats_histogram.
+/**
+ * @param os the target stream.
+ * @param h the histogram that will be streamed.
+ *
+ * @return a reference to \p os.
+ *
+ * @throws unspecified any exception thrown by the stream operators of fundamental types.
+ */
+std::ostream &operator<<(std::ostream &os, const stats_histogram &h)
+{
+    stream(os, "count: ", h.get_count());
+    if (h.get_count()) {
+        stream(os, ", mean: ", h.get_mean(), ", min: ", h.get_min(), ", p50: ", h.quantile(.5),
+               ", p99: ", h.quantile(.99), ", max: ", h.get_max());
+    }
+    return os;
+}
+
+/// Default constructor.
+/**
+ * The default constructor initialises empty statistics.
+ */
+island_stats::island_stats() : m_fevals(0) {}
+
+/// Merge the statistics of another island.
+/**
+ * @param other the statistics that will be merged into \p this.
+ *
+ * @return a reference to \p this.
+ */
+island_stats &island_stats::operator+=(const island_stats &other)
+{
+    m_queue_wait += other.m_queue_wait;
+    m_evolve += other.m_evolve;
+    m_migr_pull += other.m_migr_pull;
+    m_migr_replace += other.m_migr_replace;
+    m_migr_select += other.m_migr_select;
+    m_pop_copy += other.m_pop_copy;
+    m_fevals += other.m_fevals;
+    return *this;
+}
+
+/// Get the queue wait times.
+/**
+ * @return a histogram of the times (in nanoseconds) spent by the evolution tasks in the island's task queue.
+ */
+const stats_histogram &island_stats::get_queue_wait() const
+{
+    return m_queue_wait;
+}
+
+/// Get the evolution times.
+/**
+ * @return a histogram of the wall-clock times (in nanoseconds) of the invocations of the <tt>%run_evolve()</tt>
+ * method of the UDI.
+ */
+const stats_histogram &island_stats::get_evolve() const
+{
+    return m_evolve;
+}
+
+/// Get the migrant fetching times.
+/**
+ * @return a histogram of the times (in nanoseconds) spent fetching migrants from the archipelago.
+ */
+const stats_histogram &island_stats::get_migr_pull() const
+{
+    return m_migr_pull;
+}
+
+/// Get the replacement times.
+/**
+ * @return a histogram of the times (in nanoseconds) spent replacing individuals with migrants.
+ */
+const stats_histogram &island_stats::get_migr_replace() const
+{
+    return m_migr_replace;
+}
+
+/// Get the selection times.
+/**
+ * @return a histogram of the times (in nanoseconds) spent selecting the migrants and storing
+ * them in the archipelago.
+ */
+const stats_histogram &island_stats::get_migr_select() const
+{
+    return m_migr_select;
+}
+
+/// Get the population copy sizes.
+/**
+ * @return a histogram of the approximate sizes (in bytes) of the individuals in the copies
+ * of the island's population.
+ */
+const stats_histogram &island_stats::get_pop_copy() const
+{
+    return m_pop_copy;
+}
+
+/// Get the number of fitness evaluations.
+/**
+ * @return the number of fitness evaluations performed during the evolutions.
+ */
+unsigned long long island_stats::get_fevals() const
+{
+    return m_fevals;
+}
+
+/// Get the fitness evaluation throughput.
+/**
+ * @return the number of fitness evaluations per second of evolution time, or zero
+ * if no evolution time was recorded.
+ */
+double island_stats::get_fevals_per_second() const
+{
+    return m_evolve.get_sum() ? static_cast<double>(m_fevals) / (static_cast<double>(m_evolve.get_sum()) * 1E-9) : 0.;
+}
+
+/// Merge the statistics of two islands.
+/**
+ * @param a the first set of statistics.
+ * @param b the second set of statistics.
+ *
+ * @return the merged statistics.
+ */
+island_stats operator+(const island_stats &a, const island_stats &b)
+{
+    auto retval(a);
+    retval += b;
+    return retval;
+}
+
+/// Stream operator for pagmo::island_stats.
+/**
+ * @param os the target stream.
+ * @param s the statistics that will be streamed.
+ *
+ * @return a reference to \p os.
+ *
+ * @throws unspecified any exception thrown by the stream operators of fundamental types.
+ */
+std::ostream &operator<<(std::ostream &os, const island_stats &s)
+{
+    stream(os, "Queue wait (ns):\t", s.get_queue_wait(), '\n');
+    stream(os, "Evolve (ns):\t\t", s.get_evolve(), '\n');
+    stream(os, "Migrants pull (ns):\t", s.get_migr_pull(), '\n');
+    stream(os, "Replacement (ns):\t", s.get_migr_replace(), '\n');
+    stream(os, "Selection (ns):\t\t", s.get_migr_select(), '\n');
+    stream(os, "Population copy (B):\t", s.get_pop_copy(), '\n');
+    stream(os, "Fitness evaluations:\t", s.get_fevals(), '\n');
+    stream(os, "Evaluations per second:\t", s.get_fevals_per_second(), '\n');
+    return os;
+}
+
+} // namespace pagmo
@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
@@ -89,6 +90,14 @@ void base_bgl_topology::unsafe_check_vertex_indices(std::size_t idx, Args... oth
     unsafe_check_vertex_indices(others...);
 }
 
+// Signal that the graph was modified: bump the version
+// and discard the cached CSR snapshot.
+void base_bgl_topology::unsafe_bump_version()
+{
+    ++m_version;
+    m_csr.reset();
+}
+
 base_bgl_topology::graph_t base_bgl_topology::get_graph() const
 {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -98,6 +107,8 @@ base_bgl_topology::graph_t base_bgl_topology::get_graph() const
 base_bgl_topology::graph_t base_bgl_topology::move_graph()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
+    // NOTE: the graph will be left in an unspecified state.
+    unsafe_bump_version();
     return std::move(m_graph);
 }
 
@@ -105,6 +116,7 @@ void base_bgl_topology::set_graph(graph_t &&g)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_graph = std::move(g);
+    unsafe_bump_version();
 }
 
 base_bgl_topology::base_bgl_topology(const base_bgl_topology &other) : m_graph(other.get_graph()) {}
@@ -131,6 +143,7 @@ void base_bgl_topology::add_vertex()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
     boost::add_vertex(m_graph);
+    unsafe_bump_version();
 }
 
 std::size_t base_bgl_topology::num_vertices() const
@@ -168,6 +181,7 @@ void base_bgl_topology::add_edge(std::size_t i, std::size_t j, double w)
         = boost::add_edge(boost::vertex(detail::vcast(i), m_graph), boost::vertex(detail::vcast(j), m_graph), m_graph);
     assert(result.second);
     m_graph[result.first] = w;
+    unsafe_bump_version();
 }
 
 void base_bgl_topology::remove_edge(std::size_t i, std::size_t j)
@@ -179,6 +193,7 @@ void base_bgl_topology::remove_edge(std::size_t i, std::size_t j)
                                                + std::to_string(i) + " to " + std::to_string(j));
     }
     boost::remove_edge(boost::vertex(detail::vcast(i), m_graph), boost::vertex(detail::vcast(j), m_graph), m_graph);
+    unsafe_bump_version();
 }
 
 void base_bgl_topology::set_all_weights(double w)
@@ -190,6 +205,7 @@ void base_bgl_topology::set_all_weights(double w)
     for (auto e_range = boost::edges(m_graph); e_range.first != e_range.second; ++e_range.first) {
         m_graph[*e_range.first] = w;
     }
+    unsafe_bump_version();
 }
 
 void base_bgl_topology::set_weight(std::size_t i, std::size_t j, double w)
@@ -204,6 +220,7 @@ void base_bgl_topology::set_weight(std::size_t i, std::size_t j, double w)
         = boost::edge(boost::vertex(detail::vcast(i), m_graph), boost::vertex(detail::vcast(j), m_graph), m_graph);
     if (ret.second) {
         m_graph[ret.first] = w;
+        unsafe_bump_version();
     } else {
         pagmo_throw(std::invalid_argument, "cannot set the weight of an edge in a BGL topology: the vertex "
                                                + std::to_string(i) + " is not connected to vertex "
@@ -229,6 +246,38 @@ std::pair<std::vector<std::size_t>, vector_double> base_bgl_topology::get_connec
     return retval;
 }
 
+std::shared_ptr<const topology_csr> base_bgl_topology::to_csr() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Build the snapshot only if the graph changed since the last call.
+    if (!m_csr) {
+        const auto nv = boost::num_vertices(m_graph);
+
+        std::vector<std::size_t> row_offsets, columns;
+        vector_double weights;
+        row_offsets.reserve(detail::scast(nv) + 1u);
+        columns.reserve(detail::scast(boost::num_edges(m_graph)));
+        weights.reserve(detail::scast(boost::num_edges(m_graph)));
+
+        row_offsets.push_back(0);
+        for (auto vs = boost::vertices(m_graph); vs.first != vs.second; ++vs.first) {
+            // NOTE: the in-edges are visited in the same order as the
+            // vertices returned by get_connections().
+            for (auto ie = boost::in_edges(*vs.first, m_graph); ie.first != ie.second; ++ie.first) {
+                columns.push_back(detail::scast(boost::source(*ie.first, m_graph)));
+                weights.push_back(m_graph[*ie.first]);
+            }
+            row_offsets.push_back(columns.size());
+        }
+
+        m_csr = std::make_shared<const topology_csr>(std::move(row_offsets), std::move(columns), std::move(weights),
+                                                     m_version);
+    }
+
+    return m_csr;
+}
+
 std::string base_bgl_topology::get_extra_info() const
 {
     std::ostringstream oss;
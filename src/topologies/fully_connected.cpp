@@ -29,6 +29,7 @@ see https://www.gnu.org/licenses/. */
 #include <atomic>
 #include <cstddef>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -113,6 +114,54 @@ std::pair<std::vector<std::size_t>, vector_double> fully_connected::get_connecti
     return retval;
 }
 
+// CSR snapshot.
+// NOTE: the snapshot lists all the n * (n - 1) edges explicitly, thus its
+// size and the cost of building it are quadratic in the number of vertices.
+// This is fine for the archipelago sizes pagmo is used with, and the
+// snapshot is rebuilt only when vertices are added.
+std::shared_ptr<const topology_csr> fully_connected::to_csr() const
+{
+    // NOTE: the only way of modifying a fully connected topology
+    // is push_back(), thus we can use the number of vertices
+    // as version.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    auto retval = std::atomic_load(&m_csr);
+    if (retval && retval->num_vertices() == num_vertices) {
+        return retval;
+    }
+
+    // Overflow check for the number of edges.
+    // LCOV_EXCL_START
+    if (num_vertices > 1u && num_vertices - 1u > std::numeric_limits<std::size_t>::max() / num_vertices) {
+        pagmo_throw(std::overflow_error,
+                    "Overflow detected in the computation of the number of edges of a fully connected topology");
+    }
+    // LCOV_EXCL_STOP
+    const auto num_edges = num_vertices ? num_vertices * (num_vertices - 1u) : std::size_t(0);
+
+    std::vector<std::size_t> row_offsets, columns;
+    row_offsets.reserve(boost::numeric_cast<decltype(row_offsets.size())>(num_vertices) + 1u);
+    columns.reserve(boost::numeric_cast<decltype(columns.size())>(num_edges));
+
+    row_offsets.push_back(0);
+    for (std::size_t i = 0; i < num_vertices; ++i) {
+        for (std::size_t j = 0; j < num_vertices; ++j) {
+            if (j != i) {
+                columns.push_back(j);
+            }
+        }
+        row_offsets.push_back(columns.size());
+    }
+
+    retval = std::make_shared<const topology_csr>(
+        std::move(row_offsets), std::move(columns),
+        vector_double(boost::numeric_cast<vector_double::size_type>(num_edges), m_weight), num_vertices);
+    std::atomic_store(&m_csr, retval);
+
+    return retval;
+}
+
 // Topology name.
 std::string fully_connected::get_name() const
 {
@@ -154,6 +203,9 @@ void fully_connected::load(Archive &ar, unsigned)
     ar >> num_vertices;
 
     m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+
+    // Discard the cached CSR snapshot.
+    std::atomic_store(&m_csr, std::shared_ptr<const topology_csr>{});
 }
 
 } // namespace pagmo
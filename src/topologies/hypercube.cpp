@@ -0,0 +1,162 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/hypercube.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+// Default constructor: weight of 1, zero vertices.
+hypercube::hypercube() : hypercube(0, 1.) {}
+
+// Ctor from edge weight, zero vertices.
+hypercube::hypercube(double w) : hypercube(0, w) {}
+
+// Ctor from number of vertices and edge weight.
+hypercube::hypercube(std::size_t n, double w) : m_weight(w), m_num_vertices(n)
+{
+    detail::topology_check_edge_weight(m_weight);
+}
+
+// Identical copy/move constructors.
+hypercube::hypercube(const hypercube &other)
+    : m_weight(other.m_weight), m_num_vertices(other.m_num_vertices.load(std::memory_order_relaxed))
+{
+}
+
+hypercube::hypercube(hypercube &&other) noexcept : hypercube(static_cast<const hypercube &>(other)) {}
+
+// Push back implementation.
+void hypercube::push_back()
+{
+    m_num_vertices.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// Get connections.
+// NOTE: the vertex i is connected to all the vertices whose index differs
+// from i by exactly one bit, restricted to the bits needed to represent
+// the largest vertex index. If the number of vertices is not a power of 2,
+// the vertices which do not exist are skipped.
+std::pair<std::vector<std::size_t>, vector_double> hypercube::get_connections(std::size_t i) const
+{
+    // Fetch the number of vertices.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    if (i >= num_vertices) {
+        pagmo_throw(std::invalid_argument,
+                    "Cannot get the connections to the vertex at index " + std::to_string(i)
+                        + " in a hypercube topology: the number of vertices in the topology is only "
+                        + std::to_string(num_vertices));
+    }
+
+    std::pair<std::vector<std::size_t>, vector_double> retval;
+
+    // NOTE: here num_vertices > 0 because i < num_vertices.
+    for (auto max_idx = num_vertices - 1u, bit = std::size_t(1); max_idx; max_idx >>= 1, bit <<= 1) {
+        const auto j = i ^ bit;
+        if (j < num_vertices) {
+            retval.first.push_back(j);
+        }
+    }
+
+    retval.second.resize(retval.first.size(), m_weight);
+
+    return retval;
+}
+
+// Topology name.
+std::string hypercube::get_name() const
+{
+    return "Hypercube";
+}
+
+// Topology extra info.
+std::string hypercube::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\tNumber of vertices: " << m_num_vertices.load(std::memory_order_relaxed) << '\n';
+    oss << "\tEdges' weight: " << m_weight << '\n';
+    return oss.str();
+}
+
+// Get the edge weight.
+double hypercube::get_weight() const
+{
+    return m_weight;
+}
+
+// Get the number of vertices.
+std::size_t hypercube::num_vertices() const
+{
+    return m_num_vertices.load(std::memory_order_relaxed);
+}
+
+// Serialization.
+template <typename Archive>
+void hypercube::save(Archive &ar, unsigned) const
+{
+    detail::archive(ar, m_weight, m_num_vertices.load(std::memory_order_relaxed));
+}
+
+template <typename Archive>
+void hypercube::load(Archive &ar, unsigned)
+{
+    double weight;
+    std::size_t num_vertices;
+
+    ar >> weight;
+    ar >> num_vertices;
+
+    // NOTE: go through the constructor to check the loaded values.
+    hypercube tmp(num_vertices, weight);
+
+    m_weight = tmp.m_weight;
+    m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_TOPOLOGY_IMPLEMENT(pagmo::hypercube)
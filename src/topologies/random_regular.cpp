@@ -0,0 +1,283 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/detail/topology_hash.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/random_regular.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// A pseudo-random permutation of the [0, n) range, computed on the fly
+// via a 4-round Feistel network with cycle walking. The permutation
+// is entirely determined by the seed, the index of the round and n,
+// and both the permutation and its inverse can be evaluated in O(1) time
+// (on average) without storing anything.
+class random_regular_perm
+{
+public:
+    explicit random_regular_perm(std::uint64_t n, unsigned seed, std::uint64_t round)
+        : m_n(n), m_seed(seed), m_round(round), m_half_bits(1)
+    {
+        // Determine the number of bits in each half of the Feistel network,
+        // so that the domain of the network 2**(2*m_half_bits) is not smaller than n.
+        while (m_half_bits < 32u && (std::uint64_t(1) << (2u * m_half_bits)) < n) {
+            ++m_half_bits;
+        }
+        m_mask = (std::uint64_t(1) << m_half_bits) - 1u;
+    }
+    std::uint64_t operator()(std::uint64_t x) const
+    {
+        // NOTE: cycle walking: the network is a permutation of a domain
+        // which is at most 4 times larger than [0, n), thus on average
+        // we need at most 4 iterations to end up back in [0, n).
+        do {
+            x = forward(x);
+        } while (x >= m_n);
+        return x;
+    }
+    std::uint64_t inverse(std::uint64_t x) const
+    {
+        do {
+            x = backward(x);
+        } while (x >= m_n);
+        return x;
+    }
+
+private:
+    std::uint64_t f(unsigned t, std::uint64_t x) const
+    {
+        return topology_hash({m_seed, m_round, t, x}) & m_mask;
+    }
+    std::uint64_t forward(std::uint64_t x) const
+    {
+        auto l = x >> m_half_bits, r = x & m_mask;
+        for (unsigned t = 0; t < 4u; ++t) {
+            const auto tmp = r;
+            r = l ^ f(t, r);
+            l = tmp;
+        }
+        return (l << m_half_bits) | r;
+    }
+    std::uint64_t backward(std::uint64_t x) const
+    {
+        auto l = x >> m_half_bits, r = x & m_mask;
+        for (unsigned t = 4; t > 0u; --t) {
+            const auto tmp = l;
+            l = r ^ f(t - 1u, l);
+            r = tmp;
+        }
+        return (l << m_half_bits) | r;
+    }
+
+    std::uint64_t m_n;
+    std::uint64_t m_seed;
+    std::uint64_t m_round;
+    unsigned m_half_bits;
+    std::uint64_t m_mask;
+};
+
+} // namespace
+
+} // namespace detail
+
+// Default constructor: degree 4, weight of 1, random seed, zero vertices.
+random_regular::random_regular() : random_regular(0, 4, 1.) {}
+
+// Ctor from degree, edge weight and seed, zero vertices.
+random_regular::random_regular(std::size_t k, double w, unsigned seed) : random_regular(0, k, w, seed) {}
+
+// Ctor from number of vertices, degree, edge weight and seed.
+random_regular::random_regular(std::size_t n, std::size_t k, double w, unsigned seed)
+    : m_degree(k), m_weight(w), m_seed(seed), m_num_vertices(n)
+{
+    if (!k || k % 2u) {
+        pagmo_throw(std::invalid_argument, "The degree of a random regular topology must be even and nonzero, but a "
+                                           "value of "
+                                               + std::to_string(k) + " was provided instead");
+    }
+    detail::topology_check_edge_weight(m_weight);
+}
+
+// Identical copy/move constructors.
+random_regular::random_regular(const random_regular &other)
+    : m_degree(other.m_degree), m_weight(other.m_weight), m_seed(other.m_seed),
+      m_num_vertices(other.m_num_vertices.load(std::memory_order_relaxed))
+{
+}
+
+random_regular::random_regular(random_regular &&other) noexcept
+    : random_regular(static_cast<const random_regular &>(other))
+{
+}
+
+// Push back implementation.
+void random_regular::push_back()
+{
+    m_num_vertices.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// Get connections.
+// NOTE: the graph is the union of k/2 Hamiltonian cycles, each one visiting
+// the vertices in the order established by a pseudo-random permutation. The neighbours
+// of a vertex in each cycle are thus computed by inverting the permutation
+// and looking at the previous/next positions in the cycle. Self loops and
+// duplicate edges are removed, so that the degree is at most k (and exactly k
+// with high probability when n is large).
+std::pair<std::vector<std::size_t>, vector_double> random_regular::get_connections(std::size_t i) const
+{
+    // Fetch the number of vertices.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    if (i >= num_vertices) {
+        pagmo_throw(std::invalid_argument,
+                    "Cannot get the connections to the vertex at index " + std::to_string(i)
+                        + " in a random regular topology: the number of vertices in the topology is only "
+                        + std::to_string(num_vertices));
+    }
+
+    std::pair<std::vector<std::size_t>, vector_double> retval;
+    retval.first.reserve(m_degree);
+
+    auto add_vertex = [&retval, i](std::size_t j) {
+        if (j != i && std::find(retval.first.begin(), retval.first.end(), j) == retval.first.end()) {
+            retval.first.push_back(j);
+        }
+    };
+
+    const auto n = static_cast<std::uint64_t>(num_vertices);
+    for (std::size_t r = 0; r < m_degree / 2u; ++r) {
+        const detail::random_regular_perm perm(n, m_seed, r);
+        const auto p = perm.inverse(i);
+        add_vertex(static_cast<std::size_t>(perm((p + 1u) % n)));
+        add_vertex(static_cast<std::size_t>(perm((p + n - 1u) % n)));
+    }
+
+    retval.second.resize(retval.first.size(), m_weight);
+
+    return retval;
+}
+
+// Topology name.
+std::string random_regular::get_name() const
+{
+    return "Random regular";
+}
+
+// Topology extra info.
+std::string random_regular::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\tNumber of vertices: " << m_num_vertices.load(std::memory_order_relaxed) << '\n';
+    oss << "\tDegree: " << m_degree << '\n';
+    oss << "\tEdges' weight: " << m_weight << '\n';
+    oss << "\tSeed: " << m_seed << '\n';
+    return oss.str();
+}
+
+// Get the degree.
+std::size_t random_regular::get_degree() const
+{
+    return m_degree;
+}
+
+// Get the edge weight.
+double random_regular::get_weight() const
+{
+    return m_weight;
+}
+
+// Get the seed.
+unsigned random_regular::get_seed() const
+{
+    return m_seed;
+}
+
+// Get the number of vertices.
+std::size_t random_regular::num_vertices() const
+{
+    return m_num_vertices.load(std::memory_order_relaxed);
+}
+
+// Serialization.
+template <typename Archive>
+void random_regular::save(Archive &ar, unsigned) const
+{
+    detail::archive(ar, m_degree, m_weight, m_seed, m_num_vertices.load(std::memory_order_relaxed));
+}
+
+template <typename Archive>
+void random_regular::load(Archive &ar, unsigned)
+{
+    std::size_t degree;
+    double weight;
+    unsigned seed;
+    std::size_t num_vertices;
+
+    ar >> degree;
+    ar >> weight;
+    ar >> seed;
+    ar >> num_vertices;
+
+    // NOTE: go through the constructor to check the loaded values.
+    random_regular tmp(num_vertices, degree, weight, seed);
+
+    m_degree = tmp.m_degree;
+    m_weight = tmp.m_weight;
+    m_seed = tmp.m_seed;
+    m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_TOPOLOGY_IMPLEMENT(pagmo::random_regular)
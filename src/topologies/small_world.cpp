@@ -0,0 +1,230 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/detail/topology_hash.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/small_world.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+// Default constructor: degree 4, rewiring probability 0.1, weight of 1, random seed, zero vertices.
+small_world::small_world() : small_world(0, 4, .1, 1.) {}
+
+// Ctor from degree, rewiring probability, edge weight and seed, zero vertices.
+small_world::small_world(std::size_t k, double beta, double w, unsigned seed) : small_world(0, k, beta, w, seed) {}
+
+// Ctor from number of vertices, degree, rewiring probability, edge weight and seed.
+small_world::small_world(std::size_t n, std::size_t k, double beta, double w, unsigned seed)
+    : m_degree(k), m_beta(beta), m_weight(w), m_seed(seed), m_num_vertices(n)
+{
+    if (!k || k % 2u) {
+        pagmo_throw(std::invalid_argument, "The degree of a small-world topology must be even and nonzero, but a "
+                                           "value of "
+                                               + std::to_string(k) + " was provided instead");
+    }
+    if (!std::isfinite(beta) || beta < 0. || beta > 1.) {
+        pagmo_throw(std::invalid_argument,
+                    "The rewiring probability of a small-world topology must be in the [0, 1] range, but a value of "
+                        + std::to_string(beta) + " was provided instead");
+    }
+    detail::topology_check_edge_weight(m_weight);
+}
+
+// Identical copy/move constructors.
+small_world::small_world(const small_world &other)
+    : m_degree(other.m_degree), m_beta(other.m_beta), m_weight(other.m_weight), m_seed(other.m_seed),
+      m_num_vertices(other.m_num_vertices.load(std::memory_order_relaxed))
+{
+}
+
+small_world::small_world(small_world &&other) noexcept : small_world(static_cast<const small_world &>(other)) {}
+
+// Push back implementation.
+void small_world::push_back()
+{
+    m_num_vertices.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// Get connections.
+// NOTE: this is a directed variant of the Watts-Strogatz model. The starting point
+// is a ring lattice in which each vertex receives connections from its k/2 nearest
+// neighbours on each side. Each one of these incoming edges is then redirected,
+// with probability beta, to a source vertex chosen uniformly at random. The decisions
+// are taken via a hash of the seed, of the destination vertex and of the position
+// of the edge in the lattice, so that the connections of a vertex can be computed
+// in O(k) time without generating the rest of the graph. Self loops and duplicate edges
+// are removed.
+std::pair<std::vector<std::size_t>, vector_double> small_world::get_connections(std::size_t i) const
+{
+    // Fetch the number of vertices.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    if (i >= num_vertices) {
+        pagmo_throw(std::invalid_argument,
+                    "Cannot get the connections to the vertex at index " + std::to_string(i)
+                        + " in a small-world topology: the number of vertices in the topology is only "
+                        + std::to_string(num_vertices));
+    }
+
+    std::pair<std::vector<std::size_t>, vector_double> retval;
+
+    if (num_vertices == 1u) {
+        // NOTE: a single vertex does not connect to anything.
+        return retval;
+    }
+
+    retval.first.reserve(m_degree);
+
+    auto add_vertex = [&retval, i](std::size_t j) {
+        if (j != i && std::find(retval.first.begin(), retval.first.end(), j) == retval.first.end()) {
+            retval.first.push_back(j);
+        }
+    };
+
+    for (std::size_t j = 1; j <= m_degree / 2u; ++j) {
+        for (std::uint64_t side = 0; side < 2u; ++side) {
+            const auto h = detail::topology_hash({m_seed, i, j, side});
+            if (detail::topology_hash_to_unit(h) < m_beta) {
+                // Rewire to a random vertex different from i.
+                const auto r = detail::splitmix64(h) % (num_vertices - 1u);
+                add_vertex(static_cast<std::size_t>((i + 1u + r) % num_vertices));
+            } else {
+                const auto jm = j % num_vertices;
+                add_vertex(side ? (i + num_vertices - jm) % num_vertices : (i + jm) % num_vertices);
+            }
+        }
+    }
+
+    retval.second.resize(retval.first.size(), m_weight);
+
+    return retval;
+}
+
+// Topology name.
+std::string small_world::get_name() const
+{
+    return "Small world";
+}
+
+// Topology extra info.
+std::string small_world::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\tNumber of vertices: " << m_num_vertices.load(std::memory_order_relaxed) << '\n';
+    oss << "\tDegree: " << m_degree << '\n';
+    oss << "\tRewiring probability: " << m_beta << '\n';
+    oss << "\tEdges' weight: " << m_weight << '\n';
+    oss << "\tSeed: " << m_seed << '\n';
+    return oss.str();
+}
+
+// Get the degree.
+std::size_t small_world::get_degree() const
+{
+    return m_degree;
+}
+
+// Get the rewiring probability.
+double small_world::get_beta() const
+{
+    return m_beta;
+}
+
+// Get the edge weight.
+double small_world::get_weight() const
+{
+    return m_weight;
+}
+
+// Get the seed.
+unsigned small_world::get_seed() const
+{
+    return m_seed;
+}
+
+// Get the number of vertices.
+std::size_t small_world::num_vertices() const
+{
+    return m_num_vertices.load(std::memory_order_relaxed);
+}
+
+// Serialization.
+template <typename Archive>
+void small_world::save(Archive &ar, unsigned) const
+{
+    detail::archive(ar, m_degree, m_beta, m_weight, m_seed, m_num_vertices.load(std::memory_order_relaxed));
+}
+
+template <typename Archive>
+void small_world::load(Archive &ar, unsigned)
+{
+    std::size_t degree;
+    double beta, weight;
+    unsigned seed;
+    std::size_t num_vertices;
+
+    ar >> degree;
+    ar >> beta;
+    ar >> weight;
+    ar >> seed;
+    ar >> num_vertices;
+
+    // NOTE: go through the constructor to check the loaded values.
+    small_world tmp(num_vertices, degree, beta, weight, seed);
+
+    m_degree = tmp.m_degree;
+    m_beta = tmp.m_beta;
+    m_weight = tmp.m_weight;
+    m_seed = tmp.m_seed;
+    m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_TOPOLOGY_IMPLEMENT(pagmo::small_world)
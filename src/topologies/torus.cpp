@@ -0,0 +1,220 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/io.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/torus.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+// MINGW-specific warnings.
+#if defined(__GNUC__) && defined(__MINGW32__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+
+namespace pagmo
+{
+
+// Default constructor: a one-dimensional torus (i.e., a ring)
+// with unit weight and zero vertices.
+torus::torus() : torus(std::vector<std::size_t>{}) {}
+
+// Ctor from shape and edge weight, zero vertices.
+torus::torus(std::vector<std::size_t> shape, double w) : torus(0, std::move(shape), w) {}
+
+// Ctor from number of vertices, shape and edge weight.
+torus::torus(std::size_t n, std::vector<std::size_t> shape, double w)
+    : m_shape(std::move(shape)), m_layer_size(check_shape()), m_weight(w), m_num_vertices(n)
+{
+    detail::topology_check_edge_weight(m_weight);
+}
+
+// Check the shape and return the layer size
+// (i.e., the product of the sizes of the dimensions in the shape).
+std::size_t torus::check_shape() const
+{
+    std::size_t layer_size = 1;
+    for (const auto &s : m_shape) {
+        if (!s) {
+            pagmo_throw(std::invalid_argument, "The sizes of the dimensions of a torus topology must be nonzero");
+        }
+        if (layer_size > std::numeric_limits<std::size_t>::max() / s) {
+            pagmo_throw(std::overflow_error, "Overflow detected in the computation of the layer size of a torus "
+                                             "topology");
+        }
+        layer_size *= s;
+    }
+    return layer_size;
+}
+
+// Identical copy/move constructors.
+torus::torus(const torus &other)
+    : m_shape(other.m_shape), m_layer_size(other.m_layer_size), m_weight(other.m_weight),
+      m_num_vertices(other.m_num_vertices.load(std::memory_order_relaxed))
+{
+}
+
+torus::torus(torus &&other) noexcept : torus(static_cast<const torus &>(other)) {}
+
+// Push back implementation.
+void torus::push_back()
+{
+    m_num_vertices.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// Get connections.
+// NOTE: the vertices are laid out in row-major order in a lattice in which the sizes
+// of all the dimensions but the last are fixed (the shape). The last dimension
+// grows as vertices are added, and its size is the number of layers
+// (partially) occupied by the vertices. Each vertex is connected to its two
+// neighbours along each dimension, with periodic boundary conditions.
+std::pair<std::vector<std::size_t>, vector_double> torus::get_connections(std::size_t i) const
+{
+    // Fetch the number of vertices.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    if (i >= num_vertices) {
+        pagmo_throw(std::invalid_argument,
+                    "Cannot get the connections to the vertex at index " + std::to_string(i)
+                        + " in a torus topology: the number of vertices in the topology is only "
+                        + std::to_string(num_vertices));
+    }
+
+    std::pair<std::vector<std::size_t>, vector_double> retval;
+    retval.first.reserve(2u * (m_shape.size() + 1u));
+
+    // Helper to add a vertex to the list of connections, if it exists,
+    // if it is not i and if it was not added already.
+    auto add_vertex = [&retval, i, num_vertices](std::size_t j) {
+        if (j < num_vertices && j != i
+            && std::find(retval.first.begin(), retval.first.end(), j) == retval.first.end()) {
+            retval.first.push_back(j);
+        }
+    };
+
+    // Position of i within its layer, and index of the layer.
+    const auto pos = i % m_layer_size, layer = i / m_layer_size;
+    const auto layer_start = i - pos;
+
+    // The fixed dimensions.
+    std::size_t stride = 1;
+    for (const auto &s : m_shape) {
+        const auto c = (pos / stride) % s;
+        const auto base = pos - c * stride;
+        add_vertex(layer_start + base + ((c + 1u) % s) * stride);
+        add_vertex(layer_start + base + ((c + s - 1u) % s) * stride);
+        stride *= s;
+    }
+
+    // The last dimension.
+    const auto n_layers = (num_vertices - 1u) / m_layer_size + 1u;
+    add_vertex(((layer + 1u) % n_layers) * m_layer_size + pos);
+    add_vertex(((layer + n_layers - 1u) % n_layers) * m_layer_size + pos);
+
+    retval.second.resize(retval.first.size(), m_weight);
+
+    return retval;
+}
+
+// Topology name.
+std::string torus::get_name() const
+{
+    return "Torus";
+}
+
+// Topology extra info.
+std::string torus::get_extra_info() const
+{
+    std::ostringstream oss;
+    oss << "\tNumber of vertices: " << m_num_vertices.load(std::memory_order_relaxed) << '\n';
+    oss << "\tShape of the layers: ";
+    stream(oss, m_shape);
+    oss << "\n\tEdges' weight: " << m_weight << '\n';
+    return oss.str();
+}
+
+// Get the shape of the layers.
+const std::vector<std::size_t> &torus::get_shape() const
+{
+    return m_shape;
+}
+
+// Get the edge weight.
+double torus::get_weight() const
+{
+    return m_weight;
+}
+
+// Get the number of vertices.
+std::size_t torus::num_vertices() const
+{
+    return m_num_vertices.load(std::memory_order_relaxed);
+}
+
+// Serialization.
+template <typename Archive>
+void torus::save(Archive &ar, unsigned) const
+{
+    detail::archive(ar, m_shape, m_weight, m_num_vertices.load(std::memory_order_relaxed));
+}
+
+template <typename Archive>
+void torus::load(Archive &ar, unsigned)
+{
+    std::vector<std::size_t> shape;
+    double weight;
+    std::size_t num_vertices;
+
+    ar >> shape;
+    ar >> weight;
+    ar >> num_vertices;
+
+    // NOTE: go through the constructor to check the loaded values.
+    torus tmp(num_vertices, std::move(shape), weight);
+
+    m_shape = std::move(tmp.m_shape);
+    m_layer_size = tmp.m_layer_size;
+    m_weight = tmp.m_weight;
+    m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+}
+
+} // namespace pagmo
+
+PAGMO_S11N_TOPOLOGY_IMPLEMENT(pagmo::torus)
@@ -26,10 +26,14 @@ You should have received copies of the GNU General Public License and the
 GNU Lesser General Public License along with the PaGMO library.  If not,
 see https://www.gnu.org/licenses/. */
 
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include <boost/numeric/conversion/cast.hpp>
+
 #include <pagmo/s11n.hpp>
 #include <pagmo/topologies/unconnected.hpp>
 #include <pagmo/topology.hpp>
@@ -38,16 +42,95 @@ see https://www.gnu.org/licenses/. */
 namespace pagmo
 {
 
+// Default constructor: zero vertices.
+unconnected::unconnected() : m_num_vertices(0) {}
+
+// Identical copy/move constructors.
+unconnected::unconnected(const unconnected &other)
+    : m_num_vertices(other.m_num_vertices.load(std::memory_order_relaxed))
+{
+}
+
+unconnected::unconnected(unconnected &&other) noexcept : unconnected(static_cast<const unconnected &>(other)) {}
+
+// Identical copy/move assignment operators.
+unconnected &unconnected::operator=(const unconnected &other)
+{
+    if (this != &other) {
+        m_num_vertices.store(other.m_num_vertices.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        // Discard the cached CSR snapshot.
+        std::atomic_store(&m_csr, std::shared_ptr<const topology_csr>{});
+    }
+    return *this;
+}
+
+unconnected &unconnected::operator=(unconnected &&other) noexcept
+{
+    return *this = static_cast<const unconnected &>(other);
+}
+
 // Get connections (returns empty vectors).
 std::pair<std::vector<std::size_t>, vector_double> unconnected::get_connections(std::size_t) const
 {
     return std::make_pair(std::vector<std::size_t>{}, vector_double{});
 }
 
+// CSR snapshot (no edges).
+std::shared_ptr<const topology_csr> unconnected::to_csr() const
+{
+    // NOTE: as in fully_connected, the number of
+    // vertices doubles as version.
+    const auto num_vertices = m_num_vertices.load(std::memory_order_relaxed);
+
+    auto retval = std::atomic_load(&m_csr);
+    if (retval && retval->num_vertices() == num_vertices) {
+        return retval;
+    }
+
+    retval = std::make_shared<const topology_csr>(
+        std::vector<std::size_t>(boost::numeric_cast<std::vector<std::size_t>::size_type>(num_vertices) + 1u, 0u),
+        std::vector<std::size_t>{}, vector_double{}, num_vertices);
+    std::atomic_store(&m_csr, retval);
+
+    return retval;
+}
+
+// Add the next vertex.
+// NOTE: the number of vertices is tracked only
+// for the purpose of building CSR snapshots.
+void unconnected::push_back()
+{
+    m_num_vertices.fetch_add(1u, std::memory_order_relaxed);
+}
+
+// Get the number of vertices.
+std::size_t unconnected::num_vertices() const
+{
+    return m_num_vertices.load(std::memory_order_relaxed);
+}
+
 // Serialization.
 template <typename Archive>
-void unconnected::serialize(Archive &, unsigned)
+void unconnected::save(Archive &ar, unsigned) const
 {
+    ar << m_num_vertices.load(std::memory_order_relaxed);
+}
+
+template <typename Archive>
+void unconnected::load(Archive &ar, unsigned version)
+{
+    // NOTE: archives created before version 1 contain no data. The number
+    // of vertices is then set to zero, and the islands not included in the
+    // CSR snapshot will fall back to get_connections() (which is always
+    // empty anyway).
+    std::size_t num_vertices = 0;
+    if (version > 0u) {
+        ar >> num_vertices;
+    }
+    m_num_vertices.store(num_vertices, std::memory_order_relaxed);
+
+    // Discard the cached CSR snapshot.
+    std::atomic_store(&m_csr, std::shared_ptr<const topology_csr>{});
 }
 
 } // namespace pagmo
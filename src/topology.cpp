@@ -28,6 +28,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <ostream>
 #include <stdexcept>
 #include <string>
@@ -67,6 +68,106 @@ void topology_check_edge_weight(double w)
 
 } // namespace detail
 
+// Default constructor: a snapshot of an empty topology.
+topology_csr::topology_csr() : m_row_offsets(1u, 0u), m_version(0) {}
+
+// Constructor from row offsets, columns, weights and version.
+// Row i of the snapshot is the half-open range [row_offsets[i], row_offsets[i + 1])
+// in the vectors of columns and weights, and it contains the vertices
+// connecting to vertex i and the weights of the corresponding edges.
+topology_csr::topology_csr(std::vector<std::size_t> row_offsets, std::vector<std::size_t> columns,
+                           vector_double weights, unsigned long long version)
+    : m_row_offsets(std::move(row_offsets)), m_columns(std::move(columns)), m_weights(std::move(weights)),
+      m_version(version)
+{
+    if (m_row_offsets.empty() || m_row_offsets.front() != 0u) {
+        pagmo_throw(std::invalid_argument, "The vector of row offsets of a CSR topology snapshot must not be empty "
+                                           "and it must start with zero");
+    }
+    if (m_columns.size() != m_weights.size()) {
+        pagmo_throw(std::invalid_argument, "The vector of columns of a CSR topology snapshot has a size of "
+                                               + std::to_string(m_columns.size())
+                                               + ", while the vector of weights has a size of "
+                                               + std::to_string(m_weights.size()) + " (the two sizes must be equal)");
+    }
+    if (m_row_offsets.back() != m_columns.size()) {
+        pagmo_throw(std::invalid_argument, "The last row offset of a CSR topology snapshot is "
+                                               + std::to_string(m_row_offsets.back())
+                                               + ", but the number of edges is "
+                                               + std::to_string(m_columns.size()) + " (the two values must be equal)");
+    }
+    for (decltype(m_row_offsets.size()) i = 1; i < m_row_offsets.size(); ++i) {
+        if (m_row_offsets[i] < m_row_offsets[i - 1u]) {
+            pagmo_throw(std::invalid_argument,
+                        "The row offsets of a CSR topology snapshot must be non-decreasing, but the offset at index "
+                            + std::to_string(i) + " is smaller than the previous one");
+        }
+    }
+    const auto nv = num_vertices();
+    for (const auto &c : m_columns) {
+        if (c >= nv) {
+            pagmo_throw(std::invalid_argument, "Invalid vertex index " + std::to_string(c)
+                                                   + " detected in a CSR topology snapshot with only "
+                                                   + std::to_string(nv) + " vertices");
+        }
+    }
+    for (const auto &w : m_weights) {
+        detail::topology_check_edge_weight(w);
+    }
+}
+
+// Number of vertices.
+std::size_t topology_csr::num_vertices() const
+{
+    return m_row_offsets.size() - 1u;
+}
+
+// Number of edges.
+std::size_t topology_csr::num_edges() const
+{
+    return m_columns.size();
+}
+
+// Version of the snapshot.
+unsigned long long topology_csr::get_version() const
+{
+    return m_version;
+}
+
+// Row offsets.
+const std::vector<std::size_t> &topology_csr::get_row_offsets() const
+{
+    return m_row_offsets;
+}
+
+// Columns (i.e., the indices of the connecting vertices).
+const std::vector<std::size_t> &topology_csr::get_columns() const
+{
+    return m_columns;
+}
+
+// Weights.
+const vector_double &topology_csr::get_weights() const
+{
+    return m_weights;
+}
+
+// Get the connections to vertex i.
+std::pair<std::vector<std::size_t>, vector_double> topology_csr::get_connections(std::size_t i) const
+{
+    if (i >= num_vertices()) {
+        pagmo_throw(std::invalid_argument, "Cannot get the connections to the vertex at index " + std::to_string(i)
+                                               + " in a CSR topology snapshot: the number of vertices is only "
+                                               + std::to_string(num_vertices()));
+    }
+
+    return std::make_pair(std::vector<std::size_t>(m_columns.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[i]),
+                                                   m_columns.begin()
+                                                       + static_cast<std::ptrdiff_t>(m_row_offsets[i + 1u])),
+                          vector_double(m_weights.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[i]),
+                                        m_weights.begin() + static_cast<std::ptrdiff_t>(m_row_offsets[i + 1u])));
+}
+
 topology::topology() : topology(unconnected{}) {}
 
 void topology::generic_ctor_impl()
@@ -140,6 +241,25 @@ std::pair<std::vector<std::size_t>, vector_double> topology::get_connections(std
     return retval;
 }
 
+bool topology::has_to_csr() const
+{
+    return ptr()->has_to_csr();
+}
+
+std::shared_ptr<const topology_csr> topology::to_csr() const
+{
+    auto retval = ptr()->to_csr();
+
+    // NOTE: the content of the snapshot has already been
+    // validated upon its construction.
+    if (!retval) {
+        pagmo_throw(std::invalid_argument,
+                    "A null pointer was returned by the 'to_csr()' method of the '" + get_name() + "' topology");
+    }
+
+    return retval;
+}
+
 void topology::push_back()
 {
     ptr()->push_back();
@@ -29,14 +29,20 @@ see https://www.gnu.org/licenses/. */
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <pagmo/detail/custom_comparisons.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/rng.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/generic.hpp>
 
@@ -67,6 +73,50 @@ bool some_bound_is_equal(const problem &prob)
     return false;
 }
 
+vector_double batch_random_decision_vector_impl(const problem &prob, vector_double::size_type n, std::uint64_t key)
+{
+    const auto nx = prob.get_nx();
+    const auto ncx = nx - prob.get_nix();
+    const auto &lb = prob.get_lb();
+    const auto &ub = prob.get_ub();
+
+    // Prepare the return value.
+    vector_double out(nx * n);
+
+    // The i-th decision vector is generated from the i-th stream of the engine, so that the
+    // result is independent of the partitioning of the range among the threads.
+    using range_t = tbb::blocked_range<vector_double::size_type>;
+    tbb::parallel_for(range_t(0u, n), [&](const range_t &range) {
+        std::uniform_int_distribution<long long> idist;
+        for (auto i = range.begin(); i != range.end(); ++i) {
+            philox4x32 eng(key, i);
+            const auto dv = out.data() + i * nx;
+            // Continuous part: draw the numbers in [0, 1) in bulk, then rescale them in place.
+            eng.generate_canonical(dv, ncx);
+            for (vector_double::size_type j = 0; j < ncx; ++j) {
+                if (lb[j] == ub[j]) {
+                    dv[j] = lb[j];
+                } else {
+                    dv[j] = lb[j] + (ub[j] - lb[j]) * dv[j];
+                    // NOTE: because of rounding, the value above might end up being
+                    // equal to ub. Make sure we stay in the half-open range.
+                    if (dv[j] >= ub[j]) {
+                        dv[j] = std::nextafter(ub[j], lb[j]);
+                    }
+                }
+            }
+            // Integer part.
+            for (auto j = ncx; j < nx; ++j) {
+                dv[j] = static_cast<double>(
+                    idist(eng, std::uniform_int_distribution<long long>::param_type(static_cast<long long>(lb[j]),
+                                                                                    static_cast<long long>(ub[j]))));
+            }
+        }
+    });
+
+    return out;
+}
+
 } // namespace detail
 
 /// Binomial coefficient
@@ -0,0 +1,543 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
+
+namespace pagmo
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// The operators below process the genes in chunks of this size: the random
+// numbers needed by a chunk are drawn in bulk into stack storage, the genes
+// of the chunk which undergo variation are then compacted into an index
+// array, and the (expensive) variation formulae are evaluated only on them.
+constexpr vector_double::size_type go_chunk_size = 64u;
+
+// Check the input of the batch operators.
+void go_check_batch(const vector_double &dvs, const std::pair<vector_double, vector_double> &bounds,
+                    vector_double::size_type nix, double p, double eta, const std::string &name)
+{
+    const auto nx = bounds.first.size();
+    if (nx == 0u || bounds.second.size() != nx) {
+        pagmo_throw(std::invalid_argument,
+                    "Invalid bounds passed to " + name
+                        + ": the lower and upper bounds must have the same nonzero size, but sizes of "
+                        + std::to_string(nx) + " and " + std::to_string(bounds.second.size())
+                        + " were detected instead");
+    }
+    if (nix > nx) {
+        pagmo_throw(std::invalid_argument, "The integer dimension passed to " + name + " (" + std::to_string(nix)
+                                               + ") is larger than the dimension of the bounds ("
+                                               + std::to_string(nx) + ")");
+    }
+    if (dvs.size() % nx) {
+        pagmo_throw(std::invalid_argument, "The size of the batch passed to " + name + " ("
+                                               + std::to_string(dvs.size())
+                                               + ") is not a multiple of the dimension of the bounds ("
+                                               + std::to_string(nx) + ")");
+    }
+    if (!(p >= 0. && p <= 1.)) {
+        pagmo_throw(std::invalid_argument, "The probability passed to " + name
+                                               + " must be in the [0,1] range, while a value of " + std::to_string(p)
+                                               + " was detected");
+    }
+    if (!(eta >= 1. && eta <= 100.)) {
+        pagmo_throw(std::invalid_argument, "The distribution index passed to " + name
+                                               + " must be in [1, 100], while a value of " + std::to_string(eta)
+                                               + " was detected");
+    }
+}
+
+// SBX crossover of the couple (x1, x2), in place.
+void sbx_couple(double *x1, double *x2, const double *lb, const double *ub, vector_double::size_type ncx,
+                vector_double::size_type nx, double p_cr, double eta_c, philox4x32 &eng)
+{
+    std::uniform_real_distribution<double> drng(0., 1.);
+    const auto ex = 1. / (eta_c + 1.);
+
+    // Simulated binary crossover of the continuous part.
+    if (drng(eng) <= p_cr) {
+        // For each gene we need three random numbers: one to decide whether
+        // the gene is crossed over, one for the spread factor and one
+        // to decide which child gets which value.
+        std::array<double, 3u * go_chunk_size> u;
+        std::array<vector_double::size_type, go_chunk_size> idx;
+        for (vector_double::size_type c = 0; c < ncx; c += go_chunk_size) {
+            const auto m = std::min(go_chunk_size, ncx - c);
+            eng.generate_canonical(u.data(), 3u * m);
+            vector_double::size_type n_active = 0;
+            for (vector_double::size_type k = 0; k < m; ++k) {
+                const auto j = c + k;
+                idx[n_active] = k;
+                n_active += static_cast<vector_double::size_type>(u[k] <= .5 && std::abs(x1[j] - x2[j]) > 1e-14
+                                                                  && lb[j] != ub[j]);
+            }
+            for (vector_double::size_type h = 0; h < n_active; ++h) {
+                const auto k = idx[h], j = c + k;
+                const auto yl = lb[j], yu = ub[j];
+                const auto y1 = std::min(x1[j], x2[j]), y2 = std::max(x1[j], x2[j]);
+                const auto r = u[m + k];
+
+                auto beta = 1. + (2. * (y1 - yl) / (y2 - y1));
+                auto alpha = 2. - std::pow(beta, -(eta_c + 1.));
+                auto betaq = std::pow((r <= 1. / alpha) ? r * alpha : 1. / (2. - r * alpha), ex);
+                const auto c1 = std::min(std::max(0.5 * ((y1 + y2) - betaq * (y2 - y1)), yl), yu);
+
+                beta = 1. + (2. * (yu - y2) / (y2 - y1));
+                alpha = 2. - std::pow(beta, -(eta_c + 1.));
+                betaq = std::pow((r <= 1. / alpha) ? r * alpha : 1. / (2. - r * alpha), ex);
+                const auto c2 = std::min(std::max(0.5 * ((y1 + y2) + betaq * (y2 - y1)), yl), yu);
+
+                const bool first = u[2u * m + k] <= .5;
+                x1[j] = first ? c1 : c2;
+                x2[j] = first ? c2 : c1;
+            }
+        }
+    }
+
+    // Two-point crossover of the integer part.
+    if (nx > ncx && drng(eng) <= p_cr) {
+        std::uniform_int_distribution<vector_double::size_type> ra_num(0, nx - ncx - 1u);
+        auto site1 = ra_num(eng);
+        auto site2 = ra_num(eng);
+        if (site1 > site2) {
+            std::swap(site1, site2);
+        }
+        std::swap_ranges(x1 + ncx + site1, x1 + ncx + site2, x2 + ncx + site1);
+    }
+}
+
+// Polynomial mutation of x, in place.
+void poly_mutate(double *x, const double *lb, const double *ub, vector_double::size_type ncx,
+                 vector_double::size_type nx, double p_m, double eta_m, philox4x32 &eng)
+{
+    const auto mut_pow = 1. / (eta_m + 1.);
+
+    // Polynomial mutation of the continuous part. For each gene we need two random
+    // numbers: one to decide whether the gene is mutated, and one for the perturbation.
+    std::array<double, 2u * go_chunk_size> u;
+    std::array<vector_double::size_type, go_chunk_size> idx;
+    for (vector_double::size_type c = 0; c < ncx; c += go_chunk_size) {
+        const auto m = std::min(go_chunk_size, ncx - c);
+        eng.generate_canonical(u.data(), 2u * m);
+        vector_double::size_type n_active = 0;
+        for (vector_double::size_type k = 0; k < m; ++k) {
+            idx[n_active] = k;
+            n_active += static_cast<vector_double::size_type>(u[k] <= p_m && lb[c + k] != ub[c + k]);
+        }
+        for (vector_double::size_type h = 0; h < n_active; ++h) {
+            const auto k = idx[h], j = c + k;
+            const auto y = x[j], yl = lb[j], yu = ub[j];
+            const auto rnd = u[m + k];
+            const bool low = rnd <= .5;
+            const auto xy = low ? 1. - (y - yl) / (yu - yl) : 1. - (yu - y) / (yu - yl);
+            const auto xy_pow = std::pow(xy, eta_m + 1.);
+            const auto val = low ? 2. * rnd + (1. - 2. * rnd) * xy_pow : 2. * (1. - rnd) + 2. * (rnd - 0.5) * xy_pow;
+            const auto d = std::pow(val, mut_pow);
+            const auto deltaq = low ? d - 1. : 1. - d;
+            x[j] = std::min(std::max(y + deltaq * (yu - yl), yl), yu);
+        }
+    }
+
+    // Uniform mutation of the integer part.
+    std::uniform_real_distribution<double> drng(0., 1.);
+    for (auto j = ncx; j < nx; ++j) {
+        if (drng(eng) < p_m) {
+            x[j] = uniform_integral_from_range(lb[j], ub[j], eng);
+        }
+    }
+}
+
+// Write into trial[b, e) the DE mutant base + F * (d[0] - d[1]) + F * (d[2] - d[3]) + ...
+template <std::size_t N>
+void de_mutant(double *trial, const double *base, const std::array<const double *, 2u * N> &d, double F,
+               vector_double::size_type b, vector_double::size_type e)
+{
+    for (auto n = b; n < e; ++n) {
+        auto v = base[n];
+        for (std::size_t k = 0; k < N; ++k) {
+            v += (d[2u * k][n] - d[2u * k + 1u][n]) * F;
+        }
+        trial[n] = v;
+    }
+}
+
+// DE mutation and crossover. trial contains the target vector on input.
+template <std::size_t N>
+void de_variation(double *trial, const double *base, const std::array<const double *, 2u * N> &d, double F, double CR,
+                  bool binomial, vector_double::size_type dim, philox4x32 &eng)
+{
+    const auto n0 = std::uniform_int_distribution<vector_double::size_type>(0u, dim - 1u)(eng);
+    if (binomial) {
+        // Binomial crossover: each gene comes from the mutant with probability CR,
+        // and the gene n0 always comes from the mutant.
+        std::array<double, go_chunk_size> u;
+        for (vector_double::size_type c = 0; c < dim; c += go_chunk_size) {
+            const auto m = std::min(go_chunk_size, dim - c);
+            eng.generate_canonical(u.data(), m);
+            for (vector_double::size_type k = 0; k < m; ++k) {
+                const auto n = c + k;
+                auto v = base[n];
+                for (std::size_t l = 0; l < N; ++l) {
+                    v += (d[2u * l][n] - d[2u * l + 1u][n]) * F;
+                }
+                trial[n] = (u[k] < CR || n == n0) ? v : trial[n];
+            }
+        }
+    } else {
+        // Exponential crossover: a (circular) run of L genes starting from n0
+        // comes from the mutant, L being determined by a sequence of Bernoulli trials.
+        vector_double::size_type L = 1;
+        std::uniform_real_distribution<double> drng(0., 1.);
+        while (L < dim && drng(eng) < CR) {
+            ++L;
+        }
+        de_mutant<N>(trial, base, d, F, n0, std::min(n0 + L, dim));
+        if (n0 + L > dim) {
+            de_mutant<N>(trial, base, d, F, 0, n0 + L - dim);
+        }
+    }
+}
+
+} // namespace
+
+} // namespace detail
+
+/// Simulated binary crossover of a batch of couples
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This function applies, in place, the simulated binary crossover (SBX) to the continuous part and
+ * a two-point crossover to the integer part of a batch of decision vectors. The decision vectors
+ * are stored contiguously in \p dvs, as in the batch fitness evaluation format (see pagmo::bfe), and the
+ * \f$k\f$-th couple is formed by the decision vectors \f$2k\f$ and \f$2k+1\f$, which are replaced by the two children.
+ *
+ * The random numbers needed by the \f$k\f$-th couple are drawn in bulk from the \f$k\f$-th stream of a
+ * pagmo::philox4x32 engine with key \p key, so that the couples are processed in parallel and the
+ * result depends only on the input arguments.
+ *
+ * @param dvs the batch of decision vectors.
+ * @param bounds the problem bounds.
+ * @param nix the integer dimension of the problem.
+ * @param p_cr crossover probability.
+ * @param eta_c distribution index of the SBX crossover.
+ * @param key the key of the random engine.
+ *
+ * @throws std::invalid_argument if the bounds are empty or have different sizes, if \p nix is larger than the
+ * dimension of the bounds, if the size of \p dvs is not a multiple of twice the dimension of the bounds,
+ * if \p p_cr is not in \f$\left[0,1\right]\f$ or if \p eta_c is not in \f$\left[1,100\right]\f$.
+ */
+void sbx_crossover_batch(vector_double &dvs, const std::pair<vector_double, vector_double> &bounds,
+                         vector_double::size_type nix, double p_cr, double eta_c, std::uint64_t key)
+{
+    detail::go_check_batch(dvs, bounds, nix, p_cr, eta_c, "sbx_crossover_batch()");
+    const auto nx = bounds.first.size();
+    if (dvs.size() % (2u * nx)) {
+        pagmo_throw(std::invalid_argument, "The batch passed to sbx_crossover_batch() must contain an even "
+                                           "number of decision vectors, but "
+                                               + std::to_string(dvs.size() / nx) + " decision vectors were detected");
+    }
+
+    const auto ncx = nx - nix;
+    const auto lb = bounds.first.data(), ub = bounds.second.data();
+    const auto x = dvs.data();
+    using range_t = tbb::blocked_range<vector_double::size_type>;
+    tbb::parallel_for(range_t(0u, dvs.size() / (2u * nx)), [&](const range_t &range) {
+        for (auto k = range.begin(); k != range.end(); ++k) {
+            philox4x32 eng(key, k);
+            detail::sbx_couple(x + 2u * k * nx, x + (2u * k + 1u) * nx, lb, ub, ncx, nx, p_cr, eta_c, eng);
+        }
+    });
+}
+
+/// Polynomial mutation of a batch of decision vectors
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This function applies, in place, the polynomial mutation to the continuous part and a uniform
+ * mutation to the integer part of a batch of decision vectors. The decision vectors
+ * are stored contiguously in \p dvs, as in the batch fitness evaluation format (see pagmo::bfe).
+ * Each gene is mutated with probability \p p_m.
+ *
+ * The random numbers needed by the \f$k\f$-th decision vector are drawn in bulk from the \f$k\f$-th stream of a
+ * pagmo::philox4x32 engine with key \p key, so that the decision vectors are processed in parallel and the
+ * result depends only on the input arguments.
+ *
+ * @param dvs the batch of decision vectors.
+ * @param bounds the problem bounds.
+ * @param nix the integer dimension of the problem.
+ * @param p_m mutation probability.
+ * @param eta_m distribution index of the polynomial mutation.
+ * @param key the key of the random engine.
+ *
+ * @throws std::invalid_argument if the bounds are empty or have different sizes, if \p nix is larger than the
+ * dimension of the bounds, if the size of \p dvs is not a multiple of the dimension of the bounds,
+ * if \p p_m is not in \f$\left[0,1\right]\f$ or if \p eta_m is not in \f$\left[1,100\right]\f$.
+ * @throws unspecified any exception thrown by pagmo::uniform_integral_from_range().
+ */
+void polynomial_mutation_batch(vector_double &dvs, const std::pair<vector_double, vector_double> &bounds,
+                               vector_double::size_type nix, double p_m, double eta_m, std::uint64_t key)
+{
+    detail::go_check_batch(dvs, bounds, nix, p_m, eta_m, "polynomial_mutation_batch()");
+
+    const auto nx = bounds.first.size();
+    const auto ncx = nx - nix;
+    const auto lb = bounds.first.data(), ub = bounds.second.data();
+    const auto x = dvs.data();
+    using range_t = tbb::blocked_range<vector_double::size_type>;
+    tbb::parallel_for(range_t(0u, dvs.size() / nx), [&](const range_t &range) {
+        for (auto k = range.begin(); k != range.end(); ++k) {
+            philox4x32 eng(key, k);
+            detail::poly_mutate(x + k * nx, lb, ub, ncx, nx, p_m, eta_m, eng);
+        }
+    });
+}
+
+/// Differential evolution trial vector
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This function computes the trial vector of the differential evolution (DE) strategy \p variant
+ * for the target vector <tt>pop[i]</tt>, and writes it into \p trial. The mutant vector is built from the
+ * population members whose indices are stored in \p r and from the best decision vector \p best,
+ * and it is then recombined with the target vector via exponential or binomial crossover.
+ * Components of the trial vector which end up outside \p bounds are reinitialised uniformly within the bounds.
+ *
+ * The strategies are numbered as in pagmo::sade:
+ *
+ * - 1/6: DE/best/1/exp and DE/best/1/bin,
+ * - 2/7: DE/rand/1/exp and DE/rand/1/bin,
+ * - 3/8: DE/rand-to-best/1/exp and DE/rand-to-best/1/bin,
+ * - 4/9: DE/best/2/exp and DE/best/2/bin,
+ * - 5/10: DE/rand/2/exp and DE/rand/2/bin,
+ * - 11/12: DE/rand/3/exp and DE/rand/3/bin,
+ * - 13/14: DE/best/3/exp and DE/best/3/bin,
+ * - 15/16: DE/rand-to-current/2/exp and DE/rand-to-current/2/bin,
+ * - 17/18: DE/rand-to-best-and-current/2/exp and DE/rand-to-best-and-current/2/bin.
+ *
+ * The strategies 1 to 10 use the first 5 indices in \p r, the others use the first 7.
+ *
+ * @param trial the output trial vector, which must point to a memory area of size <tt>pop[i].size()</tt>.
+ * @param pop the population.
+ * @param i the index of the target vector in \p pop.
+ * @param r the indices of the randomly selected population members.
+ * @param best the best decision vector.
+ * @param variant the DE strategy.
+ * @param F the weight coefficient.
+ * @param CR the crossover probability.
+ * @param bounds the problem bounds.
+ * @param eng the random engine.
+ *
+ * @throws std::invalid_argument if \p variant is not in \f$\left[1,18\right]\f$, if \p i or any of the used
+ * indices in \p r is out of range, if \p r contains too few indices, or if the sizes of the decision vectors and
+ * of the bounds are not consistent.
+ */
+void de_trial(double *trial, const std::vector<vector_double> &pop, vector_double::size_type i,
+              const std::vector<vector_double::size_type> &r, const vector_double &best, unsigned variant, double F,
+              double CR, const std::pair<vector_double, vector_double> &bounds, philox4x32 &eng)
+{
+    if (variant < 1u || variant > 18u) {
+        pagmo_throw(std::invalid_argument,
+                    "The differential evolution variant must be in [1, .., 18], while a value of "
+                        + std::to_string(variant) + " was detected.");
+    }
+    if (i >= pop.size()) {
+        pagmo_throw(std::invalid_argument, "The index of the target vector (" + std::to_string(i)
+                                               + ") is out of range for a population of size "
+                                               + std::to_string(pop.size()));
+    }
+    const auto dim = pop[i].size();
+    if (dim == 0u || best.size() != dim || bounds.first.size() != dim || bounds.second.size() != dim) {
+        pagmo_throw(std::invalid_argument, "Inconsistent dimensions detected in the computation of a "
+                                           "differential evolution trial vector");
+    }
+    const auto n_idx = variant <= 10u ? 5u : 7u;
+    if (r.size() < n_idx) {
+        pagmo_throw(std::invalid_argument, "The differential evolution variant " + std::to_string(variant) + " needs "
+                                               + std::to_string(n_idx) + " random indices, but only "
+                                               + std::to_string(r.size()) + " were provided");
+    }
+    std::array<const double *, 7> p{};
+    for (auto k = 0u; k < n_idx; ++k) {
+        if (r[k] >= pop.size() || pop[r[k]].size() != dim) {
+            pagmo_throw(std::invalid_argument, "Invalid random index " + std::to_string(r[k])
+                                                   + " detected in the computation of a differential evolution "
+                                                     "trial vector");
+        }
+        p[k] = pop[r[k]].data();
+    }
+    const auto x = pop[i].data(), b = best.data();
+
+    std::copy(pop[i].begin(), pop[i].end(), trial);
+    // The strategies 1 to 10 come in blocks of 5 (exponential, then binomial), the others in
+    // exponential/binomial pairs.
+    const bool binomial = variant <= 10u ? variant > 5u : variant % 2u == 0u;
+    switch (variant <= 10u ? (variant - 1u) % 5u : 5u + (variant - 11u) / 2u) {
+        case 0u:
+            // DE/best/1.
+            detail::de_variation<1>(trial, b, {{p[1], p[2]}}, F, CR, binomial, dim, eng);
+            break;
+        case 1u:
+            // DE/rand/1.
+            detail::de_variation<1>(trial, p[0], {{p[1], p[2]}}, F, CR, binomial, dim, eng);
+            break;
+        case 2u:
+            // DE/rand-to-best/1.
+            detail::de_variation<2>(trial, x, {{b, x, p[0], p[1]}}, F, CR, binomial, dim, eng);
+            break;
+        case 3u:
+            // DE/best/2.
+            detail::de_variation<2>(trial, b, {{p[0], p[1], p[2], p[3]}}, F, CR, binomial, dim, eng);
+            break;
+        case 4u:
+            // DE/rand/2.
+            detail::de_variation<2>(trial, p[4], {{p[0], p[1], p[2], p[3]}}, F, CR, binomial, dim, eng);
+            break;
+        case 5u:
+            // DE/rand/3.
+            detail::de_variation<3>(trial, p[0], {{p[1], p[2], p[3], p[4], p[5], p[6]}}, F, CR, binomial, dim, eng);
+            break;
+        case 6u:
+            // DE/best/3.
+            detail::de_variation<3>(trial, b, {{p[1], p[2], p[3], p[4], p[5], p[6]}}, F, CR, binomial, dim, eng);
+            break;
+        case 7u:
+            // DE/rand-to-current/2.
+            detail::de_variation<2>(trial, p[0], {{p[1], x, p[2], p[3]}}, F, CR, binomial, dim, eng);
+            break;
+        default:
+            // DE/rand-to-best-and-current/2.
+            detail::de_variation<2>(trial, p[0], {{p[1], x, b, p[2]}}, F, CR, binomial, dim, eng);
+    }
+
+    // Force feasibility.
+    const auto &lb = bounds.first;
+    const auto &ub = bounds.second;
+    for (decltype(lb.size()) j = 0u; j < dim; ++j) {
+        if ((trial[j] < lb[j]) || (trial[j] > ub[j])) {
+            trial[j] = uniform_real_from_range(lb[j], ub[j], eng);
+        }
+    }
+}
+
+/// Differential evolution trial vectors for a whole population
+/**
+ * \verbatim embed:rst:leading-asterisk
+ * .. versionadded:: 2.12
+ *
+ * \endverbatim
+ *
+ * This function computes, via pagmo::de_trial(), one trial vector for each member of \p pop, using the same
+ * strategy and parameters for all the members. The indices of the population members used to build the
+ * mutant vectors are selected at random (without repetition). The trial vectors are returned
+ * contiguously, as in the batch fitness evaluation format (see pagmo::bfe).
+ *
+ * The random numbers needed by the \f$i\f$-th trial vector are drawn from the \f$i\f$-th stream of a
+ * pagmo::philox4x32 engine with key \p key, so that the trial vectors are computed in parallel and the
+ * result depends only on the input arguments.
+ *
+ * @param pop the population.
+ * @param best the best decision vector.
+ * @param variant the DE strategy.
+ * @param F the weight coefficient.
+ * @param CR the crossover probability.
+ * @param bounds the problem bounds.
+ * @param key the key of the random engine.
+ *
+ * @return the trial vectors.
+ *
+ * @throws std::invalid_argument if \p pop contains fewer members than the number of random indices
+ * needed by \p variant (5 for the strategies 1 to 10, 7 otherwise).
+ * @throws unspecified any exception thrown by pagmo::de_trial().
+ */
+vector_double de_trial_batch(const std::vector<vector_double> &pop, const vector_double &best, unsigned variant,
+                             double F, double CR, const std::pair<vector_double, vector_double> &bounds,
+                             std::uint64_t key)
+{
+    const auto NP = pop.size();
+    const auto n_idx = variant <= 10u ? 5u : 7u;
+    if (NP < n_idx) {
+        pagmo_throw(std::invalid_argument, "The differential evolution variant " + std::to_string(variant)
+                                               + " needs at least " + std::to_string(n_idx)
+                                               + " individuals in the population, " + std::to_string(NP)
+                                               + " detected");
+    }
+    const auto dim = best.size();
+    vector_double retval(NP * dim);
+
+    using range_t = tbb::blocked_range<vector_double::size_type>;
+    tbb::parallel_for(range_t(0u, NP), [&](const range_t &range) {
+        std::vector<vector_double::size_type> r(7);
+        std::uniform_int_distribution<vector_double::size_type> p_idx(0u, NP - 1u);
+        for (auto i = range.begin(); i != range.end(); ++i) {
+            philox4x32 eng(key, i);
+            // Select n_idx distinct indices at random.
+            for (auto j = 0u; j < n_idx; ++j) {
+                do {
+                    r[j] = p_idx(eng);
+                } while (std::find(r.begin(), r.begin() + j, r[j]) != r.begin() + j);
+            }
+            de_trial(retval.data() + i * dim, pop, i, r, best, variant, F, CR, bounds, eng);
+        }
+    });
+
+    return retval;
+}
+
+} // namespace pagmo
@@ -38,10 +38,12 @@ see https://www.gnu.org/licenses/. */
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstddef>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -676,6 +678,56 @@ BOOST_AUTO_TEST_CASE(archipelago_serialization)
     BOOST_CHECK(a.get_topology().extract<ring>()->num_vertices() == 10u);
 }
 
+// Helper to write an archipelago in the archive format
+// of version 0 (i.e., without the migration scheduler).
+struct archi_v0 {
+    template <typename Archive>
+    void save(Archive &ar, unsigned) const
+    {
+        std::vector<std::unique_ptr<island>> islands;
+        for (const auto &isl : *m_archi) {
+            islands.push_back(detail::make_unique<island>(isl));
+        }
+        detail::to_archive(ar, islands, m_archi->get_migrants_db(), m_archi->get_migration_log(),
+                           m_archi->get_topology(), m_archi->get_migration_type(), m_archi->get_migrant_handling());
+    }
+    template <typename Archive>
+    void load(Archive &, unsigned)
+    {
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+    const archipelago *m_archi;
+};
+
+BOOST_CLASS_TRACKING(archi_v0, boost::serialization::track_never)
+
+BOOST_AUTO_TEST_CASE(archipelago_serialization_v0)
+{
+    archipelago a{ring{}, 5, de{}, population{rosenbrock{}, 25}};
+    a.evolve(2);
+    a.wait_check();
+    a.set_migration_type(migration_type::broadcast);
+    const auto before = boost::lexical_cast<std::string>(a);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        const archi_v0 tmp{&a};
+        oarchive << tmp;
+    }
+    archipelago b;
+    b.set_migration_scheduler(migration_scheduler{});
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> b;
+    }
+    BOOST_CHECK_EQUAL(before, boost::lexical_cast<std::string>(b));
+    BOOST_CHECK(!b.get_migration_scheduler());
+    BOOST_CHECK(b.get_migration_type() == migration_type::broadcast);
+    BOOST_CHECK(b.get_migrants_db() == a.get_migrants_db());
+    BOOST_CHECK(b.get_topology().is<ring>());
+}
+
 BOOST_AUTO_TEST_CASE(archipelago_iterator_tests)
 {
     archipelago archi;
@@ -730,6 +782,78 @@ BOOST_AUTO_TEST_CASE(archipelago_champion_tests)
     BOOST_CHECK_THROW(archi.get_champions_x(), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(archipelago_summaries)
+{
+    archipelago archi;
+    BOOST_CHECK(archi.get_summaries().empty());
+    archi = archipelago{ring{}, 4, de{}, population{rosenbrock{}, 20}};
+    archi.evolve(2);
+    // Summaries can be fetched while the archipelago is evolving.
+    for (auto i = 0; i < 10; ++i) {
+        BOOST_CHECK_EQUAL(archi.get_summaries().size(), 4u);
+    }
+    archi.wait_check();
+    const auto sums = archi.get_summaries();
+    const auto cf = archi.get_champions_f();
+    BOOST_REQUIRE_EQUAL(sums.size(), 4u);
+    for (auto i = 0u; i < 4u; ++i) {
+        const auto pop = archi[i].get_population();
+        BOOST_CHECK(sums[i].get_evolutions() == 2u);
+        BOOST_CHECK(sums[i].get_population_size() == 20u);
+        BOOST_CHECK(sums[i].get_fevals() == pop.get_problem().get_fevals());
+        BOOST_CHECK(sums[i].get_champion_f() == pop.champion_f());
+        BOOST_CHECK(cf[i] == pop.champion_f());
+        BOOST_CHECK(archi.get_champions_x()[i] == pop.champion_x());
+    }
+}
+
+// A UDRP wrapping fair_replace without the in-place replacement.
+struct copy_fair_replace {
+    individuals_group_t replace(const individuals_group_t &inds, const vector_double::size_type &nx,
+                                const vector_double::size_type &nix, const vector_double::size_type &nobj,
+                                const vector_double::size_type &nec, const vector_double::size_type &nic,
+                                const vector_double &tol, const individuals_group_t &mig) const
+    {
+        return fair_replace{2}.replace(inds, nx, nix, nobj, nec, nic, tol, mig);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(archipelago_in_place_migration)
+{
+    for (auto in_place : {true, false}) {
+        archipelago archi = in_place ? archipelago{ring{}, 4u, de{10, .8, .9, 2u, 0., 0.}, rosenbrock{}, 20u,
+                                                   fair_replace{2}, select_best{2}}
+                                     : archipelago{ring{}, 4u, de{10, .8, .9, 2u, 0., 0.}, rosenbrock{}, 20u,
+                                                   copy_fair_replace{}, select_best{2}};
+        BOOST_CHECK(archi[0].get_r_policy().has_replace_in_place() == in_place);
+        archi.evolve(10);
+        // Fetch the populations while the archipelago is evolving.
+        for (auto i = 0; i < 10; ++i) {
+            BOOST_CHECK_EQUAL(archi[0].get_population().size(), 20u);
+        }
+        archi.wait_check();
+
+        // Migration happened, and the logged migrants are consistent.
+        const auto mlog = archi.get_migration_log();
+        BOOST_CHECK(!mlog.empty());
+        const rosenbrock r;
+        for (const auto &e : mlog) {
+            BOOST_CHECK(r.fitness(std::get<2>(e)) == std::get<3>(e));
+        }
+
+        // The populations are consistent after the migrants
+        // were inserted.
+        for (const auto &isl : archi) {
+            const auto pop = isl.get_population();
+            BOOST_CHECK_EQUAL(pop.size(), 20u);
+            for (decltype(pop.size()) i = 0; i < pop.size(); ++i) {
+                BOOST_CHECK(r.fitness(pop.get_x()[i]) == pop.get_f()[i]);
+            }
+            BOOST_CHECK(isl.get_summary().get_champion_f() == pop.champion_f());
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(archipelago_status)
 {
     flag.store(true);
@@ -923,3 +1047,197 @@ BOOST_AUTO_TEST_CASE(archipelago_mo_migration_bug)
     a.evolve(4);
     BOOST_CHECK_NO_THROW(a.wait_check());
 }
+
+BOOST_AUTO_TEST_CASE(archipelago_migration_scheduler)
+{
+    // Construction and validation.
+    migration_scheduler ms;
+    BOOST_CHECK(ms.get_migration_type() == migration_type::p2p);
+    BOOST_CHECK(ms.get_migrant_handling() == migrant_handling::preserve);
+    BOOST_CHECK(ms.get_gen_interval() == 1u);
+    BOOST_CHECK(ms.get_time_interval() == 0.);
+    BOOST_CHECK(ms.get_mailbox_size() == 1u);
+    BOOST_CHECK(std::isinf(ms.get_max_staleness()));
+    ms = migration_scheduler{migration_type::broadcast, migrant_handling::evict, 3u, 1.5, 4u, 10.};
+    BOOST_CHECK(ms.get_migration_type() == migration_type::broadcast);
+    BOOST_CHECK(ms.get_migrant_handling() == migrant_handling::evict);
+    BOOST_CHECK(ms.get_gen_interval() == 3u);
+    BOOST_CHECK(ms.get_time_interval() == 1.5);
+    BOOST_CHECK(ms.get_mailbox_size() == 4u);
+    BOOST_CHECK(ms.get_max_staleness() == 10.);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 0u}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 1u, -1.}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 1u,
+                                           std::numeric_limits<double>::infinity()}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 1u, 0., 0u}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 1u, 0., 1u, 0.}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((migration_scheduler{migration_type::p2p, migrant_handling::preserve, 1u, 0., 1u,
+                                           std::numeric_limits<double>::quiet_NaN()}),
+                      std::invalid_argument);
+
+    // Set/unset/get.
+    archipelago a{ring{}, 10, de{}, population{rosenbrock{}, 25}};
+    BOOST_CHECK(!a.get_migration_scheduler());
+    a.set_migration_scheduler(ms);
+    BOOST_CHECK(a.get_migration_scheduler());
+    BOOST_CHECK(a.get_migration_type() == migration_type::broadcast);
+    BOOST_CHECK(a.get_migrant_handling() == migrant_handling::evict);
+    a.set_migration_type(migration_type::p2p);
+    a.set_migrant_handling(migrant_handling::preserve);
+    BOOST_CHECK(a.get_migration_scheduler()->get_migration_type() == migration_type::p2p);
+    BOOST_CHECK(a.get_migration_scheduler()->get_migrant_handling() == migrant_handling::preserve);
+    BOOST_CHECK(a.get_migration_scheduler()->get_gen_interval() == 3u);
+    BOOST_CHECK(a.get_migration_scheduler()->get_mailbox_size() == 4u);
+    a.unset_migration_scheduler();
+    BOOST_CHECK(!a.get_migration_scheduler());
+
+    // Stream operator.
+    a.set_migration_scheduler(ms);
+    std::ostringstream oss;
+    oss << a;
+    BOOST_CHECK(boost::contains(oss.str(), "Migration scheduler:"));
+    BOOST_CHECK(boost::contains(oss.str(), "Mailbox size: 4"));
+
+    // Evolution with the scheduler.
+    for (auto mt : {migration_type::p2p, migration_type::broadcast}) {
+        for (auto mh : {migrant_handling::preserve, migrant_handling::evict}) {
+            archipelago b{ring{}, 10, de{}, population{rosenbrock{}, 25}};
+            b.set_migration_scheduler(migration_scheduler{mt, mh, 1u, 0., 2u});
+            b.evolve(10);
+            BOOST_CHECK_NO_THROW(b.wait_check());
+            BOOST_CHECK(!b.get_migration_log().empty());
+            for (const auto &e : b.get_migration_log()) {
+                BOOST_CHECK(std::get<4>(e) != std::get<5>(e));
+            }
+        }
+    }
+
+    // No migration if the generation interval is never reached.
+    archipelago c{ring{}, 10, de{}, population{rosenbrock{}, 25}};
+    c.set_migration_scheduler(migration_scheduler{migration_type::broadcast, migrant_handling::preserve, 100u});
+    c.evolve(10);
+    c.wait_check();
+    BOOST_CHECK(c.get_migration_log().empty());
+    // The migrants database is still populated.
+    BOOST_CHECK(!std::get<0>(c.get_migrants_db()[0]).empty());
+
+    // No migration if all the migrants are too old.
+    c.set_migration_scheduler(
+        migration_scheduler{migration_type::broadcast, migrant_handling::preserve, 1u, 0., 1u, 1E-12});
+    c.evolve(10);
+    c.wait_check();
+    BOOST_CHECK(c.get_migration_log().empty());
+
+    // Copy, move and serialization.
+    c.set_migration_scheduler(ms);
+    auto c2(c);
+    BOOST_CHECK(c2.get_migration_scheduler());
+    BOOST_CHECK(c2.get_migration_scheduler()->get_mailbox_size() == 4u);
+    auto c3(std::move(c2));
+    BOOST_CHECK(c3.get_migration_scheduler());
+    c2 = std::move(c3);
+    BOOST_CHECK(c2.get_migration_scheduler());
+    c2.evolve(2);
+    BOOST_CHECK_NO_THROW(c2.wait_check());
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << c2;
+    }
+    c2 = archipelago{};
+    BOOST_CHECK(!c2.get_migration_scheduler());
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> c2;
+    }
+    BOOST_CHECK(c2.get_migration_scheduler());
+    BOOST_CHECK(c2.get_migration_scheduler()->get_gen_interval() == 3u);
+    BOOST_CHECK(c2.get_migration_scheduler()->get_time_interval() == 1.5);
+    BOOST_CHECK(c2.get_migration_scheduler()->get_max_staleness() == 10.);
+    c2.evolve(2);
+    BOOST_CHECK_NO_THROW(c2.wait_check());
+    // Changing the topology and adding islands while
+    // the scheduler is active.
+    archipelago d{ring{}, 5, de{}, population{rosenbrock{}, 25}};
+    d.set_migration_scheduler(migration_scheduler{migration_type::broadcast, migrant_handling::preserve, 1u});
+    d.evolve(3);
+    d.wait_check();
+    d.push_back(de{}, population{rosenbrock{}, 25});
+    d.evolve(3);
+    d.wait_check();
+    d.set_topology(topology{unconnected{}});
+    const auto log_size = d.get_migration_log().size();
+    d.evolve(3);
+    d.wait_check();
+    BOOST_CHECK(d.get_migration_log().size() == log_size);
+    d.set_topology(topology{fully_connected{6u, 1.}});
+    d.evolve(3);
+    BOOST_CHECK_NO_THROW(d.wait_check());
+    BOOST_CHECK(d.get_migration_log().size() > log_size);
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_topology_csr)
+{
+    // Migration through a CSR snapshot of the topology.
+    archipelago a{fully_connected{}, 5, de{}, population{rosenbrock{}, 25}};
+    BOOST_CHECK(a.get_topology().has_to_csr());
+    a.evolve(5);
+    a.wait_check();
+    BOOST_CHECK(!a.get_migration_log().empty());
+    for (const auto &e : a.get_migration_log()) {
+        BOOST_CHECK(std::get<4>(e) != std::get<5>(e));
+    }
+
+    // Switching to an unconnected topology stops the migration.
+    a.set_topology(topology{unconnected{}});
+    const auto log_size = a.get_migration_log().size();
+    a.evolve(5);
+    a.wait_check();
+    BOOST_CHECK(a.get_migration_log().size() == log_size);
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_stats)
+{
+    // NOTE: disable the stopping criteria of de, so that
+    // the number of fitness evaluations is deterministic.
+    archipelago archi{ring{}, 5, de{10, .8, .9, 2u, 0., 0.}, rosenbrock{}, 20};
+    archi.set_stats_enabled(true);
+    for (const auto &isl : archi) {
+        BOOST_CHECK(isl.get_stats_enabled());
+    }
+
+    archi.evolve(4);
+    archi.wait_check();
+
+    const auto st = archi.get_stats();
+    BOOST_CHECK(st.size() == 5u);
+    for (const auto &s : st) {
+        BOOST_CHECK(s.get_queue_wait().get_count() == 1u);
+        BOOST_CHECK(s.get_evolve().get_count() == 4u);
+        BOOST_CHECK(s.get_migr_select().get_count() == 4u);
+        // The connections of a ring have unit weight, thus a
+        // migration is attempted at every generation.
+        BOOST_CHECK(s.get_migr_pull().get_count() == 4u);
+        BOOST_CHECK(s.get_migr_replace().get_count() == 4u);
+        BOOST_CHECK(s.get_fevals() == 800u);
+    }
+
+    const auto agg = archi.get_aggregated_stats();
+    BOOST_CHECK(agg.get_evolve().get_count() == 20u);
+    BOOST_CHECK(agg.get_fevals() == 4000u);
+    BOOST_CHECK(agg.get_migr_select().get_count() == 20u);
+    std::cout << agg << '\n';
+
+    archi.reset_stats();
+    BOOST_CHECK(archi.get_aggregated_stats().get_evolve().get_count() == 0u);
+
+    archi.set_stats_enabled(false);
+    archi.evolve();
+    archi.wait_check();
+    BOOST_CHECK(archi.get_aggregated_stats().get_evolve().get_count() == 0u);
+}
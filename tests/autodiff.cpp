@@ -0,0 +1,343 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+#define BOOST_TEST_MODULE autodiff_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/autodiff.hpp>
+#include <pagmo/problems/hock_schittkowsky_71.hpp>
+#include <pagmo/problems/luksan_vlcek1.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/dual.hpp>
+#include <pagmo/utils/gradients_and_hessians.hpp>
+
+using namespace pagmo;
+
+static std::mt19937 rng;
+
+// Versions of rosenbrock, hock_schittkowsky_71 and luksan_vlcek1
+// with a fitness function templated over the scalar type.
+struct ad_rosenbrock {
+    ad_rosenbrock(unsigned dim = 2u) : m_dim(dim) {}
+    template <typename S>
+    std::vector<S> fitness(const std::vector<S> &x) const
+    {
+        S retval(0.);
+        for (decltype(x.size()) i = 0u; i < x.size() - 1u; ++i) {
+            retval += 100. * (x[i] * x[i] - x[i + 1]) * (x[i] * x[i] - x[i + 1]) + (x[i] - 1) * (x[i] - 1);
+        }
+        return {retval};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return rosenbrock{m_dim}.get_bounds();
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::constant;
+    }
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned)
+    {
+        ar &m_dim;
+    }
+    unsigned m_dim;
+};
+
+PAGMO_S11N_PROBLEM_EXPORT(ad_rosenbrock)
+PAGMO_S11N_PROBLEM_EXPORT(autodiff<ad_rosenbrock>)
+
+struct ad_hs71 {
+    template <typename S>
+    std::vector<S> fitness(const std::vector<S> &x) const
+    {
+        return {x[0] * x[3] * (x[0] + x[1] + x[2]) + x[2], x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3] - 40.,
+                25. - x[0] * x[1] * x[2] * x[3]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return hock_schittkowsky_71{}.get_bounds();
+    }
+    vector_double::size_type get_nec() const
+    {
+        return 1u;
+    }
+    vector_double::size_type get_nic() const
+    {
+        return 1u;
+    }
+    std::vector<sparsity_pattern> hessians_sparsity() const
+    {
+        return hock_schittkowsky_71{}.hessians_sparsity();
+    }
+};
+
+struct ad_luksan_vlcek1 {
+    ad_luksan_vlcek1(unsigned dim = 3u) : m_dim(dim) {}
+    template <typename S>
+    std::vector<S> fitness(const std::vector<S> &x) const
+    {
+        using std::exp;
+        using std::pow;
+        using std::sin;
+        const auto n = x.size();
+        std::vector<S> f(1 + (n - 2), S(0.));
+        for (decltype(x.size()) i = 0u; i < n - 1u; ++i) {
+            const S a1 = x[i] * x[i] - x[i + 1];
+            const S a2 = x[i] - 1.;
+            f[0] += 100. * a1 * a1 + a2 * a2;
+        }
+        for (decltype(x.size()) i = 0u; i < n - 2u; ++i) {
+            f[i + 1] = (3. * pow(x[i + 1], 3.) + 2. * x[i + 2] - 5.
+                        + sin(x[i + 1] - x[i + 2]) * sin(x[i + 1] + x[i + 2]) + 4. * x[i + 1]
+                        - x[i] * exp(x[i] - x[i + 1]) - 3.);
+        }
+        return f;
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return luksan_vlcek1{m_dim}.get_bounds();
+    }
+    vector_double::size_type get_nec() const
+    {
+        return m_dim - 2u;
+    }
+    sparsity_pattern gradient_sparsity() const
+    {
+        return luksan_vlcek1{m_dim}.gradient_sparsity();
+    }
+    unsigned m_dim;
+};
+
+vector_double random_dv(const problem &p)
+{
+    const auto b = p.get_bounds();
+    vector_double retval(p.get_nx());
+    for (decltype(retval.size()) i = 0; i < retval.size(); ++i) {
+        retval[i] = std::uniform_real_distribution<double>(b.first[i], b.second[i])(rng);
+    }
+    return retval;
+}
+
+void check_close(const vector_double &a, const vector_double &b, double tol)
+{
+    BOOST_REQUIRE_EQUAL(a.size(), b.size());
+    for (decltype(a.size()) i = 0; i < a.size(); ++i) {
+        if (std::abs(b[i]) < 1e-12) {
+            BOOST_CHECK_SMALL(a[i], tol);
+        } else {
+            BOOST_CHECK_CLOSE(a[i], b[i], tol);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dual_arithmetic)
+{
+    using d2 = dual<double, 2>;
+    // x = 3 + e0, y = 2 + e1.
+    const d2 x(3., {{1., 0.}}), y(2., {{0., 1.}});
+    BOOST_CHECK(d2{}.value() == 0. && d2{}.derivs()[0] == 0.);
+    auto r = x * y + 2. * x - y / 4 + 1;
+    BOOST_CHECK_EQUAL(r.value(), 6. + 6. - .5 + 1.);
+    BOOST_CHECK_EQUAL(r.derivs()[0], 2. + 2.);
+    BOOST_CHECK_EQUAL(r.derivs()[1], 3. - .25);
+    r = x / y;
+    BOOST_CHECK_CLOSE(r.derivs()[0], .5, 1e-12);
+    BOOST_CHECK_CLOSE(r.derivs()[1], -.75, 1e-12);
+    r = -x - y;
+    BOOST_CHECK(r.value() == -5. && r.derivs()[0] == -1. && r.derivs()[1] == -1.);
+    BOOST_CHECK(x > y && y < x && x >= 3. && x <= 3. && x == 3. && x != y);
+
+    // Elementary functions.
+    BOOST_CHECK_CLOSE(sqrt(x).derivs()[0], .5 / std::sqrt(3.), 1e-12);
+    BOOST_CHECK_CLOSE(exp(x).derivs()[0], std::exp(3.), 1e-12);
+    BOOST_CHECK_CLOSE(log(x).derivs()[0], 1. / 3., 1e-12);
+    BOOST_CHECK_CLOSE(sin(x).derivs()[0], std::cos(3.), 1e-12);
+    BOOST_CHECK_CLOSE(cos(x).derivs()[0], -std::sin(3.), 1e-12);
+    BOOST_CHECK_CLOSE(tan(x).derivs()[0], 1. + std::tan(3.) * std::tan(3.), 1e-12);
+    BOOST_CHECK_CLOSE(atan(x).derivs()[0], .1, 1e-12);
+    BOOST_CHECK_EQUAL(abs(-x).derivs()[0], 1.);
+    BOOST_CHECK_CLOSE(pow(x, 3.).derivs()[0], 27., 1e-12);
+    BOOST_CHECK_CLOSE(pow(x, y).derivs()[0], 6., 1e-12);
+    BOOST_CHECK_CLOSE(pow(x, y).derivs()[1], 9. * std::log(3.), 1e-12);
+
+    // Nested duals: second derivatives of x**3 * y in (3, 2).
+    using dd = dual<d2, 2>;
+    const dd xx(d2(3., {{1., 0.}}), {{d2(1.), d2(0.)}}), yy(d2(2., {{0., 1.}}), {{d2(0.), d2(1.)}});
+    const auto h = pow(xx, 3.) * yy;
+    BOOST_CHECK_CLOSE(h.value().value(), 54., 1e-12);
+    BOOST_CHECK_CLOSE(h.derivs()[0].value(), 54., 1e-12);
+    BOOST_CHECK_CLOSE(h.derivs()[0].derivs()[0], 36., 1e-12);
+    BOOST_CHECK_CLOSE(h.derivs()[0].derivs()[1], 27., 1e-12);
+    BOOST_CHECK_CLOSE(h.derivs()[1].derivs()[0], 27., 1e-12);
+    BOOST_CHECK_SMALL(h.derivs()[1].derivs()[1], 1e-12);
+
+    std::ostringstream oss;
+    oss << x;
+    BOOST_CHECK_EQUAL(oss.str(), "3 [1, 0]");
+}
+
+BOOST_AUTO_TEST_CASE(autodiff_rosenbrock)
+{
+    for (auto dim : {2u, 3u, 4u, 5u, 9u}) {
+        problem p0{rosenbrock{dim}}, p1{autodiff<ad_rosenbrock>{ad_rosenbrock{dim}, true}},
+            p2{autodiff<ad_rosenbrock, 1>{ad_rosenbrock{dim}}};
+        BOOST_CHECK(p1.has_gradient());
+        BOOST_CHECK(p1.has_hessians());
+        BOOST_CHECK(!p2.has_hessians());
+        BOOST_CHECK(p1.get_thread_safety() == thread_safety::constant);
+        BOOST_CHECK(p1.get_name() == p1.extract<autodiff<ad_rosenbrock>>()->get_inner_problem().get_name()
+                                         + " [autodiff]");
+        for (auto i = 0; i < 10; ++i) {
+            const auto dv = random_dv(p0);
+            BOOST_CHECK(p1.fitness(dv) == p0.fitness(dv));
+            check_close(p1.gradient(dv), p0.gradient(dv), 1e-10);
+            check_close(p2.gradient(dv), p0.gradient(dv), 1e-10);
+            // Analytic hessian, dense lower triangle.
+            vector_double h;
+            for (decltype(dv.size()) r = 0; r < dim; ++r) {
+                for (decltype(dv.size()) c = 0; c <= r; ++c) {
+                    if (r == c) {
+                        h.push_back((r + 1u < dim ? 1200. * dv[r] * dv[r] - 400. * dv[r + 1] + 2. : 0.)
+                                    + (r > 0u ? 200. : 0.));
+                    } else if (r == c + 1u) {
+                        h.push_back(-400. * dv[c]);
+                    } else {
+                        h.push_back(0.);
+                    }
+                }
+            }
+            check_close(p1.hessians(dv)[0], h, 1e-10);
+        }
+        BOOST_CHECK(p1.get_fevals() == 10u);
+        BOOST_CHECK(p1.get_gevals() == 10u);
+        BOOST_CHECK(p1.get_hevals() == 10u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(autodiff_hs71)
+{
+    problem p0{hock_schittkowsky_71{}}, p1{autodiff<ad_hs71, 3>{ad_hs71{}, true}};
+    BOOST_CHECK(p1.get_nec() == 1u);
+    BOOST_CHECK(p1.get_nic() == 1u);
+    BOOST_CHECK(p1.gradient_sparsity() == p0.gradient_sparsity());
+    BOOST_CHECK(p1.hessians_sparsity() == p0.hessians_sparsity());
+    for (auto i = 0; i < 10; ++i) {
+        const auto dv = random_dv(p0);
+        BOOST_CHECK(p1.fitness(dv) == p0.fitness(dv));
+        check_close(p1.gradient(dv), p0.gradient(dv), 1e-10);
+        const auto h0 = p0.hessians(dv), h1 = p1.hessians(dv);
+        for (decltype(h0.size()) l = 0; l < h0.size(); ++l) {
+            check_close(h1[l], h0[l], 1e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(autodiff_luksan_vlcek1)
+{
+    for (auto dim : {3u, 6u, 11u}) {
+        problem p0{luksan_vlcek1{dim}}, p1{autodiff<ad_luksan_vlcek1>{ad_luksan_vlcek1{dim}, true}},
+            p2{autodiff<ad_luksan_vlcek1, 8>{ad_luksan_vlcek1{dim}, true}};
+        BOOST_CHECK(p1.gradient_sparsity() == p0.gradient_sparsity());
+        BOOST_CHECK(p1.hessians_sparsity() == detail::dense_hessians(p0.get_nf(), dim));
+        for (auto i = 0; i < 5; ++i) {
+            const auto dv = random_dv(p0);
+            BOOST_CHECK(p1.fitness(dv) == p0.fitness(dv));
+            check_close(p1.gradient(dv), p0.gradient(dv), 1e-9);
+            check_close(p2.gradient(dv), p0.gradient(dv), 1e-9);
+            // Check the hessians against the finite differences of the exact gradient.
+            const auto h1 = p1.hessians(dv), h2 = p2.hessians(dv);
+            const auto jac = estimate_gradient_h(
+                [&p1](const vector_double &x) {
+                    // Densify the sparse gradient.
+                    const auto g = p1.gradient(x);
+                    const auto sp = p1.gradient_sparsity();
+                    vector_double retval(p1.get_nf() * p1.get_nx());
+                    for (decltype(sp.size()) k = 0; k < sp.size(); ++k) {
+                        retval[sp[k].first * p1.get_nx() + sp[k].second] = g[k];
+                    }
+                    return retval;
+                },
+                dv);
+            for (decltype(h1.size()) l = 0; l < h1.size(); ++l) {
+                vector_double h;
+                for (decltype(dv.size()) r = 0; r < dim; ++r) {
+                    for (decltype(dv.size()) c = 0; c <= r; ++c) {
+                        h.push_back(jac[(l * dim + r) * dim + c]);
+                    }
+                }
+                check_close(h1[l], h, 1e-4);
+                check_close(h2[l], h1[l], 1e-10);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(autodiff_misc)
+{
+    problem p0{autodiff<ad_rosenbrock>{}};
+    BOOST_CHECK(p0.get_nx() == 2u);
+    BOOST_CHECK(!p0.has_hessians());
+    BOOST_CHECK(boost::contains(p0.get_extra_info(), "Automatic differentiation directions: 4"));
+
+    // Serialization.
+    p0 = problem{autodiff<ad_rosenbrock>{ad_rosenbrock{5u}, true}};
+    const vector_double dv{.1, .2, .3, .4, .5};
+    const auto g = p0.gradient(dv);
+    const auto before = boost::lexical_cast<std::string>(p0);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p0;
+    }
+    p0 = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p0;
+    }
+    BOOST_CHECK(before == boost::lexical_cast<std::string>(p0));
+    BOOST_CHECK(p0.has_hessians());
+    BOOST_CHECK(p0.gradient(dv) == g);
+}
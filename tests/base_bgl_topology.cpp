@@ -33,16 +33,19 @@ see https://www.gnu.org/licenses/. */
 #include <atomic>
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <pagmo/s11n.hpp>
 #include <pagmo/topologies/base_bgl_topology.hpp>
+#include <pagmo/topology.hpp>
 
 using namespace pagmo;
 
@@ -261,6 +264,7 @@ BOOST_AUTO_TEST_CASE(thread_torture_test)
                 failures += !t0.are_adjacent(0, 1);
                 t0.add_vertex();
                 failures += t0.get_connections(0).first.size() == 0u;
+                failures += t0.to_csr()->num_vertices() < 4u;
                 t0.add_vertex();
 
                 try {
@@ -285,3 +289,66 @@ BOOST_AUTO_TEST_CASE(thread_torture_test)
 
     BOOST_CHECK(failures.load() == 0);
 }
+
+BOOST_AUTO_TEST_CASE(csr_test)
+{
+    // Check that a snapshot is consistent with get_connections().
+    auto check_csr = [](const bbt &t, const topology_csr &csr) {
+        BOOST_CHECK(csr.num_vertices() == t.num_vertices());
+        for (std::size_t i = 0; i < t.num_vertices(); ++i) {
+            BOOST_CHECK(csr.get_connections(i) == t.get_connections(i));
+        }
+    };
+
+    bbt t0;
+    auto c0 = t0.to_csr();
+    BOOST_CHECK(c0->num_vertices() == 0u);
+    BOOST_CHECK(c0->num_edges() == 0u);
+    // No modifications, same snapshot.
+    BOOST_CHECK(t0.to_csr() == c0);
+
+    t0.add_vertex();
+    t0.add_vertex();
+    t0.add_vertex();
+    t0.add_edge(0, 1, .5);
+    t0.add_edge(2, 1, .25);
+    t0.add_edge(1, 0);
+    auto c1 = t0.to_csr();
+    BOOST_CHECK(c1 != c0);
+    BOOST_CHECK(c1->get_version() > c0->get_version());
+    BOOST_CHECK(c1->num_vertices() == 3u);
+    BOOST_CHECK(c1->num_edges() == 3u);
+    BOOST_CHECK(c1->get_row_offsets() == (std::vector<std::size_t>{0, 1, 3, 3}));
+    check_csr(t0, *c1);
+    BOOST_CHECK(t0.to_csr() == c1);
+
+    // Every modification results in a new snapshot.
+    t0.set_weight(0, 1, .75);
+    auto c2 = t0.to_csr();
+    BOOST_CHECK(c2->get_version() > c1->get_version());
+    check_csr(t0, *c2);
+    // The old snapshot is unaffected.
+    BOOST_CHECK(c1->get_weights() != c2->get_weights());
+    check_csr(t0, *c2);
+
+    t0.set_all_weights(.1);
+    auto c3 = t0.to_csr();
+    BOOST_CHECK(c3->get_version() > c2->get_version());
+    check_csr(t0, *c3);
+
+    t0.remove_edge(2, 1);
+    auto c4 = t0.to_csr();
+    BOOST_CHECK(c4->get_version() > c3->get_version());
+    BOOST_CHECK(c4->num_edges() == 2u);
+    check_csr(t0, *c4);
+
+    // Copy, move and assignment.
+    auto t1(t0);
+    check_csr(t1, *t1.to_csr());
+    auto t2(std::move(t1));
+    check_csr(t2, *t2.to_csr());
+    t1 = bbt{};
+    BOOST_CHECK(t1.to_csr()->num_vertices() == 0u);
+    t1 = t2;
+    check_csr(t1, *t1.to_csr());
+}
@@ -89,3 +89,42 @@ BOOST_AUTO_TEST_CASE(cec2013_serialization_test)
     auto after = boost::lexical_cast<std::string>(p);
     BOOST_CHECK_EQUAL(before, after);
 }
+
+BOOST_AUTO_TEST_CASE(cec2013_shared_data_test)
+{
+    // Instances share the problem data.
+    cec2013 p1{1u, 10u}, p2{5u, 10u};
+    BOOST_CHECK(&p1.get_origin_shift() == &p2.get_origin_shift());
+    BOOST_CHECK(&p1.get_rotation_matrix() == &p2.get_rotation_matrix());
+    auto p3(p1);
+    BOOST_CHECK(&p1.get_origin_shift() == &p3.get_origin_shift());
+    BOOST_CHECK(&p1.get_rotation_matrix() == &p3.get_rotation_matrix());
+    // The rotation matrix depends on the dimension.
+    BOOST_CHECK(&p1.get_rotation_matrix() != &cec2013(1u, 20u).get_rotation_matrix());
+    BOOST_CHECK_EQUAL(p1.get_rotation_matrix().size() % 100u, 0u);
+    // Only the id and the dimension are serialized.
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p1;
+    }
+    BOOST_CHECK(ss.str().size() < 100u);
+    ss.str("");
+    // Serialization round-trip recovers the shared data.
+    problem p{cec2013{24u, 10u}};
+    const auto f_before = p.fitness(vector_double(10u, 1.));
+    {
+        boost::archive::text_oarchive oarchive(ss);
+        oarchive << p;
+    }
+    p = problem{};
+    {
+        boost::archive::text_iarchive iarchive(ss);
+        iarchive >> p;
+    }
+    BOOST_CHECK(p.is<cec2013>());
+    BOOST_CHECK(&p.extract<cec2013>()->get_origin_shift() == &p1.get_origin_shift());
+    BOOST_CHECK(&p.extract<cec2013>()->get_rotation_matrix() == &p1.get_rotation_matrix());
+    BOOST_CHECK(p.get_name() == cec2013(24u, 10u).get_name());
+    BOOST_CHECK(p.fitness(vector_double(10u, 1.)) == f_before);
+}
@@ -144,3 +144,54 @@ BOOST_AUTO_TEST_CASE(cec2014_serialization_test)
     auto after = boost::lexical_cast<std::string>(p);
     BOOST_CHECK_EQUAL(before, after);
 }
+
+BOOST_AUTO_TEST_CASE(cec2014_shared_data_test)
+{
+    // Instances with the same id and dimension share the problem data.
+    cec2014 p1{24u, 10u}, p2{24u, 10u};
+    BOOST_CHECK(&p1.get_origin_shift() == &p2.get_origin_shift());
+    auto p3(p1);
+    BOOST_CHECK(&p1.get_origin_shift() == &p3.get_origin_shift());
+    BOOST_CHECK(&p1.get_origin_shift() != &cec2014(24u, 20u).get_origin_shift());
+    BOOST_CHECK(&p1.get_origin_shift() != &cec2014(25u, 10u).get_origin_shift());
+    // The shift data is trimmed down to the problem dimension.
+    BOOST_CHECK_EQUAL(p1.get_origin_shift().size() % 10u, 0u);
+    BOOST_CHECK_EQUAL(cec2014(1u, 2u).get_origin_shift().size() % 2u, 0u);
+    // Serialization round-trip recovers the shared data.
+    problem p{p1};
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oarchive(ss);
+        oarchive << p;
+    }
+    p = problem{};
+    {
+        boost::archive::text_iarchive iarchive(ss);
+        iarchive >> p;
+    }
+    BOOST_CHECK(&p.extract<cec2014>()->get_origin_shift() == &p1.get_origin_shift());
+}
+
+BOOST_AUTO_TEST_CASE(cec2014_batch_fitness_test)
+{
+    std::mt19937 r_engine(32u);
+    for (unsigned i = 1u; i <= 30u; ++i) {
+        for (auto dim : {10u, 30u}) {
+            problem p{cec2014{i, dim}};
+            BOOST_CHECK(p.has_batch_fitness());
+            // Use a number of decision vectors which is not a multiple of the block size.
+            const auto n_dvs = 150u;
+            vector_double dvs;
+            for (auto j = 0u; j < n_dvs; ++j) {
+                auto x = random_decision_vector(p, r_engine);
+                dvs.insert(dvs.end(), x.begin(), x.end());
+            }
+            const auto fvs = p.batch_fitness(dvs);
+            BOOST_CHECK_EQUAL(fvs.size(), n_dvs);
+            for (auto j = 0u; j < n_dvs; ++j) {
+                const auto f = p.fitness(vector_double(dvs.data() + j * dim, dvs.data() + (j + 1u) * dim));
+                BOOST_CHECK_CLOSE(fvs[j], f[0], 1e-8);
+            }
+        }
+    }
+}
@@ -0,0 +1,203 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+#define BOOST_TEST_MODULE checkpoint_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/lexical_cast.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/algorithms/nsga2.hpp>
+#include <pagmo/algorithms/null_algorithm.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/checkpoint.hpp>
+#include <pagmo/config.hpp>
+#include <pagmo/exceptions.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/zdt.hpp>
+#include <pagmo/topologies/ring.hpp>
+
+using namespace pagmo;
+
+// Check that two archipelagos have the same content.
+void check_same_archi(const archipelago &a, const archipelago &b)
+{
+    BOOST_REQUIRE_EQUAL(a.size(), b.size());
+    for (archipelago::size_type i = 0; i < a.size(); ++i) {
+        const auto pa = a[i].get_population(), pb = b[i].get_population();
+        BOOST_CHECK(pa.get_ID() == pb.get_ID());
+        BOOST_CHECK(pa.get_x() == pb.get_x());
+        BOOST_CHECK(pa.get_f() == pb.get_f());
+        BOOST_CHECK_EQUAL(pa.get_seed(), pb.get_seed());
+        BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(pa), boost::lexical_cast<std::string>(pb));
+        if (pa.size() && pa.get_problem().get_nobj() == 1u) {
+            BOOST_CHECK(pa.champion_x() == pb.champion_x());
+            BOOST_CHECK(pa.champion_f() == pb.champion_f());
+        }
+        BOOST_CHECK_EQUAL(a[i].get_name(), b[i].get_name());
+        BOOST_CHECK_EQUAL(a[i].get_algorithm().get_name(), b[i].get_algorithm().get_name());
+        BOOST_CHECK_EQUAL(a[i].get_r_policy().get_name(), b[i].get_r_policy().get_name());
+        BOOST_CHECK_EQUAL(a[i].get_s_policy().get_name(), b[i].get_s_policy().get_name());
+    }
+    BOOST_CHECK(a.get_migrants_db() == b.get_migrants_db());
+    BOOST_CHECK(a.get_migration_log() == b.get_migration_log());
+    BOOST_CHECK(a.get_migration_type() == b.get_migration_type());
+    BOOST_CHECK(a.get_migrant_handling() == b.get_migrant_handling());
+    BOOST_CHECK_EQUAL(a.get_topology().get_name(), b.get_topology().get_name());
+    BOOST_CHECK_EQUAL(static_cast<bool>(a.get_migration_scheduler()),
+                      static_cast<bool>(b.get_migration_scheduler()));
+}
+
+archipelago make_archi()
+{
+    archipelago archi{ring{}, 4, de{}, population{rosenbrock{10}, 20}};
+    archi.set_migration_type(migration_type::broadcast);
+    archi.set_migrant_handling(migrant_handling::evict);
+    archi.evolve(3);
+    archi.wait_check();
+    // An island with a multi-objective problem, and one with an empty population.
+    archi.push_back(nsga2{}, population{zdt{1, 5}, 8});
+    archi.push_back(null_algorithm{}, population{rosenbrock{3}});
+    return archi;
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_compression_stream)
+{
+    BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(checkpoint_compression::none), "none");
+    BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(checkpoint_compression::zlib), "zlib");
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_roundtrip)
+{
+    const auto archi = make_archi();
+
+    // Stream roundtrip.
+    {
+        std::stringstream ss;
+        save_checkpoint(archi, ss);
+        archipelago archi2;
+        load_checkpoint(archi2, ss);
+        check_same_archi(archi, archi2);
+    }
+
+    // A restored archipelago can be evolved.
+    {
+        archipelago archi_h{ring{}, 4, de{}, population{rosenbrock{10}, 20}};
+        archi_h.evolve(2);
+        archi_h.wait_check();
+        std::stringstream ss;
+        save_checkpoint(archi_h, ss);
+        archipelago archi2;
+        load_checkpoint(archi2, ss);
+        archi2.evolve(2);
+        archi2.wait_check();
+        BOOST_CHECK_EQUAL(archi2.size(), 4u);
+        BOOST_CHECK(archi2[0].get_population().get_problem().get_fevals()
+                    > archi_h[0].get_population().get_problem().get_fevals());
+        BOOST_CHECK(archi2.get_migration_log().size() > archi_h.get_migration_log().size());
+    }
+
+    // File roundtrip, with a migration scheduler.
+    {
+        auto archi_s = archi;
+        archi_s.set_migration_scheduler(migration_scheduler{});
+        const std::string filename = "pagmo_checkpoint_test.ckp";
+        save_checkpoint(archi_s, filename);
+        archipelago archi2;
+        load_checkpoint(archi2, filename);
+        check_same_archi(archi_s, archi2);
+        std::remove(filename.c_str());
+        BOOST_CHECK_THROW(load_checkpoint(archi2, filename), std::runtime_error);
+        check_same_archi(archi_s, archi2);
+    }
+
+    // Empty archipelago.
+    {
+        std::stringstream ss;
+        save_checkpoint(archipelago{}, ss);
+        auto archi2 = archi;
+        load_checkpoint(archi2, ss);
+        BOOST_CHECK_EQUAL(archi2.size(), 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_zlib)
+{
+    const auto archi = make_archi();
+    std::stringstream ss;
+#if defined(PAGMO_WITH_ZLIB)
+    std::stringstream ss_raw;
+    save_checkpoint(archi, ss_raw);
+    save_checkpoint(archi, ss, checkpoint_compression::zlib);
+    BOOST_CHECK(ss.str().size() < ss_raw.str().size());
+    archipelago archi2;
+    load_checkpoint(archi2, ss);
+    check_same_archi(archi, archi2);
+#else
+    BOOST_CHECK_THROW(save_checkpoint(archi, ss, checkpoint_compression::zlib), not_implemented_error);
+#endif
+    BOOST_CHECK_THROW(save_checkpoint(archi, ss, static_cast<checkpoint_compression>(42)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_invalid)
+{
+    const auto archi = make_archi();
+    std::stringstream ss;
+    save_checkpoint(archi, ss);
+    const auto data = ss.str();
+
+    archipelago archi2;
+    auto load_str = [&archi2](const std::string &s) {
+        std::istringstream iss(s);
+        load_checkpoint(archi2, iss);
+    };
+
+    // Empty data, wrong magic, truncation, trailing garbage and wrong version.
+    BOOST_CHECK_THROW(load_str(""), std::invalid_argument);
+    BOOST_CHECK_THROW(load_str("PAGMOCKQ" + data.substr(8)), std::invalid_argument);
+    BOOST_CHECK_THROW(load_str(data.substr(0, data.size() / 2u)), std::invalid_argument);
+    BOOST_CHECK_THROW(load_str(data.substr(0, data.size() - 1u)), std::invalid_argument);
+    BOOST_CHECK_THROW(load_str(data + "x"), std::invalid_argument);
+    auto bad_version = data;
+    bad_version[8] = 42;
+    BOOST_CHECK_THROW(load_str(bad_version), std::invalid_argument);
+    auto bad_comp = data;
+    bad_comp[12] = 42;
+    BOOST_CHECK_THROW(load_str(bad_comp), std::invalid_argument);
+    // Nothing was loaded.
+    BOOST_CHECK_EQUAL(archi2.size(), 0u);
+
+    load_str(data);
+    check_same_archi(archi, archi2);
+}
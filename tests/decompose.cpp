@@ -305,10 +305,35 @@ struct ts2 {
     }
 };
 
+struct ts3 {
+    vector_double fitness(const vector_double &) const
+    {
+        return {2, 2};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{0}, {1}};
+    }
+    vector_double::size_type get_nobj() const
+    {
+        return 2u;
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::constant;
+    }
+};
+
 BOOST_AUTO_TEST_CASE(decompose_thread_safety_test)
 {
     zdt p0{1, 2};
     decompose t{p0, {0.5, 0.5}, {2., 2.}};
     BOOST_CHECK(t.get_thread_safety() == thread_safety::basic);
     BOOST_CHECK((decompose{ts2{}, {0.5, 0.5}, {2., 2.}}.get_thread_safety() == thread_safety::none));
+    BOOST_CHECK((decompose{ts3{}, {0.5, 0.5}, {2., 2.}}.get_thread_safety() == thread_safety::constant));
+    // The adaptation of the ideal point modifies the UDP during fitness evaluations.
+    BOOST_CHECK((decompose{ts3{}, {0.5, 0.5}, {2., 2.}, "weighted", true}.get_thread_safety()
+                 == thread_safety::basic));
+    BOOST_CHECK((decompose{ts2{}, {0.5, 0.5}, {2., 2.}, "weighted", true}.get_thread_safety()
+                 == thread_safety::none));
 }
\ No newline at end of file
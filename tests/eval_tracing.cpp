@@ -0,0 +1,240 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE eval_tracing
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/config.hpp>
+#include <pagmo/eval_tracing.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+struct tr_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] * x[0] + x[1] * x[1]};
+    }
+    vector_double batch_fitness(const vector_double &xs) const
+    {
+        vector_double retval;
+        for (decltype(xs.size()) i = 0; i < xs.size(); i += 2u) {
+            retval.push_back(xs[i] * xs[i] + xs[i + 1u] * xs[i + 1u]);
+        }
+        return retval;
+    }
+    vector_double gradient(const vector_double &x) const
+    {
+        return {2 * x[0], 2 * x[1]};
+    }
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &x) const
+    {
+        return {fitness(x), gradient(x)};
+    }
+    std::vector<vector_double> hessians(const vector_double &) const
+    {
+        return {{2., 0., 2.}};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1., -1.}, {1., 1.}};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(eval_trace_collector_basic)
+{
+    BOOST_CHECK_THROW(eval_trace_collector(10, 0), std::invalid_argument);
+
+    eval_trace_collector c;
+    BOOST_CHECK(c.get_sample_capacity() == 0u);
+    BOOST_CHECK(c.get_sample_interval() == 1u);
+    BOOST_CHECK(c.get_latency(eval_type::fitness).get_count() == 0u);
+    BOOST_CHECK(c.get_samples().empty());
+
+    const vector_double dv{1., 2.}, fv{3.};
+    c.record(eval_type::fitness, 100, dv.data(), dv.size(), fv.data(), fv.size());
+    c.record(eval_type::fitness, 300, dv.data(), dv.size(), fv.data(), fv.size());
+    c.record(eval_type::gradient, 7, dv.data(), dv.size(), fv.data(), fv.size());
+
+    const auto h = c.get_latency(eval_type::fitness);
+    BOOST_CHECK(h.get_count() == 2u);
+    BOOST_CHECK(h.get_sum() == 400u);
+    BOOST_CHECK(h.get_min() == 100u);
+    BOOST_CHECK(h.get_max() == 300u);
+    BOOST_CHECK(c.get_latency(eval_type::gradient).get_count() == 1u);
+    BOOST_CHECK(c.get_latency(eval_type::gradient).get_max() == 7u);
+    BOOST_CHECK(c.get_latency(eval_type::hessians).get_count() == 0u);
+    // No sampling with zero capacity.
+    BOOST_CHECK(c.get_samples().empty());
+    BOOST_CHECK(c.get_n_dropped_samples() == 0u);
+
+    const auto counts = c.get_thread_counts();
+    const auto times = c.get_thread_times();
+    BOOST_CHECK(counts.size() == eval_trace_collector::n_thread_slots);
+    BOOST_CHECK(times.size() == eval_trace_collector::n_thread_slots);
+    const auto slot = eval_trace_collector::thread_slot();
+    BOOST_CHECK(counts[slot][0] == 2u);
+    BOOST_CHECK(counts[slot][2] == 1u);
+    BOOST_CHECK(times[slot][0] == 400u);
+    BOOST_CHECK(times[slot][2] == 7u);
+}
+
+BOOST_AUTO_TEST_CASE(eval_trace_collector_sampling)
+{
+    eval_trace_collector c(3, 2);
+    BOOST_CHECK(c.get_sample_capacity() == 3u);
+    BOOST_CHECK(c.get_sample_interval() == 2u);
+
+    // Record 10 evaluations: the even ones are sampled, and the
+    // ring buffer retains the last 3 samples.
+    for (int i = 0; i < 10; ++i) {
+        const vector_double dv{double(i)}, fv{double(i) * 2};
+        c.record(eval_type::batch_fitness, 1, dv.data(), dv.size(), fv.data(), fv.size());
+    }
+    auto samples = c.get_samples();
+    BOOST_CHECK(samples.size() == 3u);
+    BOOST_CHECK(samples[0].seq == 4u);
+    BOOST_CHECK(samples[1].seq == 6u);
+    BOOST_CHECK(samples[2].seq == 8u);
+    for (const auto &s : samples) {
+        BOOST_CHECK(s.type == eval_type::batch_fitness);
+        BOOST_CHECK(s.ns == 1u);
+        BOOST_CHECK(s.thread == eval_trace_collector::thread_slot());
+        BOOST_CHECK((s.dv == vector_double{double(s.seq)}));
+        BOOST_CHECK((s.out == vector_double{double(s.seq) * 2}));
+    }
+
+    // Null output.
+    const vector_double dv{42.};
+    c.record(eval_type::hessians, 1, dv.data(), dv.size(), nullptr, 0);
+    c.record(eval_type::hessians, 1, dv.data(), dv.size(), nullptr, 0);
+    samples = c.get_samples();
+    BOOST_CHECK(samples.back().seq == 10u);
+    BOOST_CHECK(samples.back().type == eval_type::hessians);
+    BOOST_CHECK(samples.back().out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(eval_trace_collector_threads)
+{
+    eval_trace_collector c(16);
+    const vector_double dv{1., 2.}, fv{3.};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&c, &dv, &fv]() {
+            for (int j = 0; j < 1000; ++j) {
+                c.record(eval_type::fitness, 10, dv.data(), dv.size(), fv.data(), fv.size());
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    BOOST_CHECK(c.get_latency(eval_type::fitness).get_count() == 4000u);
+    BOOST_CHECK(c.get_latency(eval_type::fitness).get_sum() == 40000u);
+    unsigned long long tot = 0;
+    for (const auto &cnt : c.get_thread_counts()) {
+        tot += cnt[0];
+    }
+    BOOST_CHECK(tot == 4000u);
+    BOOST_CHECK(c.get_samples().size() + c.get_n_dropped_samples() >= 16u);
+    BOOST_CHECK(c.get_samples().size() <= 16u);
+}
+
+BOOST_AUTO_TEST_CASE(eval_trace_dump)
+{
+    eval_trace_collector c(2);
+    const vector_double dv{1., 2.}, fv{3.};
+    c.record(eval_type::fitness, 5, dv.data(), dv.size(), fv.data(), fv.size());
+    c.record(eval_type::gradient, 1000, dv.data(), dv.size(), fv.data(), fv.size());
+
+    std::ostringstream oss;
+    dump_eval_trace_csv(oss, c);
+    BOOST_CHECK(oss.str() == "eval,bucket_min_ns,bucket_max_ns,count\nfitness,4,7,1\ngradient,512,1023,1\n");
+
+    oss.str("");
+    dump_eval_trace_samples_csv(oss, c);
+    const auto ts = std::to_string(eval_trace_collector::thread_slot());
+    BOOST_CHECK(oss.str() == "seq,eval,thread,ns,dv,out\n0,fitness," + ts + ",5,1 2,3\n1,gradient," + ts + ",1000,1 2,3\n");
+
+    oss.str("");
+    dump_eval_trace_folded(oss, c);
+    const auto pfx = "pagmo;thread_" + ts + ";";
+    BOOST_CHECK(oss.str() == pfx + "fitness 5\n" + pfx + "gradient 1000\n");
+
+    oss.str("");
+    oss << eval_type::batch_fitness << eval_type::hessians;
+    BOOST_CHECK(oss.str() == "batch_fitnesshessians");
+}
+
+BOOST_AUTO_TEST_CASE(eval_tracer_install)
+{
+    BOOST_CHECK(get_eval_tracer() == nullptr);
+    eval_trace_collector c;
+    BOOST_CHECK(set_eval_tracer(&c) == nullptr);
+    BOOST_CHECK(get_eval_tracer() == &c);
+
+    problem p{tr_udp{}};
+    const vector_double dv{.5, .25};
+    p.fitness(dv);
+    p.fitness(dv);
+    p.batch_fitness(vector_double{.5, .25, 1., 1.});
+    p.gradient(dv);
+    p.hessians(dv);
+    // The fused evaluation counts as one fitness and one gradient evaluation.
+    p.fitness_and_gradient(dv);
+    // A failed evaluation is not recorded.
+    BOOST_CHECK_THROW(p.fitness(vector_double{1.}), std::invalid_argument);
+
+    BOOST_CHECK(set_eval_tracer(nullptr) == &c);
+    BOOST_CHECK(get_eval_tracer() == nullptr);
+    p.fitness(dv);
+
+#if defined(PAGMO_WITH_EVAL_TRACING)
+    BOOST_CHECK(c.get_latency(eval_type::fitness).get_count() == 3u);
+    BOOST_CHECK(c.get_latency(eval_type::batch_fitness).get_count() == 1u);
+    BOOST_CHECK(c.get_latency(eval_type::gradient).get_count() == 2u);
+    BOOST_CHECK(c.get_latency(eval_type::gradient).get_count() == p.get_gevals());
+    BOOST_CHECK(c.get_latency(eval_type::hessians).get_count() == 1u);
+#else
+    // Without the hooks, nothing is recorded.
+    for (unsigned i = 0; i < eval_trace_collector::n_eval_types; ++i) {
+        BOOST_CHECK(c.get_latency(static_cast<eval_type>(i)).get_count() == 0u);
+    }
+#endif
+}
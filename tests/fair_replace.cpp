@@ -30,11 +30,14 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <initializer_list>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/numeric/conversion/converter_policies.hpp>
@@ -243,3 +246,110 @@ BOOST_AUTO_TEST_CASE(fair_replace_nan_fitness)
     // No individual was replaced, because the migrant has nan fitness.
     BOOST_CHECK(inds == new_inds);
 }
+
+// Sort a group of individuals by ID.
+static individuals_group_t sort_by_ID(const individuals_group_t &inds)
+{
+    std::vector<pop_size_t> idx(std::get<0>(inds).size());
+    for (pop_size_t i = 0; i < idx.size(); ++i) {
+        idx[i] = i;
+    }
+    std::sort(idx.begin(), idx.end(),
+              [&inds](pop_size_t a, pop_size_t b) { return std::get<0>(inds)[a] < std::get<0>(inds)[b]; });
+    individuals_group_t retval;
+    for (auto i : idx) {
+        std::get<0>(retval).push_back(std::get<0>(inds)[i]);
+        std::get<1>(retval).push_back(std::get<1>(inds)[i]);
+        std::get<2>(retval).push_back(std::get<2>(inds)[i]);
+    }
+    return retval;
+}
+
+// Apply a replacement plan to inds, and sort the result by ID
+// for comparison with the output of replace().
+static individuals_group_t apply_plan(individuals_group_t inds, const replacement_plan_t &plan,
+                                      const individuals_group_t &mig)
+{
+    for (const auto &p : plan) {
+        std::get<0>(inds)[p.first] = std::get<0>(mig)[p.second];
+        std::get<1>(inds)[p.first] = std::get<1>(mig)[p.second];
+        std::get<2>(inds)[p.first] = std::get<2>(mig)[p.second];
+    }
+    return sort_by_ID(inds);
+}
+
+BOOST_AUTO_TEST_CASE(fair_replace_replace_in_place)
+{
+    BOOST_CHECK(has_replace_in_place<fair_replace>::value);
+    BOOST_CHECK(r_policy{}.has_replace_in_place());
+
+    fair_replace f00;
+
+    individuals_group_t inds{{1, 2, 3}, {{0}, {0}, {0}}, {{1}, {2}, {3}}};
+    individuals_group_t mig{{4, 5, 6}, {{0}, {0}, {0}}, {{0.1}, {0.2}, {0.3}}};
+
+    auto view = [&inds]() { return individuals_view_t(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds)); };
+
+    BOOST_CHECK_EXCEPTION(f00.replace_in_place(view(), 1, 0, 2, 1, 0, vector_double{0.}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(),
+                                                     "The 'fair_replace' replacement policy is unable to deal with "
+                                                     "multiobjective constrained optimisation problems");
+                          });
+
+    f00 = fair_replace(100);
+    BOOST_CHECK_EXCEPTION(f00.replace_in_place(view(), 1, 0, 1, 0, 0, vector_double{}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(
+                                  ia.what(), "The absolute migration rate (100) in a 'fair_replace' replacement policy "
+                                             "is larger than the number of input individuals (3)");
+                          });
+
+    // The in-place replacement must produce the same individuals as replace().
+    auto check = [&inds, &mig, &view](const fair_replace &f, vector_double::size_type nobj,
+                                      vector_double::size_type nec, vector_double::size_type nic,
+                                      const vector_double &tol) {
+        const auto plan = f.replace_in_place(view(), 1, 0, nobj, nec, nic, tol, mig);
+        BOOST_CHECK(apply_plan(inds, plan, mig) == sort_by_ID(f.replace(inds, 1, 0, nobj, nec, nic, tol, mig)));
+        // The same must hold when going through r_policy.
+        const auto plan2 = r_policy(f).replace_in_place(view(), 1, 0, nobj, nec, nic, tol, mig);
+        BOOST_CHECK(apply_plan(inds, plan2, mig) == sort_by_ID(f.replace(inds, 1, 0, nobj, nec, nic, tol, mig)));
+        return plan;
+    };
+
+    // Single-objective, unconstrained.
+    BOOST_CHECK(check(fair_replace(.1), 1, 0, 0, {}).empty());
+    BOOST_CHECK(check(fair_replace(.5), 1, 0, 0, {}).size() == 1u);
+    BOOST_CHECK(check(fair_replace(1.), 1, 0, 0, {}).size() == 3u);
+    BOOST_CHECK(check(fair_replace(0), 1, 0, 0, {}).empty());
+    BOOST_CHECK(check(fair_replace(2), 1, 0, 0, {}).size() == 2u);
+    BOOST_CHECK(check(fair_replace(3), 1, 0, 0, {}).size() == 3u);
+
+    // Only the worst individual is replaced, in its original position.
+    BOOST_CHECK((fair_replace(1).replace_in_place(view(), 1, 0, 1, 0, 0, {}, mig) == replacement_plan_t{{2, 0}}));
+
+    // Some migrants are worse than the individuals.
+    mig = individuals_group_t{{4, 5, 6}, {{0}, {0}, {0}}, {{2.5}, {4}, {0.5}}};
+    BOOST_CHECK((check(fair_replace(3), 1, 0, 0, {}) == replacement_plan_t{{2, 2}}));
+    BOOST_CHECK((check(fair_replace(1.), 1, 0, 0, {}) == replacement_plan_t{{2, 2}}));
+
+    // Nan fitness in the migrants.
+    mig = individuals_group_t{
+        {4, 5}, {{0}, {0}}, {{std::numeric_limits<double>::quiet_NaN()}, {std::numeric_limits<double>::quiet_NaN()}}};
+    BOOST_CHECK(check(fair_replace(1), 1, 0, 0, {}).empty());
+
+    // Single-objective, constrained.
+    inds = individuals_group_t{{1, 2, 3}, {{0}, {0}, {0}}, {{1, 1, 1}, {2, 2, 2}, {3, 3, 3}}};
+    mig = individuals_group_t{{4, 5, 6}, {{0}, {0}, {0}}, {{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.3, 0.3, 0.3}}};
+    BOOST_CHECK(check(fair_replace(.1), 1, 1, 1, {0., 0.}).empty());
+    BOOST_CHECK(check(fair_replace(.5), 1, 1, 1, {0., 0.}).size() == 1u);
+    BOOST_CHECK(check(fair_replace(1.), 1, 1, 1, {0., 0.}).size() == 3u);
+    BOOST_CHECK(check(fair_replace(2), 1, 1, 1, {0., 0.}).size() == 2u);
+
+    // Multi-objective, unconstrained.
+    inds = individuals_group_t{{1, 2, 3, 4, 5}, {{0}, {0}, {0}, {0}, {0}}, {{0, 7}, {1, 5}, {2, 3}, {4, 2}, {7, 1}}};
+    mig = individuals_group_t{
+        {6, 7, 8, 9, 10, 11}, {{0}, {0}, {0}, {0}, {0}, {0}}, {{10, 0}, {2, 6}, {4, 4}, {10, 2}, {6, 6}, {9, 5}}};
+    BOOST_CHECK(check(fair_replace(1.), 2, 0, 0, {}).size() == 1u);
+    BOOST_CHECK(check(fair_replace(2), 2, 0, 0, {}).size() == 1u);
+}
@@ -36,12 +36,14 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <pagmo/s11n.hpp>
 #include <pagmo/topologies/fully_connected.hpp>
 #include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
 
 using namespace pagmo;
 
@@ -206,3 +208,48 @@ BOOST_AUTO_TEST_CASE(basic_test)
         verify_fully_connected_topology(*t1.extract<fully_connected>());
     }
 }
+
+BOOST_AUTO_TEST_CASE(csr_test)
+{
+    fully_connected r0{.25};
+    auto c0 = r0.to_csr();
+    BOOST_CHECK(c0->num_vertices() == 0u);
+    BOOST_CHECK(c0->num_edges() == 0u);
+    BOOST_CHECK(r0.to_csr() == c0);
+
+    for (std::size_t n = 1; n < 7u; ++n) {
+        r0.push_back();
+        auto c1 = r0.to_csr();
+        BOOST_CHECK(c1->get_version() > c0->get_version());
+        BOOST_CHECK(c1->num_vertices() == n);
+        BOOST_CHECK(c1->num_edges() == n * (n - 1u));
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_CHECK(c1->get_connections(i) == r0.get_connections(i));
+        }
+        BOOST_CHECK(r0.to_csr() == c1);
+        c0 = c1;
+    }
+
+    // Copies compute their own snapshots.
+    fully_connected r1(r0);
+    BOOST_CHECK(r1.to_csr() != r0.to_csr());
+    BOOST_CHECK(r1.to_csr()->get_columns() == r0.to_csr()->get_columns());
+
+    // Serialization discards the cached snapshot.
+    topology t0(r0);
+    BOOST_CHECK(t0.has_to_csr());
+    BOOST_CHECK(t0.to_csr()->num_vertices() == 6u);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << t0;
+    }
+    topology t1(fully_connected{3, .5});
+    BOOST_CHECK(t1.to_csr()->get_weights() == vector_double(6u, .5));
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> t1;
+    }
+    BOOST_CHECK(t1.to_csr()->num_vertices() == 6u);
+    BOOST_CHECK(t1.to_csr()->get_weights() == vector_double(30u, .25));
+}
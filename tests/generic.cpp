@@ -317,6 +317,17 @@ BOOST_AUTO_TEST_CASE(batch_random_decision_vector_test)
         BOOST_CHECK(std::trunc(tmp[3]) == tmp[3]);
         BOOST_CHECK(std::trunc(tmp[5]) == tmp[5]);
     }
+    // The decision vectors are generated in parallel, but the result
+    // must depend only on the state of the engine.
+    {
+        detail::random_engine_type e0(42u), e1(42u);
+        const problem p{udp00{{0, -20}, {1, 20}, 1}};
+        const auto b0 = batch_random_decision_vector(p, 1000, e0);
+        const auto b1 = batch_random_decision_vector(p, 1000, e1);
+        BOOST_CHECK(b0 == b1);
+        BOOST_CHECK(e0 == e1);
+        BOOST_CHECK(b0 != batch_random_decision_vector(p, 1000, e0));
+    }
 }
 
 BOOST_AUTO_TEST_CASE(force_bounds_test)
@@ -0,0 +1,293 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE genetic_operators_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <pagmo/rng.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/generic.hpp>
+#include <pagmo/utils/genetic_operators.hpp>
+
+using namespace pagmo;
+
+namespace
+{
+
+// Generate n random decision vectors within the bounds, the last nix components being integers.
+vector_double random_batch(const std::pair<vector_double, vector_double> &bounds, vector_double::size_type nix,
+                           vector_double::size_type n, detail::random_engine_type &r_engine)
+{
+    const auto nx = bounds.first.size();
+    vector_double retval;
+    for (decltype(n) i = 0; i < n; ++i) {
+        for (decltype(bounds.first.size()) j = 0; j < nx; ++j) {
+            retval.push_back(j < nx - nix ? uniform_real_from_range(bounds.first[j], bounds.second[j], r_engine)
+                                          : uniform_integral_from_range(bounds.first[j], bounds.second[j], r_engine));
+        }
+    }
+    return retval;
+}
+
+bool in_bounds(const vector_double &dvs, const std::pair<vector_double, vector_double> &bounds,
+               vector_double::size_type nix)
+{
+    const auto nx = bounds.first.size();
+    for (decltype(dvs.size()) i = 0; i < dvs.size(); ++i) {
+        const auto j = i % nx;
+        if (dvs[i] < bounds.first[j] || dvs[i] > bounds.second[j]) {
+            return false;
+        }
+        if (j >= nx - nix && std::trunc(dvs[i]) != dvs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(sbx_crossover_batch_test)
+{
+    detail::random_engine_type r_engine(32u);
+    // Bounds with a collapsed dimension and an integer part.
+    const std::pair<vector_double, vector_double> bounds{{-1., 2., 0., -5., 0., -3.}, {1., 2., 10., 5., 4., 3.}};
+    const auto nx = bounds.first.size();
+    const vector_double::size_type nix = 2u;
+    // A batch crossing a chunk boundary.
+    const auto dvs = random_batch(bounds, nix, 200u, r_engine);
+
+    // Determinism.
+    auto b0 = dvs, b1 = dvs, b2 = dvs;
+    sbx_crossover_batch(b0, bounds, nix, .9, 10., 42u);
+    sbx_crossover_batch(b1, bounds, nix, .9, 10., 42u);
+    sbx_crossover_batch(b2, bounds, nix, .9, 10., 43u);
+    BOOST_CHECK(b0 == b1);
+    BOOST_CHECK(b0 != b2);
+    BOOST_CHECK(b0 != dvs);
+    BOOST_CHECK(in_bounds(b0, bounds, nix));
+    // The integer genes are exchanged between the parents.
+    for (decltype(dvs.size()) i = 0; i < dvs.size(); i += 2u * nx) {
+        for (auto j = nx - nix; j < nx; ++j) {
+            BOOST_CHECK_EQUAL(b0[i + j] + b0[i + nx + j], dvs[i + j] + dvs[i + nx + j]);
+        }
+    }
+    // The collapsed dimension is never touched.
+    for (decltype(dvs.size()) i = 1; i < dvs.size(); i += nx) {
+        BOOST_CHECK_EQUAL(b0[i], 2.);
+    }
+
+    // No crossover.
+    b0 = dvs;
+    sbx_crossover_batch(b0, bounds, nix, 0., 10., 42u);
+    BOOST_CHECK(b0 == dvs);
+
+    // Large dimension, purely continuous.
+    const std::pair<vector_double, vector_double> big_bounds{vector_double(1000u, -1.), vector_double(1000u, 1.)};
+    const auto big = random_batch(big_bounds, 0u, 10u, r_engine);
+    b0 = big;
+    sbx_crossover_batch(b0, big_bounds, 0u, 1., 2., 0u);
+    BOOST_CHECK(in_bounds(b0, big_bounds, 0u));
+    BOOST_CHECK(b0 != big);
+    // Empty batch.
+    vector_double empty;
+    sbx_crossover_batch(empty, bounds, nix, .9, 10., 42u);
+    BOOST_CHECK(empty.empty());
+
+    // Errors.
+    b0 = dvs;
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, {{}, {}}, 0u, .9, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, {{0.}, {1., 2.}}, 0u, .9, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, 7u, .9, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, 1.1, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, -.1, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, .9, .5, 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, .9, 101., 42u), std::invalid_argument);
+    b0.resize(b0.size() - 1u);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, .9, 10., 42u), std::invalid_argument);
+    // Odd number of decision vectors.
+    b0.resize(dvs.size() - nx);
+    BOOST_CHECK_THROW(sbx_crossover_batch(b0, bounds, nix, .9, 10., 42u), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_mutation_batch_test)
+{
+    detail::random_engine_type r_engine(32u);
+    const std::pair<vector_double, vector_double> bounds{{-1., 2., 0., -5., 0., -3.}, {1., 2., 10., 5., 4., 3.}};
+    const auto nx = bounds.first.size();
+    const vector_double::size_type nix = 2u;
+    const auto dvs = random_batch(bounds, nix, 101u, r_engine);
+
+    // Determinism.
+    auto b0 = dvs, b1 = dvs, b2 = dvs;
+    polynomial_mutation_batch(b0, bounds, nix, .5, 10., 42u);
+    polynomial_mutation_batch(b1, bounds, nix, .5, 10., 42u);
+    polynomial_mutation_batch(b2, bounds, nix, .5, 10., 43u);
+    BOOST_CHECK(b0 == b1);
+    BOOST_CHECK(b0 != b2);
+    BOOST_CHECK(b0 != dvs);
+    BOOST_CHECK(in_bounds(b0, bounds, nix));
+
+    // No mutation.
+    b0 = dvs;
+    polynomial_mutation_batch(b0, bounds, nix, 0., 10., 42u);
+    BOOST_CHECK(b0 == dvs);
+
+    // All the continuous genes are mutated, except the collapsed one.
+    b0 = dvs;
+    polynomial_mutation_batch(b0, bounds, nix, 1., 1., 42u);
+    BOOST_CHECK(in_bounds(b0, bounds, nix));
+    for (decltype(dvs.size()) i = 0; i < dvs.size(); i += nx) {
+        BOOST_CHECK(b0[i] != dvs[i]);
+        BOOST_CHECK_EQUAL(b0[i + 1u], 2.);
+        BOOST_CHECK(b0[i + 2u] != dvs[i + 2u]);
+    }
+
+    // Large dimension, purely continuous.
+    const std::pair<vector_double, vector_double> big_bounds{vector_double(1000u, -1.), vector_double(1000u, 1.)};
+    const auto big = random_batch(big_bounds, 0u, 10u, r_engine);
+    b0 = big;
+    polynomial_mutation_batch(b0, big_bounds, 0u, .1, 20., 0u);
+    BOOST_CHECK(in_bounds(b0, big_bounds, 0u));
+    BOOST_CHECK(b0 != big);
+
+    // Errors.
+    b0 = dvs;
+    BOOST_CHECK_THROW(polynomial_mutation_batch(b0, {{}, {}}, 0u, .9, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(polynomial_mutation_batch(b0, bounds, 7u, .9, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(polynomial_mutation_batch(b0, bounds, nix, 1.1, 10., 42u), std::invalid_argument);
+    BOOST_CHECK_THROW(polynomial_mutation_batch(b0, bounds, nix, .9, 0., 42u), std::invalid_argument);
+    b0.resize(b0.size() - 1u);
+    BOOST_CHECK_THROW(polynomial_mutation_batch(b0, bounds, nix, .9, 10., 42u), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(de_trial_test)
+{
+    detail::random_engine_type r_engine(32u);
+    const std::pair<vector_double, vector_double> bounds{vector_double(100u, -1.), vector_double(100u, 1.)};
+    std::vector<vector_double> pop;
+    for (auto i = 0; i < 10; ++i) {
+        pop.push_back(random_batch(bounds, 0u, 1u, r_engine));
+    }
+    const auto best = pop[3];
+    const std::vector<vector_double::size_type> r{1, 2, 4, 5, 6, 7, 8};
+    vector_double trial(100u);
+    philox4x32 eng(42u);
+
+    // CR = 0: only one gene comes from the mutant.
+    for (unsigned variant = 1u; variant <= 18u; ++variant) {
+        de_trial(trial.data(), pop, 0u, r, best, variant, .5, 0., bounds, eng);
+        vector_double::size_type n_diff = 0;
+        for (auto j = 0u; j < 100u; ++j) {
+            n_diff += trial[j] != pop[0][j];
+        }
+        BOOST_CHECK(n_diff <= 1u);
+    }
+
+    // CR = 1 and F = 0: the trial vector is the base vector of the strategy.
+    for (unsigned variant = 1u; variant <= 18u; ++variant) {
+        de_trial(trial.data(), pop, 0u, r, best, variant, 0., 1., bounds, eng);
+        switch (variant) {
+            case 1u:
+            case 6u:
+            case 4u:
+            case 9u:
+            case 13u:
+            case 14u:
+                BOOST_CHECK(trial == best);
+                break;
+            case 3u:
+            case 8u:
+                BOOST_CHECK(trial == pop[0]);
+                break;
+            case 5u:
+            case 10u:
+                BOOST_CHECK(trial == pop[r[4]]);
+                break;
+            default:
+                BOOST_CHECK(trial == pop[r[0]]);
+        }
+    }
+
+    // DE/rand/1/bin with CR = 1.
+    de_trial(trial.data(), pop, 0u, r, best, 7u, .5, 1., bounds, eng);
+    for (auto j = 0u; j < 100u; ++j) {
+        const auto v = pop[r[0]][j] + (pop[r[1]][j] - pop[r[2]][j]) * .5;
+        BOOST_CHECK(trial[j] == v || (v < -1. || v > 1.));
+    }
+
+    // Large F: the trial vector is forced within the bounds.
+    for (unsigned variant = 1u; variant <= 18u; ++variant) {
+        de_trial(trial.data(), pop, 0u, r, best, variant, 100., 1., bounds, eng);
+        BOOST_CHECK(in_bounds(trial, bounds, 0u));
+    }
+
+    // Errors.
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 0u, r, best, 0u, .5, .5, bounds, eng), std::invalid_argument);
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 0u, r, best, 19u, .5, .5, bounds, eng), std::invalid_argument);
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 10u, r, best, 1u, .5, .5, bounds, eng), std::invalid_argument);
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 0u, {1, 2, 3, 4, 5}, best, 11u, .5, .5, bounds, eng),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 0u, {1, 2, 3, 4, 10}, best, 1u, .5, .5, bounds, eng),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW(de_trial(trial.data(), pop, 0u, r, vector_double(99u), 1u, .5, .5, bounds, eng),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(de_trial_batch_test)
+{
+    detail::random_engine_type r_engine(32u);
+    const std::pair<vector_double, vector_double> bounds{vector_double(20u, -1.), vector_double(20u, 1.)};
+    std::vector<vector_double> pop;
+    for (auto i = 0; i < 50; ++i) {
+        pop.push_back(random_batch(bounds, 0u, 1u, r_engine));
+    }
+    for (unsigned variant = 1u; variant <= 18u; ++variant) {
+        const auto t0 = de_trial_batch(pop, pop[0], variant, .8, .9, bounds, 42u);
+        const auto t1 = de_trial_batch(pop, pop[0], variant, .8, .9, bounds, 42u);
+        const auto t2 = de_trial_batch(pop, pop[0], variant, .8, .9, bounds, 43u);
+        BOOST_CHECK_EQUAL(t0.size(), 50u * 20u);
+        BOOST_CHECK(t0 == t1);
+        BOOST_CHECK(t0 != t2);
+        BOOST_CHECK(in_bounds(t0, bounds, 0u));
+    }
+    // The smallest populations.
+    pop.resize(5u);
+    BOOST_CHECK_EQUAL(de_trial_batch(pop, pop[0], 10u, .8, .9, bounds, 42u).size(), 5u * 20u);
+    BOOST_CHECK_THROW(de_trial_batch(pop, pop[0], 11u, .8, .9, bounds, 42u), std::invalid_argument);
+    pop.resize(7u, pop[0]);
+    BOOST_CHECK_EQUAL(de_trial_batch(pop, pop[0], 18u, .8, .9, bounds, 42u).size(), 7u * 20u);
+}
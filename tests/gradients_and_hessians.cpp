@@ -33,7 +33,10 @@ see https://www.gnu.org/licenses/. */
 #include <limits>
 #include <stdexcept>
 
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
 #include <pagmo/io.hpp>
+#include <pagmo/problem.hpp>
 #include <pagmo/rng.hpp>
 #include <pagmo/types.hpp>
 #include <pagmo/utils/gradients_and_hessians.hpp>
@@ -150,4 +153,67 @@ BOOST_AUTO_TEST_CASE(estimate_gradient_test)
     for (unsigned i = 0u; i < res.size(); ++i) {
         BOOST_CHECK_CLOSE(gh[i], res[i], 1e-11);
     }
-}
\ No newline at end of file
+}
+// Serial batch evaluation of a fitness function, used to test the batch estimators.
+template <typename Func>
+vector_double serial_batch(Func f, const vector_double &xs, vector_double::size_type n)
+{
+    vector_double retval;
+    for (decltype(xs.size()) i = 0; i < xs.size(); i += n) {
+        const auto fv = f(vector_double(xs.data() + i, xs.data() + i + n));
+        retval.insert(retval.end(), fv.begin(), fv.end());
+    }
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(estimate_sparsity_batch_test)
+{
+    dummy_problem udp{};
+    dummy_problem_malformed udp2{};
+    const vector_double x = {0.1, 0.2, 0.3, 0.4};
+    auto f = [udp](const vector_double &y) { return udp.fitness(y); };
+    auto sp = estimate_sparsity_batch([f](const vector_double &xs) { return serial_batch(f, xs, 4u); }, x, 1e-8);
+    BOOST_CHECK((sp == estimate_sparsity(f, x, 1e-8)));
+    BOOST_CHECK((sp == sparsity_pattern{{0, 0}, {0, 1}, {0, 2}, {0, 3}, {1, 1}, {1, 2}, {1, 3}, {2, 2}}));
+    BOOST_CHECK_THROW(estimate_sparsity_batch(
+                          [udp2](const vector_double &xs) {
+                              return serial_batch([udp2](const vector_double &y) { return udp2.fitness(y); }, xs, 4u);
+                          },
+                          x, 1e-8),
+                      std::invalid_argument);
+    // Use a bfe.
+    problem prob{dummy_problem{}};
+    bfe b{thread_bfe{}};
+    BOOST_CHECK((estimate_sparsity_batch([&prob, &b](const vector_double &xs) { return b(prob, xs); }, x) == sp));
+}
+
+BOOST_AUTO_TEST_CASE(estimate_gradient_batch_test)
+{
+    dummy_problem_easy_grad udp{};
+    dummy_problem_malformed udp2{};
+    const vector_double x = {0.1, 0.2, 0.3, 0.4};
+    auto f = [udp](const vector_double &y) { return udp.fitness(y); };
+    auto bf = [f](const vector_double &xs) { return serial_batch(f, xs, 4u); };
+    auto bf2 = [udp2](const vector_double &xs) {
+        return serial_batch([udp2](const vector_double &y) { return udp2.fitness(y); }, xs, 4u);
+    };
+    BOOST_CHECK_THROW(estimate_gradient_batch(bf2, x, 1e-8), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_gradient_h_batch(bf2, x, 1e-8), std::invalid_argument);
+    // A batch function returning an output of the wrong size.
+    auto bf_bad = [](const vector_double &) { return vector_double{1.}; };
+    BOOST_CHECK_THROW(estimate_gradient_batch(bf_bad, x, 1e-8), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_gradient_h_batch(bf_bad, x, 1e-8), std::invalid_argument);
+    BOOST_CHECK_THROW(estimate_sparsity_batch(bf_bad, x, 1e-8), std::invalid_argument);
+    // The batch estimates must be identical to the serial ones.
+    BOOST_CHECK(estimate_gradient_batch(bf, x, 1e-8) == estimate_gradient(f, x, 1e-8));
+    BOOST_CHECK(estimate_gradient_h_batch(bf, x, 1e-2) == estimate_gradient_h(f, x, 1e-2));
+    // Use a bfe.
+    problem prob{dummy_problem_easy_grad{}};
+    bfe b{thread_bfe{}};
+    auto pbf = [&prob, &b](const vector_double &xs) { return b(prob, xs); };
+    BOOST_CHECK(estimate_gradient_batch(pbf, x, 1e-8) == estimate_gradient(f, x, 1e-8));
+    BOOST_CHECK(estimate_gradient_h_batch(pbf, x, 1e-2) == estimate_gradient_h(f, x, 1e-2));
+    // Empty input.
+    BOOST_CHECK(estimate_gradient_batch(bf, vector_double{}).empty());
+    BOOST_CHECK(estimate_gradient_h_batch(bf, vector_double{}).empty());
+}
@@ -0,0 +1,187 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE hypercube
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/hypercube.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// Check that the connections are symmetric and that they differ
+// from the vertex index by exactly one bit.
+void verify_hypercube_topology(const hypercube &h)
+{
+    const auto s = h.num_vertices();
+
+    BOOST_CHECK_EXCEPTION(h.get_connections(s), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "in a hypercube topology: the number of vertices in the topology is only");
+    });
+
+    for (std::size_t i = 0; i < s; ++i) {
+        const auto conns = h.get_connections(i);
+
+        BOOST_CHECK(conns.first.size() == conns.second.size());
+        BOOST_CHECK(std::all_of(conns.second.begin(), conns.second.end(),
+                                [&h](double x) { return x == h.get_weight(); }));
+
+        for (auto j : conns.first) {
+            BOOST_CHECK(j < s);
+            const auto x = i ^ j;
+            BOOST_CHECK(x && !(x & (x - 1u)));
+            const auto c = h.get_connections(j).first;
+            BOOST_CHECK(std::find(c.begin(), c.end(), i) != c.end());
+        }
+    }
+}
+
+std::vector<std::size_t> sorted_conns(const hypercube &h, std::size_t i)
+{
+    auto retval = h.get_connections(i).first;
+    std::sort(retval.begin(), retval.end());
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(basic_test)
+{
+    {
+        // Default construct, push back a few times.
+        hypercube h0;
+        BOOST_CHECK(h0.get_weight() == 1);
+        BOOST_CHECK(h0.num_vertices() == 0u);
+        verify_hypercube_topology(h0);
+
+        h0.push_back();
+        BOOST_CHECK(h0.get_connections(0).first.empty());
+        verify_hypercube_topology(h0);
+
+        for (auto i = 0; i < 7; ++i) {
+            h0.push_back();
+            verify_hypercube_topology(h0);
+        }
+        BOOST_CHECK(h0.num_vertices() == 8u);
+        for (std::size_t i = 0; i < 8u; ++i) {
+            BOOST_CHECK(h0.get_connections(i).first.size() == 3u);
+        }
+        BOOST_CHECK((sorted_conns(h0, 0) == std::vector<std::size_t>{1, 2, 4}));
+        BOOST_CHECK((sorted_conns(h0, 5) == std::vector<std::size_t>{1, 4, 7}));
+    }
+
+    {
+        // Incomplete hypercube.
+        hypercube h0(5, .5);
+        BOOST_CHECK(h0.get_weight() == .5);
+        BOOST_CHECK(h0.num_vertices() == 5u);
+        verify_hypercube_topology(h0);
+        BOOST_CHECK((sorted_conns(h0, 0) == std::vector<std::size_t>{1, 2, 4}));
+        BOOST_CHECK((sorted_conns(h0, 3) == std::vector<std::size_t>{1, 2}));
+        BOOST_CHECK((sorted_conns(h0, 4) == std::vector<std::size_t>{0}));
+    }
+
+    {
+        // Ctor from weight, error checking.
+        hypercube h0(.25);
+        BOOST_CHECK(h0.get_weight() == .25);
+        BOOST_CHECK(h0.num_vertices() == 0u);
+        BOOST_CHECK_THROW(hypercube(2.), std::invalid_argument);
+        BOOST_CHECK_THROW(hypercube(3, -1.), std::invalid_argument);
+    }
+
+    {
+        // Copy/move ctors.
+        hypercube h0(9, .2), h1(h0), h2(std::move(h0));
+        BOOST_CHECK(h1.num_vertices() == 9u);
+        BOOST_CHECK(h2.num_vertices() == 9u);
+        BOOST_CHECK(h2.get_weight() == .2);
+        verify_hypercube_topology(h1);
+        verify_hypercube_topology(h2);
+    }
+
+    {
+        // Name/extra info.
+        hypercube h0(9, .2);
+        BOOST_CHECK(h0.get_name() == "Hypercube");
+        BOOST_CHECK(boost::contains(h0.get_extra_info(), "Edges' weight:"));
+
+        std::cout << h0.get_extra_info() << '\n';
+    }
+
+    // Minimal serialization test.
+    {
+        topology t0(hypercube(10, .2));
+        BOOST_CHECK(!t0.has_to_csr());
+        std::stringstream ss;
+        {
+            boost::archive::binary_oarchive oarchive(ss);
+            oarchive << t0;
+        }
+        topology t1;
+        BOOST_CHECK(!t1.is<hypercube>());
+        {
+            boost::archive::binary_iarchive iarchive(ss);
+            iarchive >> t1;
+        }
+        BOOST_CHECK(t1.is<hypercube>());
+        BOOST_CHECK(t1.extract<hypercube>()->num_vertices() == 10u);
+        BOOST_CHECK(t1.extract<hypercube>()->get_weight() == .2);
+        verify_hypercube_topology(*t1.extract<hypercube>());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(large_test)
+{
+    hypercube h0(1u << 20, 1.);
+    const auto conns = h0.get_connections(12345u);
+    BOOST_CHECK(conns.first.size() == 20u);
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_test)
+{
+    archipelago archi{hypercube{}, 8, de{10}, rosenbrock{}, 10};
+    BOOST_CHECK(archi.get_topology().is<hypercube>());
+    BOOST_CHECK(archi.get_topology().extract<hypercube>()->num_vertices() == 8u);
+    archi.evolve();
+    archi.wait_check();
+}
@@ -96,6 +96,54 @@ BOOST_AUTO_TEST_CASE(ipopt_evolve_test_01)
     BOOST_CHECK(!algo.extract<ipopt>()->get_log().empty());
 }
 
+// A version of hs71 which counts the evaluations of the fitness and of the gradient
+// repeated consecutively at the same decision vector.
+struct hs71_rep : hock_schittkowsky_71 {
+    vector_double fitness(const vector_double &dv) const
+    {
+        if (dv == s_last_f_dv) {
+            ++s_n_rep;
+        }
+        s_last_f_dv = dv;
+        return hock_schittkowsky_71::fitness(dv);
+    }
+    vector_double gradient(const vector_double &dv) const
+    {
+        if (dv == s_last_g_dv) {
+            ++s_n_rep;
+        }
+        s_last_g_dv = dv;
+        return hock_schittkowsky_71::gradient(dv);
+    }
+    static void reset()
+    {
+        s_last_f_dv.clear();
+        s_last_g_dv.clear();
+        s_n_rep = 0;
+    }
+    static vector_double s_last_f_dv;
+    static vector_double s_last_g_dv;
+    static unsigned s_n_rep;
+};
+
+vector_double hs71_rep::s_last_f_dv;
+vector_double hs71_rep::s_last_g_dv;
+unsigned hs71_rep::s_n_rep = 0;
+
+// The fitness and the gradient are cached between the eval_* functions
+// invoked at the same x.
+BOOST_AUTO_TEST_CASE(ipopt_eval_cache)
+{
+    problem prob(hs71_rep{});
+    prob.set_c_tol({1E-8, 1E-8});
+    population pop(prob, 1);
+    hs71_rep::reset();
+    algorithm algo(ipopt{});
+    algo.evolve(pop);
+    BOOST_CHECK_EQUAL(Ipopt::Solve_Succeeded, algo.extract<ipopt>()->get_last_opt_result());
+    BOOST_CHECK_EQUAL(hs71_rep::s_n_rep, 0u);
+}
+
 // Empty pop.
 BOOST_AUTO_TEST_CASE(ipopt_evolve_test_02)
 {
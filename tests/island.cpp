@@ -631,3 +631,117 @@ BOOST_AUTO_TEST_CASE(is_valid)
     p0 = island{udi_01{}, de{}, population{rosenbrock{}, 25}};
     BOOST_CHECK(p0.is_valid());
 }
+
+BOOST_AUTO_TEST_CASE(island_stats_test)
+{
+    // NOTE: disable the stopping criteria of de, so that
+    // the number of fitness evaluations is deterministic.
+    island isl{de{10, .8, .9, 2u, 0., 0.}, rosenbrock{}, 20};
+    BOOST_CHECK(!isl.get_stats_enabled());
+
+    // Nothing is recorded when the instrumentation is disabled.
+    isl.evolve(3);
+    isl.wait_check();
+    auto s = isl.get_stats();
+    BOOST_CHECK(s.get_queue_wait().get_count() == 0u);
+    BOOST_CHECK(s.get_evolve().get_count() == 0u);
+    BOOST_CHECK(s.get_pop_copy().get_count() == 0u);
+    BOOST_CHECK(s.get_fevals() == 0u);
+
+    isl.set_stats_enabled(true);
+    BOOST_CHECK(isl.get_stats_enabled());
+    isl.evolve(3);
+    isl.evolve(2);
+    isl.wait_check();
+    s = isl.get_stats();
+    BOOST_CHECK(s.get_queue_wait().get_count() == 2u);
+    BOOST_CHECK(s.get_evolve().get_count() == 5u);
+    // de{10} with a population of 20 performs 200 evaluations per evolution.
+    BOOST_CHECK(s.get_fevals() == 1000u);
+    BOOST_CHECK(s.get_fevals_per_second() > 0.);
+    // Each evolution of a thread_island copies the population in and out.
+    BOOST_CHECK(s.get_pop_copy().get_count() == 10u);
+    BOOST_CHECK(s.get_pop_copy().get_min() == 20u * (sizeof(unsigned long long) + 3u * sizeof(double)));
+    // No migration outside an archipelago.
+    BOOST_CHECK(s.get_migr_pull().get_count() == 0u);
+    BOOST_CHECK(s.get_migr_replace().get_count() == 0u);
+    BOOST_CHECK(s.get_migr_select().get_count() == 0u);
+
+    // Population copies requested by the user are recorded as well.
+    isl.get_population();
+    BOOST_CHECK(isl.get_stats().get_pop_copy().get_count() == 11u);
+
+    // Copies preserve the flag but not the data.
+    auto isl2(isl);
+    BOOST_CHECK(isl2.get_stats_enabled());
+    BOOST_CHECK(isl2.get_stats().get_evolve().get_count() == 0u);
+
+    // Reset.
+    isl.reset_stats();
+    BOOST_CHECK(isl.get_stats().get_evolve().get_count() == 0u);
+    BOOST_CHECK(isl.get_stats().get_fevals() == 0u);
+
+    // Disabling does not reset.
+    isl.evolve();
+    isl.wait_check();
+    isl.set_stats_enabled(false);
+    BOOST_CHECK(!isl.get_stats_enabled());
+    BOOST_CHECK(isl.get_stats().get_evolve().get_count() == 1u);
+    isl.evolve();
+    isl.wait_check();
+    BOOST_CHECK(isl.get_stats().get_evolve().get_count() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(island_summary_test)
+{
+    // Default-constructed summary.
+    island_summary s0;
+    BOOST_CHECK(s0.get_champion_x().empty());
+    BOOST_CHECK(s0.get_champion_f().empty());
+    BOOST_CHECK(s0.get_fevals() == 0u);
+    BOOST_CHECK(s0.get_evolutions() == 0u);
+    BOOST_CHECK(s0.get_population_size() == 0u);
+
+    island isl{de{10, .8, .9, 2u, 0., 0.}, rosenbrock{}, 20};
+    // Summary of a newly-constructed island.
+    auto s = isl.get_summary();
+    BOOST_CHECK(s.get_champion_x() == isl.get_population().champion_x());
+    BOOST_CHECK(s.get_champion_f() == isl.get_population().champion_f());
+    BOOST_CHECK(s.get_fevals() == 20u);
+    BOOST_CHECK(s.get_evolutions() == 0u);
+    BOOST_CHECK(s.get_population_size() == 20u);
+
+    // Summaries are published at the end of each evolution.
+    isl.evolve(3);
+    isl.wait_check();
+    s = isl.get_summary();
+    const auto pop = isl.get_population();
+    BOOST_CHECK(s.get_champion_x() == pop.champion_x());
+    BOOST_CHECK(s.get_champion_f() == pop.champion_f());
+    BOOST_CHECK(s.get_fevals() == pop.get_problem().get_fevals());
+    BOOST_CHECK(s.get_fevals() == 20u + 3u * 10u * 20u);
+    BOOST_CHECK(s.get_evolutions() == 3u);
+    BOOST_CHECK(s.get_population_size() == 20u);
+    BOOST_CHECK(!boost::lexical_cast<std::string>(s).empty());
+
+    // ... and when the population is replaced.
+    isl.set_population(population{rosenbrock{5}, 7});
+    s = isl.get_summary();
+    BOOST_CHECK(s.get_champion_x().size() == 5u);
+    BOOST_CHECK(s.get_evolutions() == 3u);
+    BOOST_CHECK(s.get_population_size() == 7u);
+
+    // Copies and deserialised islands start from a fresh count.
+    auto isl2(isl);
+    BOOST_CHECK(isl2.get_summary().get_evolutions() == 0u);
+    BOOST_CHECK(isl2.get_summary().get_champion_f() == s.get_champion_f());
+
+    // Champions are not available for multi-objective and stochastic problems.
+    isl.set_population(population{zdt{}, 10});
+    BOOST_CHECK_THROW(isl.get_summary().get_champion_x(), std::invalid_argument);
+    BOOST_CHECK_THROW(isl.get_summary().get_champion_f(), std::invalid_argument);
+    BOOST_CHECK(isl.get_summary().get_population_size() == 10u);
+    isl.set_population(population{inventory{}, 10});
+    BOOST_CHECK_THROW(isl.get_summary().get_champion_x(), std::invalid_argument);
+    BOOST_CHECK(!boost::lexical_cast<std::string>(isl.get_summary()).empty());
+}
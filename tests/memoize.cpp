@@ -0,0 +1,295 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE memoize_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pagmo/exceptions.hpp>
+#include <pagmo/io.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/hock_schittkowsky_71.hpp>
+#include <pagmo/problems/inventory.hpp>
+#include <pagmo/problems/memoize.hpp>
+#include <pagmo/problems/null_problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+BOOST_AUTO_TEST_CASE(memoize_construction_test)
+{
+    problem p0{memoize{}};
+    problem p1{memoize{null_problem{}}};
+
+    BOOST_CHECK(boost::lexical_cast<std::string>(p0) == boost::lexical_cast<std::string>(p1));
+    BOOST_CHECK(p0.get_name() == "Null problem [memoized]");
+    BOOST_CHECK(p0.extract<memoize>()->get_capacity() == 1000u);
+    BOOST_CHECK(!p0.extract<memoize>()->get_cache_gradient());
+
+    memoize m{rosenbrock{5u}, 10u, true};
+    BOOST_CHECK(m.get_capacity() == 10u);
+    BOOST_CHECK(m.get_cache_gradient());
+    BOOST_CHECK(m.get_inner_problem().is<rosenbrock>());
+    BOOST_CHECK(m.get_thread_safety() == thread_safety::constant);
+
+    BOOST_CHECK_THROW((memoize{null_problem{}, 0u}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(memoize_fitness_test)
+{
+    problem p{memoize{hock_schittkowsky_71{}, 2u, true}};
+    const auto &m = *p.extract<memoize>();
+    const problem p0{hock_schittkowsky_71{}};
+    const vector_double x1{1., 2., 3., 4.}, x2{2., 2., 3., 4.}, x3{3., 2., 3., 4.};
+
+    BOOST_CHECK(p.fitness(x1) == p0.fitness(x1));
+    BOOST_CHECK(p.fitness(x1) == p0.fitness(x1));
+    BOOST_CHECK_EQUAL(m.get_hits(), 1u);
+    BOOST_CHECK_EQUAL(m.get_misses(), 1u);
+    // The outer problem counts all evaluations, the inner one only the actual ones.
+    BOOST_CHECK_EQUAL(p.get_fevals(), 2u);
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_fevals(), 1u);
+
+    // Fill the cache: x1 is now the least recently used entry,
+    // and it will be evicted when x3 is inserted.
+    p.fitness(x2);
+    p.fitness(x3);
+    BOOST_CHECK_EQUAL(m.get_cache_size(), 2u);
+    BOOST_CHECK_EQUAL(m.get_misses(), 3u);
+    p.fitness(x1);
+    BOOST_CHECK_EQUAL(m.get_misses(), 4u);
+    // x3 was used more recently than x2, so x2 was evicted.
+    p.fitness(x3);
+    BOOST_CHECK_EQUAL(m.get_hits(), 2u);
+    p.fitness(x2);
+    BOOST_CHECK_EQUAL(m.get_misses(), 5u);
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_fevals(), 5u);
+
+    // Gradient caching.
+    BOOST_CHECK(p.gradient(x1) == p0.gradient(x1));
+    BOOST_CHECK(p.gradient(x1) == p0.gradient(x1));
+    BOOST_CHECK_EQUAL(m.get_gradient_hits(), 1u);
+    BOOST_CHECK_EQUAL(m.get_gradient_misses(), 1u);
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_gevals(), 1u);
+
+    // Without gradient caching, the gradient is always forwarded.
+    problem pn{memoize{hock_schittkowsky_71{}}};
+    pn.gradient(x1);
+    pn.gradient(x1);
+    const auto &mn = *pn.extract<memoize>();
+    BOOST_CHECK_EQUAL(mn.get_inner_problem().get_gevals(), 2u);
+    BOOST_CHECK_EQUAL(mn.get_gradient_misses(), 0u);
+
+    // Hessians are forwarded.
+    BOOST_CHECK(p.hessians(x1) == p0.hessians(x1));
+    BOOST_CHECK(p.hessians_sparsity() == p0.hessians_sparsity());
+    BOOST_CHECK(p.gradient_sparsity() == p0.gradient_sparsity());
+    BOOST_CHECK(p.get_bounds() == p0.get_bounds());
+    BOOST_CHECK_EQUAL(p.get_nec(), p0.get_nec());
+    BOOST_CHECK_EQUAL(p.get_nic(), p0.get_nic());
+
+    // Extra info.
+    const auto ei = p.get_extra_info();
+    BOOST_CHECK(ei.find("Fitness cache hits: 2") != std::string::npos);
+    BOOST_CHECK(ei.find("Fitness cache misses: 5") != std::string::npos);
+    BOOST_CHECK(ei.find("Gradient cache hits: 1") != std::string::npos);
+
+    // Clear the cache.
+    p.extract<memoize>()->clear_cache();
+    BOOST_CHECK_EQUAL(m.get_cache_size(), 0u);
+    BOOST_CHECK_EQUAL(m.get_hits(), 0u);
+    BOOST_CHECK_EQUAL(m.get_misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(memoize_shared_cache_test)
+{
+    memoize m0{rosenbrock{2u}};
+    // Copies share the cache.
+    auto m1(m0);
+    m0.fitness({1., 2.});
+    m1.fitness({1., 2.});
+    BOOST_CHECK_EQUAL(m0.get_hits(), 1u);
+    BOOST_CHECK_EQUAL(m1.get_misses(), 1u);
+
+    // Changing seed detaches the cache.
+    memoize s0{inventory{}};
+    auto s1(s0);
+    const auto x = vector_double(s0.get_inner_problem().get_nx(), 1.);
+    s0.fitness(x);
+    s1.set_seed(42u);
+    BOOST_CHECK(s1.has_set_seed());
+    BOOST_CHECK_EQUAL(s1.get_misses(), 0u);
+    BOOST_CHECK_EQUAL(s1.get_cache_size(), 0u);
+    BOOST_CHECK_EQUAL(s0.get_cache_size(), 1u);
+
+    // Mutable access to the inner problem detaches the cache.
+    const memoize i0{inventory{4u, 10u, 1u}};
+    auto i1(i0);
+    BOOST_CHECK(i0.fitness(x) == inventory(4u, 10u, 1u).fitness(x));
+    BOOST_CHECK_EQUAL(i1.get_cache_size(), 1u);
+    i1.get_inner_problem().set_seed(2u);
+    BOOST_CHECK_EQUAL(i1.get_cache_size(), 0u);
+    BOOST_CHECK_EQUAL(i1.get_misses(), 0u);
+    BOOST_CHECK_EQUAL(i0.get_cache_size(), 1u);
+    BOOST_CHECK(i1.fitness(x) == inventory(4u, 10u, 2u).fitness(x));
+    BOOST_CHECK(i0.fitness(x) == inventory(4u, 10u, 1u).fitness(x));
+    BOOST_CHECK_EQUAL(i0.get_hits(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(memoize_serialization_test)
+{
+    problem p{memoize{hock_schittkowsky_71{}, 123u, true}};
+    p.fitness({1., 1., 1., 1.});
+    p.gradient({1., 1., 1., 1.});
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p;
+    }
+    p = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p;
+    }
+    BOOST_CHECK(p.is<memoize>());
+    const auto &m = *p.extract<memoize>();
+    BOOST_CHECK_EQUAL(m.get_capacity(), 123u);
+    BOOST_CHECK(m.get_cache_gradient());
+    BOOST_CHECK(m.get_inner_problem().is<hock_schittkowsky_71>());
+    // The cache is not serialized.
+    BOOST_CHECK_EQUAL(m.get_cache_size(), 0u);
+    BOOST_CHECK_EQUAL(m.get_hits(), 0u);
+}
+
+struct udp_with_bfe {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] + x[1]};
+    }
+    vector_double batch_fitness(const vector_double &xs) const
+    {
+        vector_double fvs(xs.size() / 2u);
+        for (decltype(xs.size()) i = 0; i < xs.size() / 2u; ++i) {
+            fvs[i] = xs[2u * i] + xs[2u * i + 1u];
+        }
+        return fvs;
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{0, 0}, {1, 1}};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(memoize_batch_fitness_test)
+{
+    problem p0{udp_with_bfe{}};
+    problem p1{memoize{udp_with_bfe{}}};
+    BOOST_CHECK(p1.has_batch_fitness());
+
+    vector_double dvs(100u * 2u);
+    std::iota(dvs.begin(), dvs.end(), 0.);
+    BOOST_CHECK(p1.batch_fitness(dvs) == p0.batch_fitness(dvs));
+    const auto &m = *p1.extract<memoize>();
+    BOOST_CHECK_EQUAL(m.get_misses(), 100u);
+    BOOST_CHECK_EQUAL(m.get_hits(), 0u);
+
+    // Half of the dvs are now in the cache.
+    vector_double dvs2(100u * 2u);
+    std::iota(dvs2.begin(), dvs2.end(), 100.);
+    BOOST_CHECK(p1.batch_fitness(dvs2) == p0.batch_fitness(dvs2));
+    BOOST_CHECK_EQUAL(m.get_misses(), 150u);
+    BOOST_CHECK_EQUAL(m.get_hits(), 50u);
+    // Single-point evaluation uses the same cache.
+    BOOST_CHECK(p1.fitness({0., 1.}) == vector_double{1.});
+    BOOST_CHECK_EQUAL(m.get_hits(), 51u);
+
+    auto no_bfe = problem{memoize{hock_schittkowsky_71{}}};
+    BOOST_CHECK(!no_bfe.has_batch_fitness());
+    BOOST_CHECK_THROW(no_bfe.batch_fitness({3., 3., 3., 3.}), not_implemented_error);
+}
+
+struct fg_udp {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] * x[0]};
+    }
+    vector_double gradient(const vector_double &x) const
+    {
+        return {2. * x[0]};
+    }
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &x) const
+    {
+        return {fitness(x), gradient(x)};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1.}, {1.}};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(memoize_fitness_and_gradient_test)
+{
+    problem p{memoize{fg_udp{}, 10u, true}};
+    BOOST_CHECK(p.has_fitness_and_gradient());
+    const auto &m = *p.extract<memoize>();
+
+    auto fg = p.fitness_and_gradient({.5});
+    BOOST_CHECK(fg.first == vector_double{.25});
+    BOOST_CHECK(fg.second == vector_double{1.});
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_gevals(), 1u);
+
+    // Both now come from the cache.
+    BOOST_CHECK(p.fitness({.5}) == vector_double{.25});
+    BOOST_CHECK(p.gradient({.5}) == vector_double{1.});
+    fg = p.fitness_and_gradient({.5});
+    BOOST_CHECK(fg.second == vector_double{1.});
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(m.get_inner_problem().get_gevals(), 1u);
+    BOOST_CHECK_EQUAL(m.get_hits(), 2u);
+    BOOST_CHECK_EQUAL(m.get_gradient_hits(), 2u);
+
+    // Cached fitness, missing gradient.
+    problem p2{memoize{fg_udp{}, 10u, false}};
+    p2.fitness({.5});
+    fg = p2.fitness_and_gradient({.5});
+    BOOST_CHECK(fg.second == vector_double{1.});
+    const auto &m2 = *p2.extract<memoize>();
+    BOOST_CHECK_EQUAL(m2.get_inner_problem().get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(m2.get_inner_problem().get_gevals(), 1u);
+}
@@ -238,6 +238,55 @@ BOOST_AUTO_TEST_CASE(nlopt_evolve)
     }
 }
 
+// A version of hs71 which counts the evaluations of the fitness and of the gradient
+// repeated consecutively at the same decision vector.
+struct hs71_rep : hock_schittkowsky_71 {
+    vector_double fitness(const vector_double &dv) const
+    {
+        if (dv == s_last_f_dv) {
+            ++s_n_rep;
+        }
+        s_last_f_dv = dv;
+        return hock_schittkowsky_71::fitness(dv);
+    }
+    vector_double gradient(const vector_double &dv) const
+    {
+        if (dv == s_last_g_dv) {
+            ++s_n_rep;
+        }
+        s_last_g_dv = dv;
+        return hock_schittkowsky_71::gradient(dv);
+    }
+    static void reset()
+    {
+        s_last_f_dv.clear();
+        s_last_g_dv.clear();
+        s_n_rep = 0;
+    }
+    static vector_double s_last_f_dv;
+    static vector_double s_last_g_dv;
+    static unsigned s_n_rep;
+};
+
+vector_double hs71_rep::s_last_f_dv;
+vector_double hs71_rep::s_last_g_dv;
+unsigned hs71_rep::s_n_rep = 0;
+
+// The fitness and the gradient are cached between the invocations of the objective
+// function and of the constraints functions at the same x.
+BOOST_AUTO_TEST_CASE(nlopt_eval_cache)
+{
+    population pop{hs71_rep{}, 5};
+    pop.get_problem().set_c_tol({1E-6, 1E-6});
+    for (auto algo : {"slsqp", "cobyla"}) {
+        hs71_rep::reset();
+        const auto fevals = pop.get_problem().get_fevals();
+        algorithm{nlopt{algo}}.evolve(pop);
+        BOOST_CHECK_EQUAL(hs71_rep::s_n_rep, 0u);
+        BOOST_CHECK(pop.get_problem().get_fevals() > fevals);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(nlopt_set_sc)
 {
     auto a = nlopt{"slsqp"};
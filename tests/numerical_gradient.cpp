@@ -0,0 +1,158 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE numerical_gradient_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <pagmo/batch_evaluators/default_bfe.hpp>
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/io.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/hock_schittkowsky_71.hpp>
+#include <pagmo/problems/inventory.hpp>
+#include <pagmo/problems/null_problem.hpp>
+#include <pagmo/problems/numerical_gradient.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+#include <pagmo/utils/gradients_and_hessians.hpp>
+
+using namespace pagmo;
+
+BOOST_AUTO_TEST_CASE(numerical_gradient_construction_test)
+{
+    problem p0{numerical_gradient{}};
+    problem p1{numerical_gradient{null_problem{}}};
+
+    BOOST_CHECK(boost::lexical_cast<std::string>(p0) == boost::lexical_cast<std::string>(p1));
+    BOOST_CHECK(p0.get_name() == "Null problem [numerical gradient]");
+    BOOST_CHECK(p0.has_gradient());
+    BOOST_CHECK(!p0.has_gradient_sparsity());
+    BOOST_CHECK(p0.extract<numerical_gradient>()->get_dx() == 1e-8);
+    BOOST_CHECK(!p0.extract<numerical_gradient>()->get_high_order());
+    BOOST_CHECK(p0.extract<numerical_gradient>()->get_bfe().is<default_bfe>());
+
+    numerical_gradient ng{rosenbrock{5u}, 1e-3, true, bfe{thread_bfe{}}};
+    BOOST_CHECK(ng.get_dx() == 1e-3);
+    BOOST_CHECK(ng.get_high_order());
+    BOOST_CHECK(ng.get_bfe().is<thread_bfe>());
+    BOOST_CHECK(ng.get_inner_problem().is<rosenbrock>());
+    BOOST_CHECK(ng.get_thread_safety()
+                == std::min(ng.get_inner_problem().get_thread_safety(), ng.get_bfe().get_thread_safety()));
+    BOOST_CHECK(ng.get_extra_info().find("Finite difference step") != std::string::npos);
+
+    BOOST_CHECK_THROW((numerical_gradient{null_problem{}, 0.}), std::invalid_argument);
+    BOOST_CHECK_THROW((numerical_gradient{null_problem{}, -1e-8}), std::invalid_argument);
+    BOOST_CHECK_THROW((numerical_gradient{null_problem{}, std::numeric_limits<double>::infinity()}),
+                      std::invalid_argument);
+    BOOST_CHECK_THROW((numerical_gradient{null_problem{}, std::numeric_limits<double>::quiet_NaN()}),
+                      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(numerical_gradient_gradient_test)
+{
+    const problem p0{hock_schittkowsky_71{}};
+    const vector_double x{1.1, 2.2, 3.3, 4.4};
+    for (auto high_order : {false, true}) {
+        for (const auto &b : {bfe{}, bfe{thread_bfe{}}}) {
+            problem p{numerical_gradient{hock_schittkowsky_71{}, high_order ? 1e-2 : 1e-8, high_order, b}};
+            BOOST_CHECK(p.fitness(x) == p0.fitness(x));
+            BOOST_CHECK(p.get_nobj() == p0.get_nobj());
+            BOOST_CHECK(p.get_nec() == p0.get_nec());
+            BOOST_CHECK(p.get_nic() == p0.get_nic());
+            BOOST_CHECK(p.get_bounds() == p0.get_bounds());
+            // The gradient is dense.
+            BOOST_CHECK(p.gradient_sparsity().size() == p0.get_nf() * p0.get_nx());
+            const auto g = p.gradient(x);
+            BOOST_CHECK_EQUAL(g.size(), p0.get_nf() * p0.get_nx());
+            // Compare with the analytical gradient.
+            const auto g0 = p0.gradient(x);
+            const auto sp0 = p0.gradient_sparsity();
+            for (decltype(sp0.size()) k = 0; k < sp0.size(); ++k) {
+                BOOST_CHECK(std::abs(g[sp0[k].first * p0.get_nx() + sp0[k].second] - g0[k]) < 1e-5);
+            }
+            // Compare with the serial estimate.
+            auto f = [&p0](const vector_double &y) { return p0.fitness(y); };
+            BOOST_CHECK(g == (high_order ? estimate_gradient_h(f, x, 1e-2) : estimate_gradient(f, x, 1e-8)));
+            // The inner problem counts the evaluations used by the estimation.
+            BOOST_CHECK_EQUAL(p.extract<numerical_gradient>()->get_inner_problem().get_fevals(),
+                              1u + (high_order ? 6u : 2u) * p0.get_nx());
+        }
+    }
+    // Forwarding of hessians.
+    problem p{numerical_gradient{hock_schittkowsky_71{}}};
+    BOOST_CHECK(p.has_hessians());
+    BOOST_CHECK(p.hessians(x) == p0.hessians(x));
+    BOOST_CHECK(p.hessians_sparsity() == p0.hessians_sparsity());
+}
+
+BOOST_AUTO_TEST_CASE(numerical_gradient_stochastic_test)
+{
+    problem p{numerical_gradient{inventory{4u, 10u, 42u}}};
+    BOOST_CHECK(p.has_set_seed());
+    const vector_double x{1., 2., 3., 4.};
+    p.set_seed(43u);
+    const auto f43 = p.fitness(x);
+    problem p0{inventory{4u, 10u, 43u}};
+    BOOST_CHECK(f43 == p0.fitness(x));
+}
+
+BOOST_AUTO_TEST_CASE(numerical_gradient_serialization_test)
+{
+    problem p{numerical_gradient{rosenbrock{4u}, 1e-3, true, bfe{thread_bfe{}}}};
+    const vector_double x{.1, .2, .3, .4};
+    const auto g = p.gradient(x);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p;
+    }
+    p = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p;
+    }
+    BOOST_CHECK(p.is<numerical_gradient>());
+    const auto &ng = *p.extract<numerical_gradient>();
+    BOOST_CHECK_EQUAL(ng.get_dx(), 1e-3);
+    BOOST_CHECK(ng.get_high_order());
+    BOOST_CHECK(ng.get_bfe().is<thread_bfe>());
+    BOOST_CHECK(ng.get_inner_problem().is<rosenbrock>());
+    BOOST_CHECK(p.gradient(x) == g);
+}
@@ -38,6 +38,8 @@ see https://www.gnu.org/licenses/. */
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/lexical_cast.hpp>
 
@@ -462,3 +464,80 @@ BOOST_AUTO_TEST_CASE(population_nan_champion)
     pop0.push_back({std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()});
     BOOST_CHECK(!std::isnan(pop0.champion_f()[0]));
 }
+
+BOOST_AUTO_TEST_CASE(population_batch_test)
+{
+    // The batch API must give the same results as push_back()/set_xf().
+    for (auto p : {problem{rosenbrock{3u}}, problem{hock_schittkowsky_71{}}, problem{zdt{1u, 5u}}}) {
+        population pop0{p, 0u, 42u}, pop1{p, 0u, 42u}, pop2{p, 0u, 42u}, gen{p, 0u, 1u};
+        const auto nx = p.get_nx(), nf = p.get_nf();
+        std::vector<vector_double> xs, fs;
+        vector_double dvs, fvs;
+        for (auto i = 0; i < 10; ++i) {
+            xs.push_back(gen.random_decision_vector());
+            fs.push_back(p.fitness(xs.back()));
+            dvs.insert(dvs.end(), xs.back().begin(), xs.back().end());
+            fvs.insert(fvs.end(), fs.back().begin(), fs.back().end());
+            pop0.push_back(xs.back(), fs.back());
+        }
+        pop1.append(dvs, fvs);
+        pop2.append(std::vector<vector_double>(xs), std::vector<vector_double>(fs));
+        for (const auto &pop : {pop1, pop2}) {
+            BOOST_CHECK(pop.get_ID() == pop0.get_ID());
+            BOOST_CHECK(pop.get_x() == pop0.get_x());
+            BOOST_CHECK(pop.get_f() == pop0.get_f());
+            if (p.get_nobj() == 1u) {
+                BOOST_CHECK(pop.champion_x() == pop0.champion_x());
+                BOOST_CHECK(pop.champion_f() == pop0.champion_f());
+            }
+        }
+        // Appending an empty batch is a no-op.
+        pop1.append(vector_double{}, vector_double{});
+        BOOST_CHECK(pop1.size() == 10u);
+
+        // Overwrite the first 5 individuals with the last 5, in reverse order.
+        vector_double new_dvs, new_fvs;
+        std::vector<vector_double> new_xs, new_fs;
+        for (auto i = 9; i >= 5; --i) {
+            new_xs.push_back(pop0.get_x()[static_cast<population::size_type>(i)]);
+            new_fs.push_back(pop0.get_f()[static_cast<population::size_type>(i)]);
+            new_dvs.insert(new_dvs.end(), new_xs.back().begin(), new_xs.back().end());
+            new_fvs.insert(new_fvs.end(), new_fs.back().begin(), new_fs.back().end());
+        }
+        for (population::size_type i = 0; i < 5u; ++i) {
+            pop0.set_xf(i, new_xs[i], new_fs[i]);
+        }
+        pop1.assign_batch(new_dvs, new_fvs);
+        pop2.assign_batch(std::move(new_xs), std::move(new_fs));
+        for (const auto &pop : {pop1, pop2}) {
+            BOOST_CHECK(pop.get_ID() == pop0.get_ID());
+            BOOST_CHECK(pop.get_x() == pop0.get_x());
+            BOOST_CHECK(pop.get_f() == pop0.get_f());
+            if (p.get_nobj() == 1u) {
+                BOOST_CHECK(pop.champion_x() == pop0.champion_x());
+                BOOST_CHECK(pop.champion_f() == pop0.champion_f());
+            }
+        }
+
+        // Error handling. In case of errors, the population is not altered.
+        const auto pop_copy(pop1);
+        BOOST_CHECK_THROW(pop1.append(vector_double(nx + 1u), vector_double(nf)), std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.append(vector_double(nx), vector_double(nf + 1u)), std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.append(vector_double(nx), vector_double(2u * nf)), std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.append(std::vector<vector_double>{vector_double(nx), vector_double(nx + 1u)},
+                                      std::vector<vector_double>{vector_double(nf), vector_double(nf)}),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.append(std::vector<vector_double>{vector_double(nx), vector_double(nx)},
+                                      std::vector<vector_double>{vector_double(nf), vector_double(nf - 1u)}),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.assign_batch(vector_double(nx + 1u), vector_double(nf)), std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.assign_batch(vector_double(11u * nx), vector_double(11u * nf)),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW(pop1.assign_batch(std::vector<vector_double>{vector_double(nx)},
+                                            std::vector<vector_double>{vector_double(nf), vector_double(nf)}),
+                          std::invalid_argument);
+        BOOST_CHECK(pop1.get_ID() == pop_copy.get_ID());
+        BOOST_CHECK(pop1.get_x() == pop_copy.get_x());
+        BOOST_CHECK(pop1.get_f() == pop_copy.get_f());
+    }
+}
@@ -30,11 +30,13 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <initializer_list>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -42,9 +44,12 @@ see https://www.gnu.org/licenses/. */
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <pagmo/detail/eval_counters.hpp>
 #include <pagmo/exceptions.hpp>
 #include <pagmo/problem.hpp>
 #include <pagmo/problems/null_problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/translate.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/threading.hpp>
 #include <pagmo/types.hpp>
@@ -1352,6 +1357,78 @@ BOOST_AUTO_TEST_CASE(increase_counter)
     BOOST_CHECK(p.get_fevals() == 110u);
 }
 
+BOOST_AUTO_TEST_CASE(trusted_fitness)
+{
+    problem p{full_p{1u, 0u, 0u, {42.}}};
+    BOOST_CHECK((detail::prob_invoke_mem_fitness(p, {.5}) == vector_double{42.}));
+    BOOST_CHECK_EQUAL(p.get_fevals(), 1u);
+    BOOST_CHECK((detail::prob_invoke_mem_fitness(p, {.5}) == p.fitness({.5})));
+    BOOST_CHECK_EQUAL(p.get_fevals(), 3u);
+
+    // The trusted entry point does not check the output of the UDP.
+    problem p2{full_p{1u, 0u, 0u, {1., 2.}}};
+    BOOST_CHECK_EQUAL(detail::prob_invoke_mem_fitness(p2, {.5}).size(), 2u);
+    BOOST_CHECK_THROW(p2.fitness({.5}), std::invalid_argument);
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_counters)
+{
+    // Evaluate the same problem concurrently from more threads
+    // than there are counter shards.
+    problem p{full_p{}};
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < 2u * detail::eval_counters::max_shards; ++i) {
+        threads.emplace_back([&p]() {
+            for (int j = 0; j < 100; ++j) {
+                p.fitness({0.});
+                p.gradient({0.});
+                p.hessians({0.});
+                p.increment_fevals(2u);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    const auto n = 200u * detail::eval_counters::max_shards;
+    BOOST_CHECK_EQUAL(p.get_fevals(), 3u * n);
+    BOOST_CHECK_EQUAL(p.get_gevals(), n);
+    BOOST_CHECK_EQUAL(p.get_hevals(), n);
+
+    // Copy, move and serialisation preserve the totals.
+    problem p2(p);
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 3u * n);
+    BOOST_CHECK_EQUAL(p2.get_gevals(), n);
+    BOOST_CHECK_EQUAL(p2.get_hevals(), n);
+    p2.fitness({0.});
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 3u * n + 1u);
+    BOOST_CHECK_EQUAL(p.get_fevals(), 3u * n);
+    problem p3(std::move(p2));
+    BOOST_CHECK_EQUAL(p3.get_fevals(), 3u * n + 1u);
+    p2 = p;
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 3u * n);
+    p2 = std::move(p3);
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 3u * n + 1u);
+    BOOST_CHECK_EQUAL(p2.get_hevals(), n);
+
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p2;
+    }
+    problem p4;
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p4;
+    }
+    BOOST_CHECK_EQUAL(p4.get_fevals(), 3u * n + 1u);
+    BOOST_CHECK_EQUAL(p4.get_gevals(), n);
+    BOOST_CHECK_EQUAL(p4.get_hevals(), n);
+    p4.gradient({0.});
+    BOOST_CHECK_EQUAL(p4.get_gevals(), n + 1u);
+}
+
 struct bf_s11n {
     vector_double fitness(const vector_double &) const
     {
@@ -1593,3 +1670,392 @@ BOOST_AUTO_TEST_CASE(generic_assignment)
     BOOST_CHECK((!std::is_assignable<problem, const int &>::value));
     BOOST_CHECK((!std::is_assignable<problem, int &&>::value));
 }
+
+struct fg_p {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] * x[0] + x[1] * x[1]};
+    }
+    vector_double gradient(const vector_double &x) const
+    {
+        return {2. * x[0], 2. * x[1]};
+    }
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &x) const
+    {
+        ++n_fg;
+        return {fitness(x), gradient(x)};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1., -1.}, {1., 1.}};
+    }
+    template <typename Archive>
+    void serialize(Archive &, unsigned)
+    {
+    }
+    static unsigned n_fg;
+};
+
+unsigned fg_p::n_fg = 0;
+
+PAGMO_S11N_PROBLEM_EXPORT(fg_p)
+
+struct fg_p_override : fg_p {
+    bool has_fitness_and_gradient() const
+    {
+        return false;
+    }
+};
+
+struct fg_p_bad : fg_p {
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &) const
+    {
+        return {{1.}, {1.}};
+    }
+};
+
+// Fused fitness and gradient without gradient.
+struct fg_p_no_grad {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0]};
+    }
+    std::pair<vector_double, vector_double> fitness_and_gradient(const vector_double &x) const
+    {
+        return {fitness(x), {1.}};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1.}, {1.}};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(fitness_and_gradient)
+{
+    BOOST_CHECK(has_fitness_and_gradient<fg_p>::value);
+    BOOST_CHECK(!has_fitness_and_gradient<full_p>::value);
+    BOOST_CHECK(!override_has_fitness_and_gradient<fg_p>::value);
+    BOOST_CHECK(override_has_fitness_and_gradient<fg_p_override>::value);
+
+    // Fused evaluation.
+    problem p0{fg_p{}};
+    BOOST_CHECK(p0.has_fitness_and_gradient());
+    auto fg = p0.fitness_and_gradient({1., 2.});
+    BOOST_CHECK(fg.first == vector_double{5.});
+    BOOST_CHECK((fg.second == vector_double{2., 4.}));
+    BOOST_CHECK_EQUAL(fg_p::n_fg, 1u);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(p0.get_gevals(), 1u);
+    BOOST_CHECK_THROW(p0.fitness_and_gradient({1.}), std::invalid_argument);
+
+    // Fallback on separate fitness/gradient calls.
+    problem p1{fg_p_override{}};
+    BOOST_CHECK(!p1.has_fitness_and_gradient());
+    fg = p1.fitness_and_gradient({1., 2.});
+    BOOST_CHECK(fg.first == vector_double{5.});
+    BOOST_CHECK((fg.second == vector_double{2., 4.}));
+    BOOST_CHECK_EQUAL(fg_p::n_fg, 1u);
+    BOOST_CHECK_EQUAL(p1.get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(p1.get_gevals(), 1u);
+
+    // No gradient at all.
+    problem p2{null_problem{}};
+    BOOST_CHECK(!p2.has_fitness_and_gradient());
+    BOOST_CHECK_THROW(p2.fitness_and_gradient({1.}), not_implemented_error);
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 0u);
+
+    // Output checks.
+    problem p3{fg_p_bad{}};
+    BOOST_CHECK_THROW(p3.fitness_and_gradient({1., 2.}), std::invalid_argument);
+
+    // The fused computation requires the gradient.
+    BOOST_CHECK(has_fitness_and_gradient<fg_p_no_grad>::value);
+    BOOST_CHECK_EXCEPTION(problem{fg_p_no_grad{}}, std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "provides a fused fitness and gradient computation, but it does not "
+                                          "provide the gradient");
+    });
+
+    // Serialization preserves the flag.
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p0;
+    }
+    p0 = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p0;
+    }
+    BOOST_CHECK(p0.has_fitness_and_gradient());
+}
+
+// A UDP with the constant thread safety guarantee.
+struct shared_p {
+    vector_double fitness(const vector_double &x) const
+    {
+        return {x[0] + m_data[0]};
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{0.}, {1.}};
+    }
+    void set_seed(unsigned s)
+    {
+        m_seed = s;
+    }
+    thread_safety get_thread_safety() const
+    {
+        return m_ts;
+    }
+    template <typename Archive>
+    void serialize(Archive &ar, unsigned)
+    {
+        detail::archive(ar, m_data, m_seed, m_ts);
+    }
+    vector_double m_data = vector_double(1000, 1.);
+    unsigned m_seed = 0;
+    thread_safety m_ts = thread_safety::constant;
+};
+
+PAGMO_S11N_PROBLEM_EXPORT(shared_p)
+
+namespace pagmo
+{
+
+// Opt in to the sharing of the UDP.
+template <>
+struct is_shareable_udp<shared_p> : std::true_type {
+};
+
+} // namespace pagmo
+
+BOOST_AUTO_TEST_CASE(shared_udp)
+{
+    problem p0{shared_p{}};
+    const auto &cp0 = p0;
+
+    // Copies share the UDP instance.
+    problem p1{p0};
+    const auto &cp1 = p1;
+    BOOST_CHECK(cp1.extract<shared_p>() == cp0.extract<shared_p>());
+    problem p2;
+    p2 = p1;
+    BOOST_CHECK(static_cast<const problem &>(p2).extract<shared_p>() == cp0.extract<shared_p>());
+
+    // The evaluation counters are per copy.
+    BOOST_CHECK(p1.fitness({0.5}) == vector_double{1.5});
+    BOOST_CHECK_EQUAL(p1.get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 0u);
+    BOOST_CHECK_EQUAL(p2.get_fevals(), 0u);
+    p1.increment_fevals(5);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 0u);
+    problem p3{p1};
+    BOOST_CHECK_EQUAL(p3.get_fevals(), 6u);
+
+    // Mutable access makes a private copy of the UDP.
+    p1.extract<shared_p>()->m_data[0] = 2.;
+    BOOST_CHECK(cp1.extract<shared_p>() != cp0.extract<shared_p>());
+    BOOST_CHECK(p1.fitness({0.5}) == vector_double{2.5});
+    BOOST_CHECK(p0.fitness({0.5}) == vector_double{1.5});
+    BOOST_CHECK(p2.fitness({0.5}) == vector_double{1.5});
+    BOOST_CHECK(p3.fitness({0.5}) == vector_double{1.5});
+    BOOST_CHECK(static_cast<const problem &>(p3).extract<shared_p>() == cp0.extract<shared_p>());
+
+    // Same for set_seed().
+    p3.set_seed(42);
+    BOOST_CHECK_EQUAL(static_cast<const problem &>(p3).extract<shared_p>()->m_seed, 42u);
+    BOOST_CHECK_EQUAL(cp0.extract<shared_p>()->m_seed, 0u);
+    BOOST_CHECK(static_cast<const problem &>(p2).extract<shared_p>() == cp0.extract<shared_p>());
+
+    // A UDP which is not shared is not copied on mutable access.
+    const auto old_ptr = cp1.extract<shared_p>();
+    BOOST_CHECK(p1.extract<shared_p>() == old_ptr);
+
+    // UDPs with lower thread safety levels are always copied.
+    shared_p sp;
+    sp.m_ts = thread_safety::basic;
+    problem p4{sp};
+    problem p5{p4};
+    BOOST_CHECK(static_cast<const problem &>(p4).extract<shared_p>()
+                != static_cast<const problem &>(p5).extract<shared_p>());
+
+    // UDPs which do not opt in are always copied.
+    BOOST_CHECK(!is_shareable_udp<rosenbrock>::value);
+    problem p6{rosenbrock{3}};
+    problem p7{p6};
+    BOOST_CHECK(static_cast<const problem &>(p6).extract<rosenbrock>()
+                != static_cast<const problem &>(p7).extract<rosenbrock>());
+
+    // Meta-problems do not share the UDP, so that the counters
+    // of the inner problem are per copy.
+    BOOST_CHECK(!is_shareable_udp<translate>::value);
+    problem t0{translate{shared_p{}, {0.5}}};
+    BOOST_CHECK(t0.get_thread_safety() == thread_safety::constant);
+    problem t1{t0};
+    BOOST_CHECK(static_cast<const problem &>(t0).extract<translate>()
+                != static_cast<const problem &>(t1).extract<translate>());
+    BOOST_CHECK(t1.fitness({0.5}) == vector_double{1.});
+    BOOST_CHECK_EQUAL(t1.extract<translate>()->get_inner_problem().get_fevals(), 1u);
+    BOOST_CHECK_EQUAL(t0.extract<translate>()->get_inner_problem().get_fevals(), 0u);
+
+    // Serialisation of a shared UDP.
+    problem r0{shared_p{}};
+    problem r1{r0};
+    BOOST_CHECK(static_cast<const problem &>(r0).extract<shared_p>()
+                == static_cast<const problem &>(r1).extract<shared_p>());
+    r1.fitness({0.5});
+    const auto before = boost::lexical_cast<std::string>(r1);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << r1;
+    }
+    r1 = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> r1;
+    }
+    BOOST_CHECK_EQUAL(before, boost::lexical_cast<std::string>(r1));
+    BOOST_CHECK(r1.is<shared_p>());
+    BOOST_CHECK(static_cast<const problem &>(r0).extract<shared_p>()
+                != static_cast<const problem &>(r1).extract<shared_p>());
+    BOOST_CHECK(r0.fitness({0.5}) == r1.fitness({0.5}));
+
+    // Concurrent copies and evaluations of a shared UDP.
+    std::atomic<bool> flag{true};
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([&r0, &flag]() {
+            for (auto j = 0; j < 100; ++j) {
+                problem tmp{r0};
+                if (tmp.fitness({0.5}) != vector_double{1.5}) {
+                    flag.store(false);
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    BOOST_CHECK(flag.load());
+    BOOST_CHECK_EQUAL(r0.get_fevals(), 1u);
+}
+
+struct fi_p {
+    vector_double fitness(const vector_double &x) const
+    {
+        ++n_f;
+        return {x[0] + x[1], x[0] - x[1]};
+    }
+    void fitness_into(const double *x, double *f) const
+    {
+        ++n_fi;
+        f[0] = x[0] + x[1];
+        f[1] = x[0] - x[1];
+    }
+    vector_double::size_type get_nobj() const
+    {
+        return 2u;
+    }
+    std::pair<vector_double, vector_double> get_bounds() const
+    {
+        return {{-1., -1.}, {1., 1.}};
+    }
+    template <typename Archive>
+    void serialize(Archive &, unsigned)
+    {
+    }
+    static unsigned n_f;
+    static unsigned n_fi;
+};
+
+unsigned fi_p::n_f = 0;
+unsigned fi_p::n_fi = 0;
+
+PAGMO_S11N_PROBLEM_EXPORT(fi_p)
+
+struct fi_p_bad_sig : fg_p {
+    double fitness_into(const double *, double *) const
+    {
+        return 0.;
+    }
+};
+
+struct fi_p_bad_f : fg_p {
+    vector_double fitness(const vector_double &) const
+    {
+        return {1., 2.};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(fitness_into)
+{
+    BOOST_CHECK(has_fitness_into<fi_p>::value);
+    BOOST_CHECK(has_fitness_into<rosenbrock>::value);
+    BOOST_CHECK(!has_fitness_into<fg_p>::value);
+    BOOST_CHECK(!has_fitness_into<fi_p_bad_sig>::value);
+
+    // The UDP's fitness_into() is used by both fitness() and fitness_into().
+    problem p0{fi_p{}};
+    BOOST_CHECK(p0.has_fitness_into());
+    BOOST_CHECK((p0.fitness({1., 2.}) == vector_double{3., -1.}));
+    vector_double fv;
+    p0.fitness_into({1., 2.}, fv);
+    BOOST_CHECK((fv == vector_double{3., -1.}));
+    // Reuse of the output vector.
+    const auto old_data = fv.data();
+    p0.fitness_into({2., 2.}, fv);
+    BOOST_CHECK((fv == vector_double{4., 0.}));
+    BOOST_CHECK(fv.data() == old_data);
+    BOOST_CHECK_EQUAL(fi_p::n_f, 0u);
+    BOOST_CHECK_EQUAL(fi_p::n_fi, 3u);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 3u);
+    BOOST_CHECK_THROW(p0.fitness_into({1.}, fv), std::invalid_argument);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 3u);
+
+    // Trusted raw buffer entry point.
+    const vector_double dv{1., -1.};
+    double out[2] = {};
+    detail::prob_invoke_mem_fitness_into(p0, dv.data(), out);
+    BOOST_CHECK_EQUAL(out[0], 0.);
+    BOOST_CHECK_EQUAL(out[1], 2.);
+    BOOST_CHECK_EQUAL(p0.get_fevals(), 4u);
+
+    // Fallback on the UDP's fitness().
+    problem p1{fg_p{}};
+    BOOST_CHECK(!p1.has_fitness_into());
+    fv.clear();
+    p1.fitness_into({1., 2.}, fv);
+    BOOST_CHECK(fv == vector_double{5.});
+    detail::prob_invoke_mem_fitness_into(p1, dv.data(), out);
+    BOOST_CHECK_EQUAL(out[0], 2.);
+    BOOST_CHECK_EQUAL(p1.get_fevals(), 2u);
+    problem p2{fi_p_bad_f{}};
+    BOOST_CHECK_THROW(p2.fitness_into({1., 2.}, fv), std::invalid_argument);
+    BOOST_CHECK_THROW(detail::prob_invoke_mem_fitness_into(p2, dv.data(), out), std::invalid_argument);
+
+    // Built-in problems implementing fitness_into() give the same results as before.
+    problem p3{rosenbrock{5u}};
+    BOOST_CHECK(p3.has_fitness_into());
+    p3.fitness_into({1., 2., 3., 4., 5.}, fv);
+    BOOST_CHECK(fv == vector_double{14814.});
+    BOOST_CHECK(p3.fitness({1., 2., 3., 4., 5.}) == vector_double{14814.});
+
+    // Serialization and copies preserve the flag.
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p0;
+    }
+    p0 = problem{};
+    BOOST_CHECK(!p0.has_fitness_into());
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p0;
+    }
+    BOOST_CHECK(p0.has_fitness_into());
+    auto p4(p0);
+    BOOST_CHECK(p4.has_fitness_into());
+    auto p5(std::move(p4));
+    BOOST_CHECK(p5.has_fitness_into());
+}
@@ -43,12 +43,14 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <pagmo/exceptions.hpp>
 #include <pagmo/r_policies/fair_replace.hpp>
 #include <pagmo/r_policy.hpp>
 #include <pagmo/s11n.hpp>
@@ -506,6 +508,140 @@ BOOST_AUTO_TEST_CASE(replace)
                           });
 }
 
+// Helper to create UDRPs returning a fixed replacement plan.
+struct udrp_plan {
+    individuals_group_t replace(const individuals_group_t &inds, const vector_double::size_type &,
+                                const vector_double::size_type &, const vector_double::size_type &,
+                                const vector_double::size_type &, const vector_double::size_type &,
+                                const vector_double &, const individuals_group_t &) const
+    {
+        return inds;
+    }
+    replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &, const individuals_group_t &) const
+    {
+        return plan;
+    }
+    std::string get_name() const
+    {
+        return "udrp_plan";
+    }
+    replacement_plan_t plan;
+};
+
+// A UDRP without replace_in_place() which returns a fixed group of individuals.
+struct udrp_group {
+    individuals_group_t replace(const individuals_group_t &, const vector_double::size_type &,
+                                const vector_double::size_type &, const vector_double::size_type &,
+                                const vector_double::size_type &, const vector_double::size_type &,
+                                const vector_double &, const individuals_group_t &) const
+    {
+        return group;
+    }
+    std::string get_name() const
+    {
+        return "udrp_group";
+    }
+    individuals_group_t group;
+};
+
+BOOST_AUTO_TEST_CASE(replace_in_place)
+{
+    struct no_udrp_00 {
+        individuals_group_t replace(const individuals_group_t &inds, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double::size_type &, const vector_double::size_type &,
+                                    const vector_double &, const individuals_group_t &) const
+        {
+            return inds;
+        }
+        // Missing const.
+        replacement_plan_t replace_in_place(const individuals_view_t &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double::size_type &, const vector_double::size_type &,
+                                            const vector_double &, const individuals_group_t &)
+        {
+            return replacement_plan_t{};
+        }
+    };
+
+    BOOST_CHECK(has_replace_in_place<udrp_plan>::value);
+    BOOST_CHECK(has_replace_in_place<fair_replace>::value);
+    BOOST_CHECK(!has_replace_in_place<no_udrp_00>::value);
+    BOOST_CHECK(!has_replace_in_place<udrp1>::value);
+    BOOST_CHECK(!has_replace_in_place<int>::value);
+
+    const individuals_group_t inds{{0, 1}, {{1.}, {2.}}, {{1.}, {2.}}};
+    const individuals_group_t mig{{2, 3, 4}, {{1.}, {2.}, {3.}}, {{1.}, {2.}, {3.}}};
+    const individuals_view_t view(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds));
+
+    // UDRPs without replace_in_place().
+    BOOST_CHECK(!r_policy{udrp1{}}.has_replace_in_place());
+    BOOST_CHECK(!r_policy{no_udrp_00{}}.has_replace_in_place());
+    // The plan is deduced from the output of replace().
+    BOOST_CHECK(r_policy{udrp1{}}.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig).empty());
+    udrp_group ug;
+    ug.group = individuals_group_t{{4, 1}, {{3.}, {2.}}, {{3.}, {2.}}};
+    BOOST_CHECK((r_policy{ug}.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig) == replacement_plan_t{{0, 2}}));
+    ug.group = individuals_group_t{{3, 2}, {{2.}, {1.}}, {{2.}, {1.}}};
+    BOOST_CHECK((r_policy{ug}.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig) == replacement_plan_t{{0, 1}, {1, 0}}));
+    // Individuals which are neither in inds nor in mig.
+    ug.group = individuals_group_t{{0, 5}, {{1.}, {2.}}, {{1.}, {2.}}};
+    BOOST_CHECK_EXCEPTION(r_policy{ug}.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "the replace() method of a replacement policy of "
+                                                                "type 'udrp_group' returned an individual with ID 5 "
+                                                                "which is neither in the original group nor among "
+                                                                "the migrants");
+                          });
+    // Change in the number of individuals.
+    ug.group = individuals_group_t{{0}, {{1.}}, {{1.}}};
+    BOOST_CHECK_EXCEPTION(r_policy{ug}.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "changed the number of individuals from 2 to 1");
+                          });
+
+    udrp_plan u;
+    u.plan = replacement_plan_t{{1, 2}, {0, 0}};
+    r_policy r0{u};
+    BOOST_CHECK(r0.has_replace_in_place());
+    BOOST_CHECK((r0.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig) == replacement_plan_t{{1, 2}, {0, 0}}));
+
+    // Input checks.
+    BOOST_CHECK_EXCEPTION(r0.replace_in_place(view, 2, 0, 1, 0, 0, {}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "not all the individuals passed to a replacement "
+                                                                "policy of type 'udrp_plan' have the expected "
+                                                                "dimension (2)");
+                          });
+
+    // Output checks.
+    u.plan = replacement_plan_t{{2, 0}};
+    r0 = r_policy{u};
+    BOOST_CHECK_EXCEPTION(r0.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "an invalid replacement plan was returned by a "
+                                                                "replacement policy of type 'udrp_plan': the plan "
+                                                                "contains the pair of indices (2, 0), but the number "
+                                                                "of individuals is 2 and the number of migrants is 3");
+                          });
+    u.plan = replacement_plan_t{{0, 3}};
+    r0 = r_policy{u};
+    BOOST_CHECK_THROW(r0.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument);
+    u.plan = replacement_plan_t{{0, 0}, {0, 1}};
+    r0 = r_policy{u};
+    BOOST_CHECK_EXCEPTION(r0.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "the plan contains duplicate individual or migrant "
+                                                                "indices");
+                          });
+    u.plan = replacement_plan_t{{0, 1}, {1, 1}};
+    r0 = r_policy{u};
+    BOOST_CHECK_THROW(r0.replace_in_place(view, 1, 0, 1, 0, 0, {}, mig), std::invalid_argument);
+}
+
 struct udrp_a {
     individuals_group_t replace(const individuals_group_t &inds, const vector_double::size_type &,
                                 const vector_double::size_type &, const vector_double::size_type &,
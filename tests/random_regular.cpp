@@ -0,0 +1,234 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE random_regular
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/random_regular.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// Check that the connections are symmetric and well-formed,
+// and that the graph is connected.
+void verify_random_regular_topology(const random_regular &r)
+{
+    const auto s = r.num_vertices();
+
+    BOOST_CHECK_EXCEPTION(r.get_connections(s), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(),
+                               "in a random regular topology: the number of vertices in the topology is only");
+    });
+
+    for (std::size_t i = 0; i < s; ++i) {
+        const auto conns = r.get_connections(i);
+
+        BOOST_CHECK(conns.first.size() == conns.second.size());
+        BOOST_CHECK(conns.first.size() <= r.get_degree());
+        BOOST_CHECK(std::all_of(conns.second.begin(), conns.second.end(),
+                                [&r](double x) { return x == r.get_weight(); }));
+        BOOST_CHECK(std::find(conns.first.begin(), conns.first.end(), i) == conns.first.end());
+
+        auto sorted = conns.first;
+        std::sort(sorted.begin(), sorted.end());
+        BOOST_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+        for (auto j : conns.first) {
+            BOOST_CHECK(j < s);
+            const auto c = r.get_connections(j).first;
+            BOOST_CHECK(std::find(c.begin(), c.end(), i) != c.end());
+        }
+    }
+
+    // Connectivity.
+    if (s) {
+        std::vector<char> visited(s, 0);
+        std::vector<std::size_t> stack{0};
+        visited[0] = 1;
+        std::size_t n_visited = 1;
+        while (!stack.empty()) {
+            const auto cur = stack.back();
+            stack.pop_back();
+            for (auto j : r.get_connections(cur).first) {
+                if (!visited[j]) {
+                    visited[j] = 1;
+                    ++n_visited;
+                    stack.push_back(j);
+                }
+            }
+        }
+        BOOST_CHECK(n_visited == s);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(basic_test)
+{
+    {
+        // Default construct, push back a few times.
+        random_regular r0;
+        BOOST_CHECK(r0.get_weight() == 1);
+        BOOST_CHECK(r0.get_degree() == 4u);
+        BOOST_CHECK(r0.num_vertices() == 0u);
+        verify_random_regular_topology(r0);
+
+        r0.push_back();
+        BOOST_CHECK(r0.get_connections(0).first.empty());
+
+        for (auto i = 0; i < 20; ++i) {
+            r0.push_back();
+            verify_random_regular_topology(r0);
+        }
+        BOOST_CHECK(r0.num_vertices() == 21u);
+    }
+
+    {
+        // Various sizes and degrees.
+        for (std::size_t n : {2u, 3u, 5u, 16u, 17u, 100u, 257u}) {
+            for (std::size_t k : {2u, 4u, 6u}) {
+                random_regular r0(n, k, .5, static_cast<unsigned>(n + k));
+                BOOST_CHECK(r0.get_weight() == .5);
+                BOOST_CHECK(r0.get_degree() == k);
+                BOOST_CHECK(r0.get_seed() == static_cast<unsigned>(n + k));
+                verify_random_regular_topology(r0);
+            }
+        }
+    }
+
+    {
+        // Ctor from degree, weight and seed.
+        random_regular r0(6, .25, 42u);
+        BOOST_CHECK(r0.get_degree() == 6u);
+        BOOST_CHECK(r0.get_weight() == .25);
+        BOOST_CHECK(r0.get_seed() == 42u);
+        BOOST_CHECK(r0.num_vertices() == 0u);
+    }
+
+    {
+        // Determinism.
+        random_regular r0(100, 4, 1., 42u), r1(100, 4, 1., 42u), r2(100, 4, 1., 43u);
+        bool diff = false;
+        for (std::size_t i = 0; i < 100u; ++i) {
+            BOOST_CHECK(r0.get_connections(i) == r1.get_connections(i));
+            diff = diff || r0.get_connections(i) != r2.get_connections(i);
+        }
+        BOOST_CHECK(diff);
+    }
+
+    {
+        // Error checking.
+        BOOST_CHECK_EXCEPTION(random_regular(10, 3, 1.), std::invalid_argument, [](const std::invalid_argument &ia) {
+            return boost::contains(ia.what(), "The degree of a random regular topology must be even and nonzero");
+        });
+        BOOST_CHECK_THROW(random_regular(10, 0, 1.), std::invalid_argument);
+        BOOST_CHECK_THROW(random_regular(10, 4, 2.), std::invalid_argument);
+    }
+
+    {
+        // Copy/move ctors.
+        random_regular r0(50, 4, .2, 1u), r1(r0), r2(std::move(r0));
+        BOOST_CHECK(r1.num_vertices() == 50u);
+        BOOST_CHECK(r2.num_vertices() == 50u);
+        BOOST_CHECK(r2.get_seed() == 1u);
+        for (std::size_t i = 0; i < 50u; ++i) {
+            BOOST_CHECK(r1.get_connections(i) == r2.get_connections(i));
+        }
+    }
+
+    {
+        // Name/extra info.
+        random_regular r0(9, 4, .2);
+        BOOST_CHECK(r0.get_name() == "Random regular");
+        BOOST_CHECK(boost::contains(r0.get_extra_info(), "Degree:"));
+        BOOST_CHECK(boost::contains(r0.get_extra_info(), "Seed:"));
+
+        std::cout << r0.get_extra_info() << '\n';
+    }
+
+    // Minimal serialization test.
+    {
+        random_regular r0(30, 4, .2, 7u);
+        topology t0(r0);
+        BOOST_CHECK(!t0.has_to_csr());
+        std::stringstream ss;
+        {
+            boost::archive::binary_oarchive oarchive(ss);
+            oarchive << t0;
+        }
+        topology t1;
+        BOOST_CHECK(!t1.is<random_regular>());
+        {
+            boost::archive::binary_iarchive iarchive(ss);
+            iarchive >> t1;
+        }
+        BOOST_CHECK(t1.is<random_regular>());
+        const auto &r1 = *t1.extract<random_regular>();
+        BOOST_CHECK(r1.num_vertices() == 30u);
+        BOOST_CHECK(r1.get_degree() == 4u);
+        BOOST_CHECK(r1.get_weight() == .2);
+        BOOST_CHECK(r1.get_seed() == 7u);
+        for (std::size_t i = 0; i < 30u; ++i) {
+            BOOST_CHECK(r1.get_connections(i) == r0.get_connections(i));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(large_test)
+{
+    // In large graphs, almost all vertices have exactly k neighbours.
+    random_regular r0(10000, 6, 1., 42u);
+    std::size_t n_full = 0;
+    for (std::size_t i = 0; i < 10000u; ++i) {
+        n_full += r0.get_connections(i).first.size() == 6u;
+    }
+    BOOST_CHECK(n_full > 9900u);
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_test)
+{
+    archipelago archi{random_regular{}, 10, de{10}, rosenbrock{}, 10};
+    BOOST_CHECK(archi.get_topology().is<random_regular>());
+    BOOST_CHECK(archi.get_topology().extract<random_regular>()->num_vertices() == 10u);
+    archi.evolve();
+    archi.wait_check();
+}
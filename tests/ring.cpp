@@ -197,3 +197,28 @@ BOOST_AUTO_TEST_CASE(basic_test)
 
     std::cout << r0.get_extra_info() << '\n';
 }
+
+BOOST_AUTO_TEST_CASE(csr_test)
+{
+    ring r0{.5};
+    auto c0 = r0.to_csr();
+    BOOST_CHECK(c0->num_vertices() == 0u);
+
+    for (std::size_t n = 1; n < 7u; ++n) {
+        r0.push_back();
+        auto c1 = r0.to_csr();
+        BOOST_CHECK(c1->get_version() > c0->get_version());
+        BOOST_CHECK(c1->num_vertices() == n);
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_CHECK(c1->get_connections(i) == r0.get_connections(i));
+        }
+        BOOST_CHECK(r0.to_csr() == c1);
+        c0 = c1;
+    }
+
+    // Via topology.
+    topology t0(r0);
+    BOOST_CHECK(t0.has_to_csr());
+    BOOST_CHECK(t0.to_csr()->num_vertices() == 6u);
+    BOOST_CHECK(t0.to_csr()->num_edges() == 12u);
+}
@@ -31,8 +31,12 @@ see https://www.gnu.org/licenses/. */
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
+#include <random>
+#include <sstream>
 #include <thread>
 #include <vector>
 
@@ -82,3 +86,88 @@ BOOST_AUTO_TEST_CASE(data_races_test)
     t1.join();
     t2.join();
 }
+
+BOOST_AUTO_TEST_CASE(philox4x32_kat_test)
+{
+    // Known-answer tests from the Random123 distribution.
+    using b_t = philox4x32::block_type;
+    BOOST_CHECK((philox4x32::bijection(b_t{{0, 0, 0, 0}}, {{0, 0}})
+                 == b_t{{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}}));
+    BOOST_CHECK((philox4x32::bijection(b_t{{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}},
+                                       {{0xffffffffu, 0xffffffffu}})
+                 == b_t{{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}}));
+    BOOST_CHECK((philox4x32::bijection(b_t{{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}},
+                                       {{0xa4093822u, 0x299f31d0u}})
+                 == b_t{{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}}));
+    // The first block of the stream 0 of a zero key.
+    philox4x32 e;
+    BOOST_CHECK(e.block(0) == (b_t{{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}}));
+    BOOST_CHECK_EQUAL(e(), 0x6627e8d5u);
+    BOOST_CHECK_EQUAL(e(), 0xe169c58du);
+}
+
+BOOST_AUTO_TEST_CASE(philox4x32_engine_test)
+{
+    // Same key and stream, same sequence.
+    philox4x32 e0(42, 3), e1(42, 3), e2(42, 4), e3(43, 3);
+    BOOST_CHECK(e0 == e1);
+    BOOST_CHECK(e0 != e2);
+    BOOST_CHECK(e0 != e3);
+    std::vector<philox4x32::result_type> v0, v1, v2, v3;
+    for (auto i = 0; i < 100; ++i) {
+        v0.push_back(e0());
+        v1.push_back(e1());
+        v2.push_back(e2());
+        v3.push_back(e3());
+    }
+    BOOST_CHECK(v0 == v1);
+    BOOST_CHECK(v0 != v2);
+    BOOST_CHECK(v0 != v3);
+
+    // Bulk generation and discard() are consistent with operator(),
+    // also when starting from the middle of a block.
+    for (auto skip : {0, 1, 3, 4, 5}) {
+        philox4x32 a(7, 1), b(7, 1), c(7, 1);
+        for (auto i = 0; i < skip; ++i) {
+            a();
+            b();
+        }
+        c.discard(static_cast<unsigned long long>(skip));
+        BOOST_CHECK(a == c);
+        std::vector<philox4x32::result_type> bulk(23);
+        a.generate(bulk.data(), bulk.size());
+        for (auto x : bulk) {
+            BOOST_CHECK_EQUAL(x, b());
+        }
+        BOOST_CHECK(a == b);
+        BOOST_CHECK_EQUAL(a(), b());
+    }
+
+    // Canonical and normal deviates.
+    philox4x32 e4(123);
+    std::vector<double> u(1001), n(1001);
+    e4.generate_canonical(u.data(), u.size());
+    BOOST_CHECK(std::all_of(u.begin(), u.end(), [](double x) { return x >= 0. && x < 1.; }));
+    e4.generate_normal(n.data(), n.size());
+    BOOST_CHECK(std::all_of(n.begin(), n.end(), [](double x) { return std::isfinite(x); }));
+    philox4x32 e5(123);
+    std::vector<double> u2(1001);
+    e5.generate_canonical(u2.data(), u2.size());
+    BOOST_CHECK(u == u2);
+
+    // Usage with the standard distributions.
+    philox4x32 e6(5, 6), e7(5, 6);
+    std::uniform_real_distribution<double> dist;
+    BOOST_CHECK_EQUAL(dist(e6), dist(e7));
+
+    // Reseeding and stream operators.
+    e6.seed(5, 6);
+    e7.seed(5, 6);
+    e6();
+    BOOST_CHECK(e6 != e7);
+    std::stringstream ss;
+    ss << e6;
+    ss >> e7;
+    BOOST_CHECK(e6 == e7);
+    BOOST_CHECK_EQUAL(e6(), e7());
+}
@@ -43,6 +43,7 @@ see https://www.gnu.org/licenses/. */
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -467,6 +468,100 @@ BOOST_AUTO_TEST_CASE(selection)
         });
 }
 
+BOOST_AUTO_TEST_CASE(select_view)
+{
+    struct udsp_00 {
+        individuals_group_t select(const individuals_group_t &inds, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double &) const
+        {
+            return inds;
+        }
+        individuals_group_t select_view(const individuals_view_t &inds, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &) const
+        {
+            return individuals_group_t{{std::get<0>(inds)[0]}, {std::get<1>(inds)[0]}, {std::get<2>(inds)[0]}};
+        }
+    };
+    struct udsp_01 {
+        individuals_group_t select(const individuals_group_t &inds, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double &) const
+        {
+            return inds;
+        }
+        // Missing const.
+        individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &)
+        {
+            return individuals_group_t{};
+        }
+    };
+    struct udsp_02 {
+        individuals_group_t select(const individuals_group_t &inds, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double::size_type &, const vector_double::size_type &,
+                                   const vector_double &) const
+        {
+            return inds;
+        }
+        individuals_group_t select_view(const individuals_view_t &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double::size_type &, const vector_double::size_type &,
+                                        const vector_double &) const
+        {
+            return individuals_group_t{{0}, {{1., 1.}}, {{1.}}};
+        }
+        std::string get_name() const
+        {
+            return "udsp_02";
+        }
+    };
+
+    BOOST_CHECK(has_select_view<udsp_00>::value);
+    BOOST_CHECK(!has_select_view<udsp_01>::value);
+    BOOST_CHECK(!has_select_view<udsp1>::value);
+    BOOST_CHECK(!has_select_view<int>::value);
+
+    const individuals_group_t inds{{0, 1}, {{1.}, {2.}}, {{1.}, {2.}}};
+    const individuals_view_t view(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds));
+
+    s_policy s0{udsp_00{}};
+    BOOST_CHECK(s0.has_select_view());
+    BOOST_CHECK((s0.select_view(view, 1, 0, 1, 0, 0, {}) == individuals_group_t{{0}, {{1.}}, {{1.}}}));
+    BOOST_CHECK(s0.select(inds, 1, 0, 1, 0, 0, {}) == inds);
+
+    // If the UDSP does not provide select_view(), select() is used.
+    s0 = s_policy{udsp_01{}};
+    BOOST_CHECK(!s0.has_select_view());
+    BOOST_CHECK(s0.select_view(view, 1, 0, 1, 0, 0, {}) == inds);
+    s0 = s_policy{udsp1{}};
+    BOOST_CHECK(!s0.has_select_view());
+    BOOST_CHECK(s0.select_view(view, 1, 0, 1, 0, 0, {}) == inds);
+
+    // Input/output checks.
+    s0 = s_policy{udsp_00{}};
+    BOOST_CHECK_EXCEPTION(s0.select_view(view, 2, 0, 1, 0, 0, {}), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "not all the individuals passed to a selection policy "
+                                                                "of type '")
+                                     && boost::contains(ia.what(), "' have the expected dimension (2)");
+                          });
+    s0 = s_policy{udsp_02{}};
+    BOOST_CHECK_EXCEPTION(s0.select_view(view, 1, 0, 1, 0, 0, {}), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "not all the individuals returned by a selection "
+                                                                "policy of type 'udsp_02' have the expected "
+                                                                "dimension (1)");
+                          });
+}
+
 struct udsp_a {
     individuals_group_t select(const individuals_group_t &inds, const vector_double::size_type &,
                                const vector_double::size_type &, const vector_double::size_type &,
@@ -34,6 +34,7 @@ see https://www.gnu.org/licenses/. */
 #include <limits>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -230,3 +231,45 @@ BOOST_AUTO_TEST_CASE(select_best_nan_fitness)
     // Check that the individual with nan fitness was not selected.
     BOOST_CHECK((new_inds == individuals_group_t{{1, 2}, {{0}, {0}}, {{1}, {2}}}));
 }
+
+BOOST_AUTO_TEST_CASE(select_best_select_view)
+{
+    BOOST_CHECK(has_select_view<select_best>::value);
+    BOOST_CHECK(s_policy{}.has_select_view());
+
+    individuals_group_t inds{{1, 2, 3}, {{0}, {0}, {0}}, {{3}, {1}, {2}}};
+
+    auto view = [&inds]() { return individuals_view_t(std::get<0>(inds), std::get<1>(inds), std::get<2>(inds)); };
+
+    BOOST_CHECK_EXCEPTION(select_best(100).select_view(view(), 1, 0, 1, 0, 0, vector_double{}), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(
+                                  ia.what(), "The absolute migration rate (100) in a 'Select best' selection policy "
+                                             "is larger than the number of input individuals (3)");
+                          });
+
+    // The selection from a view must produce the same individuals as select().
+    auto check = [&inds, &view](const select_best &s, vector_double::size_type nobj, vector_double::size_type nec,
+                                vector_double::size_type nic, const vector_double &tol) {
+        const auto sel = s.select_view(view(), 1, 0, nobj, nec, nic, tol);
+        BOOST_CHECK(sel == s.select(inds, 1, 0, nobj, nec, nic, tol));
+        BOOST_CHECK(sel == s_policy(s).select_view(view(), 1, 0, nobj, nec, nic, tol));
+        return sel;
+    };
+
+    // Single-objective, unconstrained.
+    BOOST_CHECK(check(select_best(.1), 1, 0, 0, {}) == individuals_group_t{});
+    BOOST_CHECK((check(select_best(.5), 1, 0, 0, {}) == individuals_group_t{{2}, {{0}}, {{1}}}));
+    BOOST_CHECK((check(select_best(2), 1, 0, 0, {}) == individuals_group_t{{2, 3}, {{0}, {0}}, {{1}, {2}}}));
+    BOOST_CHECK(
+        (check(select_best(1.), 1, 0, 0, {}) == individuals_group_t{{2, 3, 1}, {{0}, {0}, {0}}, {{1}, {2}, {3}}}));
+
+    // Single-objective, constrained.
+    inds = individuals_group_t{{1, 2, 3}, {{0}, {0}, {0}}, {{3, 3, 3}, {1, 1, 1}, {2, 2, 2}}};
+    BOOST_CHECK((check(select_best(2), 1, 1, 1, {0., 0.})
+                 == individuals_group_t{{2, 3}, {{0}, {0}}, {{1, 1, 1}, {2, 2, 2}}}));
+
+    // Multi-objective, unconstrained.
+    inds = individuals_group_t{{1, 2, 3, 4, 5}, {{0}, {0}, {0}, {0}, {0}}, {{0, 7}, {1, 5}, {2, 3}, {4, 2}, {7, 1}}};
+    BOOST_CHECK(std::get<0>(check(select_best(3), 2, 0, 0, {})).size() == 3u);
+}
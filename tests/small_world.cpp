@@ -0,0 +1,238 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE small_world
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/small_world.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+void verify_small_world_topology(const small_world &t)
+{
+    const auto s = t.num_vertices();
+
+    BOOST_CHECK_EXCEPTION(t.get_connections(s), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "in a small-world topology: the number of vertices in the topology is only");
+    });
+
+    for (std::size_t i = 0; i < s; ++i) {
+        const auto conns = t.get_connections(i);
+
+        BOOST_CHECK(conns.first.size() == conns.second.size());
+        BOOST_CHECK(conns.first.size() <= t.get_degree());
+        BOOST_CHECK(std::all_of(conns.second.begin(), conns.second.end(),
+                                [&t](double x) { return x == t.get_weight(); }));
+        BOOST_CHECK(std::find(conns.first.begin(), conns.first.end(), i) == conns.first.end());
+        BOOST_CHECK(std::all_of(conns.first.begin(), conns.first.end(), [s](std::size_t j) { return j < s; }));
+
+        auto sorted = conns.first;
+        std::sort(sorted.begin(), sorted.end());
+        BOOST_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+    }
+}
+
+std::vector<std::size_t> sorted_conns(const small_world &t, std::size_t i)
+{
+    auto retval = t.get_connections(i).first;
+    std::sort(retval.begin(), retval.end());
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(basic_test)
+{
+    {
+        // Default construct, push back a few times.
+        small_world t0;
+        BOOST_CHECK(t0.get_weight() == 1);
+        BOOST_CHECK(t0.get_degree() == 4u);
+        BOOST_CHECK(t0.get_beta() == .1);
+        BOOST_CHECK(t0.num_vertices() == 0u);
+        verify_small_world_topology(t0);
+
+        t0.push_back();
+        BOOST_CHECK(t0.get_connections(0).first.empty());
+
+        for (auto i = 0; i < 20; ++i) {
+            t0.push_back();
+            verify_small_world_topology(t0);
+        }
+        BOOST_CHECK(t0.num_vertices() == 21u);
+    }
+
+    {
+        // With no rewiring, we get a ring lattice.
+        small_world t0(10, 4, 0., .5, 42u);
+        BOOST_CHECK(t0.get_weight() == .5);
+        BOOST_CHECK(t0.get_seed() == 42u);
+        verify_small_world_topology(t0);
+        BOOST_CHECK((sorted_conns(t0, 0) == std::vector<std::size_t>{1, 2, 8, 9}));
+        BOOST_CHECK((sorted_conns(t0, 5) == std::vector<std::size_t>{3, 4, 6, 7}));
+
+        // Small lattices.
+        small_world t1(3, 6, 0., 1., 42u);
+        verify_small_world_topology(t1);
+        BOOST_CHECK((sorted_conns(t1, 0) == std::vector<std::size_t>{1, 2}));
+        small_world t2(2, 2, 0., 1., 42u);
+        BOOST_CHECK((sorted_conns(t2, 1) == std::vector<std::size_t>{0}));
+    }
+
+    {
+        // Full rewiring.
+        small_world t0(100, 4, 1., 1., 42u);
+        verify_small_world_topology(t0);
+        std::size_t n_lattice = 0;
+        for (std::size_t i = 0; i < 100u; ++i) {
+            const auto c = t0.get_connections(i).first;
+            n_lattice += static_cast<std::size_t>(std::count(c.begin(), c.end(), (i + 1u) % 100u));
+        }
+        BOOST_CHECK(n_lattice < 20u);
+
+        // Partial rewiring.
+        small_world t1(1000, 4, .2, 1., 42u), t2(1000, 4, 0., 1., 42u);
+        verify_small_world_topology(t1);
+        std::size_t n_diff = 0;
+        for (std::size_t i = 0; i < 1000u; ++i) {
+            n_diff += sorted_conns(t1, i) != sorted_conns(t2, i);
+        }
+        BOOST_CHECK(n_diff > 300u);
+        BOOST_CHECK(n_diff < 900u);
+    }
+
+    {
+        // Ctor from degree, beta, weight and seed.
+        small_world t0(6, .3, .25, 42u);
+        BOOST_CHECK(t0.get_degree() == 6u);
+        BOOST_CHECK(t0.get_beta() == .3);
+        BOOST_CHECK(t0.get_weight() == .25);
+        BOOST_CHECK(t0.get_seed() == 42u);
+        BOOST_CHECK(t0.num_vertices() == 0u);
+    }
+
+    {
+        // Determinism.
+        small_world t0(100, 4, .5, 1., 42u), t1(100, 4, .5, 1., 42u), t2(100, 4, .5, 1., 43u);
+        bool diff = false;
+        for (std::size_t i = 0; i < 100u; ++i) {
+            BOOST_CHECK(t0.get_connections(i) == t1.get_connections(i));
+            diff = diff || t0.get_connections(i) != t2.get_connections(i);
+        }
+        BOOST_CHECK(diff);
+    }
+
+    {
+        // Error checking.
+        BOOST_CHECK_EXCEPTION(small_world(10, 3, .1, 1.), std::invalid_argument, [](const std::invalid_argument &ia) {
+            return boost::contains(ia.what(), "The degree of a small-world topology must be even and nonzero");
+        });
+        BOOST_CHECK_THROW(small_world(10, 0, .1, 1.), std::invalid_argument);
+        BOOST_CHECK_EXCEPTION(small_world(10, 2, -.1, 1.), std::invalid_argument, [](const std::invalid_argument &ia) {
+            return boost::contains(ia.what(),
+                                   "The rewiring probability of a small-world topology must be in the [0, 1] range");
+        });
+        BOOST_CHECK_THROW(small_world(10, 2, 1.1, 1.), std::invalid_argument);
+        BOOST_CHECK_THROW(small_world(10, 2, std::numeric_limits<double>::quiet_NaN(), 1.), std::invalid_argument);
+        BOOST_CHECK_THROW(small_world(10, 2, .1, 2.), std::invalid_argument);
+    }
+
+    {
+        // Copy/move ctors.
+        small_world t0(50, 4, .3, .2, 1u), t1(t0), t2(std::move(t0));
+        BOOST_CHECK(t1.num_vertices() == 50u);
+        BOOST_CHECK(t2.num_vertices() == 50u);
+        BOOST_CHECK(t2.get_beta() == .3);
+        for (std::size_t i = 0; i < 50u; ++i) {
+            BOOST_CHECK(t1.get_connections(i) == t2.get_connections(i));
+        }
+    }
+
+    {
+        // Name/extra info.
+        small_world t0(9, 4, .2, .5);
+        BOOST_CHECK(t0.get_name() == "Small world");
+        BOOST_CHECK(boost::contains(t0.get_extra_info(), "Rewiring probability:"));
+        BOOST_CHECK(boost::contains(t0.get_extra_info(), "Seed:"));
+
+        std::cout << t0.get_extra_info() << '\n';
+    }
+
+    // Minimal serialization test.
+    {
+        small_world t0(30, 4, .3, .2, 7u);
+        topology topo0(t0);
+        BOOST_CHECK(!topo0.has_to_csr());
+        std::stringstream ss;
+        {
+            boost::archive::binary_oarchive oarchive(ss);
+            oarchive << topo0;
+        }
+        topology topo1;
+        BOOST_CHECK(!topo1.is<small_world>());
+        {
+            boost::archive::binary_iarchive iarchive(ss);
+            iarchive >> topo1;
+        }
+        BOOST_CHECK(topo1.is<small_world>());
+        const auto &t1 = *topo1.extract<small_world>();
+        BOOST_CHECK(t1.num_vertices() == 30u);
+        BOOST_CHECK(t1.get_degree() == 4u);
+        BOOST_CHECK(t1.get_beta() == .3);
+        BOOST_CHECK(t1.get_weight() == .2);
+        BOOST_CHECK(t1.get_seed() == 7u);
+        for (std::size_t i = 0; i < 30u; ++i) {
+            BOOST_CHECK(t1.get_connections(i) == t0.get_connections(i));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_test)
+{
+    archipelago archi{small_world{}, 10, de{10}, rosenbrock{}, 10};
+    BOOST_CHECK(archi.get_topology().is<small_world>());
+    BOOST_CHECK(archi.get_topology().extract<small_world>()->num_vertices() == 10u);
+    archi.evolve();
+    archi.wait_check();
+}
@@ -0,0 +1,223 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+#define BOOST_TEST_MODULE static_problem_test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <pagmo/batch_evaluators/thread_bfe.hpp>
+#include <pagmo/bfe.hpp>
+#include <pagmo/population.hpp>
+#include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/problems/static_problem.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/threading.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// Fixed-dimension Rosenbrock function.
+template <std::size_t N>
+struct s_rosenbrock {
+    std::array<double, 1> fitness(const std::array<double, N> &x) const
+    {
+        double retval = 0.;
+        for (std::size_t i = 0; i < N - 1u; ++i) {
+            retval += 100. * (x[i] * x[i] - x[i + 1]) * (x[i] * x[i] - x[i + 1]) + (x[i] - 1) * (x[i] - 1);
+        }
+        return {{retval}};
+    }
+    std::pair<std::array<double, N>, std::array<double, N>> get_bounds() const
+    {
+        std::array<double, N> lb, ub;
+        lb.fill(-5.);
+        ub.fill(10.);
+        return {lb, ub};
+    }
+    thread_safety get_thread_safety() const
+    {
+        return thread_safety::constant;
+    }
+    template <typename Archive>
+    void serialize(Archive &, unsigned)
+    {
+    }
+};
+
+using s_rosenbrock5 = static_problem<5, 1, s_rosenbrock<5>>;
+
+PAGMO_S11N_PROBLEM_EXPORT(s_rosenbrock5)
+
+// A constrained problem with some state.
+struct s_constr {
+    std::array<double, 3> fitness(const std::array<double, 2> &x) const
+    {
+        return {{x[0] + x[1] + m_shift, x[0] - x[1], x[0] * x[1]}};
+    }
+    std::pair<std::array<double, 2>, std::array<double, 2>> get_bounds() const
+    {
+        return {{{-1., -1.}}, {{1., 1.}}};
+    }
+    vector_double::size_type get_nec() const
+    {
+        return 1u;
+    }
+    vector_double::size_type get_nic() const
+    {
+        return 1u;
+    }
+    vector_double::size_type get_nix() const
+    {
+        return 1u;
+    }
+    std::string get_name() const
+    {
+        return "s_constr";
+    }
+    double m_shift = 0.;
+};
+
+// Inconsistent fitness dimension.
+struct s_bad_nf {
+    std::array<double, 2> fitness(const std::array<double, 2> &) const
+    {
+        return {{0., 0.}};
+    }
+    std::pair<std::array<double, 2>, std::array<double, 2>> get_bounds() const
+    {
+        return {{{-1., -1.}}, {{1., 1.}}};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(static_problem_type_traits)
+{
+    BOOST_CHECK((has_static_fitness<s_rosenbrock<5>, 5, 1>::value));
+    BOOST_CHECK((!has_static_fitness<s_rosenbrock<5>, 4, 1>::value));
+    BOOST_CHECK((!has_static_fitness<s_rosenbrock<5>, 5, 2>::value));
+    BOOST_CHECK((!has_static_fitness<rosenbrock, 5, 1>::value));
+    BOOST_CHECK((has_static_bounds<s_constr, 2>::value));
+    BOOST_CHECK((!has_static_bounds<rosenbrock, 2>::value));
+    BOOST_CHECK((is_udp<s_rosenbrock5>::value));
+    BOOST_CHECK((is_udp<static_problem<2, 3, s_constr>>::value));
+    BOOST_CHECK((has_fitness_into<s_rosenbrock5>::value));
+    BOOST_CHECK((!has_batch_fitness<s_rosenbrock5>::value));
+}
+
+BOOST_AUTO_TEST_CASE(static_problem_basic)
+{
+    problem p0{s_rosenbrock5{}}, p1{rosenbrock{5}};
+    BOOST_CHECK(p0.get_nx() == 5u);
+    BOOST_CHECK(p0.get_nf() == 1u);
+    BOOST_CHECK(p0.get_bounds() == p1.get_bounds());
+    BOOST_CHECK(p0.get_thread_safety() == thread_safety::constant);
+    BOOST_CHECK(p0.has_fitness_into());
+    BOOST_CHECK(!p0.has_batch_fitness());
+    BOOST_CHECK(boost::contains(p0.get_extra_info(), "Fixed dimension: 5"));
+
+    // Same results as the dynamic version.
+    const vector_double dv{1., 2., 3., 4., 5.};
+    BOOST_CHECK(p0.fitness(dv) == p1.fitness(dv));
+    vector_double fv;
+    p0.fitness_into(dv, fv);
+    BOOST_CHECK(fv == p1.fitness(dv));
+    BOOST_CHECK_THROW(p0.fitness({1., 2.}), std::invalid_argument);
+
+    // Batch evaluation.
+    vector_double dvs;
+    for (auto i = 0; i < 100; ++i) {
+        for (auto j = 0; j < 5; ++j) {
+            dvs.push_back(i * .1 - j * .05);
+        }
+    }
+    const auto fvs = bfe{thread_bfe{}}(p0, dvs);
+    BOOST_CHECK(fvs.size() == 100u);
+    BOOST_CHECK(fvs == bfe{thread_bfe{}}(p1, dvs));
+    // The default bfe picks the (parallel) thread bfe.
+    BOOST_CHECK(fvs == bfe{}(p0, dvs));
+    BOOST_CHECK(p0.get_fevals() == 202u);
+
+    // Population construction.
+    population pop0{p0, 20u, 42u}, pop1{p1, 20u, 42u};
+    BOOST_CHECK(pop0.get_x() == pop1.get_x());
+    BOOST_CHECK(pop0.get_f() == pop1.get_f());
+
+    // Access to the inner problem.
+    BOOST_CHECK(p0.extract<s_rosenbrock5>() != nullptr);
+    const auto &inner = p0.extract<s_rosenbrock5>()->get_inner_problem();
+    BOOST_CHECK(inner.fitness({{1., 2., 3., 4., 5.}})[0] == p1.fitness(dv)[0]);
+}
+
+BOOST_AUTO_TEST_CASE(static_problem_constrained)
+{
+    s_constr c;
+    c.m_shift = 1.;
+    problem p0{static_problem<2, 3, s_constr>{c}};
+    BOOST_CHECK(p0.get_nobj() == 1u);
+    BOOST_CHECK(p0.get_nec() == 1u);
+    BOOST_CHECK(p0.get_nic() == 1u);
+    BOOST_CHECK(p0.get_nix() == 1u);
+    BOOST_CHECK(p0.get_name() == "s_constr");
+    BOOST_CHECK(p0.get_thread_safety() == thread_safety::basic);
+    BOOST_CHECK((p0.fitness({.5, 0.}) == vector_double{1.5, .5, 0.}));
+    BOOST_CHECK((bfe{}(p0, {.5, 0., 1., -1.}) == vector_double{1.5, .5, 0., 1., 2., -1.}));
+
+    // Mutable access to the inner problem.
+    p0.extract<static_problem<2, 3, s_constr>>()->get_inner_problem().m_shift = 2.;
+    BOOST_CHECK((p0.fitness({.5, 0.}) == vector_double{2.5, .5, 0.}));
+
+    BOOST_CHECK_THROW((static_problem<2, 2, s_bad_nf>{}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(static_problem_s11n)
+{
+    problem p0{s_rosenbrock5{}};
+    p0.fitness({1., 2., 3., 4., 5.});
+    const auto before = boost::lexical_cast<std::string>(p0);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << p0;
+    }
+    p0 = problem{};
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> p0;
+    }
+    BOOST_CHECK(p0.is<s_rosenbrock5>());
+    BOOST_CHECK(before == boost::lexical_cast<std::string>(p0));
+}
@@ -0,0 +1,173 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE stats
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/stats.hpp>
+
+using namespace pagmo;
+
+BOOST_AUTO_TEST_CASE(stats_histogram_test)
+{
+    stats_histogram h;
+    BOOST_CHECK(h.get_count() == 0u);
+    BOOST_CHECK(h.get_sum() == 0u);
+    BOOST_CHECK(h.get_min() == 0u);
+    BOOST_CHECK(h.get_max() == 0u);
+    BOOST_CHECK(h.get_mean() == 0.);
+    BOOST_CHECK(h.quantile(.5) == 0u);
+    for (auto c : h.get_buckets()) {
+        BOOST_CHECK(c == 0u);
+    }
+
+    h.add(0);
+    h.add(1);
+    h.add(5);
+    h.add(6);
+    h.add(1000);
+    BOOST_CHECK(h.get_count() == 5u);
+    BOOST_CHECK(h.get_sum() == 1012u);
+    BOOST_CHECK(h.get_min() == 0u);
+    BOOST_CHECK(h.get_max() == 1000u);
+    BOOST_CHECK(h.get_mean() == 1012. / 5.);
+    BOOST_CHECK(h.get_buckets()[0] == 1u);
+    BOOST_CHECK(h.get_buckets()[1] == 1u);
+    BOOST_CHECK(h.get_buckets()[3] == 2u);
+    BOOST_CHECK(h.get_buckets()[10] == 1u);
+
+    // Quantiles.
+    BOOST_CHECK(h.quantile(0.) == 0u);
+    BOOST_CHECK(h.quantile(.2) == 0u);
+    BOOST_CHECK(h.quantile(.4) == 1u);
+    BOOST_CHECK(h.quantile(.6) == 7u);
+    BOOST_CHECK(h.quantile(.8) == 7u);
+    BOOST_CHECK(h.quantile(1.) == 1000u);
+    BOOST_CHECK_EXCEPTION(h.quantile(1.5), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "The quantile of a histogram must be in the [0, 1] range");
+    });
+    BOOST_CHECK_THROW(h.quantile(-.1), std::invalid_argument);
+    BOOST_CHECK_THROW(h.quantile(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+
+    // Largest values.
+    stats_histogram h2;
+    h2.add(std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK(h2.get_buckets()[64] == 1u);
+    BOOST_CHECK(h2.quantile(.5) == std::numeric_limits<unsigned long long>::max());
+    h2.add(42);
+    BOOST_CHECK(h2.get_min() == 42u);
+
+    // Merging.
+    const auto h3 = h + h2;
+    BOOST_CHECK(h3.get_count() == 7u);
+    BOOST_CHECK(h3.get_min() == 0u);
+    BOOST_CHECK(h3.get_max() == std::numeric_limits<unsigned long long>::max());
+    BOOST_CHECK(h3.get_buckets()[64] == 1u);
+    BOOST_CHECK(h3.get_buckets()[6] == 1u);
+    BOOST_CHECK(h3.get_buckets()[3] == 2u);
+    stats_histogram h4;
+    h4 += h;
+    BOOST_CHECK(h4.get_buckets() == h.get_buckets());
+    BOOST_CHECK(h4.get_min() == h.get_min());
+    h4 += stats_histogram{};
+    BOOST_CHECK(h4.get_min() == h.get_min());
+    BOOST_CHECK(h4.get_count() == h.get_count());
+
+    // Bucket helpers.
+    BOOST_CHECK(stats_histogram::bucket_index(0) == 0u);
+    BOOST_CHECK(stats_histogram::bucket_index(1) == 1u);
+    BOOST_CHECK(stats_histogram::bucket_index(7) == 3u);
+    BOOST_CHECK(stats_histogram::bucket_index(8) == 4u);
+    BOOST_CHECK(stats_histogram::bucket_index(std::numeric_limits<unsigned long long>::max()) == 64u);
+    BOOST_CHECK((stats_histogram::bucket_bounds(0) == std::make_pair(0ull, 0ull)));
+    BOOST_CHECK((stats_histogram::bucket_bounds(1) == std::make_pair(1ull, 1ull)));
+    BOOST_CHECK((stats_histogram::bucket_bounds(4) == std::make_pair(8ull, 15ull)));
+    BOOST_CHECK((stats_histogram::bucket_bounds(64)
+                 == std::make_pair(1ull << 63, std::numeric_limits<unsigned long long>::max())));
+    BOOST_CHECK_EXCEPTION(stats_histogram::bucket_bounds(65), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "Invalid bucket index 65: the number of buckets is 65");
+                          });
+
+    // Construction from bucket counts.
+    stats_histogram h5(h.get_buckets(), h.get_sum(), h.get_min(), h.get_max());
+    BOOST_CHECK(h5.get_buckets() == h.get_buckets());
+    BOOST_CHECK(h5.get_count() == h.get_count());
+    BOOST_CHECK(h5.get_sum() == h.get_sum());
+    BOOST_CHECK(h5.get_min() == h.get_min());
+    BOOST_CHECK(h5.get_max() == h.get_max());
+    BOOST_CHECK(h5.quantile(.6) == h.quantile(.6));
+    stats_histogram h6(stats_histogram::buckets_t{}, 0, 0, 0);
+    BOOST_CHECK(h6.get_count() == 0u);
+    BOOST_CHECK_EXCEPTION(stats_histogram(h.get_buckets(), h.get_sum(), 2, 1000), std::invalid_argument,
+                          [](const std::invalid_argument &ia) {
+                              return boost::contains(ia.what(), "are not consistent with the bucket counts");
+                          });
+    BOOST_CHECK_THROW(stats_histogram(h.get_buckets(), h.get_sum(), 1000, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(stats_histogram(h.get_buckets(), h.get_sum(), 0, 2000), std::invalid_argument);
+
+    // Streaming.
+    std::ostringstream oss;
+    oss << h;
+    BOOST_CHECK(boost::contains(oss.str(), "count: 5"));
+    BOOST_CHECK(boost::contains(oss.str(), "p99: "));
+    oss.str("");
+    oss << stats_histogram{};
+    BOOST_CHECK(oss.str() == "count: 0");
+}
+
+BOOST_AUTO_TEST_CASE(island_stats_test)
+{
+    island_stats s;
+    BOOST_CHECK(s.get_queue_wait().get_count() == 0u);
+    BOOST_CHECK(s.get_evolve().get_count() == 0u);
+    BOOST_CHECK(s.get_migr_pull().get_count() == 0u);
+    BOOST_CHECK(s.get_migr_replace().get_count() == 0u);
+    BOOST_CHECK(s.get_migr_select().get_count() == 0u);
+    BOOST_CHECK(s.get_pop_copy().get_count() == 0u);
+    BOOST_CHECK(s.get_fevals() == 0u);
+    BOOST_CHECK(s.get_fevals_per_second() == 0.);
+
+    const auto s2 = s + s;
+    BOOST_CHECK(s2.get_fevals() == 0u);
+
+    std::ostringstream oss;
+    oss << s;
+    BOOST_CHECK(boost::contains(oss.str(), "Queue wait (ns):"));
+    BOOST_CHECK(boost::contains(oss.str(), "Evaluations per second:"));
+    std::cout << s << '\n';
+}
@@ -64,7 +64,9 @@ BOOST_AUTO_TEST_CASE(basic_tests)
     BOOST_CHECK_EQUAL(bfe0.get_thread_safety(), thread_safety::basic);
 
     // Try with a problem providing the constant thread safety level.
+    // NOTE: rosenbrock writes its fitness directly into the output.
     problem p0{rosenbrock{2}};
+    BOOST_CHECK(p0.has_fitness_into());
     // Rosenbrock has dimension 2, thus these are 5000 dvs.
     vector_double dvs(10000u);
     for (auto &x : dvs) {
@@ -80,7 +82,9 @@ BOOST_AUTO_TEST_CASE(basic_tests)
     }
 
     // Try with a problem providing the basic thread safety level.
+    // NOTE: inventory exercises the fallback on fitness().
     p0 = problem{inventory{4}};
+    BOOST_CHECK(!p0.has_fitness_into());
     for (auto &x : dvs) {
         x = uniform_real_from_range(0., 1., rng);
     }
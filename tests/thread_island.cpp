@@ -30,16 +30,24 @@ see https://www.gnu.org/licenses/. */
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <initializer_list>
 #include <stdexcept>
 #include <utility>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/any.hpp>
 
+#include <pagmo/algorithm.hpp>
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/detail/gte_getter.hpp>
 #include <pagmo/island.hpp>
 #include <pagmo/islands/thread_island.hpp>
 #include <pagmo/population.hpp>
 #include <pagmo/problem.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/topologies/ring.hpp>
 #include <pagmo/threading.hpp>
 #include <pagmo/types.hpp>
 
@@ -94,3 +102,40 @@ BOOST_AUTO_TEST_CASE(thread_island_test)
         });
     }
 }
+
+static std::atomic<unsigned> n_gte(0);
+
+// Check that the gte is requested only when algorithm or problem
+// do not provide at least the basic thread safety guarantee.
+BOOST_AUTO_TEST_CASE(thread_island_gte_test)
+{
+    const auto old_getter = detail::gte_getter;
+    detail::gte_getter = []() {
+        ++n_gte;
+        return boost::any{};
+    };
+
+    {
+        // Archipelago with thread-safe algos/probs and migration.
+        archipelago archi(ring{}, 4u, thread_island{}, de{}, rosenbrock{}, 20u);
+        archi.evolve(3);
+        archi.wait_check();
+        BOOST_CHECK_EQUAL(n_gte.load(), 0u);
+    }
+
+    {
+        island isl(thread_island{}, tu_uda{}, problem(), 20u);
+        isl.evolve();
+        BOOST_CHECK_THROW(isl.wait_check(), std::invalid_argument);
+        BOOST_CHECK_EQUAL(n_gte.load(), 1u);
+    }
+
+    {
+        island isl(thread_island{}, algorithm(), tu_udp{}, 20u);
+        isl.evolve();
+        BOOST_CHECK_THROW(isl.wait_check(), std::invalid_argument);
+        BOOST_CHECK_EQUAL(n_gte.load(), 2u);
+    }
+
+    detail::gte_getter = old_getter;
+}
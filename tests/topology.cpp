@@ -33,6 +33,7 @@ see https://www.gnu.org/licenses/. */
 #include <cstddef>
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -42,6 +43,7 @@ see https://www.gnu.org/licenses/. */
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <pagmo/exceptions.hpp>
 #include <pagmo/s11n.hpp>
 #include <pagmo/topologies/ring.hpp>
 #include <pagmo/topologies/unconnected.hpp>
@@ -333,3 +335,78 @@ BOOST_AUTO_TEST_CASE(topology_push_back_n_test)
 
     BOOST_CHECK(t0.extract<ring>()->num_vertices() == 7u);
 }
+
+struct udt02 : udt00 {
+    std::shared_ptr<const topology_csr> to_csr() const
+    {
+        return std::make_shared<const topology_csr>(std::vector<std::size_t>{0, 1, 1}, std::vector<std::size_t>{1},
+                                                    vector_double{.5}, 42);
+    }
+};
+
+struct udt03 : udt00 {
+    std::shared_ptr<const topology_csr> to_csr() const
+    {
+        return nullptr;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(topology_csr_test)
+{
+    BOOST_CHECK(!has_to_csr<void>::value);
+    BOOST_CHECK(!has_to_csr<udt00>::value);
+    BOOST_CHECK(has_to_csr<udt02>::value);
+    BOOST_CHECK(has_to_csr<ring>::value);
+    BOOST_CHECK(has_to_csr<unconnected>::value);
+
+    // Default-constructed snapshot.
+    topology_csr c0;
+    BOOST_CHECK(c0.num_vertices() == 0u);
+    BOOST_CHECK(c0.num_edges() == 0u);
+    BOOST_CHECK(c0.get_version() == 0u);
+    BOOST_CHECK(c0.get_row_offsets() == std::vector<std::size_t>{0});
+    BOOST_CHECK_THROW(c0.get_connections(0), std::invalid_argument);
+
+    // Snapshot with 3 vertices: 1 -> 0, 2 -> 0, 0 -> 2.
+    topology_csr c1({0, 2, 2, 3}, {1, 2, 0}, {.1, .2, .3}, 3);
+    BOOST_CHECK(c1.num_vertices() == 3u);
+    BOOST_CHECK(c1.num_edges() == 3u);
+    BOOST_CHECK(c1.get_version() == 3u);
+    BOOST_CHECK((c1.get_connections(0).first == std::vector<std::size_t>{1, 2}));
+    BOOST_CHECK((c1.get_connections(0).second == vector_double{.1, .2}));
+    BOOST_CHECK(c1.get_connections(1).first.empty());
+    BOOST_CHECK(c1.get_connections(1).second.empty());
+    BOOST_CHECK((c1.get_connections(2).first == std::vector<std::size_t>{0}));
+    BOOST_CHECK((c1.get_connections(2).second == vector_double{.3}));
+    BOOST_CHECK_THROW(c1.get_connections(3), std::invalid_argument);
+
+    // Invalid snapshots.
+    BOOST_CHECK_THROW(topology_csr({}, {}, {}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({1}, {}, {}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 1}, {0}, {}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 2}, {0}, {.1}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 1, 0, 1}, {0}, {.1}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 1}, {1}, {.1}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 1}, {0}, {2.}), std::invalid_argument);
+    BOOST_CHECK_THROW(topology_csr({0, 1}, {0}, {std::numeric_limits<double>::quiet_NaN()}),
+                      std::invalid_argument);
+
+    // Topology interface.
+    topology t0{udt00{}};
+    BOOST_CHECK(!t0.has_to_csr());
+    BOOST_CHECK_EXCEPTION(t0.to_csr(), not_implemented_error, [](const not_implemented_error &nie) {
+        return boost::contains(nie.what(), "A CSR snapshot has been requested but it is not implemented in the UDT");
+    });
+
+    t0 = udt02{};
+    BOOST_CHECK(t0.has_to_csr());
+    BOOST_CHECK(t0.to_csr()->get_version() == 42u);
+    BOOST_CHECK(t0.to_csr()->num_vertices() == 2u);
+
+    t0 = udt03{};
+    BOOST_CHECK(t0.has_to_csr());
+    BOOST_CHECK_EXCEPTION(t0.to_csr(), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(),
+                               "A null pointer was returned by the 'to_csr()' method of the 'udt00' topology");
+    });
+}
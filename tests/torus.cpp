@@ -0,0 +1,240 @@
+/* Copyright 2017-2018 PaGMO development team
+
+This file is part of the PaGMO library.
+
+The PaGMO library is free software; you can redistribute it and/or modify
+it under the terms of either:
+
+  * the GNU Lesser General Public License as published by the Free
+    Software Foundation; either version 3 of the License, or (at your
+    option) any later version.
+
+or
+
+  * the GNU General Public License as published by the Free Software
+    Foundation; either version 3 of the License, or (at your option) any
+    later version.
+
+or both in parallel, as here.
+
+The PaGMO library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+for more details.
+
+You should have received copies of the GNU General Public License and the
+GNU Lesser General Public License along with the PaGMO library.  If not,
+see https://www.gnu.org/licenses/. */
+
+#define BOOST_TEST_MODULE torus
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <pagmo/algorithms/de.hpp>
+#include <pagmo/archipelago.hpp>
+#include <pagmo/problems/rosenbrock.hpp>
+#include <pagmo/s11n.hpp>
+#include <pagmo/topologies/torus.hpp>
+#include <pagmo/topology.hpp>
+#include <pagmo/types.hpp>
+
+using namespace pagmo;
+
+// Check that the connections are symmetric and well-formed.
+void verify_torus_topology(const torus &t)
+{
+    const auto s = t.num_vertices();
+
+    BOOST_CHECK_EXCEPTION(t.get_connections(s), std::invalid_argument, [](const std::invalid_argument &ia) {
+        return boost::contains(ia.what(), "in a torus topology: the number of vertices in the topology is only");
+    });
+
+    for (std::size_t i = 0; i < s; ++i) {
+        const auto conns = t.get_connections(i);
+
+        BOOST_CHECK(conns.first.size() == conns.second.size());
+        BOOST_CHECK(conns.first.size() <= 2u * (t.get_shape().size() + 1u));
+        BOOST_CHECK(std::all_of(conns.second.begin(), conns.second.end(),
+                                [&t](double x) { return x == t.get_weight(); }));
+        BOOST_CHECK(std::find(conns.first.begin(), conns.first.end(), i) == conns.first.end());
+
+        auto sorted = conns.first;
+        std::sort(sorted.begin(), sorted.end());
+        BOOST_CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+        for (auto j : conns.first) {
+            BOOST_CHECK(j < s);
+            const auto c = t.get_connections(j).first;
+            BOOST_CHECK(std::find(c.begin(), c.end(), i) != c.end());
+        }
+    }
+}
+
+std::vector<std::size_t> sorted_conns(const torus &t, std::size_t i)
+{
+    auto retval = t.get_connections(i).first;
+    std::sort(retval.begin(), retval.end());
+    return retval;
+}
+
+BOOST_AUTO_TEST_CASE(basic_test)
+{
+    {
+        // Default construct: a ring.
+        torus t0;
+        BOOST_CHECK(t0.get_weight() == 1);
+        BOOST_CHECK(t0.get_shape().empty());
+        BOOST_CHECK(t0.num_vertices() == 0u);
+        verify_torus_topology(t0);
+
+        t0.push_back();
+        BOOST_CHECK(t0.get_connections(0).first.empty());
+        t0.push_back();
+        BOOST_CHECK((sorted_conns(t0, 0) == std::vector<std::size_t>{1}));
+        verify_torus_topology(t0);
+
+        for (auto i = 0; i < 5; ++i) {
+            t0.push_back();
+        }
+        BOOST_CHECK(t0.num_vertices() == 7u);
+        BOOST_CHECK((sorted_conns(t0, 0) == std::vector<std::size_t>{1, 6}));
+        BOOST_CHECK((sorted_conns(t0, 3) == std::vector<std::size_t>{2, 4}));
+        verify_torus_topology(t0);
+    }
+
+    {
+        // 2D torus.
+        torus t0(16, {4}, .5);
+        BOOST_CHECK(t0.get_weight() == .5);
+        BOOST_CHECK((t0.get_shape() == std::vector<std::size_t>{4}));
+        BOOST_CHECK(t0.num_vertices() == 16u);
+        verify_torus_topology(t0);
+        for (std::size_t i = 0; i < 16u; ++i) {
+            BOOST_CHECK(t0.get_connections(i).first.size() == 4u);
+        }
+        BOOST_CHECK((sorted_conns(t0, 0) == std::vector<std::size_t>{1, 3, 4, 12}));
+        BOOST_CHECK((sorted_conns(t0, 5) == std::vector<std::size_t>{1, 4, 6, 9}));
+        BOOST_CHECK((sorted_conns(t0, 15) == std::vector<std::size_t>{3, 11, 12, 14}));
+
+        // Partially-filled last layer.
+        torus t1(6, {4});
+        verify_torus_topology(t1);
+        BOOST_CHECK((sorted_conns(t1, 0) == std::vector<std::size_t>{1, 3, 4}));
+        BOOST_CHECK((sorted_conns(t1, 4) == std::vector<std::size_t>{0, 5}));
+        BOOST_CHECK((sorted_conns(t1, 2) == std::vector<std::size_t>{1, 3}));
+
+        // Grow it.
+        for (auto i = 0; i < 10; ++i) {
+            t1.push_back();
+            verify_torus_topology(t1);
+        }
+        BOOST_CHECK(t1.num_vertices() == 16u);
+        BOOST_CHECK(sorted_conns(t1, 5) == sorted_conns(t0, 5));
+    }
+
+    {
+        // 3D torus.
+        torus t0(27, {3, 3});
+        verify_torus_topology(t0);
+        for (std::size_t i = 0; i < 27u; ++i) {
+            BOOST_CHECK(t0.get_connections(i).first.size() == 6u);
+        }
+        BOOST_CHECK((sorted_conns(t0, 13) == std::vector<std::size_t>{4, 10, 12, 14, 16, 22}));
+
+        // Dimensions of size 1 and 2.
+        torus t1(8, {1, 2});
+        verify_torus_topology(t1);
+        BOOST_CHECK((sorted_conns(t1, 0) == std::vector<std::size_t>{1, 2, 6}));
+    }
+
+    {
+        // Ctor from shape.
+        torus t0({2, 5}, .25);
+        BOOST_CHECK(t0.num_vertices() == 0u);
+        BOOST_CHECK(t0.get_weight() == .25);
+        BOOST_CHECK((t0.get_shape() == std::vector<std::size_t>{2, 5}));
+    }
+
+    {
+        // Error checking.
+        BOOST_CHECK_EXCEPTION(torus(std::vector<std::size_t>{3, 0}), std::invalid_argument,
+                              [](const std::invalid_argument &ia) {
+                                  return boost::contains(
+                                      ia.what(), "The sizes of the dimensions of a torus topology must be nonzero");
+                              });
+        BOOST_CHECK_THROW(torus(std::vector<std::size_t>{std::numeric_limits<std::size_t>::max(), 2}),
+                          std::overflow_error);
+        BOOST_CHECK_THROW(torus(std::vector<std::size_t>{3}, 2.), std::invalid_argument);
+        BOOST_CHECK_THROW(torus(std::vector<std::size_t>{3}, -1.), std::invalid_argument);
+    }
+
+    {
+        // Copy/move ctors.
+        torus t0(9, {3}, .2), t1(t0), t2(std::move(t0));
+        BOOST_CHECK(t1.num_vertices() == 9u);
+        BOOST_CHECK(t2.num_vertices() == 9u);
+        BOOST_CHECK((t2.get_shape() == std::vector<std::size_t>{3}));
+        verify_torus_topology(t1);
+        verify_torus_topology(t2);
+    }
+
+    {
+        // Name/extra info.
+        torus t0(9, {3}, .2);
+        BOOST_CHECK(t0.get_name() == "Torus");
+        BOOST_CHECK(boost::contains(t0.get_extra_info(), "Shape of the layers:"));
+        BOOST_CHECK(boost::contains(t0.get_extra_info(), "Edges' weight:"));
+
+        std::cout << t0.get_extra_info() << '\n';
+    }
+
+    // Minimal serialization test.
+    {
+        topology t0(torus(10, {3}, .2));
+        BOOST_CHECK(!t0.has_to_csr());
+        std::stringstream ss;
+        {
+            boost::archive::binary_oarchive oarchive(ss);
+            oarchive << t0;
+        }
+        topology t1;
+        BOOST_CHECK(!t1.is<torus>());
+        {
+            boost::archive::binary_iarchive iarchive(ss);
+            iarchive >> t1;
+        }
+        BOOST_CHECK(t1.is<torus>());
+        BOOST_CHECK(t1.extract<torus>()->num_vertices() == 10u);
+        BOOST_CHECK(t1.extract<torus>()->get_weight() == .2);
+        BOOST_CHECK((t1.extract<torus>()->get_shape() == std::vector<std::size_t>{3}));
+        verify_torus_topology(*t1.extract<torus>());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(large_test)
+{
+    // The connections are computed on the fly, so large
+    // topologies are cheap to construct and query.
+    torus t0(1000000, {100, 100});
+    BOOST_CHECK((sorted_conns(t0, 0) == std::vector<std::size_t>{1, 99, 100, 9900, 10000, 990000}));
+}
+
+BOOST_AUTO_TEST_CASE(archipelago_test)
+{
+    archipelago archi{torus({3}), 9, de{10}, rosenbrock{}, 10};
+    BOOST_CHECK(archi.get_topology().is<torus>());
+    BOOST_CHECK(archi.get_topology().extract<torus>()->num_vertices() == 9u);
+    archi.evolve();
+    archi.wait_check();
+}
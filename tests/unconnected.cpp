@@ -31,6 +31,7 @@ see https://www.gnu.org/licenses/. */
 #include <boost/test/unit_test.hpp>
 
 #include <sstream>
+#include <utility>
 
 #include <pagmo/s11n.hpp>
 #include <pagmo/topologies/ring.hpp>
@@ -68,3 +69,53 @@ BOOST_AUTO_TEST_CASE(basic_test)
         BOOST_CHECK(t1.is<unconnected>());
     }
 }
+
+BOOST_AUTO_TEST_CASE(csr_test)
+{
+    unconnected r0;
+    BOOST_CHECK(r0.num_vertices() == 0u);
+    auto c0 = r0.to_csr();
+    BOOST_CHECK(c0->num_vertices() == 0u);
+    BOOST_CHECK(r0.to_csr() == c0);
+
+    r0.push_back();
+    r0.push_back();
+    r0.push_back();
+    BOOST_CHECK(r0.num_vertices() == 3u);
+    auto c1 = r0.to_csr();
+    BOOST_CHECK(c1->get_version() > c0->get_version());
+    BOOST_CHECK(c1->num_vertices() == 3u);
+    BOOST_CHECK(c1->num_edges() == 0u);
+    BOOST_CHECK(c1->get_connections(2).first.empty());
+    BOOST_CHECK(r0.to_csr() == c1);
+
+    // Copy and serialization.
+    unconnected r1(r0);
+    BOOST_CHECK(r1.num_vertices() == 3u);
+    topology t0(r1);
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oarchive(ss);
+        oarchive << t0;
+    }
+    topology t1;
+    BOOST_CHECK(t1.to_csr()->num_vertices() == 0u);
+    {
+        boost::archive::binary_iarchive iarchive(ss);
+        iarchive >> t1;
+    }
+    BOOST_CHECK(t1.extract<unconnected>()->num_vertices() == 3u);
+    BOOST_CHECK(t1.to_csr()->num_vertices() == 3u);
+
+    // Assignment.
+    unconnected r2;
+    auto c2 = r2.to_csr();
+    r2 = r0;
+    BOOST_CHECK(r2.num_vertices() == 3u);
+    BOOST_CHECK(r2.to_csr() != c2);
+    BOOST_CHECK(r2.to_csr()->num_vertices() == 3u);
+    r2.push_back();
+    r0 = std::move(r2);
+    BOOST_CHECK(r0.num_vertices() == 4u);
+    BOOST_CHECK(r0.to_csr()->num_vertices() == 4u);
+}